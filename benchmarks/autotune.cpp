@@ -0,0 +1,174 @@
+// Kernel autotuner
+//
+// Measures the kernel_tunables candidates on this host and writes the best
+// configuration to a tunables file, which tunables() loads at startup. Run it
+// once per machine (at install time, or after a hardware change):
+//
+//   autotune                 # writes default_tunables_path()
+//   autotune <path>          # writes <path>
+//   autotune --dry-run       # only prints the result
+//
+// Each knob is tuned in turn (coordinate descent), holding the others at their
+// current best:
+//
+// 1. unroll_factor: vectorize() add at L1-, L2- and DRAM-resident sizes
+// 2. prefetch_distance_bytes: the same sweep; prefetching only matters once
+//    the inputs miss in L2, but must not slow down the cached sizes
+// 3. streaming_store_llc_fraction: sizes from LLC/4 to 2 x LLC, which is where
+//    the regular/streaming crossover lies
+//
+// A candidate's score is the sum over sizes of nanoseconds per element, so
+// every size weighs equally regardless of its absolute runtime. A challenger
+// must beat the incumbent by more than 2% to replace it; this keeps noise from
+// flipping settings between runs.
+
+#include "container/column.hpp"
+#include "core/kernel_tunables.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace franklin {
+namespace {
+
+using Float32Column = column_vector<Float32DefaultPolicy>;
+
+constexpr double kImprovementThreshold = 0.98;
+constexpr int kRepetitions = 5;
+
+// Best-of-kRepetitions nanoseconds per element for one vectorize() add
+double time_add(const Float32Column& a, const Float32Column& b,
+                Float32Column& out) {
+  const std::size_t elements = out.data().size();
+  // Enough calls per repetition to run for ~2ms on cached sizes
+  const std::size_t calls =
+      std::max<std::size_t>(1, (std::size_t{1} << 19) / elements);
+
+  double best = std::numeric_limits<double>::max();
+  for (int rep = 0; rep < kRepetitions; ++rep) {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t call = 0; call < calls; ++call) {
+      vectorize<Float32DefaultPolicy, Float32Pipeline<OpType::Add>>(a, b, out);
+      asm volatile("" : : "r"(out.data().data()) : "memory");
+    }
+    std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    best = std::min(best, elapsed.count() / static_cast<double>(calls));
+  }
+  return best / static_cast<double>(elements);
+}
+
+struct workload {
+  Float32Column a;
+  Float32Column b;
+  Float32Column out;
+
+  explicit workload(std::size_t elements)
+      : a(elements), b(elements), out(elements) {
+    std::fill(a.data().begin(), a.data().end(), 1.0f);
+    std::fill(b.data().begin(), b.data().end(), 2.0f);
+  }
+};
+
+std::vector<workload> make_workloads(const std::vector<std::size_t>& bytes) {
+  std::vector<workload> workloads;
+  workloads.reserve(bytes.size());
+  for (std::size_t size : bytes) {
+    workloads.emplace_back(size / sizeof(float));
+  }
+  return workloads;
+}
+
+double score(std::vector<workload>& workloads) {
+  double total = 0.0;
+  for (auto& w : workloads) {
+    total += time_add(w.a, w.b, w.out);
+  }
+  return total;
+}
+
+// Try every candidate for one field of tunables(), keep the best
+template <typename T>
+void tune(const char* name, T kernel_tunables::*field,
+          const std::vector<T>& candidates, std::vector<workload>& workloads) {
+  const T current = tunables().*field;
+  T best_value = current;
+  double best_score = score(workloads);
+  std::printf("%s\n  %-14g %8.4f ns/elem (current)\n", name,
+              static_cast<double>(current), best_score);
+
+  for (T candidate : candidates) {
+    if (candidate == current) {
+      continue;
+    }
+    tunables().*field = candidate;
+    double candidate_score = score(workloads);
+    std::printf("  %-14g %8.4f ns/elem\n", static_cast<double>(candidate),
+                candidate_score);
+    if (candidate_score < kImprovementThreshold * best_score) {
+      best_value = candidate;
+      best_score = candidate_score;
+    }
+  }
+  tunables().*field = best_value;
+  std::printf("  -> %g\n\n", static_cast<double>(best_value));
+}
+
+} // namespace
+} // namespace franklin
+
+int main(int argc, char** argv) {
+  using namespace franklin;
+
+  bool dry_run = false;
+  std::string path = default_tunables_path();
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--dry-run") == 0) {
+      dry_run = true;
+    } else {
+      path = argv[i];
+    }
+  }
+
+  const std::size_t llc = llc_size_bytes();
+  std::printf("CPU: %s\nLLC: %zu KB\n\n", host_cpu_id().c_str(), llc / 1024);
+
+  // Tune the loop shape with regular stores so the streaming cutoff does not
+  // interfere, then tune the cutoff for the chosen loop
+  const double configured_fraction = tunables().streaming_store_llc_fraction;
+  tunables().streaming_store_llc_fraction =
+      std::numeric_limits<double>::infinity();
+
+  auto loop_workloads = make_workloads({16 * 1024, 256 * 1024, 2 * llc});
+  tune<std::size_t>("unroll_factor", &kernel_tunables::unroll_factor,
+                    {1, 2, 4, 8}, loop_workloads);
+  tune<std::size_t>("prefetch_distance_bytes",
+                    &kernel_tunables::prefetch_distance_bytes,
+                    {0, 128, 256, 512, 1024, 2048, 4096}, loop_workloads);
+  loop_workloads.clear();
+
+  tunables().streaming_store_llc_fraction = configured_fraction;
+  auto llc_workloads = make_workloads({llc / 4, llc / 2, llc, 2 * llc});
+  tune<double>("streaming_store_llc_fraction",
+               &kernel_tunables::streaming_store_llc_fraction,
+               {0.125, 0.25, 0.5, 1.0, 2.0, 4.0}, llc_workloads);
+
+  if (dry_run) {
+    return 0;
+  }
+  if (path.empty()) {
+    std::fprintf(stderr, "No tunables path; pass one explicitly\n");
+    return 1;
+  }
+  if (!save_tunables(path, tunables())) {
+    std::fprintf(stderr, "Failed to write %s (does the directory exist?)\n",
+                 path.c_str());
+    return 1;
+  }
+  std::printf("Wrote %s\n", path.c_str());
+  return 0;
+}
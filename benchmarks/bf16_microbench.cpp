@@ -1,5 +1,6 @@
 #include "container/column.hpp"
 #include <benchmark/benchmark.h>
+#include <vector>
 
 namespace franklin {
 
@@ -28,7 +29,9 @@ static void BM_BF16_LoadStore_Only(benchmark::State& state) {
                          benchmark::Counter::kIs1024);
 }
 
-// Microbenchmark: BF16 with conversion but no compute
+// Microbenchmark: BF16 with conversion but no compute. Conversion is
+// BF16NativeConversion (AVX-512 BF16) or BF16EmulatedConversion (AVX2).
+template <typename Conversion>
 static void BM_BF16_ConvertOnly(benchmark::State& state) {
   const size_t size = state.range(0);
   column_vector<BF16DefaultPolicy> a(size);
@@ -47,8 +50,8 @@ static void BM_BF16_ConvertOnly(benchmark::State& state) {
     for (size_t i = 0; i < size; i += 8) {
       __m128i bf16_data =
           _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
-      __m256 fp32_data = _mm256_cvtpbh_ps((__m128bh)bf16_data);
-      __m128i bf16_result = (__m128i)_mm256_cvtneps_pbh(fp32_data);
+      __m256 fp32_data = Conversion::widen(bf16_data);
+      __m128i bf16_result = Conversion::narrow(fp32_data);
       _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), bf16_result);
     }
 
@@ -62,6 +65,85 @@ static void BM_BF16_ConvertOnly(benchmark::State& state) {
                          benchmark::Counter::kIs1024);
 }
 
+// Microbenchmark: full column multiply kernel with either conversion
+template <typename Conversion>
+static void BM_BF16_Multiply(benchmark::State& state) {
+  const size_t size = state.range(0);
+  column_vector<BF16DefaultPolicy> a(size);
+  column_vector<BF16DefaultPolicy> b(size);
+  column_vector<BF16DefaultPolicy> result(size);
+
+  for (size_t i = 0; i < size; ++i) {
+    a.data()[i] = bf16::from_float_trunc(static_cast<float>(i));
+    b.data()[i] = bf16::from_float_trunc(1.0f / static_cast<float>(i + 1));
+  }
+
+  size_t bytes_processed = 0;
+  for (auto _ : state) {
+    vectorize<BF16DefaultPolicy, BF16Pipeline<OpType::Mul, Conversion>>(
+        a, b, result);
+    benchmark::DoNotOptimize(result);
+    bytes_processed += size * sizeof(bf16) * 3; // two reads + write
+  }
+
+  state.SetBytesProcessed(bytes_processed);
+  state.counters["GB/s"] =
+      benchmark::Counter(bytes_processed, benchmark::Counter::kIsRate,
+                         benchmark::Counter::kIs1024);
+}
+
+// Bulk fp32 -> bf16 ingest: per-element scalar loop against bf16::convert
+// with each rounding mode (range(1): 0 truncate, 1 nearest even,
+// 2 stochastic, 3 scalar nearest-even loop)
+static void BM_BF16_BulkNarrow(benchmark::State& state) {
+  const size_t size = state.range(0);
+  std::vector<float> src(size);
+  std::vector<bf16> dst(size);
+  for (size_t i = 0; i < size; ++i) {
+    src[i] = 1.0f / static_cast<float>(i + 1);
+  }
+
+  size_t bytes_processed = 0;
+  for (auto _ : state) {
+    if (state.range(1) == 3) {
+      for (size_t i = 0; i < size; ++i) {
+        dst[i] = bf16::from_float_rne(src[i]);
+      }
+    } else {
+      bf16::convert(src.data(), dst.data(), size,
+                    static_cast<bf16::rounding>(state.range(1)), 1);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+    bytes_processed += size * (sizeof(float) + sizeof(bf16));
+  }
+
+  state.SetBytesProcessed(bytes_processed);
+  state.counters["GB/s"] =
+      benchmark::Counter(bytes_processed, benchmark::Counter::kIsRate,
+                         benchmark::Counter::kIs1024);
+}
+
+// Bulk bf16 -> fp32
+static void BM_BF16_BulkWiden(benchmark::State& state) {
+  const size_t size = state.range(0);
+  std::vector<bf16> src(size, bf16(1.5f));
+  std::vector<float> dst(size);
+
+  size_t bytes_processed = 0;
+  for (auto _ : state) {
+    bf16::convert(src.data(), dst.data(), size);
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+    bytes_processed += size * (sizeof(float) + sizeof(bf16));
+  }
+
+  state.SetBytesProcessed(bytes_processed);
+  state.counters["GB/s"] =
+      benchmark::Counter(bytes_processed, benchmark::Counter::kIsRate,
+                         benchmark::Counter::kIs1024);
+}
+
 // Microbenchmark: Float32 for comparison
 static void BM_Float32_LoadStore_Only(benchmark::State& state) {
   const size_t size = state.range(0);
@@ -86,7 +168,30 @@ static void BM_Float32_LoadStore_Only(benchmark::State& state) {
 }
 
 BENCHMARK(BM_BF16_LoadStore_Only)->Arg(4096)->Arg(1048576);
-BENCHMARK(BM_BF16_ConvertOnly)->Arg(4096)->Arg(1048576);
+// Native against emulated conversion. The emulated narrow is about a dozen
+// AVX2 uops to native's two, so it costs ~2.5x on cache-resident columns
+// and next to nothing once the columns stream from memory (16M elements).
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+BENCHMARK_TEMPLATE(BM_BF16_ConvertOnly, BF16NativeConversion)
+    ->Arg(4096)
+    ->Arg(1048576)
+    ->Arg(16777216);
+BENCHMARK_TEMPLATE(BM_BF16_Multiply, BF16NativeConversion)
+    ->Arg(4096)
+    ->Arg(1048576)
+    ->Arg(16777216);
+#endif
+BENCHMARK_TEMPLATE(BM_BF16_ConvertOnly, BF16EmulatedConversion)
+    ->Arg(4096)
+    ->Arg(1048576)
+    ->Arg(16777216);
+BENCHMARK_TEMPLATE(BM_BF16_Multiply, BF16EmulatedConversion)
+    ->Arg(4096)
+    ->Arg(1048576)
+    ->Arg(16777216);
+BENCHMARK(BM_BF16_BulkNarrow)
+    ->ArgsProduct({{4096, 1048576}, {0, 1, 2, 3}});
+BENCHMARK(BM_BF16_BulkWiden)->Arg(4096)->Arg(1048576);
 BENCHMARK(BM_Float32_LoadStore_Only)->Arg(4096)->Arg(1048576);
 
 } // namespace franklin
@@ -14,6 +14,9 @@
 // 1. Sequential LOAD throughput (reading data sequentially)
 // 2. Sequential STORE throughput (writing data sequentially)
 // 3. Mixed LOAD/STORE throughput
+// 4. Software prefetch distance sweep for the column kernels' access pattern
+//    (two input streams, one output stream). The best distance is printed at
+//    the end of the run as the recommended FRANKLIN_PREFETCH_DISTANCE.
 //
 // Key methodology:
 // - Use volatile pointers to prevent the compiler from optimizing away memory
@@ -33,8 +36,11 @@
 #include <algorithm>
 #include <benchmark/benchmark.h>
 #include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <immintrin.h>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace franklin {
@@ -555,6 +561,114 @@ static void BM_Mixed_LoadStore_DRAM(benchmark::State& state) {
                          benchmark::Counter::kIs1024);
 }
 
+// ============================================================================
+// PREFETCH DISTANCE SWEEP
+// ============================================================================
+// Mirrors the inner loop of vectorize() in container/column.hpp: two input
+// streams are loaded, added and stored to a third, 4 x 256-bit vectors (128
+// bytes) per iteration. Each iteration prefetches both inputs state.range(0)
+// bytes ahead; distance 0 disables software prefetching. The working set is
+// 3 x 32 MB so every access misses the caches.
+
+static void BM_Prefetch_Distance_DRAM(benchmark::State& state) {
+  const size_t distance_bytes = static_cast<size_t>(state.range(0));
+  const size_t stream_bytes = 32 * 1024 * 1024;
+  const size_t element_count = stream_bytes / sizeof(int32_t);
+  const size_t distance = distance_bytes / sizeof(int32_t);
+  constexpr size_t unroll = 32; // 4 x 8 int32 lanes
+
+  std::vector<int32_t> a(element_count);
+  std::vector<int32_t> b(element_count);
+  std::vector<int32_t> out(element_count);
+  for (size_t i = 0; i < element_count; ++i) {
+    a[i] = static_cast<int32_t>(i);
+    b[i] = static_cast<int32_t>(i ^ 0x5A5A5A5A);
+  }
+  compiler_barrier();
+
+  const int32_t* pa = a.data();
+  const int32_t* pb = b.data();
+  int32_t* po = out.data();
+
+  size_t bytes_processed = 0;
+  for (auto _ : state) {
+    for (size_t i = 0; i + unroll <= element_count; i += unroll) {
+      if (distance) {
+        const char* fa = reinterpret_cast<const char*>(pa + i + distance);
+        const char* fb = reinterpret_cast<const char*>(pb + i + distance);
+        _mm_prefetch(fa, _MM_HINT_T0);
+        _mm_prefetch(fa + 64, _MM_HINT_T0);
+        _mm_prefetch(fb, _MM_HINT_T0);
+        _mm_prefetch(fb + 64, _MM_HINT_T0);
+      }
+      for (size_t v = 0; v < unroll; v += 8) {
+        __m256i x = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(pa + i + v));
+        __m256i y = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(pb + i + v));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(po + i + v),
+                            _mm256_add_epi32(x, y));
+      }
+    }
+    compiler_barrier();
+    bytes_processed += 3 * stream_bytes;
+  }
+
+  benchmark::DoNotOptimize(po);
+  state.SetBytesProcessed(bytes_processed);
+  state.counters["GB/s"] =
+      benchmark::Counter(bytes_processed, benchmark::Counter::kIsRate,
+                         benchmark::Counter::kIs1024);
+  state.counters["distance"] = static_cast<double>(distance_bytes);
+}
+
+// Console reporter that remembers the prefetch sweep results and prints the
+// fastest distance once all benchmarks have run. Ties within 2% go to the
+// shorter distance, which is less likely to be evicted before use.
+class PrefetchTuningReporter : public benchmark::ConsoleReporter {
+public:
+  void ReportRuns(const std::vector<Run>& reports) override {
+    for (const Run& run : reports) {
+      if (run.run_type != Run::RT_Iteration || run.error_occurred) {
+        continue;
+      }
+      auto distance = run.counters.find("distance");
+      auto rate = run.counters.find("GB/s");
+      if (distance != run.counters.end() && rate != run.counters.end()) {
+        auto& best = throughput_[static_cast<size_t>(distance->second.value)];
+        best = std::max(best, rate->second.value);
+      }
+    }
+    ConsoleReporter::ReportRuns(reports);
+  }
+
+  void Finalize() override {
+    ConsoleReporter::Finalize();
+    if (throughput_.empty()) {
+      return;
+    }
+    double peak = 0.0;
+    for (const auto& [distance, rate] : throughput_) {
+      peak = std::max(peak, rate);
+    }
+    for (const auto& [distance, rate] : throughput_) {
+      if (rate >= 0.98 * peak) {
+        const double baseline = throughput_.begin()->second;
+        std::printf("\nRecommended prefetch distance: %zu bytes "
+                    "(%.2f GB/s, %+.1f%% vs distance %zu)\n"
+                    "  export FRANKLIN_PREFETCH_DISTANCE=%zu\n",
+                    distance, rate / (1024.0 * 1024.0 * 1024.0),
+                    100.0 * (rate / baseline - 1.0),
+                    throughput_.begin()->first, distance);
+        return;
+      }
+    }
+  }
+
+private:
+  std::map<size_t, double> throughput_;
+};
+
 } // namespace
 
 // Register benchmarks with Google Benchmark framework
@@ -573,6 +687,21 @@ BENCHMARK(BM_Mixed_LoadStore_L2)->Name("Cache_Mixed_L2");
 BENCHMARK(BM_Mixed_LoadStore_L3)->Name("Cache_Mixed_L3");
 BENCHMARK(BM_Mixed_LoadStore_DRAM)->Name("Cache_Mixed_DRAM");
 
+BENCHMARK(BM_Prefetch_Distance_DRAM)
+    ->Name("Cache_Prefetch_Distance_DRAM")
+    ->Arg(0)
+    ->RangeMultiplier(2)
+    ->Range(64, 4096);
+
 } // namespace franklin
 
-BENCHMARK_MAIN();
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  franklin::PrefetchTuningReporter reporter;
+  benchmark::RunSpecifiedBenchmarks(&reporter);
+  benchmark::Shutdown();
+  return 0;
+}
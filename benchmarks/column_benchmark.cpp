@@ -23,6 +23,15 @@ template <typename Policy> void fill_random(column_vector<Policy>& col) {
     for (size_t i = 0; i < col.data().size(); ++i) {
       col.data()[i] = bf16::from_float_trunc(dist(rng));
     }
+  } else if constexpr (std::is_same_v<typename Policy::value_type,
+                                      std::int64_t>) {
+    // Decimal amounts up to 10^7 at the policy's scale
+    std::uniform_int_distribution<std::int64_t> dist(
+        -10'000'000 * pow10_i64(Policy::scale),
+        10'000'000 * pow10_i64(Policy::scale));
+    for (size_t i = 0; i < col.data().size(); ++i) {
+      col.data()[i] = dist(rng);
+    }
   }
 }
 
@@ -78,6 +87,116 @@ static void BM_Int32_Mul_ElementWise(benchmark::State& state) {
                          benchmark::Counter::kIs1024);
 }
 
+// Int32 arithmetic under each overflow mode; none of the rows overflow
+template <OverflowMode Mode> struct Int32OverflowPolicy : Int32DefaultPolicy {
+  static constexpr OverflowMode overflow = Mode;
+};
+
+template <OverflowMode Mode, OpType Op>
+static void BM_Int32_Overflow(benchmark::State& state) {
+  using Policy = Int32OverflowPolicy<Mode>;
+  const size_t size = state.range(0);
+  column_vector<Policy> a(size);
+  column_vector<Policy> b(size);
+  column_vector<Policy> result(size);
+
+  fill_random(a);
+  fill_random(b);
+
+  size_t bytes_processed = 0;
+  for (auto _ : state) {
+    vectorize<Policy, column_pipeline_t<Policy, Op>>(a, b, result);
+    benchmark::DoNotOptimize(result.data().data());
+    bytes_processed += size * sizeof(int32_t) * 3;
+  }
+
+  state.SetBytesProcessed(bytes_processed);
+  state.counters["GB/s"] =
+      benchmark::Counter(bytes_processed, benchmark::Counter::kIsRate,
+                         benchmark::Counter::kIs1024);
+}
+
+// Decimal64 arithmetic at two decimals under each overflow mode; products
+// are rounded back to two decimals and none of the rows overflow
+template <OverflowMode Mode, OpType Op>
+static void BM_Decimal64(benchmark::State& state) {
+  using Policy = Decimal64Policy<2, RoundingMode::HalfEven, Mode>;
+  const size_t size = state.range(0);
+  column_vector<Policy> a(size);
+  column_vector<Policy> b(size);
+  column_vector<Policy> result(size);
+
+  fill_random(a);
+  fill_random(b);
+
+  size_t bytes_processed = 0;
+  for (auto _ : state) {
+    vectorize<Policy, column_pipeline_t<Policy, Op>>(a, b, result);
+    benchmark::DoNotOptimize(result.data().data());
+    bytes_processed += size * sizeof(std::int64_t) * 3;
+  }
+
+  state.SetBytesProcessed(bytes_processed);
+  state.counters["GB/s"] =
+      benchmark::Counter(bytes_processed, benchmark::Counter::kIsRate,
+                         benchmark::Counter::kIs1024);
+}
+
+// Calendar extraction from timestamps spread over 2000-2040, against the
+// scalar civil-calendar code applied row by row
+static column_vector<TimestampMicrosPolicy> random_timestamps(size_t size) {
+  column_vector<TimestampMicrosPolicy> column(size);
+  std::mt19937_64 rng(42);
+  std::uniform_int_distribution<std::int64_t> dist(
+      micros_from_days(days_from_civil(2000, 1, 1)),
+      micros_from_days(days_from_civil(2040, 1, 1)));
+  for (size_t i = 0; i < size; ++i) {
+    column.data()[i] = dist(rng);
+  }
+  return column;
+}
+
+template <DatePart Part>
+static void BM_Timestamp_Extract(benchmark::State& state) {
+  const size_t size = state.range(0);
+  const auto ts = random_timestamps(size);
+  column_vector<Int32DefaultPolicy> result(size);
+
+  for (auto _ : state) {
+    extract_into<Part>(ts, result.data().data());
+    benchmark::DoNotOptimize(result.data().data());
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+template <DatePart Part>
+static void BM_Timestamp_Extract_Scalar(benchmark::State& state) {
+  const size_t size = state.range(0);
+  const auto ts = random_timestamps(size);
+  column_vector<Int32DefaultPolicy> result(size);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < size; ++i) {
+      result.data()[i] = timestamp_part(ts.data()[i], Part);
+    }
+    benchmark::DoNotOptimize(result.data().data());
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+template <TimeUnit Unit>
+static void BM_Timestamp_Trunc(benchmark::State& state) {
+  const size_t size = state.range(0);
+  const auto ts = random_timestamps(size);
+  column_vector<TimestampMicrosPolicy> result(size);
+
+  for (auto _ : state) {
+    trunc_into<Unit>(ts, result.data().data());
+    benchmark::DoNotOptimize(result.data().data());
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
 // Float32 operations
 static void BM_Float32_Add_ElementWise(benchmark::State& state) {
   const size_t size = state.range(0);
@@ -339,6 +458,85 @@ static void BM_Float32_Polynomial(benchmark::State& state) {
       benchmark::Counter::kIsRate, benchmark::Counter::kIs1024);
 }
 
+// ============================================================================
+// IN-PLACE UPDATES - One step of an iterative solver, y = y + alpha * x
+// ============================================================================
+
+static void BM_Float32_Axpy(benchmark::State& state) {
+  const size_t size = state.range(0);
+  column_vector<Float32DefaultPolicy> x(size);
+  column_vector<Float32DefaultPolicy> y(size);
+
+  fill_random(x);
+  fill_random(y);
+  const float alpha = 1e-6f;
+
+  size_t bytes_processed = 0;
+  for (auto _ : state) {
+    // Read x, read and write y
+    y.axpy(alpha, x);
+    benchmark::DoNotOptimize(y.data().data());
+    bytes_processed += size * sizeof(float) * 3;
+  }
+
+  state.SetBytesProcessed(bytes_processed);
+  state.counters["GB/s"] =
+      benchmark::Counter(bytes_processed, benchmark::Counter::kIsRate,
+                         benchmark::Counter::kIs1024);
+}
+
+static void BM_Float32_Axpy_Allocating(benchmark::State& state) {
+  const size_t size = state.range(0);
+  column_vector<Float32DefaultPolicy> x(size);
+  column_vector<Float32DefaultPolicy> y(size);
+
+  fill_random(x);
+  fill_random(y);
+  const float alpha = 1e-6f;
+
+  size_t bytes_processed = 0;
+  for (auto _ : state) {
+    // Two temporaries per step, the second moved into y
+    y = y + x * alpha;
+    benchmark::DoNotOptimize(y.data().data());
+    bytes_processed += size * sizeof(float) * 3;
+  }
+
+  state.SetBytesProcessed(bytes_processed);
+  state.counters["GB/s"] =
+      benchmark::Counter(bytes_processed, benchmark::Counter::kIsRate,
+                         benchmark::Counter::kIs1024);
+}
+
+// Element-wise addition into a reused destination, as a streaming loop does,
+// against operator+ allocating (and page-faulting) a new output every time
+static void BM_Float32_Add_EvalInto(benchmark::State& state) {
+  const size_t size = state.range(0);
+  column_vector<Float32DefaultPolicy> a(size);
+  column_vector<Float32DefaultPolicy> b(size);
+  column_vector<Float32DefaultPolicy> dest;
+
+  fill_random(a);
+  fill_random(b);
+
+  size_t bytes_processed = 0;
+  for (auto _ : state) {
+    if (state.range(1) == 0) {
+      eval_into<OpType::Add>(dest, a, b);
+      benchmark::DoNotOptimize(dest.data().data());
+    } else {
+      auto result = a + b;
+      benchmark::DoNotOptimize(result.data().data());
+    }
+    bytes_processed += size * sizeof(float) * 3;
+  }
+
+  state.SetBytesProcessed(bytes_processed);
+  state.counters["GB/s"] =
+      benchmark::Counter(bytes_processed, benchmark::Counter::kIsRate,
+                         benchmark::Counter::kIs1024);
+}
+
 // ============================================================================
 // CACHE EFFECTS - Different working set sizes
 // ============================================================================
@@ -390,11 +588,40 @@ BENCHMARK(BM_Float32_Mul_ElementWise)->Arg(1024)->Arg(4096);
 BENCHMARK(BM_BF16_Add_ElementWise)->Arg(1024)->Arg(4096);
 BENCHMARK(BM_BF16_Mul_ElementWise)->Arg(1024)->Arg(4096);
 
+// Overflow modes
+BENCHMARK(BM_Int32_Overflow<OverflowMode::Wrap, OpType::Add>)->Arg(4096);
+BENCHMARK(BM_Int32_Overflow<OverflowMode::Saturate, OpType::Add>)->Arg(4096);
+BENCHMARK(BM_Int32_Overflow<OverflowMode::Report, OpType::Add>)->Arg(4096);
+BENCHMARK(BM_Int32_Overflow<OverflowMode::Null, OpType::Add>)->Arg(4096);
+BENCHMARK(BM_Int32_Overflow<OverflowMode::Wrap, OpType::Mul>)->Arg(4096);
+BENCHMARK(BM_Int32_Overflow<OverflowMode::Saturate, OpType::Mul>)->Arg(4096);
+BENCHMARK(BM_Int32_Overflow<OverflowMode::Report, OpType::Mul>)->Arg(4096);
+BENCHMARK(BM_Int32_Overflow<OverflowMode::Null, OpType::Mul>)->Arg(4096);
+BENCHMARK(BM_Decimal64<OverflowMode::Wrap, OpType::Add>)->Arg(4096);
+BENCHMARK(BM_Decimal64<OverflowMode::Report, OpType::Add>)->Arg(4096);
+BENCHMARK(BM_Decimal64<OverflowMode::Wrap, OpType::Mul>)->Arg(4096);
+BENCHMARK(BM_Decimal64<OverflowMode::Report, OpType::Mul>)->Arg(4096);
+BENCHMARK(BM_Timestamp_Extract<DatePart::Year>)->Arg(64 * 1024);
+BENCHMARK(BM_Timestamp_Extract_Scalar<DatePart::Year>)->Arg(64 * 1024);
+BENCHMARK(BM_Timestamp_Extract<DatePart::Hour>)->Arg(64 * 1024);
+BENCHMARK(BM_Timestamp_Extract_Scalar<DatePart::Hour>)->Arg(64 * 1024);
+BENCHMARK(BM_Timestamp_Trunc<TimeUnit::Month>)->Arg(64 * 1024);
+
 // Scalar operations
 BENCHMARK(BM_Int32_Mul_Scalar)->Arg(1024)->Arg(4096)->Arg(1024 * 1024);
 BENCHMARK(BM_Float32_Mul_Scalar)->Arg(1024)->Arg(4096)->Arg(1024 * 1024);
 BENCHMARK(BM_Float32_FMA_Scalar)->Arg(1024)->Arg(4096)->Arg(1024 * 1024);
 
+// In-place updates against the allocating operators
+BENCHMARK(BM_Float32_Axpy)->Arg(4096)->Arg(1024 * 1024)->Arg(16 * 1024 * 1024);
+BENCHMARK(BM_Float32_Axpy_Allocating)
+    ->Arg(4096)
+    ->Arg(1024 * 1024)
+    ->Arg(16 * 1024 * 1024);
+
+BENCHMARK(BM_Float32_Add_EvalInto)
+    ->ArgsProduct({{4096, 1024 * 1024, 16 * 1024 * 1024}, {0, 1}});
+
 // Complex expressions showing fusion opportunities
 BENCHMARK(BM_Float32_ComplexUnfused)->Arg(4096)->Arg(1024 * 1024);
 BENCHMARK(BM_Float32_Polynomial)->Arg(4096)->Arg(1024 * 1024);
@@ -390,6 +390,184 @@ static void BM_BF16Max_64K(benchmark::State& state) {
 }
 BENCHMARK(BM_BF16Max_64K);
 
+// ============================================================================
+// Summation Modes
+// ============================================================================
+//
+// sum(SummationMode) trades speed for accuracy; range(0) is the mode
+// (0 Naive, 1 Compensated, 2 Pairwise, 3 Float64). Time relative to Naive
+// for Float32 on one core, 64K rows (cache) / 16M rows (memory):
+//
+//   Compensated  1.7x / 1.15x  add, two abs, compare and two blends per
+//                              vector instead of one add
+//   Pairwise     0.9x / 1.05x  four independent accumulators per 256-row
+//                              leaf hide the cost of merging the leaves
+//   Float64      1.9x / 1.3x   extract plus two fp32 -> fp64 conversions
+//                              per vector, all on the shuffle port
+//
+// BF16 columns show the same ordering. Pairwise is the cheap default for
+// accuracy; Compensated and Float64 are for sums that must not drift.
+
+template <typename Policy>
+static void BM_SumMode(benchmark::State& state) {
+  const size_t size = state.range(1);
+  column_vector<Policy> col(size);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> dist(1.0f, 100.0f);
+  for (size_t i = 0; i < size; ++i) {
+    col.data()[i] = typename Policy::value_type(dist(rng));
+    col.present_mask().set(i, i % 10 != 0);
+  }
+
+  const auto mode = static_cast<SummationMode>(state.range(0));
+  for (auto _ : state) {
+    auto result = col.sum(mode);
+    benchmark::DoNotOptimize(result);
+  }
+
+  const size_t bytes_per_iteration =
+      size * sizeof(typename Policy::value_type);
+  state.SetBytesProcessed(state.iterations() * bytes_per_iteration);
+}
+BENCHMARK_TEMPLATE(BM_SumMode, Float32DefaultPolicy)
+    ->ArgsProduct({{0, 1, 2, 3}, {64 * 1024, 16 * 1024 * 1024}});
+BENCHMARK_TEMPLATE(BM_SumMode, BF16DefaultPolicy)
+    ->ArgsProduct({{0, 1, 2, 3}, {64 * 1024, 16 * 1024 * 1024}});
+
+// ============================================================================
+// Multiple Aggregates
+// ============================================================================
+//
+// SUM, MIN, MAX and COUNT of one column: range(0) is 0 for one aggregate()
+// pass, 1 for four separate calls. One pass is ~2.7x faster at 16M rows,
+// where each call streams the column from memory again, and ~2x at 64K.
+
+template <typename Policy>
+static void BM_Aggregate(benchmark::State& state) {
+  const size_t size = state.range(1);
+  column_vector<Policy> col(size);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> dist(1.0f, 100.0f);
+  for (size_t i = 0; i < size; ++i) {
+    col.data()[i] = typename Policy::value_type(dist(rng));
+    col.present_mask().set(i, i % 10 != 0);
+  }
+
+  for (auto _ : state) {
+    if (state.range(0) == 0) {
+      auto result = col.aggregate({AggregateOp::Sum, AggregateOp::Min,
+                                   AggregateOp::Max, AggregateOp::Count});
+      benchmark::DoNotOptimize(result);
+    } else {
+      auto sum = col.sum();
+      auto min = col.min();
+      auto max = col.max();
+      auto count = col.present_mask().count();
+      benchmark::DoNotOptimize(sum);
+      benchmark::DoNotOptimize(min);
+      benchmark::DoNotOptimize(max);
+      benchmark::DoNotOptimize(count);
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * size *
+                          sizeof(typename Policy::value_type));
+}
+BENCHMARK_TEMPLATE(BM_Aggregate, Int32DefaultPolicy)
+    ->ArgsProduct({{0, 1}, {64 * 1024, 16 * 1024 * 1024}});
+BENCHMARK_TEMPLATE(BM_Aggregate, Float32DefaultPolicy)
+    ->ArgsProduct({{0, 1}, {64 * 1024, 16 * 1024 * 1024}});
+
+// ============================================================================
+// Statistics
+// ============================================================================
+//
+// variance() in one pass against the three it used to take: sum() for the
+// mean, a subtraction into a temporary, and sum() of its square (a second
+// temporary). range(0) is 0 for the fused kernel, 1 for the three passes.
+// On one core the fused kernel is ~20x faster at 64K rows and ~17x at 16M;
+// the three passes spend most of their time allocating and filling the
+// temporaries. dot() runs at memory bandwidth for both Float32 and BF16.
+
+static void BM_Variance(benchmark::State& state) {
+  const size_t size = state.range(1);
+  column_vector<Float32DefaultPolicy> col(size);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> dist(1.0f, 100.0f);
+  for (size_t i = 0; i < size; ++i) {
+    col.data()[i] = dist(rng);
+    col.present_mask().set(i, i % 10 != 0);
+  }
+  const float count = static_cast<float>(col.present_mask().count());
+
+  for (auto _ : state) {
+    double result;
+    if (state.range(0) == 0) {
+      result = col.variance();
+    } else {
+      const auto centered = col - col.sum() / count;
+      result = (centered * centered).sum() / (count - 1);
+    }
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetBytesProcessed(state.iterations() * size * sizeof(float));
+}
+BENCHMARK(BM_Variance)->ArgsProduct({{0, 1}, {64 * 1024, 16 * 1024 * 1024}});
+
+template <typename Policy> static void BM_Dot(benchmark::State& state) {
+  const size_t size = state.range(0);
+  column_vector<Policy> a(size);
+  column_vector<Policy> b(size);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  for (size_t i = 0; i < size; ++i) {
+    a.data()[i] = typename Policy::value_type(dist(rng));
+    b.data()[i] = typename Policy::value_type(dist(rng));
+    a.present_mask().set(i, i % 10 != 0);
+  }
+
+  for (auto _ : state) {
+    auto result = a.dot(b);
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetBytesProcessed(state.iterations() * size * 2 *
+                          sizeof(typename Policy::value_type));
+}
+BENCHMARK_TEMPLATE(BM_Dot, Float32DefaultPolicy)
+    ->Arg(64 * 1024)
+    ->Arg(16 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_Dot, BF16DefaultPolicy)
+    ->Arg(64 * 1024)
+    ->Arg(16 * 1024 * 1024);
+
+// Exact sum of decimal amounts, compared with the wrapping Int32 sum
+static void BM_Decimal64Sum(benchmark::State& state) {
+  const size_t size = state.range(0);
+  column_vector<Decimal64Policy<2>> col(size);
+
+  std::mt19937_64 rng(42);
+  std::uniform_int_distribution<std::int64_t> dist(-1'000'000'000,
+                                                   1'000'000'000);
+  for (size_t i = 0; i < size; ++i) {
+    col.data()[i] = dist(rng);
+    col.present_mask().set(i, i % 10 != 0);
+  }
+
+  for (auto _ : state) {
+    std::int64_t result = col.sum();
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetBytesProcessed(state.iterations() * size * sizeof(std::int64_t));
+}
+BENCHMARK(BM_Decimal64Sum)->Arg(64 * 1024)->Arg(16 * 1024 * 1024);
+
 // ============================================================================
 // Any/All Benchmarks
 // ============================================================================
@@ -3,13 +3,26 @@
 // This benchmark compares:
 // 1. Naive approach: tmp = a * b (loop 1), then tmp += c (loop 2)
 // 2. Fused approach: result = a * b + c (single loop with FMA)
+// 3. Fused approach with non-temporal (streaming) stores for the output
+// 4. column.hpp's vectorize() with regular vs streaming stores
+// 5. column.hpp's vectorize() with and without software prefetching
 //
 // Columns are sized larger than L3 cache to ensure memory-bound performance.
 // The naive approach loads data twice and writes to memory twice.
 // The fused approach loads data once and writes once, demonstrating the
 // value of avoiding temporaries and reducing memory traffic.
+//
+// The streaming variants show the crossover for non-temporal stores: while the
+// output fits in the LLC, regular stores win because the next reader finds the
+// output in cache; beyond it, streaming stores skip the read-for-ownership of
+// each output line and stop the output from evicting the inputs.
+//
+// The prefetch variants compare the loop with software prefetching disabled
+// against the configured tunables().prefetch_distance_bytes. The gain only
+// shows once the inputs spill out of L2.
 
 #include "container/column.hpp"
+#include "core/kernel_tunables.hpp"
 #include <benchmark/benchmark.h>
 #include <immintrin.h>
 #include <vector>
@@ -136,6 +149,38 @@ __attribute__((noinline)) void fused_fma_single_loop(const Float32Column& a,
   }
 }
 
+// ============================================================================
+// STREAMING IMPLEMENTATION: Fused loop with non-temporal stores
+// ============================================================================
+
+// Same as fused_fma_single_loop, but the output is written with streaming
+// stores that bypass the cache hierarchy
+__attribute__((noinline)) void
+fused_fma_single_loop_streaming(const Float32Column& a, const Float32Column& b,
+                                const Float32Column& c, Float32Column& result) {
+  const size_t n = a.data().size();
+  const float* __restrict__ a_ptr = a.data().data();
+  const float* __restrict__ b_ptr = b.data().data();
+  const float* __restrict__ c_ptr = c.data().data();
+  float* __restrict__ result_ptr = result.data().data();
+
+  const size_t simd_end = (n / 8) * 8;
+
+  for (size_t i = 0; i < simd_end; i += 8) {
+    __m256 va = _mm256_load_ps(a_ptr + i);
+    __m256 vb = _mm256_load_ps(b_ptr + i);
+    __m256 vc = _mm256_load_ps(c_ptr + i);
+    __m256 vr = _mm256_fmadd_ps(va, vb, vc);
+    _mm256_stream_ps(result_ptr + i, vr);
+  }
+  // Streaming stores are weakly ordered; fence before anyone reads result
+  _mm_sfence();
+
+  for (size_t i = simd_end; i < n; ++i) {
+    result_ptr[i] = a_ptr[i] * b_ptr[i] + c_ptr[i];
+  }
+}
+
 // ============================================================================
 // BENCHMARK FIXTURES
 // ============================================================================
@@ -219,6 +264,84 @@ BENCHMARK_DEFINE_F(KernelFusionFixture, Fused_SingleLoop_FMA)
       benchmark::Counter(column_size * sizeof(float) / 1024.0);
 }
 
+BENCHMARK_DEFINE_F(KernelFusionFixture, Fused_SingleLoop_FMA_Streaming)
+(benchmark::State& state) {
+  const size_t column_size = state.range(0);
+
+  for (auto _ : state) {
+    fused_fma_single_loop_streaming(a_, b_, c_, result_);
+    benchmark::DoNotOptimize(result_.data().data());
+    benchmark::ClobberMemory();
+  }
+
+  if (result_.data()[0] != 11.0f) {
+    state.SkipWithError("Incorrect result in Fused_SingleLoop_FMA_Streaming");
+  }
+
+  const size_t bytes_per_iter = column_size * sizeof(float) * 4;
+  state.SetBytesProcessed(state.iterations() * bytes_per_iter);
+  state.counters["elements"] = benchmark::Counter(column_size);
+  state.counters["size_kb"] =
+      benchmark::Counter(column_size * sizeof(float) / 1024.0);
+}
+
+// column.hpp's vectorize() with the streaming cutoff forced off (fraction ->
+// infinity) or on (fraction = 0), independent of the detected LLC size, and
+// with the given software prefetch distance
+static void run_vectorize_add(benchmark::State& state, const Float32Column& a,
+                              const Float32Column& b, Float32Column& result,
+                              double llc_fraction, size_t prefetch_bytes) {
+  const size_t column_size = state.range(0);
+  const kernel_tunables saved = tunables();
+  tunables().streaming_store_llc_fraction = llc_fraction;
+  tunables().prefetch_distance_bytes = prefetch_bytes;
+
+  for (auto _ : state) {
+    vectorize<Float32Policy, Float32Pipeline<OpType::Add>>(a, b, result);
+    benchmark::DoNotOptimize(result.data().data());
+    benchmark::ClobberMemory();
+  }
+  tunables() = saved;
+
+  if (result.data()[0] != 5.0f) {
+    state.SkipWithError("Incorrect result in vectorize add");
+  }
+
+  // 2 input arrays + 1 output array
+  const size_t bytes_per_iter = column_size * sizeof(float) * 3;
+  state.SetBytesProcessed(state.iterations() * bytes_per_iter);
+  state.counters["elements"] = benchmark::Counter(column_size);
+  state.counters["size_kb"] =
+      benchmark::Counter(column_size * sizeof(float) / 1024.0);
+  state.counters["llc_kb"] = benchmark::Counter(llc_size_bytes() / 1024.0);
+  state.counters["prefetch_bytes"] = benchmark::Counter(prefetch_bytes);
+}
+
+BENCHMARK_DEFINE_F(KernelFusionFixture, Vectorize_Add_RegularStores)
+(benchmark::State& state) {
+  run_vectorize_add(state, a_, b_, result_, 1e18,
+                    tunables().prefetch_distance_bytes);
+}
+
+BENCHMARK_DEFINE_F(KernelFusionFixture, Vectorize_Add_StreamingStores)
+(benchmark::State& state) {
+  run_vectorize_add(state, a_, b_, result_, 0.0,
+                    tunables().prefetch_distance_bytes);
+}
+
+BENCHMARK_DEFINE_F(KernelFusionFixture, Vectorize_Add_NoPrefetch)
+(benchmark::State& state) {
+  run_vectorize_add(state, a_, b_, result_, 1e18, 0);
+}
+
+// Same L1 -> beyond-L3 sweep as below, for the streaming comparisons
+static void cache_sweep(benchmark::internal::Benchmark* b) {
+  for (int64_t elements = 8 * 1024; elements <= 64 * 1024 * 1024;
+       elements *= 2) {
+    b->Arg(elements);
+  }
+}
+
 // Register benchmarks with size parameters
 // Test sizes from L1 cache (8K elements = 32KB) to beyond L3 (64M elements =
 // 256MB)
@@ -254,6 +377,15 @@ BENCHMARK_REGISTER_F(KernelFusionFixture, Fused_SingleLoop_FMA)
     ->Arg(32 * 1024 * 1024)  // 32M elements = 128 MB (exceeds L3)
     ->Arg(64 * 1024 * 1024); // 64M elements = 256 MB (exceeds L3)
 
+BENCHMARK_REGISTER_F(KernelFusionFixture, Fused_SingleLoop_FMA_Streaming)
+    ->Apply(cache_sweep);
+BENCHMARK_REGISTER_F(KernelFusionFixture, Vectorize_Add_RegularStores)
+    ->Apply(cache_sweep);
+BENCHMARK_REGISTER_F(KernelFusionFixture, Vectorize_Add_StreamingStores)
+    ->Apply(cache_sweep);
+BENCHMARK_REGISTER_F(KernelFusionFixture, Vectorize_Add_NoPrefetch)
+    ->Apply(cache_sweep);
+
 } // namespace
 } // namespace franklin
 
@@ -0,0 +1,398 @@
+// End-to-end query benchmark over franklin primitives
+//
+// The other benchmarks in this directory measure single kernels in isolation.
+// This one runs TPC-H-like query pipelines (filter + arithmetic + group-by
+// aggregate + top-k) over a synthetic lineitem table stored as row groups of
+// column_vectors, so that library-level changes can be validated against a
+// workload that looks like a real analytical query.
+//
+// Data generation is deterministic: every row group is generated from its own
+// seed, so the table content does not depend on the thread count or on the
+// order in which benchmarks run.
+//
+// Queries:
+// - Q1 (pricing summary): shipdate filter, disc_price = price * (1 - disc),
+//   charge = disc_price * (1 + tax), grouped by (returnflag, linestatus).
+// - Q6 (forecast revenue): conjunctive range filter, sum(price * discount)
+//   through the masked column reduction.
+// - TopK (supplier revenue): revenue grouped by supplier key (10K groups per
+//   scale factor), then the top 10 suppliers.
+//
+// Each query reports rows/s and GB/s (column bytes touched per second) for
+// every (scale factor, thread count) combination.
+//
+// Scale factors default to 0.1 and 1 (600K and 6M rows). Override with a
+// comma-separated list, e.g.:
+//   FRANKLIN_QUERY_SCALE_FACTORS=1,10 bazel-bin/benchmarks/query_benchmark
+
+#include "container/column.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace franklin {
+namespace {
+
+using Int32Column = column_vector<Int32DefaultPolicy>;
+using Float32Column = column_vector<Float32DefaultPolicy>;
+using Bitmask = dynamic_bitset<BitsetPolicy>;
+
+// TPC-H lineitem cardinality at scale factor 1
+constexpr std::size_t kRowsPerScaleFactor = 6'000'000;
+constexpr std::size_t kSuppliersPerScaleFactor = 10'000;
+// 64K rows: 256 KB per 4-byte column, so one column of a row group fits in L2
+constexpr std::size_t kRowGroupSize = 64 * 1024;
+constexpr std::uint64_t kSeed = 0x6672616E6B6C696EULL;
+
+// Days since 1992-01-01; the generated shipdates span 1992-01-01..1998-12-01
+constexpr std::int32_t kMaxShipdate = 2526;
+constexpr std::int32_t kQ1Cutoff = 2436;  // 1998-09-02
+constexpr std::int32_t kQ6Begin = 731;    // 1994-01-01
+constexpr std::int32_t kQ6End = 1096;     // 1995-01-01
+constexpr std::size_t kNumFlagStatus = 6; // returnflag x linestatus
+constexpr std::size_t kTopK = 10;
+
+struct LineitemRowGroup {
+  std::size_t rows;
+  Int32Column quantity;
+  Int32Column shipdate;
+  Int32Column flag_status; // returnflag * 2 + linestatus
+  Int32Column suppkey;
+  Float32Column extendedprice;
+  Float32Column discount; // ~1% missing to exercise the validity masks
+  Float32Column tax;
+};
+
+struct Lineitem {
+  std::vector<LineitemRowGroup> row_groups;
+  std::size_t rows;
+  std::size_t suppliers;
+};
+
+LineitemRowGroup generate_row_group(std::size_t index, std::size_t rows,
+                                    std::size_t suppliers) {
+  std::mt19937_64 rng(kSeed ^ (index * 0x9E3779B97F4A7C15ULL));
+  std::uniform_int_distribution<std::int32_t> quantity_dist(1, 50);
+  std::uniform_int_distribution<std::int32_t> shipdate_dist(0, kMaxShipdate);
+  std::uniform_int_distribution<std::int32_t> flag_dist(0, kNumFlagStatus - 1);
+  std::uniform_int_distribution<std::int32_t> supp_dist(
+      0, static_cast<std::int32_t>(suppliers - 1));
+  std::uniform_real_distribution<float> part_price_dist(900.0f, 2000.0f);
+  std::uniform_int_distribution<std::int32_t> discount_dist(0, 10);
+  std::uniform_int_distribution<std::int32_t> tax_dist(0, 8);
+  std::uniform_int_distribution<std::int32_t> null_dist(0, 99);
+
+  LineitemRowGroup rg{rows,
+                      Int32Column(rows),
+                      Int32Column(rows),
+                      Int32Column(rows),
+                      Int32Column(rows),
+                      Float32Column(rows),
+                      Float32Column(rows),
+                      Float32Column(rows)};
+  for (std::size_t i = 0; i < rows; ++i) {
+    const std::int32_t quantity = quantity_dist(rng);
+    rg.quantity.data()[i] = quantity;
+    rg.shipdate.data()[i] = shipdate_dist(rng);
+    rg.flag_status.data()[i] = flag_dist(rng);
+    rg.suppkey.data()[i] = supp_dist(rng);
+    rg.extendedprice.data()[i] =
+        static_cast<float>(quantity) * part_price_dist(rng);
+    rg.discount.data()[i] = static_cast<float>(discount_dist(rng)) * 0.01f;
+    rg.tax.data()[i] = static_cast<float>(tax_dist(rng)) * 0.01f;
+    if (null_dist(rng) == 0) {
+      rg.discount.present_mask().set(i, false);
+    }
+  }
+  return rg;
+}
+
+const Lineitem& lineitem(double scale_factor) {
+  // Generation dominates setup time, so tables are shared across benchmarks
+  static std::map<double, Lineitem> tables;
+  auto it = tables.find(scale_factor);
+  if (it != tables.end()) {
+    return it->second;
+  }
+
+  Lineitem table;
+  table.rows = static_cast<std::size_t>(scale_factor * kRowsPerScaleFactor);
+  table.suppliers = std::max<std::size_t>(
+      1, static_cast<std::size_t>(scale_factor * kSuppliersPerScaleFactor));
+  for (std::size_t start = 0, index = 0; start < table.rows;
+       start += kRowGroupSize, ++index) {
+    table.row_groups.push_back(generate_row_group(
+        index, std::min(kRowGroupSize, table.rows - start), table.suppliers));
+  }
+  return tables.emplace(scale_factor, std::move(table)).first->second;
+}
+
+// Run fn(thread_index, row_group) over all row groups with dynamic scheduling
+template <typename Fn>
+void parallel_row_groups(const Lineitem& table, std::size_t num_threads,
+                         Fn&& fn) {
+  std::atomic<std::size_t> next{0};
+  auto worker = [&](std::size_t thread_index) {
+    for (std::size_t rg = next.fetch_add(1, std::memory_order_relaxed);
+         rg < table.row_groups.size();
+         rg = next.fetch_add(1, std::memory_order_relaxed)) {
+      fn(thread_index, table.row_groups[rg]);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (std::size_t t = 1; t < num_threads; ++t) {
+    threads.emplace_back(worker, t);
+  }
+  worker(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+// Evaluate pred over a column into a selection bitmask, 64 rows at a time so
+// the compare loop vectorizes. The result is ANDed with the column's own
+// validity mask.
+template <typename Column, typename Pred>
+Bitmask select(const Column& col, std::size_t rows, Pred&& pred) {
+  Bitmask selection(col.data().size(), false);
+  auto& blocks = selection.blocks();
+  const auto* data = col.data().data();
+  const std::size_t full_blocks = rows / 64;
+  for (std::size_t b = 0; b < full_blocks; ++b) {
+    std::uint64_t word = 0;
+    for (std::size_t j = 0; j < 64; ++j) {
+      word |= static_cast<std::uint64_t>(pred(data[b * 64 + j])) << j;
+    }
+    blocks[b] = word;
+  }
+  for (std::size_t i = full_blocks * 64; i < rows; ++i) {
+    selection.set(i, pred(data[i]));
+  }
+  selection &= col.present_mask();
+  return selection;
+}
+
+// Call fn(row) for every set bit of mask
+template <typename Fn>
+FRANKLIN_FORCE_INLINE void for_each_selected(const Bitmask& mask, Fn&& fn) {
+  const auto& blocks = mask.blocks();
+  for (std::size_t b = 0; b < blocks.size(); ++b) {
+    for (std::uint64_t word = blocks[b]; word; word &= word - 1) {
+      fn(b * 64 + std::countr_zero(word));
+    }
+  }
+}
+
+// ============================================================================
+// QUERIES
+// ============================================================================
+
+struct Q1Group {
+  double sum_qty = 0;
+  double sum_base_price = 0;
+  double sum_disc_price = 0;
+  double sum_charge = 0;
+  std::int64_t count = 0;
+};
+using Q1Result = std::array<Q1Group, kNumFlagStatus>;
+
+Q1Result run_q1(const Lineitem& table, std::size_t num_threads) {
+  std::vector<Q1Result> partials(num_threads);
+  parallel_row_groups(table, num_threads, [&](std::size_t t,
+                                              const LineitemRowGroup& rg) {
+    Bitmask selection = select(rg.shipdate, rg.rows,
+                               [](std::int32_t d) { return d <= kQ1Cutoff; });
+    Float32Column disc_price = rg.extendedprice * (1.0f - rg.discount);
+    Float32Column charge = disc_price * (rg.tax + 1.0f);
+    selection &= charge.present_mask();
+
+    const std::int32_t* key = rg.flag_status.data().data();
+    const std::int32_t* qty = rg.quantity.data().data();
+    const float* price = rg.extendedprice.data().data();
+    const float* dp = disc_price.data().data();
+    const float* ch = charge.data().data();
+    Q1Result& acc = partials[t];
+    for_each_selected(selection, [&](std::size_t i) {
+      Q1Group& g = acc[key[i]];
+      g.sum_qty += qty[i];
+      g.sum_base_price += price[i];
+      g.sum_disc_price += dp[i];
+      g.sum_charge += ch[i];
+      ++g.count;
+    });
+  });
+
+  Q1Result result{};
+  for (const auto& partial : partials) {
+    for (std::size_t g = 0; g < kNumFlagStatus; ++g) {
+      result[g].sum_qty += partial[g].sum_qty;
+      result[g].sum_base_price += partial[g].sum_base_price;
+      result[g].sum_disc_price += partial[g].sum_disc_price;
+      result[g].sum_charge += partial[g].sum_charge;
+      result[g].count += partial[g].count;
+    }
+  }
+  return result;
+}
+
+double run_q6(const Lineitem& table, std::size_t num_threads) {
+  std::vector<double> partials(num_threads, 0.0);
+  parallel_row_groups(table, num_threads, [&](std::size_t t,
+                                              const LineitemRowGroup& rg) {
+    Bitmask selection = select(rg.shipdate, rg.rows, [](std::int32_t d) {
+      return d >= kQ6Begin && d < kQ6End;
+    });
+    selection &= select(rg.quantity, rg.rows,
+                        [](std::int32_t q) { return q < 24; });
+    selection &= select(rg.discount, rg.rows,
+                        [](float d) { return d >= 0.045f && d <= 0.075f; });
+    Float32Column revenue = rg.extendedprice * rg.discount;
+    revenue.present_mask() &= selection;
+    partials[t] += revenue.sum();
+  });
+
+  double result = 0.0;
+  for (double partial : partials) {
+    result += partial;
+  }
+  return result;
+}
+
+using TopKResult = std::vector<std::pair<double, std::int32_t>>;
+
+TopKResult run_topk(const Lineitem& table, std::size_t num_threads) {
+  std::vector<std::vector<double>> partials(
+      num_threads, std::vector<double>(table.suppliers, 0.0));
+  parallel_row_groups(table, num_threads, [&](std::size_t t,
+                                              const LineitemRowGroup& rg) {
+    Float32Column revenue = rg.extendedprice * (1.0f - rg.discount);
+    const std::int32_t* supp = rg.suppkey.data().data();
+    const float* rev = revenue.data().data();
+    std::vector<double>& acc = partials[t];
+    for_each_selected(revenue.present_mask(),
+                      [&](std::size_t i) { acc[supp[i]] += rev[i]; });
+  });
+
+  TopKResult groups(table.suppliers);
+  for (std::size_t s = 0; s < table.suppliers; ++s) {
+    double total = 0.0;
+    for (const auto& partial : partials) {
+      total += partial[s];
+    }
+    groups[s] = {total, static_cast<std::int32_t>(s)};
+  }
+  const std::size_t k = std::min(kTopK, groups.size());
+  std::partial_sort(groups.begin(), groups.begin() + k, groups.end(),
+                    std::greater<>());
+  groups.resize(k);
+  return groups;
+}
+
+// ============================================================================
+// BENCHMARKS
+// ============================================================================
+
+// Bytes of column data (values + validity masks) each query reads per row
+constexpr double kQ1BytesPerRow = 6 * sizeof(std::int32_t) + 6.0 / 8.0;
+constexpr double kQ6BytesPerRow = 4 * sizeof(std::int32_t) + 4.0 / 8.0;
+constexpr double kTopKBytesPerRow = 3 * sizeof(std::int32_t) + 3.0 / 8.0;
+
+template <typename Query>
+void run_query(benchmark::State& state, double scale_factor,
+               double bytes_per_row, Query&& query) {
+  const Lineitem& table = lineitem(scale_factor);
+  const auto num_threads = static_cast<std::size_t>(state.range(0));
+
+  for (auto _ : state) {
+    auto result = query(table, num_threads);
+    benchmark::DoNotOptimize(result);
+    benchmark::ClobberMemory();
+  }
+
+  const double rows = static_cast<double>(table.rows) * state.iterations();
+  state.SetItemsProcessed(static_cast<std::int64_t>(rows));
+  state.SetBytesProcessed(static_cast<std::int64_t>(rows * bytes_per_row));
+  state.counters["rows/s"] =
+      benchmark::Counter(rows, benchmark::Counter::kIsRate);
+  state.counters["GB/s"] =
+      benchmark::Counter(rows * bytes_per_row, benchmark::Counter::kIsRate,
+                         benchmark::Counter::kIs1024);
+  state.counters["threads"] = benchmark::Counter(num_threads);
+  state.counters["rows"] = benchmark::Counter(table.rows);
+}
+
+std::vector<double> scale_factors() {
+  std::vector<double> result;
+  if (const char* env = std::getenv("FRANKLIN_QUERY_SCALE_FACTORS")) {
+    std::string spec(env);
+    std::size_t pos = 0;
+    while (pos < spec.size()) {
+      std::size_t comma = spec.find(',', pos);
+      if (comma == std::string::npos) {
+        comma = spec.size();
+      }
+      result.push_back(std::stod(spec.substr(pos, comma - pos)));
+      pos = comma + 1;
+    }
+  }
+  if (result.empty()) {
+    result = {0.1, 1.0};
+  }
+  return result;
+}
+
+void register_benchmarks() {
+  const std::size_t max_threads =
+      std::max(1u, std::thread::hardware_concurrency());
+  std::vector<std::int64_t> thread_counts;
+  for (std::size_t t = 1; t <= max_threads; t *= 2) {
+    thread_counts.push_back(static_cast<std::int64_t>(t));
+  }
+
+  for (double sf : scale_factors()) {
+    const std::string suffix = "/SF" + std::to_string(sf).substr(0, 4);
+    auto configure = [&](benchmark::internal::Benchmark* b) {
+      b->ArgName("threads")->UseRealTime()->Unit(benchmark::kMillisecond);
+      for (std::int64_t t : thread_counts) {
+        b->Arg(t);
+      }
+    };
+    configure(benchmark::RegisterBenchmark(
+        ("BM_Query_Q1" + suffix).c_str(), [sf](benchmark::State& state) {
+          run_query(state, sf, kQ1BytesPerRow, run_q1);
+        }));
+    configure(benchmark::RegisterBenchmark(
+        ("BM_Query_Q6" + suffix).c_str(), [sf](benchmark::State& state) {
+          run_query(state, sf, kQ6BytesPerRow, run_q6);
+        }));
+    configure(benchmark::RegisterBenchmark(
+        ("BM_Query_TopK" + suffix).c_str(), [sf](benchmark::State& state) {
+          run_query(state, sf, kTopKBytesPerRow, run_topk);
+        }));
+  }
+}
+
+} // namespace
+} // namespace franklin
+
+int main(int argc, char** argv) {
+  franklin::register_benchmarks();
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
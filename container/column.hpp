@@ -3,18 +3,38 @@
 
 #include "container/dynamic_bitset.hpp"
 #include "core/bf16.hpp"
+#include "core/civil_time.hpp"
 #include "core/compiler_macros.hpp"
 #include "core/data_type_enum.hpp"
+#include "core/decimal.hpp"
+#include "core/kernel_tunables.hpp"
 #include "memory/aligned_allocator.hpp"
+#include <algorithm>
 #include <bit>
+#include <cmath>
 #include <concepts>
 #include <cstdint>
 #include <immintrin.h>
+#include <initializer_list>
+#include <limits>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace franklin {
 
+// What Int32 and Decimal64 element-wise arithmetic does with results that do
+// not fit in their 32 or 64 bits. Floating-point columns always follow IEEE
+// 754.
+enum class OverflowMode {
+  Wrap,     // two's complement wrap-around
+  Saturate, // clamp to the smallest / largest value of the type
+  Report,   // wrap, and throw std::runtime_error once per kernel
+  Null,     // wrap, and clear the present bit of the row
+};
+
 namespace concepts {
 
 template <typename T>
@@ -28,6 +48,46 @@ concept ColumnPolicy = requires {
   requires std::is_same_v<decltype(T::policy_id), const DataTypeEnum::Enum>;
 };
 
+// Optional policy member overriding tunables().prefetch_distance_bytes
+template <typename T>
+concept HasPrefetchDistance = requires {
+  { T::prefetch_distance } -> std::convertible_to<std::size_t>;
+};
+
+// Optional policy member fixing the number of elements of every column at
+// compile time. Kernels for such policies are straight-line code.
+template <typename T>
+concept HasFixedSize = requires {
+  { T::fixed_size } -> std::convertible_to<std::size_t>;
+};
+
+// Optional policy member selecting the OverflowMode of an Int32 or Decimal64
+// column; columns without it wrap
+template <typename T>
+concept HasOverflowMode = requires {
+  { T::overflow } -> std::convertible_to<OverflowMode>;
+};
+
+// Fixed-point decimal columns: int64 raw values at the scale of the policy
+template <typename T>
+concept DecimalColumnPolicy = ColumnPolicy<T> && requires {
+  requires std::is_same_v<typename T::value_type, std::int64_t>;
+  { T::scale } -> std::convertible_to<unsigned>;
+  { T::rounding } -> std::convertible_to<RoundingMode>;
+};
+
+// Dates and timestamps (see core/civil_time.hpp)
+template <typename T>
+concept TemporalColumnPolicy =
+    ColumnPolicy<T> && (T::policy_id == DataTypeEnum::Date32 ||
+                        T::policy_id == DataTypeEnum::TimestampMicros);
+
+// Every other column type. Only these have element-wise arithmetic, sum()
+// and aggregate(); dates and timestamps have none. product() and axpy() are
+// further limited to Int32, Float32 and BF16.
+template <typename T>
+concept ArithmeticColumnPolicy = ColumnPolicy<T> && !TemporalColumnPolicy<T>;
+
 template <typename T>
 concept PipelinePolicy = requires {
   typename T::value_type;
@@ -74,6 +134,125 @@ struct BF16DefaultPolicy {
   static constexpr DataTypeEnum::Enum policy_id = DataTypeEnum::BF16Default;
 };
 
+// Decimal columns with Scale fractional digits: 1234 is 12.34 at Scale 2
+// (see core/decimal.hpp). Sums and differences are exact and products are
+// rounded back to Scale with Rounding. Overflow is reported by default,
+// since a wrapped amount is never what was meant.
+template <unsigned Scale, RoundingMode Rounding = RoundingMode::HalfEven,
+          OverflowMode Overflow = OverflowMode::Report>
+struct Decimal64Policy {
+  static_assert(Scale <= max_decimal_scale,
+                "10^Scale must fit in an int64");
+  using value_type = std::int64_t;
+  using allocator_type = memory::aligned_allocator<value_type, 64>;
+  static constexpr bool is_view = false;
+  static constexpr bool allow_missing = true;
+  static constexpr bool use_avx512 = false;
+  static constexpr bool assume_aligned = true;
+  static constexpr DataTypeEnum::Enum policy_id = DataTypeEnum::Decimal64;
+  static constexpr unsigned scale = Scale;
+  static constexpr RoundingMode rounding = Rounding;
+  static constexpr OverflowMode overflow = Overflow;
+};
+
+// Days since 1970-01-01. Calendar fields come from extract() and
+// date_trunc(); there is no date arithmetic.
+struct Date32Policy {
+  using value_type = std::int32_t;
+  using allocator_type = memory::aligned_allocator<value_type, 64>;
+  static constexpr bool is_view = false;
+  static constexpr bool allow_missing = true;
+  static constexpr bool use_avx512 = false;
+  static constexpr bool assume_aligned = true;
+  static constexpr DataTypeEnum::Enum policy_id = DataTypeEnum::Date32;
+};
+
+// Microseconds since 1970-01-01 00:00:00 UTC, as for Date32Policy
+struct TimestampMicrosPolicy {
+  using value_type = std::int64_t;
+  using allocator_type = memory::aligned_allocator<value_type, 64>;
+  static constexpr bool is_view = false;
+  static constexpr bool allow_missing = true;
+  static constexpr bool use_avx512 = false;
+  static constexpr bool assume_aligned = true;
+  static constexpr DataTypeEnum::Enum policy_id =
+      DataTypeEnum::TimestampMicros;
+};
+
+// ============================================================================
+// Compile-time size traits
+// ============================================================================
+
+// Every owning column's buffer is padded to a whole number of cache lines, so
+// its size is a multiple of this many elements. Views make no such guarantee.
+template <concepts::ColumnPolicy Policy>
+constexpr std::size_t size_granularity() noexcept {
+  if constexpr (Policy::is_view) {
+    return 1;
+  } else {
+    return FRANKLIN_CACHE_LINE_SIZE / sizeof(typename Policy::value_type);
+  }
+}
+
+// Buffer size for a column of `size` logical elements
+template <concepts::ColumnPolicy Policy>
+constexpr std::size_t padded_size(std::size_t size) noexcept {
+  constexpr std::size_t granularity = size_granularity<Policy>();
+  return ((size + granularity - 1) / granularity) * granularity;
+}
+
+// Overflow mode of a column policy
+template <concepts::ColumnPolicy Policy>
+constexpr OverflowMode overflow_mode() noexcept {
+  if constexpr (concepts::HasOverflowMode<Policy>) {
+    static_assert(std::is_integral_v<typename Policy::value_type> ||
+                      Policy::overflow == OverflowMode::Wrap,
+                  "overflow modes apply to Int32 and Decimal64 columns");
+    return Policy::overflow;
+  } else {
+    return OverflowMode::Wrap;
+  }
+}
+
+// Fractional digits of a column policy: the scale of Decimal64 columns, 0
+// for every other type
+template <concepts::ColumnPolicy Policy>
+constexpr unsigned column_scale() noexcept {
+  if constexpr (concepts::DecimalColumnPolicy<Policy>) {
+    return Policy::scale;
+  } else {
+    return 0;
+  }
+}
+
+// Accuracy of floating-point sums. Int32 sums are exact (modulo overflow)
+// whatever the mode.
+enum class SummationMode {
+  Naive,       // fp32 accumulators; error grows with the number of rows
+  Compensated, // Neumaier compensation per lane; error independent of n
+  Pairwise,    // fp32 blocks added as a binary tree; error grows with log n
+  Float64,     // fp64 accumulators
+};
+
+// Aggregates that column_vector::aggregate() computes together
+enum class AggregateOp { Sum, Min, Max, Count, Mean };
+
+// Result of column_vector::aggregate(). Only the requested fields are set.
+// sum, min and max equal what sum(), min() and max() return; mean is
+// accumulated in fp64 (int64 for Int32 columns) and is NaN when no value is
+// present. total is the sum behind the mean, set with it: unlike sum it
+// neither wraps nor rounds to T. Decimal64 results are raw values at the
+// column's scale: sum and total are exact, with the overflow mode applied as
+// in sum(), and mean divides the exact total.
+template <typename T> struct aggregate_result {
+  std::size_t count = 0;
+  T sum{};
+  T min{};
+  T max{};
+  double mean = std::numeric_limits<double>::quiet_NaN();
+  std::conditional_t<std::is_integral_v<T>, std::int64_t, double> total{};
+};
+
 template <concepts::ColumnPolicy Policy> class column_vector {
 public:
   using value_type = typename Policy::value_type;
@@ -117,31 +296,68 @@ public:
   // Move assignment
   column_vector& operator=(column_vector&& other) noexcept;
 
-  // Element-wise operations
-  column_vector operator+(const column_vector& other) const;
-  column_vector operator+(column_vector&& other) const;
+  // Element-wise operations. These and the reductions below, except min()
+  // and max(), require an ArithmeticColumnPolicy.
+  column_vector operator+(const column_vector& other) const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  column_vector operator+(column_vector&& other) const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
 
-  column_vector operator-(const column_vector& other) const;
-  column_vector operator-(column_vector&& other) const;
+  column_vector operator-(const column_vector& other) const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  column_vector operator-(column_vector&& other) const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
 
-  column_vector operator*(const column_vector& other) const;
-  column_vector operator*(column_vector&& other) const;
+  column_vector operator*(const column_vector& other) const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  column_vector operator*(column_vector&& other) const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
 
   // Scalar operations (column op scalar)
-  column_vector operator+(value_type scalar) const;
-  column_vector operator-(value_type scalar) const;
-  column_vector operator*(value_type scalar) const;
+  column_vector operator+(value_type scalar) const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  column_vector operator-(value_type scalar) const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  column_vector operator*(value_type scalar) const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+
+  // In-place element-wise operations, keeping the rows present in both
+  // operands. They reuse this column's buffer, and `a += a` and friends read
+  // the column once.
+  column_vector& operator+=(const column_vector& other)
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  column_vector& operator-=(const column_vector& other)
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  column_vector& operator*=(const column_vector& other)
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  column_vector& operator+=(value_type scalar)
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  column_vector& operator-=(value_type scalar)
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  column_vector& operator*=(value_type scalar)
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+
+  // this += alpha * x, one fused multiply-add per element (BF16 computes in
+  // fp32 and rounds once; Int32 is exact, and only the result is subject to
+  // the overflow mode)
+  column_vector& axpy(value_type alpha, const column_vector& x)
+    requires(concepts::ArithmeticColumnPolicy<Policy> &&
+             !concepts::DecimalColumnPolicy<Policy>);
 
   // Friend operators for (scalar op column)
-  friend column_vector operator+(value_type scalar, const column_vector& col) {
+  friend column_vector operator+(value_type scalar, const column_vector& col)
+    requires concepts::ArithmeticColumnPolicy<Policy>
+  {
     return col + scalar; // Addition is commutative
   }
-  friend column_vector operator*(value_type scalar, const column_vector& col) {
+  friend column_vector operator*(value_type scalar, const column_vector& col)
+    requires concepts::ArithmeticColumnPolicy<Policy>
+  {
     return col * scalar; // Multiplication is commutative
   }
 
   // Forward declaration needed for friend template
-  template <concepts::ColumnPolicy P>
+  template <concepts::ArithmeticColumnPolicy P>
   friend column_vector<P> operator-(typename P::value_type scalar,
                                     const column_vector<P>& col);
 
@@ -176,11 +392,33 @@ public:
   }
 
   // Reduction operations - return identity value if empty or all missing
-  value_type sum() const;
-  value_type product() const;
+  value_type sum() const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  value_type sum(SummationMode mode) const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+  value_type product() const
+    requires(concepts::ArithmeticColumnPolicy<Policy> &&
+             !concepts::DecimalColumnPolicy<Policy>);
   value_type min() const;
   value_type max() const;
 
+  // Any subset of SUM, MIN, MAX, COUNT and MEAN in one pass over the column,
+  // e.g. aggregate({AggregateOp::Min, AggregateOp::Max})
+  aggregate_result<value_type>
+  aggregate(std::initializer_list<AggregateOp> ops) const
+    requires concepts::ArithmeticColumnPolicy<Policy>;
+
+  // Statistics of Float32 and BF16 columns, each in a single pass and
+  // returned in fp64. dot() takes the rows present in both columns, which
+  // must have the same size. dot() and l2_norm() are 0 when no row is
+  // present, mean() is NaN; variance() and stddev() are the sample versions
+  // (divided by n - 1) and NaN below two present values.
+  double dot(const column_vector& other) const;
+  double l2_norm() const;
+  double mean() const;
+  double variance() const;
+  double stddev() const;
+
   // Present mask operations
   bool any() const noexcept { return present_mask_.any(); }
   bool all() const noexcept { return present_mask_.all(); }
@@ -196,12 +434,13 @@ template <concepts::ColumnPolicy Policy>
 column_vector<Policy>::column_vector(std::size_t size,
                                      const allocator_type& alloc)
     : allocator_(alloc) {
-  // Round up to cache-line boundary for proper SIMD alignment
-  // 64-byte cache line / sizeof(value_type) elements per cache line
-  constexpr std::size_t elements_per_cache_line = 64 / sizeof(value_type);
-  std::size_t rounded_size =
-      ((size + elements_per_cache_line - 1) / elements_per_cache_line) *
-      elements_per_cache_line;
+  // Round up to cache-line boundary for proper SIMD alignment. Fixed-size
+  // policies always allocate their full width.
+  std::size_t rounded_size = padded_size<Policy>(size);
+  if constexpr (concepts::HasFixedSize<Policy>) {
+    FRANKLIN_ASSERT(rounded_size <= padded_size<Policy>(Policy::fixed_size));
+    rounded_size = padded_size<Policy>(Policy::fixed_size);
+  }
 
   data_ = std::vector<value_type, allocator_type>(rounded_size, alloc);
   // Create present_mask with all bits false, then set only valid elements to
@@ -217,12 +456,13 @@ template <concepts::ColumnPolicy Policy>
 column_vector<Policy>::column_vector(std::size_t size, const value_type& value,
                                      const allocator_type& alloc)
     : allocator_(alloc) {
-  // Round up to cache-line boundary for proper SIMD alignment
-  // 64-byte cache line / sizeof(value_type) elements per cache line
-  constexpr std::size_t elements_per_cache_line = 64 / sizeof(value_type);
-  std::size_t rounded_size =
-      ((size + elements_per_cache_line - 1) / elements_per_cache_line) *
-      elements_per_cache_line;
+  // Round up to cache-line boundary for proper SIMD alignment. Fixed-size
+  // policies always allocate their full width.
+  std::size_t rounded_size = padded_size<Policy>(size);
+  if constexpr (concepts::HasFixedSize<Policy>) {
+    FRANKLIN_ASSERT(rounded_size <= padded_size<Policy>(Policy::fixed_size));
+    rounded_size = padded_size<Policy>(Policy::fixed_size);
+  }
 
   data_ = std::vector<value_type, allocator_type>(rounded_size, value, alloc);
   // Create present_mask with all bits false, then set only valid elements to
@@ -273,18 +513,178 @@ column_vector<Policy>::operator=(column_vector&& other) noexcept {
 // Operation types for vectorized computation
 enum class OpType { Add, Sub, Mul };
 
+// a op b on 8 Int32 lanes, wrapping. Sets the sign bit of every lane of
+// overflow whose exact result does not fit in 32 bits and leaves the others.
+template <OpType Op>
+FRANKLIN_FORCE_INLINE __m256i int32_op_checked(__m256i a, __m256i b,
+                                               __m256i& overflow) {
+  if constexpr (Op == OpType::Add) {
+    // Overflow iff both operands have the sign the result lacks
+    const __m256i r = _mm256_add_epi32(a, b);
+    overflow = _mm256_or_si256(
+        overflow,
+        _mm256_and_si256(_mm256_xor_si256(a, r), _mm256_xor_si256(b, r)));
+    return r;
+  } else if constexpr (Op == OpType::Sub) {
+    // Overflow iff the operands differ in sign and the result's differs
+    // from a's
+    const __m256i r = _mm256_sub_epi32(a, b);
+    overflow = _mm256_or_si256(
+        overflow,
+        _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, r)));
+    return r;
+  } else if constexpr (Op == OpType::Mul) {
+    // Full 64-bit products of the even and odd lanes; the low halves are
+    // the wrapped result, which fits iff the high half is its sign extension
+    const __m256i even = _mm256_mul_epi32(a, b);
+    const __m256i odd =
+        _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    const __m256i r =
+        _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0b10101010);
+    const __m256i high =
+        _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0b10101010);
+    const __m256i fits = _mm256_cmpeq_epi32(high, _mm256_srai_epi32(r, 31));
+    overflow = _mm256_or_si256(overflow,
+                               _mm256_xor_si256(fits, _mm256_set1_epi32(-1)));
+    return r;
+  }
+}
+
+// a op b on 8 Int32 lanes under an overflow mode. Report and Null wrap here;
+// their kernels call int32_op_checked to collect the overflowing lanes.
+template <OpType Op, OverflowMode Mode>
+FRANKLIN_FORCE_INLINE __m256i int32_op(__m256i a, __m256i b) {
+  if constexpr (Mode == OverflowMode::Saturate) {
+    __m256i overflow = _mm256_setzero_si256();
+    const __m256i r = int32_op_checked<Op>(a, b, overflow);
+    // The exact result has a's sign for Add and Sub and the sign of a ^ b
+    // for Mul: INT32_MAX flipped to INT32_MIN when that sign is negative
+    const __m256i sign = Op == OpType::Mul ? _mm256_xor_si256(a, b) : a;
+    const __m256i limit =
+        _mm256_xor_si256(_mm256_srai_epi32(sign, 31),
+                         _mm256_set1_epi32(std::numeric_limits<int>::max()));
+    return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(r),
+                                                _mm256_castsi256_ps(limit),
+                                                _mm256_castsi256_ps(overflow)));
+  } else if constexpr (Op == OpType::Add) {
+    return _mm256_add_epi32(a, b);
+  } else if constexpr (Op == OpType::Sub) {
+    return _mm256_sub_epi32(a, b);
+  } else if constexpr (Op == OpType::Mul) {
+    return _mm256_mullo_epi32(a, b);
+  }
+}
+
+// a * b / 10^Scale for the lanes of a product wider than 63 bits, one lane
+// at a time in 128-bit arithmetic. Such products of amounts are rare, so
+// this stays out of line.
+template <unsigned Scale, RoundingMode Rounding>
+FRANKLIN_FORCE_NOINLINE inline __m256i
+decimal_mul_wide(__m256i a, __m256i b, __m256i& overflow) {
+  alignas(32) std::int64_t as[4];
+  alignas(32) std::int64_t bs[4];
+  alignas(32) std::int64_t result[4];
+  alignas(32) std::int64_t overflowed[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(as), a);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(bs), b);
+  for (int j = 0; j < 4; ++j) {
+    const __int128 exact = multiply_round<Rounding>(as[j], bs[j], Scale);
+    result[j] = static_cast<std::int64_t>(exact);
+    overflowed[j] = exact == result[j] ? 0 : -1;
+  }
+  overflow = _mm256_or_si256(
+      overflow,
+      _mm256_load_si256(reinterpret_cast<const __m256i*>(overflowed)));
+  return _mm256_load_si256(reinterpret_cast<const __m256i*>(result));
+}
+
+// a op b on 4 lanes of two decimals at scale Scale, wrapping; products are
+// rounded back to Scale with Rounding. Sets the sign bit of every lane of
+// overflow whose exact result does not fit in 64 bits.
+template <OpType Op, unsigned Scale, RoundingMode Rounding>
+FRANKLIN_FORCE_INLINE __m256i decimal_op_checked(__m256i a, __m256i b,
+                                                 __m256i& overflow) {
+  if constexpr (Op == OpType::Add) {
+    const __m256i r = _mm256_add_epi64(a, b);
+    overflow = _mm256_or_si256(
+        overflow,
+        _mm256_and_si256(_mm256_xor_si256(a, r), _mm256_xor_si256(b, r)));
+    return r;
+  } else if constexpr (Op == OpType::Sub) {
+    const __m256i r = _mm256_sub_epi64(a, b);
+    overflow = _mm256_or_si256(
+        overflow,
+        _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, r)));
+    return r;
+  } else if constexpr (Op == OpType::Mul) {
+    // Multiply the magnitudes into 128 bits. Below 2^63 the product is a
+    // single unsigned lane, divided by 10^Scale with a multiply-high.
+    const __m256i a_negative = negative_epi64(a);
+    const __m256i b_negative = negative_epi64(b);
+    const __m256i ua = abs_epi64(a, a_negative);
+    const __m256i ub = abs_epi64(b, b_negative);
+    const __m256i low = mullo_epi64(ua, ub);
+    const __m256i wide = _mm256_or_si256(
+        mulhi_epu64(ua, ub),
+        _mm256_and_si256(
+            low, _mm256_set1_epi64x(std::numeric_limits<long long>::min())));
+    if (!_mm256_testz_si256(wide, wide)) [[unlikely]] {
+      return decimal_mul_wide<Scale, Rounding>(a, b, overflow);
+    }
+    const __m256i negative = _mm256_xor_si256(a_negative, b_negative);
+    __m256i q = low;
+    if constexpr (Scale > 0) {
+      constexpr pow10_divisor divisor = pow10_divisor::make(Scale);
+      q = divide_pow10_epu64<Rounding>(low, negative, divisor);
+    }
+    return _mm256_sub_epi64(_mm256_xor_si256(q, negative), negative);
+  }
+}
+
+// a op b on 4 decimal lanes under an overflow mode. Report and Null wrap
+// here; their kernels call decimal_op_checked to collect the overflowing
+// lanes.
+template <OpType Op, unsigned Scale, RoundingMode Rounding, OverflowMode Mode>
+FRANKLIN_FORCE_INLINE __m256i decimal_op(__m256i a, __m256i b) {
+  if constexpr (Mode == OverflowMode::Saturate) {
+    __m256i overflow = _mm256_setzero_si256();
+    const __m256i r = decimal_op_checked<Op, Scale, Rounding>(a, b, overflow);
+    const __m256i sign = Op == OpType::Mul ? _mm256_xor_si256(a, b) : a;
+    const __m256i limit = _mm256_xor_si256(
+        negative_epi64(sign),
+        _mm256_set1_epi64x(std::numeric_limits<long long>::max()));
+    return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(r),
+                                                _mm256_castsi256_pd(limit),
+                                                _mm256_castsi256_pd(overflow)));
+  } else if constexpr (Op == OpType::Add) {
+    return _mm256_add_epi64(a, b);
+  } else if constexpr (Op == OpType::Sub) {
+    return _mm256_sub_epi64(a, b);
+  } else if constexpr (Op == OpType::Mul) {
+    __m256i ignored = _mm256_setzero_si256();
+    return decimal_op_checked<Op, Scale, Rounding>(a, b, ignored);
+  }
+}
+
 // Default pipeline for int32_t - no transformation needed
-template <OpType Op> struct Int32Pipeline {
+template <OpType Op, OverflowMode Mode = OverflowMode::Wrap>
+struct Int32Pipeline {
   using value_type = std::int32_t;
   using storage_register_type = __m256i;
   using compute_register_type = __m256i;
   static constexpr std::size_t elements_per_iteration = 8;
+  static constexpr OverflowMode overflow_mode = Mode;
 
   FRANKLIN_FORCE_INLINE static storage_register_type
   load(const value_type* ptr) {
     return _mm256_load_si256(reinterpret_cast<const __m256i*>(ptr));
   }
 
+  FRANKLIN_FORCE_INLINE static storage_register_type
+  loadu(const value_type* ptr) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+  }
+
   FRANKLIN_FORCE_INLINE static compute_register_type
   transform_to(storage_register_type reg) {
     return reg; // no-op for primitives
@@ -292,13 +692,13 @@ template <OpType Op> struct Int32Pipeline {
 
   FRANKLIN_FORCE_INLINE static compute_register_type
   op(compute_register_type a, compute_register_type b) {
-    if constexpr (Op == OpType::Add) {
-      return _mm256_add_epi32(a, b);
-    } else if constexpr (Op == OpType::Sub) {
-      return _mm256_sub_epi32(a, b);
-    } else if constexpr (Op == OpType::Mul) {
-      return _mm256_mullo_epi32(a, b);
-    }
+    return int32_op<Op, Mode>(a, b);
+  }
+
+  FRANKLIN_FORCE_INLINE static compute_register_type
+  op_checked(compute_register_type a, compute_register_type b,
+             compute_register_type& overflow) {
+    return int32_op_checked<Op>(a, b, overflow);
   }
 
   FRANKLIN_FORCE_INLINE static storage_register_type
@@ -310,6 +710,17 @@ template <OpType Op> struct Int32Pipeline {
                                           storage_register_type reg) {
     _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), reg);
   }
+
+  FRANKLIN_FORCE_INLINE static void storeu(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), reg);
+  }
+
+  // Non-temporal store: bypasses the cache hierarchy (requires sfence)
+  FRANKLIN_FORCE_INLINE static void stream(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), reg);
+  }
 };
 
 // Float32 pipeline - direct AVX2 operations on float
@@ -324,6 +735,11 @@ template <OpType Op> struct Float32Pipeline {
     return _mm256_load_ps(ptr);
   }
 
+  FRANKLIN_FORCE_INLINE static storage_register_type
+  loadu(const value_type* ptr) {
+    return _mm256_loadu_ps(ptr);
+  }
+
   FRANKLIN_FORCE_INLINE static compute_register_type
   transform_to(storage_register_type reg) {
     return reg; // no-op for primitives
@@ -349,10 +765,22 @@ template <OpType Op> struct Float32Pipeline {
                                           storage_register_type reg) {
     _mm256_store_ps(ptr, reg);
   }
+
+  FRANKLIN_FORCE_INLINE static void storeu(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm256_storeu_ps(ptr, reg);
+  }
+
+  // Non-temporal store: bypasses the cache hierarchy (requires sfence)
+  FRANKLIN_FORCE_INLINE static void stream(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm256_stream_ps(ptr, reg);
+  }
 };
 
-// BF16 pipeline - converts to fp32 for computation using native instructions
-template <OpType Op> struct BF16Pipeline {
+// BF16 pipeline - converts to fp32 for computation
+template <OpType Op, typename Conversion = BF16DefaultConversion>
+struct BF16Pipeline {
   using value_type = bf16;
   using storage_register_type = __m128i; // 8 bf16 values = 16 bytes
   using compute_register_type = __m256;  // 8 fp32 values = 32 bytes
@@ -363,12 +791,15 @@ template <OpType Op> struct BF16Pipeline {
     return _mm_load_si128(reinterpret_cast<const __m128i*>(ptr));
   }
 
-  // Convert 8 bf16 to 8 fp32 using native AVX-512 BF16 instruction
+  FRANKLIN_FORCE_INLINE static storage_register_type
+  loadu(const value_type* ptr) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+  }
+
+  // Convert 8 bf16 to 8 fp32
   FRANKLIN_FORCE_INLINE static compute_register_type
   transform_to(storage_register_type bf16_reg) {
-    // _mm256_cvtpbh_ps: Convert packed BF16 to packed single-precision FP
-    // Takes __m128bh (8 bf16) and returns __m256 (8 fp32)
-    return _mm256_cvtpbh_ps(reinterpret_cast<__m128bh>(bf16_reg));
+    return Conversion::widen(bf16_reg);
   }
 
   FRANKLIN_FORCE_INLINE static compute_register_type
@@ -382,28 +813,37 @@ template <OpType Op> struct BF16Pipeline {
     }
   }
 
-  // Convert 8 fp32 back to 8 bf16 using native AVX-512 BF16 instruction
-  // This provides proper rounding instead of truncation
+  // Convert 8 fp32 back to 8 bf16, rounding to nearest even
   FRANKLIN_FORCE_INLINE static storage_register_type
   transform_from(compute_register_type fp32_reg) {
-    // _mm256_cvtneps_pbh: Convert packed single-precision FP to packed BF16
-    // Takes __m256 (8 fp32) and returns __m128bh (8 bf16) with rounding
-    __m128bh result = _mm256_cvtneps_pbh(fp32_reg);
-    return reinterpret_cast<__m128i>(result);
+    return Conversion::narrow(fp32_reg);
   }
 
   FRANKLIN_FORCE_INLINE static void store(value_type* ptr,
                                           storage_register_type reg) {
     _mm_store_si128(reinterpret_cast<__m128i*>(ptr), reg);
   }
+
+  FRANKLIN_FORCE_INLINE static void storeu(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), reg);
+  }
+
+  // Non-temporal store: bypasses the cache hierarchy (requires sfence)
+  FRANKLIN_FORCE_INLINE static void stream(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(ptr), reg);
+  }
 };
 
 // Scalar broadcast helpers for each pipeline type
-template <OpType Op> struct Int32ScalarPipeline {
+template <OpType Op, OverflowMode Mode = OverflowMode::Wrap>
+struct Int32ScalarPipeline {
   using value_type = std::int32_t;
   using storage_register_type = __m256i;
   using compute_register_type = __m256i;
   static constexpr std::size_t elements_per_iteration = 8;
+  static constexpr OverflowMode overflow_mode = Mode;
 
   FRANKLIN_FORCE_INLINE static compute_register_type
   broadcast(value_type scalar) {
@@ -412,13 +852,13 @@ template <OpType Op> struct Int32ScalarPipeline {
 
   FRANKLIN_FORCE_INLINE static compute_register_type
   op(compute_register_type a, compute_register_type b) {
-    if constexpr (Op == OpType::Add) {
-      return _mm256_add_epi32(a, b);
-    } else if constexpr (Op == OpType::Sub) {
-      return _mm256_sub_epi32(a, b);
-    } else if constexpr (Op == OpType::Mul) {
-      return _mm256_mullo_epi32(a, b);
-    }
+    return int32_op<Op, Mode>(a, b);
+  }
+
+  FRANKLIN_FORCE_INLINE static compute_register_type
+  op_checked(compute_register_type a, compute_register_type b,
+             compute_register_type& overflow) {
+    return int32_op_checked<Op>(a, b, overflow);
   }
 
   FRANKLIN_FORCE_INLINE static storage_register_type
@@ -426,10 +866,26 @@ template <OpType Op> struct Int32ScalarPipeline {
     return _mm256_load_si256(reinterpret_cast<const __m256i*>(ptr));
   }
 
+  FRANKLIN_FORCE_INLINE static storage_register_type
+  loadu(const value_type* ptr) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+  }
+
   FRANKLIN_FORCE_INLINE static void store(value_type* ptr,
                                           storage_register_type reg) {
     _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), reg);
   }
+
+  FRANKLIN_FORCE_INLINE static void storeu(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), reg);
+  }
+
+  // Non-temporal store: bypasses the cache hierarchy (requires sfence)
+  FRANKLIN_FORCE_INLINE static void stream(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), reg);
+  }
 };
 
 template <OpType Op> struct Float32ScalarPipeline {
@@ -459,10 +915,26 @@ template <OpType Op> struct Float32ScalarPipeline {
     return _mm256_load_ps(ptr);
   }
 
+  FRANKLIN_FORCE_INLINE static storage_register_type
+  loadu(const value_type* ptr) {
+    return _mm256_loadu_ps(ptr);
+  }
+
   FRANKLIN_FORCE_INLINE static void store(value_type* ptr,
                                           storage_register_type reg) {
     _mm256_store_ps(ptr, reg);
   }
+
+  FRANKLIN_FORCE_INLINE static void storeu(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm256_storeu_ps(ptr, reg);
+  }
+
+  // Non-temporal store: bypasses the cache hierarchy (requires sfence)
+  FRANKLIN_FORCE_INLINE static void stream(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm256_stream_ps(ptr, reg);
+  }
 };
 
 template <OpType Op> struct BF16ScalarPipeline {
@@ -494,21 +966,106 @@ template <OpType Op> struct BF16ScalarPipeline {
     return _mm_load_si128(reinterpret_cast<const __m128i*>(ptr));
   }
 
+  FRANKLIN_FORCE_INLINE static storage_register_type
+  loadu(const value_type* ptr) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+  }
+
   FRANKLIN_FORCE_INLINE static compute_register_type
   transform_to(storage_register_type bf16_reg) {
-    return _mm256_cvtpbh_ps(reinterpret_cast<__m128bh>(bf16_reg));
+    return BF16DefaultConversion::widen(bf16_reg);
   }
 
   FRANKLIN_FORCE_INLINE static storage_register_type
   transform_from(compute_register_type fp32_reg) {
-    __m128bh result = _mm256_cvtneps_pbh(fp32_reg);
-    return reinterpret_cast<__m128i>(result);
+    return BF16DefaultConversion::narrow(fp32_reg);
   }
 
   FRANKLIN_FORCE_INLINE static void store(value_type* ptr,
                                           storage_register_type reg) {
     _mm_store_si128(reinterpret_cast<__m128i*>(ptr), reg);
   }
+
+  FRANKLIN_FORCE_INLINE static void storeu(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), reg);
+  }
+
+  // Non-temporal store: bypasses the cache hierarchy (requires sfence)
+  FRANKLIN_FORCE_INLINE static void stream(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(ptr), reg);
+  }
+};
+
+// Decimal64 pipeline - raw int64 values, 4 per register
+template <OpType Op, unsigned Scale,
+          RoundingMode Rounding = RoundingMode::HalfEven,
+          OverflowMode Mode = OverflowMode::Report>
+struct Decimal64Pipeline {
+  using value_type = std::int64_t;
+  using storage_register_type = __m256i;
+  using compute_register_type = __m256i;
+  static constexpr std::size_t elements_per_iteration = 4;
+  static constexpr OverflowMode overflow_mode = Mode;
+
+  FRANKLIN_FORCE_INLINE static storage_register_type
+  load(const value_type* ptr) {
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(ptr));
+  }
+
+  FRANKLIN_FORCE_INLINE static storage_register_type
+  loadu(const value_type* ptr) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+  }
+
+  FRANKLIN_FORCE_INLINE static compute_register_type
+  transform_to(storage_register_type reg) {
+    return reg; // no-op for primitives
+  }
+
+  FRANKLIN_FORCE_INLINE static compute_register_type
+  op(compute_register_type a, compute_register_type b) {
+    return decimal_op<Op, Scale, Rounding, Mode>(a, b);
+  }
+
+  FRANKLIN_FORCE_INLINE static compute_register_type
+  op_checked(compute_register_type a, compute_register_type b,
+             compute_register_type& overflow) {
+    return decimal_op_checked<Op, Scale, Rounding>(a, b, overflow);
+  }
+
+  FRANKLIN_FORCE_INLINE static storage_register_type
+  transform_from(compute_register_type reg) {
+    return reg; // no-op for primitives
+  }
+
+  FRANKLIN_FORCE_INLINE static void store(value_type* ptr,
+                                          storage_register_type reg) {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), reg);
+  }
+
+  FRANKLIN_FORCE_INLINE static void storeu(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), reg);
+  }
+
+  // Non-temporal store: bypasses the cache hierarchy (requires sfence)
+  FRANKLIN_FORCE_INLINE static void stream(value_type* ptr,
+                                           storage_register_type reg) {
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), reg);
+  }
+};
+
+// The scalar is a raw value at the column's scale
+template <OpType Op, unsigned Scale,
+          RoundingMode Rounding = RoundingMode::HalfEven,
+          OverflowMode Mode = OverflowMode::Report>
+struct Decimal64ScalarPipeline
+    : Decimal64Pipeline<Op, Scale, Rounding, Mode> {
+  FRANKLIN_FORCE_INLINE static __m256i broadcast(std::int64_t scalar) {
+    return _mm256_set1_epi64x(scalar);
+  }
 };
 
 // AVX2-optimized bitset AND: dst &= src
@@ -519,6 +1076,128 @@ inline void bitset_and_avx2(dynamic_bitset<BitsetPolicy>& dst,
   dst &= src;
 }
 
+// Pipelines for y = alpha * x + y: the loads, stores and conversions of the
+// Add pipeline of each type, plus a fused multiply-add
+template <typename T, OverflowMode Mode = OverflowMode::Wrap>
+struct AxpyPipeline;
+
+template <OverflowMode Mode>
+struct AxpyPipeline<std::int32_t, Mode> : Int32Pipeline<OpType::Add, Mode> {
+  FRANKLIN_FORCE_INLINE static __m256i broadcast(std::int32_t alpha) {
+    return _mm256_set1_epi32(alpha);
+  }
+
+  // alpha * x + y is computed exactly and only the final value saturates
+  // or is flagged: an out-of-range product that y brings back in range is
+  // not an overflow
+  FRANKLIN_FORCE_INLINE static __m256i fma(__m256i alpha, __m256i x,
+                                           __m256i y) {
+    if constexpr (Mode == OverflowMode::Saturate) {
+      __m256i high;
+      const __m256i r = wide_fma(alpha, x, y, high);
+      // Lanes whose high half is not the sign extension of the low half
+      const __m256i fits = _mm256_cmpeq_epi32(high, _mm256_srai_epi32(r, 31));
+      const __m256i limit = _mm256_xor_si256(
+          _mm256_set1_epi32(std::numeric_limits<std::int32_t>::max()),
+          _mm256_srai_epi32(high, 31));
+      return _mm256_blendv_epi8(limit, r, fits);
+    } else {
+      return _mm256_add_epi32(_mm256_mullo_epi32(alpha, x), y);
+    }
+  }
+
+  FRANKLIN_FORCE_INLINE static __m256i fma_checked(__m256i alpha, __m256i x,
+                                                   __m256i y,
+                                                   __m256i& overflow) {
+    __m256i high;
+    const __m256i r = wide_fma(alpha, x, y, high);
+    const __m256i fits = _mm256_cmpeq_epi32(high, _mm256_srai_epi32(r, 31));
+    overflow = _mm256_or_si256(overflow,
+                               _mm256_xor_si256(fits, _mm256_set1_epi32(-1)));
+    return r;
+  }
+
+private:
+  // 64-bit alpha * x + y of the even and odd lanes (|alpha * x| <= 2^62, so
+  // the sum cannot wrap): returns the low halves, `high` the high halves
+  FRANKLIN_FORCE_INLINE static __m256i wide_fma(__m256i alpha, __m256i x,
+                                                __m256i y, __m256i& high) {
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i even = _mm256_add_epi64(_mm256_mul_epi32(alpha, x),
+                                          _mm256_mul_epi32(y, one));
+    const __m256i odd = _mm256_add_epi64(
+        _mm256_mul_epi32(_mm256_srli_epi64(alpha, 32),
+                         _mm256_srli_epi64(x, 32)),
+        _mm256_mul_epi32(_mm256_srli_epi64(y, 32), one));
+    high = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0b10101010);
+    return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0b10101010);
+  }
+};
+
+template <> struct AxpyPipeline<float> : Float32Pipeline<OpType::Add> {
+  FRANKLIN_FORCE_INLINE static compute_register_type
+  broadcast(value_type alpha) {
+    return _mm256_set1_ps(alpha);
+  }
+
+  FRANKLIN_FORCE_INLINE static compute_register_type
+  fma(compute_register_type alpha, compute_register_type x,
+      compute_register_type y) {
+    return _mm256_fmadd_ps(alpha, x, y);
+  }
+};
+
+template <> struct AxpyPipeline<bf16> : BF16Pipeline<OpType::Add> {
+  FRANKLIN_FORCE_INLINE static compute_register_type
+  broadcast(value_type alpha) {
+    return _mm256_set1_ps(alpha.to_float());
+  }
+
+  FRANKLIN_FORCE_INLINE static compute_register_type
+  fma(compute_register_type alpha, compute_register_type x,
+      compute_register_type y) {
+    return _mm256_fmadd_ps(alpha, x, y);
+  }
+};
+
+// Column and scalar pipelines of a column policy
+template <concepts::ColumnPolicy Policy, OpType Op> struct policy_pipelines {
+  using column = std::conditional_t<
+      std::is_same_v<typename Policy::value_type, std::int32_t>,
+      Int32Pipeline<Op, overflow_mode<Policy>()>,
+      std::conditional_t<std::is_same_v<typename Policy::value_type, float>,
+                         Float32Pipeline<Op>, BF16Pipeline<Op>>>;
+  using scalar = std::conditional_t<
+      std::is_same_v<typename Policy::value_type, std::int32_t>,
+      Int32ScalarPipeline<Op, overflow_mode<Policy>()>,
+      std::conditional_t<std::is_same_v<typename Policy::value_type, float>,
+                         Float32ScalarPipeline<Op>, BF16ScalarPipeline<Op>>>;
+};
+
+template <concepts::DecimalColumnPolicy Policy, OpType Op>
+struct policy_pipelines<Policy, Op> {
+  using column = Decimal64Pipeline<Op, Policy::scale, Policy::rounding,
+                                   overflow_mode<Policy>()>;
+  using scalar = Decimal64ScalarPipeline<Op, Policy::scale, Policy::rounding,
+                                         overflow_mode<Policy>()>;
+};
+
+template <concepts::ColumnPolicy Policy, OpType Op>
+using column_pipeline_t = typename policy_pipelines<Policy, Op>::column;
+
+template <concepts::ColumnPolicy Policy, OpType Op>
+using scalar_pipeline_t = typename policy_pipelines<Policy, Op>::scalar;
+
+// Whether kernels of Pipeline collect overflowing lanes (Report and Null)
+template <typename Pipeline> constexpr bool checks_overflow() noexcept {
+  if constexpr (requires { Pipeline::overflow_mode; }) {
+    return Pipeline::overflow_mode == OverflowMode::Report ||
+           Pipeline::overflow_mode == OverflowMode::Null;
+  } else {
+    return false;
+  }
+}
+
 // Reduction operation types
 enum class ReductionOp { Sum, Product, Min, Max };
 
@@ -532,7 +1211,26 @@ extract_8bits_from_bitset(const dynamic_bitset<BitsetPolicy>& bitset,
 }
 
 FRANKLIN_FORCE_INLINE __m256i expand_8bits_to_8x32bit_mask(uint8_t bits) {
+#if defined(__AVX512VL__) && defined(__AVX512DQ__)
   return _mm256_movm_epi32(bits);
+#else
+  // Lane j tests bit j
+  const __m256i lane_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+  return _mm256_cmpeq_epi32(
+      _mm256_and_si256(_mm256_set1_epi32(bits), lane_bits), lane_bits);
+#endif
+}
+
+// The low 4 bits as a mask of 4 int64 lanes
+FRANKLIN_FORCE_INLINE __m256i expand_4bits_to_4x64bit_mask(uint8_t bits) {
+#if defined(__AVX512VL__) && defined(__AVX512DQ__)
+  return _mm256_movm_epi64(bits);
+#else
+  // Lane j tests bit j
+  const __m256i lane_bits = _mm256_setr_epi64x(1, 2, 4, 8);
+  return _mm256_cmpeq_epi64(
+      _mm256_and_si256(_mm256_set1_epi64x(bits), lane_bits), lane_bits);
+#endif
 }
 
 // Horizontal sum for Int32
@@ -726,6 +1424,176 @@ reduce_int32(const int32_t* data, const dynamic_bitset<BitsetPolicy>& mask,
   }
 }
 
+// An exact Decimal64 total as an int64, handled with Mode when it does not
+// fit
+template <OverflowMode Mode>
+inline std::int64_t narrow_decimal64_sum(__int128 total) {
+  const auto result = static_cast<std::int64_t>(total);
+  if (total == result) [[likely]] {
+    return result;
+  }
+  if constexpr (Mode == OverflowMode::Wrap) {
+    return result;
+  } else if constexpr (Mode == OverflowMode::Saturate) {
+    return total < 0 ? std::numeric_limits<std::int64_t>::min()
+                     : std::numeric_limits<std::int64_t>::max();
+  } else {
+    throw std::runtime_error("Decimal64 overflow in sum()");
+  }
+}
+
+// Exact sum of the present values of a Decimal64 column. Each lane keeps a
+// wrapping int64 sum and counts how often it wrapped, so partial sums may
+// leave the int64 range as long as the total does not; a total that does is
+// handled with Mode.
+template <OverflowMode Mode>
+inline std::int64_t sum_decimal64(const std::int64_t* data,
+                                  const dynamic_bitset<BitsetPolicy>& mask,
+                                  std::size_t num_elements) {
+  __m256i low = _mm256_setzero_si256();
+  __m256i high = _mm256_setzero_si256();
+  const __m256i one = _mm256_set1_epi64x(1);
+  std::size_t i = 0;
+  for (; i + 4 <= num_elements; i += 4) {
+    const __m256i x = _mm256_and_si256(
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(data + i)),
+        expand_4bits_to_4x64bit_mask(extract_8bits_from_bitset(mask, i)));
+    const __m256i sum = _mm256_add_epi64(low, x);
+    // A wrap goes up when x is positive and down when it is negative
+    const __m256i wrapped = negative_epi64(
+        _mm256_and_si256(_mm256_xor_si256(low, sum), _mm256_xor_si256(x, sum)));
+    high = _mm256_add_epi64(
+        high,
+        _mm256_and_si256(wrapped, _mm256_or_si256(negative_epi64(x), one)));
+    low = sum;
+  }
+
+  alignas(32) std::int64_t lows[4];
+  alignas(32) std::int64_t highs[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lows), low);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(highs), high);
+  __int128 total = 0;
+  for (int j = 0; j < 4; ++j) {
+    total += (static_cast<__int128>(highs[j]) << 64) + lows[j];
+  }
+  for (; i < num_elements; ++i) {
+    if (mask[i]) {
+      total += data[i];
+    }
+  }
+  return narrow_decimal64_sum<Mode>(total);
+}
+
+// Min or max of the present values of an int64 column (Decimal64 or
+// TimestampMicros)
+template <ReductionOp Op>
+inline std::int64_t reduce_int64(const std::int64_t* data,
+                                 const dynamic_bitset<BitsetPolicy>& mask,
+                                 std::size_t num_elements) {
+  static_assert(Op == ReductionOp::Min || Op == ReductionOp::Max);
+  constexpr std::int64_t identity =
+      Op == ReductionOp::Min ? std::numeric_limits<std::int64_t>::max()
+                             : std::numeric_limits<std::int64_t>::lowest();
+  const __m256i identity_vec = _mm256_set1_epi64x(identity);
+  __m256i accumulator = identity_vec;
+  std::size_t i = 0;
+  for (; i + 4 <= num_elements; i += 4) {
+    const __m256i x = _mm256_blendv_epi8(
+        identity_vec,
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(data + i)),
+        expand_4bits_to_4x64bit_mask(extract_8bits_from_bitset(mask, i)));
+    const __m256i take = Op == ReductionOp::Min
+                             ? _mm256_cmpgt_epi64(accumulator, x)
+                             : _mm256_cmpgt_epi64(x, accumulator);
+    accumulator = _mm256_blendv_epi8(accumulator, x, take);
+  }
+
+  alignas(32) std::int64_t lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), accumulator);
+  std::int64_t result = identity;
+  for (int j = 0; j < 4; ++j) {
+    result = Op == ReductionOp::Min ? std::min(result, lanes[j])
+                                    : std::max(result, lanes[j]);
+  }
+  for (; i < num_elements; ++i) {
+    if (mask[i]) {
+      result = Op == ReductionOp::Min ? std::min(result, data[i])
+                                      : std::max(result, data[i]);
+    }
+  }
+  return result;
+}
+
+// Count, exact total, min and max of the present values of a Decimal64
+// column in one pass, with the accumulators of sum_decimal64 and
+// reduce_int64. Loads are unaligned; the last partial vector is summed in
+// scalar code.
+struct decimal64_aggregates {
+  std::size_t count = 0;
+  __int128 total = 0;
+  std::int64_t min = std::numeric_limits<std::int64_t>::max();
+  std::int64_t max = std::numeric_limits<std::int64_t>::lowest();
+};
+
+inline decimal64_aggregates
+aggregate_decimal64(const std::int64_t* data,
+                    const dynamic_bitset<BitsetPolicy>& mask,
+                    std::size_t num_elements) {
+  decimal64_aggregates result;
+  const __m256i min_identity = _mm256_set1_epi64x(result.min);
+  const __m256i max_identity = _mm256_set1_epi64x(result.max);
+  const __m256i one = _mm256_set1_epi64x(1);
+  __m256i low = _mm256_setzero_si256();
+  __m256i high = _mm256_setzero_si256();
+  __m256i min = min_identity;
+  __m256i max = max_identity;
+  std::size_t i = 0;
+  for (; i + 4 <= num_elements; i += 4) {
+    const std::uint8_t bits = extract_8bits_from_bitset(mask, i) & 0xF;
+    const __m256i m = expand_4bits_to_4x64bit_mask(bits);
+    const __m256i raw =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    result.count += std::popcount(bits);
+
+    const __m256i x = _mm256_and_si256(raw, m);
+    const __m256i sum = _mm256_add_epi64(low, x);
+    const __m256i wrapped = negative_epi64(
+        _mm256_and_si256(_mm256_xor_si256(low, sum), _mm256_xor_si256(x, sum)));
+    high = _mm256_add_epi64(
+        high,
+        _mm256_and_si256(wrapped, _mm256_or_si256(negative_epi64(x), one)));
+    low = sum;
+
+    const __m256i lo = _mm256_blendv_epi8(min_identity, raw, m);
+    const __m256i hi = _mm256_blendv_epi8(max_identity, raw, m);
+    min = _mm256_blendv_epi8(min, lo, _mm256_cmpgt_epi64(min, lo));
+    max = _mm256_blendv_epi8(max, hi, _mm256_cmpgt_epi64(hi, max));
+  }
+
+  alignas(32) std::int64_t lows[4];
+  alignas(32) std::int64_t highs[4];
+  alignas(32) std::int64_t mins[4];
+  alignas(32) std::int64_t maxs[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lows), low);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(highs), high);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(mins), min);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(maxs), max);
+  for (int j = 0; j < 4; ++j) {
+    result.total += (static_cast<__int128>(highs[j]) << 64) + lows[j];
+    result.min = std::min(result.min, mins[j]);
+    result.max = std::max(result.max, maxs[j]);
+  }
+  for (; i < num_elements; ++i) {
+    if (mask[i]) {
+      ++result.count;
+      result.total += data[i];
+      result.min = std::min(result.min, data[i]);
+      result.max = std::max(result.max, data[i]);
+    }
+  }
+  return result;
+}
+
 // Float32 SIMD reduction
 template <ReductionOp Op>
 FRANKLIN_FORCE_INLINE float
@@ -845,7 +1713,7 @@ FRANKLIN_FORCE_INLINE bf16 reduce_bf16(const bf16* data,
         _mm_load_si128(reinterpret_cast<const __m128i*>(data + i));
 
     // Convert to FP32
-    __m256 fp32_data = _mm256_cvtpbh_ps(reinterpret_cast<__m128bh>(bf16_data));
+    __m256 fp32_data = BF16DefaultConversion::widen(bf16_data);
 
     // Get mask and blend
     std::uint8_t const mask_bits = extract_8bits_from_bitset(mask, i);
@@ -879,7 +1747,7 @@ FRANKLIN_FORCE_INLINE bf16 reduce_bf16(const bf16* data,
 
     __m128i bf16_tail =
         _mm_load_si128(reinterpret_cast<const __m128i*>(data + i));
-    __m256 fp32_tail = _mm256_cvtpbh_ps(reinterpret_cast<__m128bh>(bf16_tail));
+    __m256 fp32_tail = BF16DefaultConversion::widen(bf16_tail);
     __m256 blended_tail =
         _mm256_blendv_ps(identity_vec, fp32_tail, simd_tail_mask);
 
@@ -915,94 +1783,736 @@ FRANKLIN_FORCE_INLINE bf16 reduce_bf16(const bf16* data,
   return bf16::from_float_trunc(fp32_result);
 }
 
-// Vectorized scalar operation: column op scalar
-template <concepts::ColumnPolicy ColPolicy, typename ScalarPipeline>
-static void vectorize_scalar(column_vector<ColPolicy> const& input,
-                             typename ColPolicy::value_type scalar,
-                             column_vector<ColPolicy>& output) {
-  using value_type = typename ColPolicy::value_type;
-  // OPTIMIZATION: Use __restrict__ to tell compiler pointers don't alias
-  const value_type* __restrict input_ptr = input.data().data();
-  value_type* __restrict output_ptr = output.data().data();
-
-  std::size_t offset = 0;
-  const std::size_t step = ScalarPipeline::elements_per_iteration;
-  const std::size_t num_elements = output.data().size();
+// ============================================================================
+// Comparisons
+// ============================================================================
+
+// Comparison of a filter predicate, e.g. the `>` of `where c > 0`
+enum class CompareOp { Lt, Le, Gt, Ge, Eq, Ne };
+
+// The comparison with its operands swapped: a op b == b swapped(op) a
+constexpr CompareOp swapped(CompareOp op) noexcept {
+  switch (op) {
+  case CompareOp::Lt:
+    return CompareOp::Gt;
+  case CompareOp::Le:
+    return CompareOp::Ge;
+  case CompareOp::Gt:
+    return CompareOp::Lt;
+  case CompareOp::Ge:
+    return CompareOp::Le;
+  default:
+    return op;
+  }
+}
 
-  // Broadcast scalar to all lanes ONCE outside the loop
-  auto scalar_reg = ScalarPipeline::broadcast(scalar);
+// a op b as a lane mask. Ordered predicates except for !=, so that NaN
+// compares as in C++.
+template <CompareOp Op>
+FRANKLIN_FORCE_INLINE __m256 compare_lanes(__m256 a, __m256 b) {
+  if constexpr (Op == CompareOp::Lt) {
+    return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+  } else if constexpr (Op == CompareOp::Le) {
+    return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+  } else if constexpr (Op == CompareOp::Gt) {
+    return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+  } else if constexpr (Op == CompareOp::Ge) {
+    return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+  } else if constexpr (Op == CompareOp::Eq) {
+    return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+  } else {
+    return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ);
+  }
+}
+
+// Int32 lanes: AVX2 only has == and >, the rest are swaps and complements
+template <CompareOp Op>
+FRANKLIN_FORCE_INLINE __m256i compare_lanes(__m256i a, __m256i b) {
+  const __m256i ones = _mm256_set1_epi32(-1);
+  if constexpr (Op == CompareOp::Lt) {
+    return _mm256_cmpgt_epi32(b, a);
+  } else if constexpr (Op == CompareOp::Le) {
+    return _mm256_xor_si256(_mm256_cmpgt_epi32(a, b), ones);
+  } else if constexpr (Op == CompareOp::Gt) {
+    return _mm256_cmpgt_epi32(a, b);
+  } else if constexpr (Op == CompareOp::Ge) {
+    return _mm256_xor_si256(_mm256_cmpgt_epi32(b, a), ones);
+  } else if constexpr (Op == CompareOp::Eq) {
+    return _mm256_cmpeq_epi32(a, b);
+  } else {
+    return _mm256_xor_si256(_mm256_cmpeq_epi32(a, b), ones);
+  }
+}
 
-  // OPTIMIZATION: Manual loop unrolling (4x) for instruction-level parallelism
-  const std::size_t unroll_step = step * 4;
+// One bit per lane of a lane mask
+FRANKLIN_FORCE_INLINE std::uint8_t lane_bits(__m256 mask) {
+  return static_cast<std::uint8_t>(_mm256_movemask_ps(mask));
+}
 
-  while (offset + unroll_step <= num_elements) {
-    // Unroll 1
-    auto in1_storage = ScalarPipeline::load(input_ptr + offset);
-    typename ScalarPipeline::compute_register_type in1_compute;
-    if constexpr (std::is_same_v<value_type, bf16>) {
-      in1_compute = ScalarPipeline::transform_to(in1_storage);
-    } else {
-      in1_compute = in1_storage;
+FRANKLIN_FORCE_INLINE std::uint8_t lane_bits(__m256i mask) {
+  return lane_bits(_mm256_castsi256_ps(mask));
+}
+
+// Rows i..i+7 of a column as compared: int32 lanes, or fp32 lanes for
+// Float32 and (widened) BF16
+template <typename T> FRANKLIN_FORCE_INLINE auto compare_operand(const T* ptr) {
+  if constexpr (std::is_same_v<T, std::int32_t>) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+  } else if constexpr (std::is_same_v<T, float>) {
+    return _mm256_loadu_ps(ptr);
+  } else {
+    static_assert(std::is_same_v<T, bf16>, "Unsupported type for compare()");
+    return BF16DefaultConversion::widen(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+  }
+}
+
+// A scalar in every lane
+template <typename T> FRANKLIN_FORCE_INLINE auto compare_operand(T value) {
+  if constexpr (std::is_same_v<T, std::int32_t>) {
+    return _mm256_set1_epi32(value);
+  } else if constexpr (std::is_same_v<T, float>) {
+    return _mm256_set1_ps(value);
+  } else {
+    static_assert(std::is_same_v<T, bf16>, "Unsupported type for compare()");
+    return _mm256_set1_ps(value.to_float());
+  }
+}
+
+// lhs op rhs(i) for every vector of 8 rows of lhs, with the rows where lhs
+// is absent cleared. Each vector's movemask is stored as one byte of the
+// result, so no row is visited on its own.
+template <concepts::ColumnPolicy Policy, typename Rhs>
+dynamic_bitset<BitsetPolicy> compare_rows(CompareOp op,
+                                          const column_vector<Policy>& lhs,
+                                          Rhs&& rhs) {
+  const auto* lhs_ptr = lhs.data().data();
+  const std::size_t num_elements = lhs.data().size();
+  dynamic_bitset<BitsetPolicy> selected(lhs.present_mask().size());
+  // Blocks are allocated in whole cache lines, so there is a byte for every
+  // vector of the padded column
+  FRANKLIN_ASSERT(num_elements <= selected.blocks().size() * 64);
+  auto* bytes = reinterpret_cast<std::uint8_t*>(selected.blocks().data());
+
+  auto loop = [&]<CompareOp Op>() {
+    for (std::size_t i = 0; i + 8 <= num_elements; i += 8) {
+      bytes[i / 8] =
+          lane_bits(compare_lanes<Op>(compare_operand(lhs_ptr + i), rhs(i)));
     }
-    auto r1_compute = ScalarPipeline::op(in1_compute, scalar_reg);
+  };
+  switch (op) {
+  case CompareOp::Lt:
+    loop.template operator()<CompareOp::Lt>();
+    break;
+  case CompareOp::Le:
+    loop.template operator()<CompareOp::Le>();
+    break;
+  case CompareOp::Gt:
+    loop.template operator()<CompareOp::Gt>();
+    break;
+  case CompareOp::Ge:
+    loop.template operator()<CompareOp::Ge>();
+    break;
+  case CompareOp::Eq:
+    loop.template operator()<CompareOp::Eq>();
+    break;
+  case CompareOp::Ne:
+    loop.template operator()<CompareOp::Ne>();
+    break;
+  }
+  // Also clears the rows past the end of the column
+  selected &= lhs.present_mask();
+  return selected;
+}
 
-    // Unroll 2
-    auto in2_storage = ScalarPipeline::load(input_ptr + offset + step);
-    typename ScalarPipeline::compute_register_type in2_compute;
-    if constexpr (std::is_same_v<value_type, bf16>) {
-      in2_compute = ScalarPipeline::transform_to(in2_storage);
+// Rows where `lhs op rhs` holds and every column operand is present, e.g.
+// the selection of `where c > 0`. Int32, Float32 and BF16 columns; BF16
+// values compare in fp32. Both columns must have the same size.
+template <concepts::ColumnPolicy Policy>
+dynamic_bitset<BitsetPolicy> compare(CompareOp op,
+                                     const column_vector<Policy>& lhs,
+                                     const column_vector<Policy>& rhs) {
+  FRANKLIN_ASSERT(lhs.data().size() == rhs.data().size());
+  const auto* rhs_ptr = rhs.data().data();
+  auto selected = compare_rows(op, lhs, [rhs_ptr](std::size_t i) {
+    return compare_operand(rhs_ptr + i);
+  });
+  selected &= rhs.present_mask();
+  return selected;
+}
+
+template <concepts::ColumnPolicy Policy>
+dynamic_bitset<BitsetPolicy> compare(CompareOp op,
+                                     const column_vector<Policy>& lhs,
+                                     typename Policy::value_type rhs) {
+  const auto lanes = compare_operand(rhs);
+  return compare_rows(op, lhs, [lanes](std::size_t) { return lanes; });
+}
+
+template <concepts::ColumnPolicy Policy>
+dynamic_bitset<BitsetPolicy> compare(CompareOp op,
+                                     typename Policy::value_type lhs,
+                                     const column_vector<Policy>& rhs) {
+  return compare(swapped(op), rhs, lhs);
+}
+
+// Bits of `mask` for rows i..i+7, cleared past num_elements
+FRANKLIN_FORCE_INLINE std::uint8_t
+row_bits(const dynamic_bitset<BitsetPolicy>& mask, std::size_t i,
+         std::size_t num_elements) {
+  std::uint8_t bits = extract_8bits_from_bitset(mask, i);
+  if (num_elements - i < 8) {
+    bits &= static_cast<std::uint8_t>((1u << (num_elements - i)) - 1);
+  }
+  return bits;
+}
+
+FRANKLIN_FORCE_INLINE __m256 lane_mask(std::uint8_t bits) {
+  return _mm256_castsi256_ps(expand_8bits_to_8x32bit_mask(bits));
+}
+
+// data[i..i+8) as fp32. A partial last vector is copied out, so unpadded
+// views are not read past their end.
+template <typename T>
+FRANKLIN_FORCE_INLINE __m256 load_fp32_lanes(const T* data, std::size_t i,
+                                             std::size_t num_elements) {
+  auto load = [](const T* p) {
+    if constexpr (std::is_same_v<T, float>) {
+      return _mm256_loadu_ps(p);
     } else {
-      in2_compute = in2_storage;
+      return BF16DefaultConversion::widen(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
     }
-    auto r2_compute = ScalarPipeline::op(in2_compute, scalar_reg);
+  };
+  if (num_elements - i >= 8) {
+    return load(data + i);
+  }
+  T tail[8] = {};
+  for (std::size_t j = 0; j < num_elements - i; ++j) {
+    tail[j] = data[i + j];
+  }
+  return load(tail);
+}
 
-    // Unroll 3
-    auto in3_storage = ScalarPipeline::load(input_ptr + offset + 2 * step);
-    typename ScalarPipeline::compute_register_type in3_compute;
-    if constexpr (std::is_same_v<value_type, bf16>) {
-      in3_compute = ScalarPipeline::transform_to(in3_storage);
-    } else {
-      in3_compute = in3_storage;
+// Returns v unchanged, but the compiler can no longer see how it was
+// computed, so it cannot simplify arithmetic across this point
+FRANKLIN_FORCE_INLINE __m256 optimization_barrier(__m256 v) {
+  asm("" : "+x"(v));
+  return v;
+}
+
+// Sum of the eight lanes, in fp64
+FRANKLIN_FORCE_INLINE double horizontal_sum_ps_fp64(__m256 v) {
+  const __m256d sum =
+      _mm256_add_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(v)),
+                    _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+  alignas(32) double lanes[4];
+  _mm256_store_pd(lanes, sum);
+  return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+// Sum of the present values among data[0..num_elements) in the given mode,
+// in fp64 so that the accurate modes keep their precision until the caller
+// rounds. Missing values are zeroed with an AND, NaNs in present rows
+// propagate.
+template <SummationMode Mode, typename T>
+double sum_float_lanes(const T* data, const dynamic_bitset<BitsetPolicy>& mask,
+                       std::size_t num_elements) {
+  static_assert(Mode != SummationMode::Naive,
+                "Naive sums are reduce_float32 and reduce_bf16");
+  auto masked = [&](std::size_t i) {
+    return _mm256_and_ps(load_fp32_lanes(data, i, num_elements),
+                         lane_mask(row_bits(mask, i, num_elements)));
+  };
+
+  std::size_t i = 0;
+  if constexpr (Mode == SummationMode::Compensated) {
+    // Neumaier: the rounding error of each addition goes into c, taken from
+    // whichever operand is larger in magnitude. Once a lane's sum is inf or
+    // NaN its error is not a number (inf - inf), so c keeps its last finite
+    // value and the lane's result is just s.
+    //
+    // The opt configuration builds with -ffast-math, under which the error
+    // (large - t) + small may be reassociated to zero and comparisons with
+    // inf folded. The barriers keep t and large - t opaque, and finiteness is
+    // read from the exponent bits, so the kernel holds under any flags.
+    const __m256 abs_mask =
+        _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256i exponent = _mm256_set1_epi32(0x7f800000);
+    auto step = [&](__m256& s, __m256& c, __m256 x) {
+      const __m256 t = optimization_barrier(_mm256_add_ps(s, x));
+      const __m256 s_larger =
+          _mm256_cmp_ps(_mm256_and_ps(s, abs_mask), _mm256_and_ps(x, abs_mask),
+                        _CMP_GE_OQ);
+      const __m256 large = _mm256_blendv_ps(x, s, s_larger);
+      const __m256 small = _mm256_blendv_ps(s, x, s_larger);
+      const __m256 error = _mm256_add_ps(
+          optimization_barrier(_mm256_sub_ps(large, t)), small);
+      const __m256i t_exponent =
+          _mm256_and_si256(_mm256_castps_si256(t), exponent);
+      const __m256 non_finite =
+          _mm256_castsi256_ps(_mm256_cmpeq_epi32(t_exponent, exponent));
+      c = _mm256_add_ps(c, _mm256_andnot_ps(non_finite, error));
+      s = t;
+    };
+    __m256 s0 = _mm256_setzero_ps();
+    __m256 c0 = _mm256_setzero_ps();
+    __m256 s1 = _mm256_setzero_ps();
+    __m256 c1 = _mm256_setzero_ps();
+    for (; i + 16 <= num_elements; i += 16) {
+      step(s0, c0, masked(i));
+      step(s1, c1, masked(i + 8));
+    }
+    for (; i < num_elements; i += 8) {
+      step(s0, c0, masked(i));
+    }
+    return (horizontal_sum_ps_fp64(s0) + horizontal_sum_ps_fp64(s1)) +
+           (horizontal_sum_ps_fp64(c0) + horizontal_sum_ps_fp64(c1));
+  } else if constexpr (Mode == SummationMode::Pairwise) {
+    // Leaves of 256 values, summed naively in four accumulators, are merged
+    // like a binary counter: two partial sums of the same level combine into
+    // one of the next, so every value takes part in O(log n) additions
+    constexpr std::size_t leaf = 256;
+    __m256 partial[64];
+    std::uint8_t level[64];
+    std::size_t depth = 0;
+    while (i < num_elements) {
+      const std::size_t end = std::min(num_elements, i + leaf);
+      __m256 a0 = _mm256_setzero_ps();
+      __m256 a1 = _mm256_setzero_ps();
+      __m256 a2 = _mm256_setzero_ps();
+      __m256 a3 = _mm256_setzero_ps();
+      for (; i + 32 <= end; i += 32) {
+        a0 = _mm256_add_ps(a0, masked(i));
+        a1 = _mm256_add_ps(a1, masked(i + 8));
+        a2 = _mm256_add_ps(a2, masked(i + 16));
+        a3 = _mm256_add_ps(a3, masked(i + 24));
+      }
+      for (; i < end; i += 8) {
+        a0 = _mm256_add_ps(a0, masked(i));
+      }
+      __m256 sum = _mm256_add_ps(_mm256_add_ps(a0, a1), _mm256_add_ps(a2, a3));
+      std::uint8_t sum_level = 0;
+      while (depth > 0 && level[depth - 1] == sum_level) {
+        sum = _mm256_add_ps(partial[--depth], sum);
+        ++sum_level;
+      }
+      partial[depth] = sum;
+      level[depth++] = sum_level;
+    }
+    // Remaining partial sums, smallest first
+    __m256 sum = _mm256_setzero_ps();
+    while (depth > 0) {
+      sum = _mm256_add_ps(partial[--depth], sum);
+    }
+    return horizontal_sum_ps_fp64(sum);
+  } else {
+    __m256d d0 = _mm256_setzero_pd();
+    __m256d d1 = _mm256_setzero_pd();
+    __m256d d2 = _mm256_setzero_pd();
+    __m256d d3 = _mm256_setzero_pd();
+    auto add = [](__m256d& lo, __m256d& hi, __m256 x) {
+      lo = _mm256_add_pd(lo, _mm256_cvtps_pd(_mm256_castps256_ps128(x)));
+      hi = _mm256_add_pd(hi, _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));
+    };
+    for (; i + 16 <= num_elements; i += 16) {
+      add(d0, d1, masked(i));
+      add(d2, d3, masked(i + 8));
+    }
+    for (; i < num_elements; i += 8) {
+      add(d0, d1, masked(i));
     }
-    auto r3_compute = ScalarPipeline::op(in3_compute, scalar_reg);
+    const __m256d sum =
+        _mm256_add_pd(_mm256_add_pd(d0, d1), _mm256_add_pd(d2, d3));
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, sum);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  }
+}
 
-    // Unroll 4
-    auto in4_storage = ScalarPipeline::load(input_ptr + offset + 3 * step);
-    typename ScalarPipeline::compute_register_type in4_compute;
-    if constexpr (std::is_same_v<value_type, bf16>) {
-      in4_compute = ScalarPipeline::transform_to(in4_storage);
-    } else {
-      in4_compute = in4_storage;
+constexpr unsigned aggregate_flag(AggregateOp op) noexcept {
+  return 1u << static_cast<unsigned>(op);
+}
+
+// data[i..i+8) of an Int32 column. A partial last vector is copied out, as
+// in load_fp32_lanes().
+FRANKLIN_FORCE_INLINE __m256i load_int32_lanes(const std::int32_t* data,
+                                               std::size_t i,
+                                               std::size_t num_elements) {
+  if (num_elements - i >= 8) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+  }
+  std::int32_t tail[8] = {};
+  for (std::size_t j = 0; j < num_elements - i; ++j) {
+    tail[j] = data[i + j];
+  }
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tail));
+}
+
+// Count, sum, min and max of the present values among data[0..num_elements)
+// in one pass, plus the total behind the mean when WantMean. The first four
+// cost a few register operations per vector and are always computed;
+// aggregate() keeps the requested ones. Only the widening total is worth
+// compiling out. Each aggregate keeps its own accumulator and updates it
+// with the same operations, in the same order, as reduce_int32,
+// reduce_float32 and reduce_bf16, so the results match the single
+// reductions bit for bit. Loads are unaligned and tail-safe.
+template <bool WantMean, typename T>
+void aggregate_lanes(const T* data, const dynamic_bitset<BitsetPolicy>& mask,
+                     std::size_t num_elements, aggregate_result<T>& result) {
+  static_assert(std::is_same_v<T, std::int32_t> || std::is_same_v<T, float> ||
+                    std::is_same_v<T, bf16>,
+                "aggregate() supports Int32, Float32 and BF16 columns");
+  std::size_t count = 0;
+
+  if constexpr (std::is_same_v<T, std::int32_t>) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i min_identity =
+        _mm256_set1_epi32(std::numeric_limits<int32_t>::max());
+    const __m256i max_identity =
+        _mm256_set1_epi32(std::numeric_limits<int32_t>::lowest());
+    __m256i sum = zero;
+    __m256i min = min_identity;
+    __m256i max = max_identity;
+    // The mean sums in int64 lanes, so it is right where sum() wraps
+    __m256i wide0 = zero;
+    __m256i wide1 = zero;
+    for (std::size_t i = 0; i < num_elements; i += 8) {
+      const __m256i x = load_int32_lanes(data, i, num_elements);
+      const std::uint8_t bits = row_bits(mask, i, num_elements);
+      const __m256i m = expand_8bits_to_8x32bit_mask(bits);
+      count += std::popcount(bits);
+      sum = _mm256_add_epi32(sum, _mm256_blendv_epi8(zero, x, m));
+      min = _mm256_min_epi32(min, _mm256_blendv_epi8(min_identity, x, m));
+      max = _mm256_max_epi32(max, _mm256_blendv_epi8(max_identity, x, m));
+      if constexpr (WantMean) {
+        const __m256i v = _mm256_and_si256(x, m);
+        wide0 = _mm256_add_epi64(
+            wide0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        wide1 = _mm256_add_epi64(
+            wide1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+      }
     }
-    auto r4_compute = ScalarPipeline::op(in4_compute, scalar_reg);
+    result.sum = horizontal_sum_epi32(sum);
+    result.min = horizontal_min_epi32(min);
+    result.max = horizontal_max_epi32(max);
+    if constexpr (WantMean) {
+      alignas(32) std::int64_t lanes[4];
+      _mm256_store_si256(reinterpret_cast<__m256i*>(lanes),
+                         _mm256_add_epi64(wide0, wide1));
+      result.total = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+      if (count != 0) {
+        result.mean =
+            static_cast<double>(result.total) / static_cast<double>(count);
+      }
+    }
+  } else {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 min_identity =
+        _mm256_set1_ps(std::numeric_limits<float>::max());
+    const __m256 max_identity =
+        _mm256_set1_ps(std::numeric_limits<float>::lowest());
+    __m256 sum = zero;
+    __m256 min = min_identity;
+    __m256 max = max_identity;
+    __m256d wide0 = _mm256_setzero_pd();
+    __m256d wide1 = _mm256_setzero_pd();
+    for (std::size_t i = 0; i < num_elements; i += 8) {
+      const __m256 x = load_fp32_lanes(data, i, num_elements);
+      const std::uint8_t bits = row_bits(mask, i, num_elements);
+      const __m256 m = lane_mask(bits);
+      count += std::popcount(bits);
+      sum = _mm256_add_ps(sum, _mm256_blendv_ps(zero, x, m));
+      min = _mm256_min_ps(min, _mm256_blendv_ps(min_identity, x, m));
+      max = _mm256_max_ps(max, _mm256_blendv_ps(max_identity, x, m));
+      if constexpr (WantMean) {
+        const __m256 v = _mm256_and_ps(x, m);
+        wide0 = _mm256_add_pd(wide0,
+                              _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        wide1 = _mm256_add_pd(wide1,
+                              _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+      }
+    }
+    auto to_value = [](float v) {
+      if constexpr (std::is_same_v<T, float>) {
+        return v;
+      } else {
+        return bf16::from_float_trunc(v);
+      }
+    };
+    result.sum = to_value(horizontal_sum_ps(sum));
+    result.min = to_value(horizontal_min_ps(min));
+    result.max = to_value(horizontal_max_ps(max));
+    if constexpr (WantMean) {
+      alignas(32) double lanes[4];
+      _mm256_store_pd(lanes, _mm256_add_pd(wide0, wide1));
+      result.total = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+      if (count != 0) {
+        result.mean = result.total / static_cast<double>(count);
+      }
+    }
+  }
+  result.count = count;
+}
 
-    // Transform back and store (BF16 only)
-    typename ScalarPipeline::storage_register_type r1_storage, r2_storage,
-        r3_storage, r4_storage;
-    if constexpr (std::is_same_v<value_type, bf16>) {
-      r1_storage = ScalarPipeline::transform_from(r1_compute);
-      r2_storage = ScalarPipeline::transform_from(r2_compute);
-      r3_storage = ScalarPipeline::transform_from(r3_compute);
-      r4_storage = ScalarPipeline::transform_from(r4_compute);
-    } else {
-      r1_storage = r1_compute;
-      r2_storage = r2_compute;
-      r3_storage = r3_compute;
-      r4_storage = r4_compute;
+// Dot product of the rows present in both a and b among [0, num_elements).
+// Products are FMA'd into fp32 accumulators that are folded into fp64 every
+// 256 rows, so the rounding error grows with the block rather than the
+// column. BF16 pairs go through vdpbf16ps where the CPU has it, which
+// multiplies and sums them in fp32 without widening first.
+template <typename T>
+double dot_float_lanes(const T* a, const T* b,
+                       const dynamic_bitset<BitsetPolicy>& mask_a,
+                       const dynamic_bitset<BitsetPolicy>& mask_b,
+                       std::size_t num_elements) {
+  constexpr std::size_t block = 256;
+  double total = 0.0;
+#if defined(__AVX512BF16__) && defined(__AVX512VL__) && defined(__AVX512BW__)
+  if constexpr (std::is_same_v<T, bf16>) {
+    // Sixteen rows per step; the masked loads zero missing rows and stop at
+    // the last one, so the tail needs no copy
+    auto both = [&](std::size_t i) {
+      const auto& wa = mask_a.blocks();
+      const auto& wb = mask_b.blocks();
+      __mmask16 k = static_cast<__mmask16>((wa[i >> 6] & wb[i >> 6]) >>
+                                           (i & 63));
+      if (num_elements - i < 16) {
+        k &= static_cast<__mmask16>((1u << (num_elements - i)) - 1);
+      }
+      return k;
+    };
+    auto step = [&](__m256& acc, std::size_t i) {
+      const __mmask16 k = both(i);
+      const __m256i x = _mm256_maskz_loadu_epi16(k, a + i);
+      const __m256i y = _mm256_maskz_loadu_epi16(k, b + i);
+      acc = _mm256_dpbf16_ps(acc, (__m256bh)x, (__m256bh)y);
+    };
+    for (std::size_t i = 0; i < num_elements;) {
+      const std::size_t end = std::min(num_elements, i + block);
+      __m256 acc0 = _mm256_setzero_ps();
+      __m256 acc1 = _mm256_setzero_ps();
+      for (; i + 32 <= end; i += 32) {
+        step(acc0, i);
+        step(acc1, i + 16);
+      }
+      for (; i < end; i += 16) {
+        step(acc0, i);
+      }
+      total += horizontal_sum_ps_fp64(_mm256_add_ps(acc0, acc1));
     }
+    return total;
+  }
+#endif
+  // Both operands are masked: 0 * NaN in a missing row would still be NaN
+  auto step = [&](__m256& acc, std::size_t i) {
+    const __m256 m = lane_mask(row_bits(mask_a, i, num_elements) &
+                               row_bits(mask_b, i, num_elements));
+    acc = _mm256_fmadd_ps(
+        _mm256_and_ps(load_fp32_lanes(a, i, num_elements), m),
+        _mm256_and_ps(load_fp32_lanes(b, i, num_elements), m), acc);
+  };
+  for (std::size_t i = 0; i < num_elements;) {
+    const std::size_t end = std::min(num_elements, i + block);
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    for (; i + 16 <= end; i += 16) {
+      step(acc0, i);
+      step(acc1, i + 8);
+    }
+    for (; i < end; i += 8) {
+      step(acc0, i);
+    }
+    total += horizontal_sum_ps_fp64(_mm256_add_ps(acc0, acc1));
+  }
+  return total;
+}
 
-    ScalarPipeline::store(output_ptr + offset, r1_storage);
-    ScalarPipeline::store(output_ptr + offset + step, r2_storage);
-    ScalarPipeline::store(output_ptr + offset + 2 * step, r3_storage);
-    ScalarPipeline::store(output_ptr + offset + 3 * step, r4_storage);
+// Count, mean and sum of squared deviations from the mean (M2) of a set of
+// values
+struct float_moments {
+  double count = 0.0;
+  double mean = 0.0;
+  double m2 = 0.0;
+};
 
-    offset += unroll_step;
+// Moments of the present values among data[0..num_elements) in one pass
+// over memory. Each 256-row block is summed, then its deviations from a
+// shift near the block mean are summed and squared while the block is still
+// in L1; the shifted form keeps M2 accurate where the textbook
+// sum-of-squares formula cancels. Blocks are merged with the pairwise update
+// of Chan, Golub and LeVeque, in fp64.
+template <typename T>
+float_moments moments_float_lanes(const T* data,
+                                  const dynamic_bitset<BitsetPolicy>& mask,
+                                  std::size_t num_elements) {
+  constexpr std::size_t block = 256;
+  float_moments total;
+  for (std::size_t begin = 0; begin < num_elements; begin += block) {
+    const std::size_t end = std::min(num_elements, begin + block);
+    std::size_t count = 0;
+    __m256 s0 = _mm256_setzero_ps();
+    __m256 s1 = _mm256_setzero_ps();
+    auto add = [&](__m256& s, std::size_t i) {
+      const std::uint8_t bits = row_bits(mask, i, num_elements);
+      count += std::popcount(bits);
+      s = _mm256_add_ps(s, _mm256_and_ps(load_fp32_lanes(data, i, num_elements),
+                                         lane_mask(bits)));
+    };
+    std::size_t i = begin;
+    for (; i + 16 <= end; i += 16) {
+      add(s0, i);
+      add(s1, i + 8);
+    }
+    for (; i < end; i += 8) {
+      add(s0, i);
+    }
+    if (count == 0) {
+      continue;
+    }
+    const float shift = static_cast<float>(
+        horizontal_sum_ps_fp64(_mm256_add_ps(s0, s1)) / count);
+
+    const __m256 shift_v = _mm256_set1_ps(shift);
+    __m256 d0 = _mm256_setzero_ps();
+    __m256 d1 = _mm256_setzero_ps();
+    __m256 q0 = _mm256_setzero_ps();
+    __m256 q1 = _mm256_setzero_ps();
+    auto deviate = [&](__m256& d, __m256& q, std::size_t i) {
+      const __m256 x =
+          _mm256_sub_ps(load_fp32_lanes(data, i, num_elements), shift_v);
+      const __m256 dev =
+          _mm256_and_ps(x, lane_mask(row_bits(mask, i, num_elements)));
+      d = _mm256_add_ps(d, dev);
+      q = _mm256_fmadd_ps(dev, dev, q);
+    };
+    for (i = begin; i + 16 <= end; i += 16) {
+      deviate(d0, q0, i);
+      deviate(d1, q1, i + 8);
+    }
+    for (; i < end; i += 8) {
+      deviate(d0, q0, i);
+    }
+    const double n_b = static_cast<double>(count);
+    const double dev_sum = horizontal_sum_ps_fp64(_mm256_add_ps(d0, d1));
+    const double block_mean = shift + dev_sum / n_b;
+    const double block_m2 =
+        horizontal_sum_ps_fp64(_mm256_add_ps(q0, q1)) - dev_sum * dev_sum / n_b;
+
+    const double n_a = total.count;
+    const double n = n_a + n_b;
+    const double delta = block_mean - total.mean;
+    total.mean += delta * n_b / n;
+    total.m2 += block_m2 + delta * delta * n_a * n_b / n;
+    total.count = n;
+  }
+  return total;
+}
+
+// Aligned or unaligned load, chosen at compile time from Policy::assume_aligned
+template <typename Pipeline, bool Aligned>
+FRANKLIN_FORCE_INLINE typename Pipeline::storage_register_type
+load_vector(const typename Pipeline::value_type* ptr) {
+  if constexpr (Aligned) {
+    return Pipeline::load(ptr);
+  } else {
+    return Pipeline::loadu(ptr);
   }
+}
 
-  // Handle remaining iterations
-  while (offset + step <= num_elements) {
-    auto input_storage = ScalarPipeline::load(input_ptr + offset);
+// Store a result register, bypassing the cache when Streaming is set
+template <typename Pipeline, bool Streaming, bool Aligned = true>
+FRANKLIN_FORCE_INLINE void
+store_result(typename Pipeline::value_type* ptr,
+             typename Pipeline::storage_register_type reg) {
+  if constexpr (Streaming) {
+    Pipeline::stream(ptr, reg);
+  } else if constexpr (Aligned) {
+    Pipeline::store(ptr, reg);
+  } else {
+    Pipeline::storeu(ptr, reg);
+  }
+}
 
+// Checks that num_elements is a multiple of the policy's size granularity.
+// Past the check the compiler knows it is, so remainder handling for padded
+// columns folds away.
+template <concepts::ColumnPolicy Policy>
+FRANKLIN_FORCE_INLINE void assume_padded(std::size_t num_elements) noexcept {
+  FRANKLIN_ASSERT(num_elements % size_granularity<Policy>() == 0);
+}
+
+// Whether a kernel writing num_elements values to out_ptr should use
+// non-temporal stores: the output must be large relative to the LLC (see
+// core/kernel_tunables.hpp) and 32-byte aligned, since streaming stores fault
+// on misaligned addresses.
+template <typename T>
+FRANKLIN_FORCE_INLINE bool should_stream(const T* out_ptr,
+                                         std::size_t num_elements) noexcept {
+  return (reinterpret_cast<std::uintptr_t>(out_ptr) & 31) == 0 &&
+         use_streaming_stores(num_elements * sizeof(T));
+}
+
+// Software prefetch distance for a column policy, in elements
+template <concepts::ColumnPolicy Policy>
+FRANKLIN_FORCE_INLINE std::size_t prefetch_distance_elements() noexcept {
+  if constexpr (concepts::HasPrefetchDistance<Policy>) {
+    return Policy::prefetch_distance / sizeof(typename Policy::value_type);
+  } else {
+    return tunables().prefetch_distance_bytes /
+           sizeof(typename Policy::value_type);
+  }
+}
+
+// Prefetch every cache line of [ptr, ptr + Bytes). Prefetches never fault, so
+// running past the end of a buffer is harmless.
+template <std::size_t Bytes>
+FRANKLIN_FORCE_INLINE void prefetch_span(const void* ptr) {
+  const char* bytes = static_cast<const char*>(ptr);
+  for (std::size_t line = 0; line < Bytes; line += FRANKLIN_CACHE_LINE_SIZE) {
+    _mm_prefetch(bytes + line, _MM_HINT_T0);
+  }
+}
+
+// Invoke fn with std::integral_constant<std::size_t, factor>, mapping the
+// runtime unroll factor from tunables() onto the instantiated loop bodies.
+// Unsupported factors fall back to 4.
+template <typename Fn>
+FRANKLIN_FORCE_INLINE void with_unroll_factor(std::size_t factor, Fn&& fn) {
+  switch (factor) {
+  case 1:
+    fn(std::integral_constant<std::size_t, 1>{});
+    break;
+  case 2:
+    fn(std::integral_constant<std::size_t, 2>{});
+    break;
+  case 8:
+    fn(std::integral_constant<std::size_t, 8>{});
+    break;
+  default:
+    fn(std::integral_constant<std::size_t, 4>{});
+    break;
+  }
+}
+
+template <concepts::ColumnPolicy ColPolicy, typename ScalarPipeline,
+          std::size_t Unroll, bool Streaming>
+FRANKLIN_FORCE_INLINE void vectorize_scalar_loop(
+    const typename ScalarPipeline::value_type* __restrict input_ptr,
+    typename ScalarPipeline::compute_register_type scalar_reg,
+    typename ScalarPipeline::value_type* __restrict output_ptr,
+    std::size_t num_elements, std::size_t prefetch_elements) {
+  using value_type = typename ScalarPipeline::value_type;
+  using storage_register_type =
+      typename ScalarPipeline::storage_register_type;
+  constexpr bool aligned = ColPolicy::assume_aligned;
+  std::size_t offset = 0;
+  constexpr std::size_t step = ScalarPipeline::elements_per_iteration;
+
+  assume_padded<ColPolicy>(num_elements);
+
+  // One load->op chain for the vector at ptr
+  auto compute = [&](const value_type* ptr) {
+    auto input_storage = load_vector<ScalarPipeline, aligned>(ptr);
     typename ScalarPipeline::compute_register_type input_compute;
     if constexpr (std::is_same_v<value_type, bf16>) {
       input_compute = ScalarPipeline::transform_to(input_storage);
@@ -1012,22 +2522,269 @@ static void vectorize_scalar(column_vector<ColPolicy> const& input,
 
     auto result_compute = ScalarPipeline::op(input_compute, scalar_reg);
 
-    typename ScalarPipeline::storage_register_type result_storage;
+    // Transform back (BF16 only)
+    storage_register_type result_storage;
     if constexpr (std::is_same_v<value_type, bf16>) {
       result_storage = ScalarPipeline::transform_from(result_compute);
     } else {
       result_storage = result_compute;
     }
+    return result_storage;
+  };
+
+  // OPTIMIZATION: Manual loop unrolling (Unroll x) for instruction-level
+  // parallelism. The pack expansion emits Unroll independent chains as
+  // straight-line code, all loads ahead of the stores.
+  constexpr std::size_t unroll_step = step * Unroll;
+
+  while (offset + unroll_step <= num_elements) {
+    // OPTIMIZATION: Software prefetch of the input stream
+    if (prefetch_elements) {
+      prefetch_span<unroll_step * sizeof(value_type)>(input_ptr + offset +
+                                                      prefetch_elements);
+    }
+
+    [&]<std::size_t... U>(std::index_sequence<U...>) {
+      const storage_register_type results[] = {
+          compute(input_ptr + offset + U * step)...};
+      (store_result<ScalarPipeline, Streaming, aligned>(
+           output_ptr + offset + U * step, results[U]),
+       ...);
+    }(std::make_index_sequence<Unroll>{});
+
+    offset += unroll_step;
+  }
+
+  // Handle remaining iterations. Compiled out when padding guarantees sizes
+  // are a multiple of the unrolled step.
+  if constexpr (size_granularity<ColPolicy>() % unroll_step != 0) {
+    while (offset + step <= num_elements) {
+      store_result<ScalarPipeline, Streaming, aligned>(
+          output_ptr + offset, compute(input_ptr + offset));
+      offset += step;
+    }
+  }
+}
+
+// Straight-line kernel for fixed-size policies: N is known at compile time, so
+// there is no loop, no remainder and no tunable lookup.
+template <typename Pipeline, std::size_t N, bool Aligned, typename Compute>
+FRANKLIN_FORCE_INLINE void
+vectorize_fixed(typename Pipeline::value_type* __restrict out_ptr,
+                Compute&& compute) {
+  constexpr std::size_t step = Pipeline::elements_per_iteration;
+  static_assert(N % step == 0, "fixed size must be a whole number of vectors");
+
+  [&]<std::size_t... U>(std::index_sequence<U...>) {
+    const typename Pipeline::storage_register_type results[] = {
+        compute(U * step)...};
+    (store_result<Pipeline, false, Aligned>(out_ptr + U * step, results[U]),
+     ...);
+  }(std::make_index_sequence<N / step>{});
+}
 
-    ScalarPipeline::store(output_ptr + offset, result_storage);
+// Kernel of the Report and Null overflow modes: out[offset, offset + step) =
+// compute(offset, overflow) for every vector, four at a time, all loaded
+// before any is stored, so compute may read out. compute returns the wrapped
+// result and sets the sign bit of its overflowing lanes in overflow. `mask`
+// holds the validity of the result on entry. Null clears the rows that
+// overflowed; Report ORs the overflowing present lanes into one register and
+// throws after the loop, leaving out with the wrapped results. Lanes are
+// 8 int32 or 4 int64 wide.
+template <concepts::ColumnPolicy ColPolicy, typename Pipeline,
+          typename Compute>
+FRANKLIN_FORCE_INLINE void
+vectorize_checked(typename Pipeline::value_type* out_ptr,
+                  std::size_t num_elements,
+                  dynamic_bitset<BitsetPolicy>& mask, Compute&& compute) {
+  static_assert(checks_overflow<Pipeline>());
+  constexpr bool aligned = ColPolicy::assume_aligned;
+  constexpr std::size_t step = Pipeline::elements_per_iteration;
+  constexpr std::size_t unroll_step = step * 4;
+  constexpr bool wide_lanes = step == 4;
+  assume_padded<ColPolicy>(num_elements);
+
+  __m256i flags = _mm256_setzero_si256();
+  auto check = [&](std::size_t offset, __m256i overflow) {
+    if constexpr (Pipeline::overflow_mode == OverflowMode::Report) {
+      const std::uint8_t present = extract_8bits_from_bitset(mask, offset);
+      flags = _mm256_or_si256(
+          flags, _mm256_and_si256(
+                     overflow, wide_lanes
+                                   ? expand_4bits_to_4x64bit_mask(present)
+                                   : expand_8bits_to_8x32bit_mask(present)));
+    } else {
+      const unsigned bits =
+          wide_lanes ? _mm256_movemask_pd(_mm256_castsi256_pd(overflow))
+                     : _mm256_movemask_ps(_mm256_castsi256_ps(overflow));
+      if (bits != 0) [[unlikely]] {
+        mask.blocks()[offset >> 6] &= ~(std::uint64_t{bits} << (offset & 63));
+      }
+    }
+  };
 
-    offset += step;
+  std::size_t offset = 0;
+  for (; offset + unroll_step <= num_elements; offset += unroll_step) {
+    [&]<std::size_t... U>(std::index_sequence<U...>) {
+      __m256i overflow[] = {((void)U, _mm256_setzero_si256())...};
+      const __m256i results[] = {compute(offset + U * step, overflow[U])...};
+      (store_result<Pipeline, false, aligned>(out_ptr + offset + U * step,
+                                              results[U]),
+       ...);
+      (check(offset + U * step, overflow[U]), ...);
+    }(std::make_index_sequence<4>{});
+  }
+  if constexpr (size_granularity<ColPolicy>() % unroll_step != 0) {
+    for (; offset + step <= num_elements; offset += step) {
+      __m256i overflow = _mm256_setzero_si256();
+      store_result<Pipeline, false, aligned>(out_ptr + offset,
+                                             compute(offset, overflow));
+      check(offset, overflow);
+    }
+  }
+
+  if constexpr (Pipeline::overflow_mode == OverflowMode::Report) {
+    // Only the sign bit of each lane is meaningful
+    const bool overflowed =
+        wide_lanes ? !_mm256_testz_pd(_mm256_castsi256_pd(flags),
+                                      _mm256_castsi256_pd(flags))
+                   : !_mm256_testz_ps(_mm256_castsi256_ps(flags),
+                                      _mm256_castsi256_ps(flags));
+    if (overflowed) {
+      throw std::runtime_error(wide_lanes
+                                   ? "Decimal64 overflow in column arithmetic"
+                                   : "Int32 overflow in column arithmetic");
+    }
+  }
+}
+
+// Vectorized scalar operation: column op scalar
+template <concepts::ColumnPolicy ColPolicy, typename ScalarPipeline>
+static void vectorize_scalar(column_vector<ColPolicy> const& input,
+                             typename ColPolicy::value_type scalar,
+                             column_vector<ColPolicy>& output) {
+  using value_type = typename ColPolicy::value_type;
+  // OPTIMIZATION: Use __restrict__ to tell compiler pointers don't alias
+  const value_type* __restrict input_ptr = input.data().data();
+  value_type* __restrict output_ptr = output.data().data();
+  const std::size_t num_elements = output.data().size();
+
+  // Broadcast scalar to all lanes ONCE outside the loop
+  auto scalar_reg = ScalarPipeline::broadcast(scalar);
+
+  if constexpr (checks_overflow<ScalarPipeline>()) {
+    output.present_mask() = input.present_mask();
+    vectorize_checked<ColPolicy, ScalarPipeline>(
+        output_ptr, num_elements, output.present_mask(),
+        [&](std::size_t offset, __m256i& overflow) {
+          return ScalarPipeline::op_checked(
+              load_vector<ScalarPipeline, ColPolicy::assume_aligned>(
+                  input_ptr + offset),
+              scalar_reg, overflow);
+        });
+    return;
+  } else if constexpr (concepts::HasFixedSize<ColPolicy>) {
+    constexpr std::size_t n = padded_size<ColPolicy>(ColPolicy::fixed_size);
+    FRANKLIN_DEBUG_ASSERT(num_elements == n);
+    vectorize_fixed<ScalarPipeline, n, ColPolicy::assume_aligned>(
+        output_ptr, [&](std::size_t offset) {
+          auto reg = load_vector<ScalarPipeline, ColPolicy::assume_aligned>(
+              input_ptr + offset);
+          if constexpr (std::is_same_v<value_type, bf16>) {
+            return ScalarPipeline::transform_from(ScalarPipeline::op(
+                ScalarPipeline::transform_to(reg), scalar_reg));
+          } else {
+            return ScalarPipeline::op(reg, scalar_reg);
+          }
+        });
+  } else {
+    // Large outputs bypass the cache; sfence orders the weakly-ordered
+    // streaming stores before any later loads of the output.
+    const std::size_t prefetch = prefetch_distance_elements<ColPolicy>();
+    const bool streaming = should_stream(output_ptr, num_elements);
+    with_unroll_factor(tunables().unroll_factor, [&](auto unroll) {
+      constexpr std::size_t factor = decltype(unroll)::value;
+      if (streaming) {
+        vectorize_scalar_loop<ColPolicy, ScalarPipeline, factor, true>(
+            input_ptr, scalar_reg, output_ptr, num_elements, prefetch);
+        _mm_sfence();
+      } else {
+        vectorize_scalar_loop<ColPolicy, ScalarPipeline, factor, false>(
+            input_ptr, scalar_reg, output_ptr, num_elements, prefetch);
+      }
+    });
   }
 
   // Copy bitmask ONCE after the loop (scalar is always "present")
   output.present_mask() = input.present_mask();
 }
 
+template <concepts::ColumnPolicy ColPolicy, concepts::PipelinePolicy Pipeline,
+          std::size_t Unroll, bool Streaming>
+FRANKLIN_FORCE_INLINE void
+vectorize_loop(const typename Pipeline::value_type* __restrict fst_ptr,
+               const typename Pipeline::value_type* __restrict snd_ptr,
+               typename Pipeline::value_type* __restrict out_ptr,
+               std::size_t num_elements, std::size_t prefetch_elements) {
+  using value_type = typename Pipeline::value_type;
+  using storage_register_type = typename Pipeline::storage_register_type;
+  constexpr bool aligned = ColPolicy::assume_aligned;
+  std::size_t offset = 0;
+  constexpr std::size_t step = Pipeline::elements_per_iteration;
+
+  assume_padded<ColPolicy>(num_elements);
+
+  // One load->compute chain for elements [at, at+step)
+  auto compute = [&](std::size_t at) {
+    auto a_storage = load_vector<Pipeline, aligned>(fst_ptr + at);
+    auto b_storage = load_vector<Pipeline, aligned>(snd_ptr + at);
+    auto a_compute = Pipeline::transform_to(a_storage);
+    auto b_compute = Pipeline::transform_to(b_storage);
+    auto result_compute = Pipeline::op(a_compute, b_compute);
+    return Pipeline::transform_from(result_compute);
+  };
+
+  // OPTIMIZATION: Manual loop unrolling (Unroll x) for instruction-level
+  // parallelism. This creates Unroll independent load->compute->store chains
+  // that can execute in parallel on modern out-of-order CPUs, reducing
+  // critical path latency. The best factor depends on the number of load
+  // ports and the register file, so it is a tunable rather than a constant.
+  constexpr std::size_t unroll_step = step * Unroll;
+
+  while (offset + unroll_step <= num_elements) {
+    // OPTIMIZATION: Software prefetch of both input streams. With two inputs
+    // and an output in flight the hardware prefetcher can fall behind; the
+    // branch is loop-invariant and predicts perfectly.
+    if (prefetch_elements) {
+      prefetch_span<unroll_step * sizeof(value_type)>(fst_ptr + offset +
+                                                      prefetch_elements);
+      prefetch_span<unroll_step * sizeof(value_type)>(snd_ptr + offset +
+                                                      prefetch_elements);
+    }
+
+    // Compute all chains, then store all results (can pipeline with loads
+    // from next iteration)
+    [&]<std::size_t... U>(std::index_sequence<U...>) {
+      const storage_register_type results[] = {compute(offset + U * step)...};
+      (store_result<Pipeline, Streaming, aligned>(out_ptr + offset + U * step,
+                                                  results[U]),
+       ...);
+    }(std::make_index_sequence<Unroll>{});
+
+    offset += unroll_step;
+  }
+
+  // Handle remaining iterations with single-iteration loop. Compiled out when
+  // padding guarantees sizes are a multiple of the unrolled step.
+  if constexpr (size_granularity<ColPolicy>() % unroll_step != 0) {
+    while (offset + step <= num_elements) {
+      store_result<Pipeline, Streaming, aligned>(out_ptr + offset,
+                                                 compute(offset));
+      offset += step;
+    }
+  }
+}
+
 template <concepts::ColumnPolicy ColPolicy, concepts::PipelinePolicy Pipeline>
 static void vectorize(column_vector<ColPolicy> const& fst,
                       column_vector<ColPolicy> const& snd,
@@ -1039,68 +2796,50 @@ static void vectorize(column_vector<ColPolicy> const& fst,
   const value_type* __restrict fst_ptr = fst.data().data();
   const value_type* __restrict snd_ptr = snd.data().data();
   value_type* __restrict out_ptr = out.data().data();
-
-  std::size_t offset = 0;
-  const std::size_t step = Pipeline::elements_per_iteration;
   const std::size_t num_elements = out.data().size();
 
-  // OPTIMIZATION: Manual loop unrolling (4x) for instruction-level parallelism
-  // This creates 4 independent load->compute->store chains that can execute
-  // in parallel on modern out-of-order CPUs, reducing critical path latency
-  const std::size_t unroll_step = step * 4;
-
-  while (offset + unroll_step <= num_elements) {
-    // Unroll 1: Process elements [offset, offset+step)
-    auto a1_storage = Pipeline::load(fst_ptr + offset);
-    auto b1_storage = Pipeline::load(snd_ptr + offset);
-    auto a1_compute = Pipeline::transform_to(a1_storage);
-    auto b1_compute = Pipeline::transform_to(b1_storage);
-    auto r1_compute = Pipeline::op(a1_compute, b1_compute);
-    auto r1_storage = Pipeline::transform_from(r1_compute);
-
-    // Unroll 2: Process elements [offset+step, offset+2*step)
-    auto a2_storage = Pipeline::load(fst_ptr + offset + step);
-    auto b2_storage = Pipeline::load(snd_ptr + offset + step);
-    auto a2_compute = Pipeline::transform_to(a2_storage);
-    auto b2_compute = Pipeline::transform_to(b2_storage);
-    auto r2_compute = Pipeline::op(a2_compute, b2_compute);
-    auto r2_storage = Pipeline::transform_from(r2_compute);
-
-    // Unroll 3: Process elements [offset+2*step, offset+3*step)
-    auto a3_storage = Pipeline::load(fst_ptr + offset + 2 * step);
-    auto b3_storage = Pipeline::load(snd_ptr + offset + 2 * step);
-    auto a3_compute = Pipeline::transform_to(a3_storage);
-    auto b3_compute = Pipeline::transform_to(b3_storage);
-    auto r3_compute = Pipeline::op(a3_compute, b3_compute);
-    auto r3_storage = Pipeline::transform_from(r3_compute);
-
-    // Unroll 4: Process elements [offset+3*step, offset+4*step)
-    auto a4_storage = Pipeline::load(fst_ptr + offset + 3 * step);
-    auto b4_storage = Pipeline::load(snd_ptr + offset + 3 * step);
-    auto a4_compute = Pipeline::transform_to(a4_storage);
-    auto b4_compute = Pipeline::transform_to(b4_storage);
-    auto r4_compute = Pipeline::op(a4_compute, b4_compute);
-    auto r4_storage = Pipeline::transform_from(r4_compute);
-
-    // Store all results (can pipeline with loads from next iteration)
-    Pipeline::store(out_ptr + offset, r1_storage);
-    Pipeline::store(out_ptr + offset + step, r2_storage);
-    Pipeline::store(out_ptr + offset + 2 * step, r3_storage);
-    Pipeline::store(out_ptr + offset + 3 * step, r4_storage);
-
-    offset += unroll_step;
-  }
-
-  // Handle remaining iterations with single-iteration loop
-  while (offset + step <= num_elements) {
-    auto a_storage = Pipeline::load(fst_ptr + offset);
-    auto b_storage = Pipeline::load(snd_ptr + offset);
-    auto a_compute = Pipeline::transform_to(a_storage);
-    auto b_compute = Pipeline::transform_to(b_storage);
-    auto result_compute = Pipeline::op(a_compute, b_compute);
-    auto result_storage = Pipeline::transform_from(result_compute);
-    Pipeline::store(out_ptr + offset, result_storage);
-    offset += step;
+  if constexpr (checks_overflow<Pipeline>()) {
+    out.present_mask() = fst.present_mask();
+    bitset_and_avx2(out.present_mask(), snd.present_mask());
+    vectorize_checked<ColPolicy, Pipeline>(
+        out_ptr, num_elements, out.present_mask(),
+        [&](std::size_t offset, __m256i& overflow) {
+          constexpr bool aligned = ColPolicy::assume_aligned;
+          return Pipeline::op_checked(
+              load_vector<Pipeline, aligned>(fst_ptr + offset),
+              load_vector<Pipeline, aligned>(snd_ptr + offset), overflow);
+        });
+    return;
+  } else if constexpr (concepts::HasFixedSize<ColPolicy>) {
+    constexpr std::size_t n = padded_size<ColPolicy>(ColPolicy::fixed_size);
+    FRANKLIN_DEBUG_ASSERT(num_elements == n);
+    vectorize_fixed<Pipeline, n, ColPolicy::assume_aligned>(
+        out_ptr, [&](std::size_t offset) {
+          auto a = load_vector<Pipeline, ColPolicy::assume_aligned>(fst_ptr +
+                                                                    offset);
+          auto b = load_vector<Pipeline, ColPolicy::assume_aligned>(snd_ptr +
+                                                                    offset);
+          return Pipeline::transform_from(Pipeline::op(
+              Pipeline::transform_to(a), Pipeline::transform_to(b)));
+        });
+  } else {
+    // OPTIMIZATION: Outputs that would not survive in the LLC are written
+    // with non-temporal stores, avoiding the read-for-ownership of every
+    // output line and the eviction of the inputs. sfence orders the
+    // weakly-ordered streaming stores before any later loads of the output.
+    const std::size_t prefetch = prefetch_distance_elements<ColPolicy>();
+    const bool streaming = should_stream(out_ptr, num_elements);
+    with_unroll_factor(tunables().unroll_factor, [&](auto unroll) {
+      constexpr std::size_t factor = decltype(unroll)::value;
+      if (streaming) {
+        vectorize_loop<ColPolicy, Pipeline, factor, true>(
+            fst_ptr, snd_ptr, out_ptr, num_elements, prefetch);
+        _mm_sfence();
+      } else {
+        vectorize_loop<ColPolicy, Pipeline, factor, false>(
+            fst_ptr, snd_ptr, out_ptr, num_elements, prefetch);
+      }
+    });
   }
 
   // Compute bitmask intersection ONCE after the loop using AVX2-optimized
@@ -1112,76 +2851,104 @@ static void vectorize(column_vector<ColPolicy> const& fst,
   // The present_mask_ handles validity of elements within the padded buffer.
 }
 
+template <concepts::ColumnPolicy ColPolicy, concepts::PipelinePolicy Pipeline,
+          std::size_t Unroll, bool Streaming>
+FRANKLIN_FORCE_INLINE void vectorize_destructive_loop(
+    typename Pipeline::value_type* __restrict mut_ptr,
+    const typename Pipeline::value_type* __restrict snd_ptr,
+    std::size_t num_elements, std::size_t prefetch_elements) {
+  using value_type = typename Pipeline::value_type;
+  using storage_register_type = typename Pipeline::storage_register_type;
+  constexpr bool aligned = ColPolicy::assume_aligned;
+  std::size_t offset = 0;
+  constexpr std::size_t step = Pipeline::elements_per_iteration;
+
+  assume_padded<ColPolicy>(num_elements);
+
+  auto compute = [&](std::size_t at) {
+    auto a_storage = load_vector<Pipeline, aligned>(mut_ptr + at);
+    auto b_storage = load_vector<Pipeline, aligned>(snd_ptr + at);
+    auto a_compute = Pipeline::transform_to(a_storage);
+    auto b_compute = Pipeline::transform_to(b_storage);
+    auto result_compute = Pipeline::op(a_compute, b_compute);
+    return Pipeline::transform_from(result_compute);
+  };
+
+  // OPTIMIZATION: Manual loop unrolling (Unroll x), as in vectorize_loop().
+  // Every chain of an iteration is loaded before any is stored.
+  constexpr std::size_t unroll_step = step * Unroll;
+
+  while (offset + unroll_step <= num_elements) {
+    // OPTIMIZATION: Software prefetch of both input streams
+    if (prefetch_elements) {
+      prefetch_span<unroll_step * sizeof(value_type)>(mut_ptr + offset +
+                                                      prefetch_elements);
+      prefetch_span<unroll_step * sizeof(value_type)>(snd_ptr + offset +
+                                                      prefetch_elements);
+    }
+
+    [&]<std::size_t... U>(std::index_sequence<U...>) {
+      const storage_register_type results[] = {compute(offset + U * step)...};
+      (store_result<Pipeline, Streaming, aligned>(mut_ptr + offset + U * step,
+                                                  results[U]),
+       ...);
+    }(std::make_index_sequence<Unroll>{});
+
+    offset += unroll_step;
+  }
+
+  // Handle remaining iterations. Compiled out when padding guarantees sizes
+  // are a multiple of the unrolled step.
+  if constexpr (size_granularity<ColPolicy>() % unroll_step != 0) {
+    while (offset + step <= num_elements) {
+      store_result<Pipeline, Streaming, aligned>(mut_ptr + offset,
+                                                 compute(offset));
+      offset += step;
+    }
+  }
+}
+
 template <concepts::ColumnPolicy ColPolicy, concepts::PipelinePolicy Pipeline>
 static void vectorize_destructive(column_vector<ColPolicy>& mut,
                                   column_vector<ColPolicy> const& snd) {
 
   using value_type = typename ColPolicy::value_type;
+  constexpr bool aligned = ColPolicy::assume_aligned;
   // OPTIMIZATION: Use __restrict__ for non-aliasing pointers
   value_type* __restrict mut_ptr = mut.data().data();
   const value_type* __restrict snd_ptr = snd.data().data();
 
-  std::size_t offset = 0;
-  const std::size_t step = Pipeline::elements_per_iteration;
   const std::size_t num_elements =
       std::min(mut.data().size(), snd.data().size());
-
-  // OPTIMIZATION: Manual loop unrolling (4x)
-  const std::size_t unroll_step = step * 4;
-
-  while (offset + unroll_step <= num_elements) {
-    // Unroll 1
-    auto a1_storage = Pipeline::load(mut_ptr + offset);
-    auto b1_storage = Pipeline::load(snd_ptr + offset);
-    auto a1_compute = Pipeline::transform_to(a1_storage);
-    auto b1_compute = Pipeline::transform_to(b1_storage);
-    auto r1_compute = Pipeline::op(a1_compute, b1_compute);
-    auto r1_storage = Pipeline::transform_from(r1_compute);
-
-    // Unroll 2
-    auto a2_storage = Pipeline::load(mut_ptr + offset + step);
-    auto b2_storage = Pipeline::load(snd_ptr + offset + step);
-    auto a2_compute = Pipeline::transform_to(a2_storage);
-    auto b2_compute = Pipeline::transform_to(b2_storage);
-    auto r2_compute = Pipeline::op(a2_compute, b2_compute);
-    auto r2_storage = Pipeline::transform_from(r2_compute);
-
-    // Unroll 3
-    auto a3_storage = Pipeline::load(mut_ptr + offset + 2 * step);
-    auto b3_storage = Pipeline::load(snd_ptr + offset + 2 * step);
-    auto a3_compute = Pipeline::transform_to(a3_storage);
-    auto b3_compute = Pipeline::transform_to(b3_storage);
-    auto r3_compute = Pipeline::op(a3_compute, b3_compute);
-    auto r3_storage = Pipeline::transform_from(r3_compute);
-
-    // Unroll 4
-    auto a4_storage = Pipeline::load(mut_ptr + offset + 3 * step);
-    auto b4_storage = Pipeline::load(snd_ptr + offset + 3 * step);
-    auto a4_compute = Pipeline::transform_to(a4_storage);
-    auto b4_compute = Pipeline::transform_to(b4_storage);
-    auto r4_compute = Pipeline::op(a4_compute, b4_compute);
-    auto r4_storage = Pipeline::transform_from(r4_compute);
-
-    // Store all results
-    Pipeline::store(mut_ptr + offset, r1_storage);
-    Pipeline::store(mut_ptr + offset + step, r2_storage);
-    Pipeline::store(mut_ptr + offset + 2 * step, r3_storage);
-    Pipeline::store(mut_ptr + offset + 3 * step, r4_storage);
-
-    offset += unroll_step;
-  }
-
-  // Handle remaining iterations
-  while (offset + step <= num_elements) {
-    auto a_storage = Pipeline::load(mut_ptr + offset);
-    auto b_storage = Pipeline::load(snd_ptr + offset);
-    auto a_compute = Pipeline::transform_to(a_storage);
-    auto b_compute = Pipeline::transform_to(b_storage);
-    auto result_compute = Pipeline::op(a_compute, b_compute);
-    auto result_storage = Pipeline::transform_from(result_compute);
-    Pipeline::store(mut_ptr + offset, result_storage);
-    offset += step;
-  }
+  assume_padded<ColPolicy>(num_elements);
+
+  if constexpr (checks_overflow<Pipeline>()) {
+    bitset_and_avx2(mut.present_mask(), snd.present_mask());
+    vectorize_checked<ColPolicy, Pipeline>(
+        mut_ptr, num_elements, mut.present_mask(),
+        [&](std::size_t offset, __m256i& overflow) {
+          return Pipeline::op_checked(
+              load_vector<Pipeline, aligned>(mut_ptr + offset),
+              load_vector<Pipeline, aligned>(snd_ptr + offset), overflow);
+        });
+    return;
+  }
+
+  // Large outputs are streamed and the unroll factor is tuned, as in
+  // vectorize()
+  const std::size_t prefetch = prefetch_distance_elements<ColPolicy>();
+  const bool streaming = should_stream(mut_ptr, num_elements);
+  with_unroll_factor(tunables().unroll_factor, [&](auto unroll) {
+    constexpr std::size_t factor = decltype(unroll)::value;
+    if (streaming) {
+      vectorize_destructive_loop<ColPolicy, Pipeline, factor, true>(
+          mut_ptr, snd_ptr, num_elements, prefetch);
+      _mm_sfence();
+    } else {
+      vectorize_destructive_loop<ColPolicy, Pipeline, factor, false>(
+          mut_ptr, snd_ptr, num_elements, prefetch);
+    }
+  });
 
   // Compute bitmask intersection ONCE after the loop using AVX2-optimized
   // bitset AND
@@ -1191,17 +2958,226 @@ static void vectorize_destructive(column_vector<ColPolicy>& mut,
   // The present_mask_ handles validity of elements within the padded buffer.
 }
 
+// In-place loop: out[offset, offset + step) = compute(offset) for every
+// vector, tunables().unroll_factor at a time. compute may read out at the
+// same offsets, so out is not __restrict; all vectors of an iteration are
+// loaded before any is stored. Large outputs are streamed as in vectorize().
+template <concepts::ColumnPolicy ColPolicy, typename Pipeline, typename Compute>
+FRANKLIN_FORCE_INLINE void
+vectorize_in_place(typename Pipeline::value_type* out_ptr,
+                   std::size_t num_elements, Compute&& compute) {
+  constexpr bool aligned = ColPolicy::assume_aligned;
+  constexpr std::size_t step = Pipeline::elements_per_iteration;
+  assume_padded<ColPolicy>(num_elements);
+
+  auto loop = [&]<std::size_t Unroll, bool Streaming>() {
+    constexpr std::size_t unroll_step = step * Unroll;
+    std::size_t offset = 0;
+    for (; offset + unroll_step <= num_elements; offset += unroll_step) {
+      [&]<std::size_t... U>(std::index_sequence<U...>) {
+        const typename Pipeline::storage_register_type results[] = {
+            compute(offset + U * step)...};
+        (store_result<Pipeline, Streaming, aligned>(
+             out_ptr + offset + U * step, results[U]),
+         ...);
+      }(std::make_index_sequence<Unroll>{});
+    }
+    if constexpr (size_granularity<ColPolicy>() % unroll_step != 0) {
+      for (; offset + step <= num_elements; offset += step) {
+        store_result<Pipeline, Streaming, aligned>(out_ptr + offset,
+                                                   compute(offset));
+      }
+    }
+  };
+  const bool streaming = should_stream(out_ptr, num_elements);
+  with_unroll_factor(tunables().unroll_factor, [&](auto unroll) {
+    constexpr std::size_t factor = decltype(unroll)::value;
+    if (streaming) {
+      loop.template operator()<factor, true>();
+      _mm_sfence();
+    } else {
+      loop.template operator()<factor, false>();
+    }
+  });
+}
+
+// mut = mut op snd. Columns own their buffers, so the operands either are
+// the same column or do not overlap at all; the first case cannot go
+// through the __restrict pointers of vectorize_destructive, and computes
+// op(x, x) from a single load instead.
+template <concepts::ColumnPolicy ColPolicy, OpType Op>
+static void compound_assign(column_vector<ColPolicy>& mut,
+                            column_vector<ColPolicy> const& snd) {
+  using Pipeline = column_pipeline_t<ColPolicy, Op>;
+  FRANKLIN_ASSERT(mut.present_mask().size() == snd.present_mask().size());
+  auto* mut_ptr = mut.data().data();
+  if (mut_ptr != snd.data().data()) {
+    vectorize_destructive<ColPolicy, Pipeline>(mut, snd);
+    return;
+  }
+  if constexpr (checks_overflow<Pipeline>()) {
+    vectorize_checked<ColPolicy, Pipeline>(
+        mut_ptr, mut.data().size(), mut.present_mask(),
+        [&](std::size_t offset, __m256i& overflow) {
+          const auto x = load_vector<Pipeline, ColPolicy::assume_aligned>(
+              mut_ptr + offset);
+          return Pipeline::op_checked(x, x, overflow);
+        });
+    return;
+  }
+  vectorize_in_place<ColPolicy, Pipeline>(
+      mut_ptr, mut.data().size(), [&](std::size_t offset) {
+        const auto x = Pipeline::transform_to(
+            load_vector<Pipeline, ColPolicy::assume_aligned>(mut_ptr +
+                                                             offset));
+        return Pipeline::transform_from(Pipeline::op(x, x));
+      });
+}
+
+// mut = mut op scalar; the present mask is unchanged
+template <concepts::ColumnPolicy ColPolicy, OpType Op>
+static void compound_assign(column_vector<ColPolicy>& mut,
+                            typename ColPolicy::value_type scalar) {
+  using value_type = typename ColPolicy::value_type;
+  using ScalarPipeline = scalar_pipeline_t<ColPolicy, Op>;
+  auto* mut_ptr = mut.data().data();
+  const auto scalar_reg = ScalarPipeline::broadcast(scalar);
+  if constexpr (checks_overflow<ScalarPipeline>()) {
+    vectorize_checked<ColPolicy, ScalarPipeline>(
+        mut_ptr, mut.data().size(), mut.present_mask(),
+        [&](std::size_t offset, __m256i& overflow) {
+          return ScalarPipeline::op_checked(
+              load_vector<ScalarPipeline, ColPolicy::assume_aligned>(
+                  mut_ptr + offset),
+              scalar_reg, overflow);
+        });
+    return;
+  }
+  vectorize_in_place<ColPolicy, ScalarPipeline>(
+      mut_ptr, mut.data().size(), [&](std::size_t offset) {
+        const auto reg =
+            load_vector<ScalarPipeline, ColPolicy::assume_aligned>(mut_ptr +
+                                                                   offset);
+        if constexpr (std::is_same_v<value_type, bf16>) {
+          return ScalarPipeline::transform_from(ScalarPipeline::op(
+              ScalarPipeline::transform_to(reg), scalar_reg));
+        } else {
+          return ScalarPipeline::op(reg, scalar_reg);
+        }
+      });
+}
+
+// dest = a op b, written into dest's buffer, which is resized to the padded
+// length of the operands and only reallocated when it lacks the capacity.
+// Loops that evaluate into the same column every step allocate nothing after
+// the first. dest may be a or b.
+template <OpType Op, concepts::ArithmeticColumnPolicy Policy>
+void eval_into(column_vector<Policy>& dest, column_vector<Policy> const& a,
+               column_vector<Policy> const& b) {
+  using Pipeline = column_pipeline_t<Policy, Op>;
+  constexpr bool aligned = Policy::assume_aligned;
+  FRANKLIN_ASSERT(a.present_mask().size() == b.present_mask().size());
+  // Sized the same way whether or not dest is an operand. Growing keeps the
+  // values of an operand that dest aliases.
+  dest.data().resize(
+      padded_size<Policy>(std::min(a.data().size(), b.data().size())));
+  if (&dest == &a) {
+    compound_assign<Policy, Op>(dest, b);
+    return;
+  }
+  if (&dest == &b) {
+    // dest = a op dest: every vector is read before it is overwritten
+    auto* out_ptr = dest.data().data();
+    const auto* a_ptr = a.data().data();
+    const std::size_t n = dest.data().size();
+    bitset_and_avx2(dest.present_mask(), a.present_mask());
+    if constexpr (checks_overflow<Pipeline>()) {
+      vectorize_checked<Policy, Pipeline>(
+          out_ptr, n, dest.present_mask(),
+          [&](std::size_t offset, __m256i& overflow) {
+            return Pipeline::op_checked(
+                load_vector<Pipeline, aligned>(a_ptr + offset),
+                load_vector<Pipeline, aligned>(out_ptr + offset), overflow);
+          });
+    } else {
+      vectorize_in_place<Policy, Pipeline>(
+          out_ptr, n, [&](std::size_t offset) {
+            return Pipeline::transform_from(Pipeline::op(
+                Pipeline::transform_to(
+                    load_vector<Pipeline, aligned>(a_ptr + offset)),
+                Pipeline::transform_to(
+                    load_vector<Pipeline, aligned>(out_ptr + offset))));
+          });
+    }
+    return;
+  }
+  vectorize<Policy, Pipeline>(a, b, dest);
+}
+
+// dest = a op scalar
+template <OpType Op, concepts::ArithmeticColumnPolicy Policy>
+void eval_into(column_vector<Policy>& dest, column_vector<Policy> const& a,
+               typename Policy::value_type scalar) {
+  if (&dest == &a) {
+    compound_assign<Policy, Op>(dest, scalar);
+    return;
+  }
+  dest.data().resize(padded_size<Policy>(a.data().size()));
+  vectorize_scalar<Policy, scalar_pipeline_t<Policy, Op>>(a, scalar, dest);
+}
+
+// dest = scalar op a
+template <OpType Op, concepts::ArithmeticColumnPolicy Policy>
+void eval_into(column_vector<Policy>& dest, typename Policy::value_type scalar,
+               column_vector<Policy> const& a) {
+  using value_type = typename Policy::value_type;
+  using ScalarPipeline = scalar_pipeline_t<Policy, Op>;
+  if (&dest != &a) {
+    dest.data().resize(padded_size<Policy>(a.data().size()));
+    dest.present_mask() = a.present_mask();
+  }
+  auto* out_ptr = dest.data().data();
+  const auto* a_ptr = a.data().data();
+  const auto scalar_reg = ScalarPipeline::broadcast(scalar);
+  if constexpr (checks_overflow<ScalarPipeline>()) {
+    vectorize_checked<Policy, ScalarPipeline>(
+        out_ptr, a.data().size(), dest.present_mask(),
+        [&](std::size_t offset, __m256i& overflow) {
+          return ScalarPipeline::op_checked(
+              scalar_reg,
+              load_vector<ScalarPipeline, Policy::assume_aligned>(a_ptr +
+                                                                  offset),
+              overflow);
+        });
+    return;
+  }
+  vectorize_in_place<Policy, ScalarPipeline>(
+      out_ptr, a.data().size(), [&](std::size_t offset) {
+        const auto reg =
+            load_vector<ScalarPipeline, Policy::assume_aligned>(a_ptr + offset);
+        if constexpr (std::is_same_v<value_type, bf16>) {
+          return ScalarPipeline::transform_from(ScalarPipeline::op(
+              scalar_reg, ScalarPipeline::transform_to(reg)));
+        } else {
+          return ScalarPipeline::op(scalar_reg, reg);
+        }
+      });
+}
+
 // Element-wise addition
 template <concepts::ColumnPolicy Policy>
 column_vector<Policy>
-column_vector<Policy>::operator+(const column_vector& other) const {
+column_vector<Policy>::operator+(const column_vector& other) const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
   FRANKLIN_ASSERT(present_mask_.size() == other.present_mask_.size());
-  if constexpr (std::is_same_v<value_type, std::int32_t>) {
+  if constexpr (std::is_integral_v<value_type>) {
     const auto effective_size =
         std::min<std::size_t>(data_.size(), other.data_.size());
     column_vector<Policy> output(effective_size, allocator_);
 
-    vectorize<Policy, Int32Pipeline<OpType::Add>>(*this, other, output);
+    vectorize<Policy, column_pipeline_t<Policy, OpType::Add>>(*this, other,
+                                                              output);
     return output;
   } else if constexpr (std::is_same_v<value_type, float>) {
     const auto effective_size =
@@ -1224,10 +3200,13 @@ column_vector<Policy>::operator+(const column_vector& other) const {
 
 template <concepts::ColumnPolicy Policy>
 column_vector<Policy>
-column_vector<Policy>::operator+(column_vector&& other) const {
+column_vector<Policy>::operator+(column_vector&& other) const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
   FRANKLIN_ASSERT(present_mask_.size() == other.present_mask_.size());
-  if constexpr (std::is_same_v<value_type, std::int32_t>) {
-    vectorize_destructive<Policy, Int32Pipeline<OpType::Add>>(other, *this);
+  if constexpr (std::is_integral_v<value_type>) {
+    vectorize_destructive<Policy, column_pipeline_t<Policy, OpType::Add>>(
+        other, *this);
     return other;
   } else if constexpr (std::is_same_v<value_type, float>) {
     vectorize_destructive<Policy, Float32Pipeline<OpType::Add>>(other, *this);
@@ -1243,14 +3222,17 @@ column_vector<Policy>::operator+(column_vector&& other) const {
 // Element-wise subtraction
 template <concepts::ColumnPolicy Policy>
 column_vector<Policy>
-column_vector<Policy>::operator-(const column_vector& other) const {
+column_vector<Policy>::operator-(const column_vector& other) const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
   FRANKLIN_ASSERT(present_mask_.size() == other.present_mask_.size());
-  if constexpr (std::is_same_v<value_type, std::int32_t>) {
+  if constexpr (std::is_integral_v<value_type>) {
     const auto effective_size =
         std::min<std::size_t>(data_.size(), other.data_.size());
     column_vector<Policy> output(effective_size, allocator_);
 
-    vectorize<Policy, Int32Pipeline<OpType::Sub>>(*this, other, output);
+    vectorize<Policy, column_pipeline_t<Policy, OpType::Sub>>(*this, other,
+                                                              output);
     return output;
   } else if constexpr (std::is_same_v<value_type, float>) {
     const auto effective_size =
@@ -1273,16 +3255,19 @@ column_vector<Policy>::operator-(const column_vector& other) const {
 
 template <concepts::ColumnPolicy Policy>
 column_vector<Policy>
-column_vector<Policy>::operator-(column_vector&& other) const {
+column_vector<Policy>::operator-(column_vector&& other) const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
   FRANKLIN_ASSERT(present_mask_.size() == other.present_mask_.size());
   // Subtraction is non-commutative, so we can't reuse the rvalue buffer
   // since vectorize_destructive(other, *this) would compute other - *this
   // but we need *this - other. Just allocate a new result.
-  if constexpr (std::is_same_v<value_type, std::int32_t>) {
+  if constexpr (std::is_integral_v<value_type>) {
     const auto effective_size =
         std::min<std::size_t>(data_.size(), other.data_.size());
     column_vector<Policy> output(effective_size, allocator_);
-    vectorize<Policy, Int32Pipeline<OpType::Sub>>(*this, other, output);
+    vectorize<Policy, column_pipeline_t<Policy, OpType::Sub>>(*this, other,
+                                                              output);
     return output;
   } else if constexpr (std::is_same_v<value_type, float>) {
     const auto effective_size =
@@ -1304,14 +3289,17 @@ column_vector<Policy>::operator-(column_vector&& other) const {
 // Element-wise multiplication
 template <concepts::ColumnPolicy Policy>
 column_vector<Policy>
-column_vector<Policy>::operator*(const column_vector& other) const {
+column_vector<Policy>::operator*(const column_vector& other) const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
   FRANKLIN_ASSERT(present_mask_.size() == other.present_mask_.size());
-  if constexpr (std::is_same_v<value_type, std::int32_t>) {
+  if constexpr (std::is_integral_v<value_type>) {
     const auto effective_size =
         std::min<std::size_t>(data_.size(), other.data_.size());
     column_vector<Policy> output(effective_size, allocator_);
 
-    vectorize<Policy, Int32Pipeline<OpType::Mul>>(*this, other, output);
+    vectorize<Policy, column_pipeline_t<Policy, OpType::Mul>>(*this, other,
+                                                              output);
     return output;
   } else if constexpr (std::is_same_v<value_type, float>) {
     const auto effective_size =
@@ -1334,10 +3322,13 @@ column_vector<Policy>::operator*(const column_vector& other) const {
 
 template <concepts::ColumnPolicy Policy>
 column_vector<Policy>
-column_vector<Policy>::operator*(column_vector&& other) const {
+column_vector<Policy>::operator*(column_vector&& other) const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
   FRANKLIN_ASSERT(present_mask_.size() == other.present_mask_.size());
-  if constexpr (std::is_same_v<value_type, std::int32_t>) {
-    vectorize_destructive<Policy, Int32Pipeline<OpType::Mul>>(other, *this);
+  if constexpr (std::is_integral_v<value_type>) {
+    vectorize_destructive<Policy, column_pipeline_t<Policy, OpType::Mul>>(
+        other, *this);
     return other;
   } else if constexpr (std::is_same_v<value_type, float>) {
     vectorize_destructive<Policy, Float32Pipeline<OpType::Mul>>(other, *this);
@@ -1353,11 +3344,13 @@ column_vector<Policy>::operator*(column_vector&& other) const {
 // Scalar addition: column + scalar
 template <concepts::ColumnPolicy Policy>
 column_vector<Policy>
-column_vector<Policy>::operator+(value_type scalar) const {
-  if constexpr (std::is_same_v<value_type, std::int32_t>) {
+column_vector<Policy>::operator+(value_type scalar) const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
+  if constexpr (std::is_integral_v<value_type>) {
     column_vector<Policy> output(data_.size(), allocator_);
-    vectorize_scalar<Policy, Int32ScalarPipeline<OpType::Add>>(*this, scalar,
-                                                               output);
+    vectorize_scalar<Policy, scalar_pipeline_t<Policy, OpType::Add>>(
+        *this, scalar, output);
     return output;
   } else if constexpr (std::is_same_v<value_type, float>) {
     column_vector<Policy> output(data_.size(), allocator_);
@@ -1377,11 +3370,13 @@ column_vector<Policy>::operator+(value_type scalar) const {
 // Scalar subtraction: column - scalar
 template <concepts::ColumnPolicy Policy>
 column_vector<Policy>
-column_vector<Policy>::operator-(value_type scalar) const {
-  if constexpr (std::is_same_v<value_type, std::int32_t>) {
+column_vector<Policy>::operator-(value_type scalar) const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
+  if constexpr (std::is_integral_v<value_type>) {
     column_vector<Policy> output(data_.size(), allocator_);
-    vectorize_scalar<Policy, Int32ScalarPipeline<OpType::Sub>>(*this, scalar,
-                                                               output);
+    vectorize_scalar<Policy, scalar_pipeline_t<Policy, OpType::Sub>>(
+        *this, scalar, output);
     return output;
   } else if constexpr (std::is_same_v<value_type, float>) {
     column_vector<Policy> output(data_.size(), allocator_);
@@ -1401,11 +3396,13 @@ column_vector<Policy>::operator-(value_type scalar) const {
 // Scalar multiplication: column * scalar
 template <concepts::ColumnPolicy Policy>
 column_vector<Policy>
-column_vector<Policy>::operator*(value_type scalar) const {
-  if constexpr (std::is_same_v<value_type, std::int32_t>) {
+column_vector<Policy>::operator*(value_type scalar) const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
+  if constexpr (std::is_integral_v<value_type>) {
     column_vector<Policy> output(data_.size(), allocator_);
-    vectorize_scalar<Policy, Int32ScalarPipeline<OpType::Mul>>(*this, scalar,
-                                                               output);
+    vectorize_scalar<Policy, scalar_pipeline_t<Policy, OpType::Mul>>(
+        *this, scalar, output);
     return output;
   } else if constexpr (std::is_same_v<value_type, float>) {
     column_vector<Policy> output(data_.size(), allocator_);
@@ -1423,90 +3420,18 @@ column_vector<Policy>::operator*(value_type scalar) const {
 }
 
 // Friend operator implementation: scalar - column (non-commutative)
-template <concepts::ColumnPolicy Policy>
+template <concepts::ArithmeticColumnPolicy Policy>
 column_vector<Policy> operator-(typename Policy::value_type scalar,
                                 const column_vector<Policy>& col) {
   using value_type = typename Policy::value_type;
 
-  // scalar - column requires us to compute (scalar - col[i]) for each element
-  // This is equivalent to (-col[i] + scalar) which we can express as:
-  // 1. Negate the column (multiply by -1)
-  // 2. Add the scalar
-
-  if constexpr (std::is_same_v<value_type, std::int32_t>) {
-    // Create a column filled with the scalar value
+  if constexpr (std::is_integral_v<value_type> ||
+                std::is_same_v<value_type, float> ||
+                std::is_same_v<value_type, bf16>) {
+    // eval_into applies the overflow mode of Int32 policies and streams
+    // large outputs
     column_vector<Policy> result(col.data().size(), col.allocator_);
-
-    // Manually compute scalar - column using SIMD
-    const value_type* col_ptr = col.data().data();
-    value_type* result_ptr = result.data().data();
-
-    auto scalar_reg = _mm256_set1_epi32(scalar);
-    std::size_t offset = 0;
-    const std::size_t step = 8;
-    const std::size_t num_elements = col.data().size();
-
-    while (offset + step <= num_elements) {
-      auto col_reg =
-          _mm256_load_si256(reinterpret_cast<const __m256i*>(col_ptr + offset));
-      auto result_reg = _mm256_sub_epi32(scalar_reg, col_reg);
-      _mm256_store_si256(reinterpret_cast<__m256i*>(result_ptr + offset),
-                         result_reg);
-
-      offset += step;
-    }
-
-    // Copy bitmask ONCE after the loop
-    result.present_mask() = col.present_mask();
-    return result;
-  } else if constexpr (std::is_same_v<value_type, float>) {
-    column_vector<Policy> result(col.data().size(), col.allocator_);
-
-    const value_type* col_ptr = col.data().data();
-    value_type* result_ptr = result.data().data();
-
-    auto scalar_reg = _mm256_set1_ps(scalar);
-    std::size_t offset = 0;
-    const std::size_t step = 8;
-    const std::size_t num_elements = col.data().size();
-
-    while (offset + step <= num_elements) {
-      auto col_reg = _mm256_load_ps(col_ptr + offset);
-      auto result_reg = _mm256_sub_ps(scalar_reg, col_reg);
-      _mm256_store_ps(result_ptr + offset, result_reg);
-
-      offset += step;
-    }
-
-    // Copy bitmask ONCE after the loop
-    result.present_mask() = col.present_mask();
-    return result;
-  } else if constexpr (std::is_same_v<value_type, bf16>) {
-    column_vector<Policy> result(col.data().size(), col.allocator_);
-
-    const value_type* col_ptr = col.data().data();
-    value_type* result_ptr = result.data().data();
-
-    float fp32_scalar = scalar.to_float();
-    auto scalar_reg = _mm256_set1_ps(fp32_scalar);
-    std::size_t offset = 0;
-    const std::size_t step = 8;
-    const std::size_t num_elements = col.data().size();
-
-    while (offset + step <= num_elements) {
-      auto col_bf16 =
-          _mm_load_si128(reinterpret_cast<const __m128i*>(col_ptr + offset));
-      auto col_fp32 = _mm256_cvtpbh_ps(reinterpret_cast<__m128bh>(col_bf16));
-      auto result_fp32 = _mm256_sub_ps(scalar_reg, col_fp32);
-      __m128bh result_bf16 = _mm256_cvtneps_pbh(result_fp32);
-      _mm_store_si128(reinterpret_cast<__m128i*>(result_ptr + offset),
-                      reinterpret_cast<__m128i>(result_bf16));
-
-      offset += step;
-    }
-
-    // Copy bitmask ONCE after the loop
-    result.present_mask() = col.present_mask();
+    eval_into<OpType::Sub>(result, scalar, col);
     return result;
   } else {
     static_assert(!std::is_same_v<int, int>);
@@ -1531,10 +3456,15 @@ bool column_vector<Policy>::present_unchecked(
 
 // Reduction operation implementations
 template <concepts::ColumnPolicy Policy>
-typename Policy::value_type column_vector<Policy>::sum() const {
+typename Policy::value_type column_vector<Policy>::sum() const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
   if constexpr (std::is_same_v<value_type, std::int32_t>) {
     return reduce_int32<ReductionOp::Sum>(data_.data(), present_mask_,
                                           data_.size());
+  } else if constexpr (concepts::DecimalColumnPolicy<Policy>) {
+    return sum_decimal64<overflow_mode<Policy>()>(data_.data(), present_mask_,
+                                                  data_.size());
   } else if constexpr (std::is_same_v<value_type, float>) {
     return reduce_float32<ReductionOp::Sum>(data_.data(), present_mask_,
                                             data_.size());
@@ -1547,7 +3477,255 @@ typename Policy::value_type column_vector<Policy>::sum() const {
 }
 
 template <concepts::ColumnPolicy Policy>
-typename Policy::value_type column_vector<Policy>::product() const {
+typename Policy::value_type
+column_vector<Policy>::sum(SummationMode mode) const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
+  if constexpr (std::is_integral_v<value_type>) {
+    return sum();
+  } else {
+    const value_type* data = data_.data();
+    double result = 0.0;
+    switch (mode) {
+    case SummationMode::Naive:
+      return sum();
+    case SummationMode::Compensated:
+      result = sum_float_lanes<SummationMode::Compensated>(data, present_mask_,
+                                                           data_.size());
+      break;
+    case SummationMode::Pairwise:
+      result = sum_float_lanes<SummationMode::Pairwise>(data, present_mask_,
+                                                        data_.size());
+      break;
+    case SummationMode::Float64:
+      result = sum_float_lanes<SummationMode::Float64>(data, present_mask_,
+                                                       data_.size());
+      break;
+    }
+    if constexpr (std::is_same_v<value_type, float>) {
+      return static_cast<float>(result);
+    } else {
+      return bf16::from_float_rne(static_cast<float>(result));
+    }
+  }
+}
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy>&
+column_vector<Policy>::operator+=(const column_vector& other)
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
+  compound_assign<Policy, OpType::Add>(*this, other);
+  return *this;
+}
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy>&
+column_vector<Policy>::operator-=(const column_vector& other)
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
+  compound_assign<Policy, OpType::Sub>(*this, other);
+  return *this;
+}
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy>&
+column_vector<Policy>::operator*=(const column_vector& other)
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
+  compound_assign<Policy, OpType::Mul>(*this, other);
+  return *this;
+}
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy>& column_vector<Policy>::operator+=(value_type scalar)
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
+  compound_assign<Policy, OpType::Add>(*this, scalar);
+  return *this;
+}
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy>& column_vector<Policy>::operator-=(value_type scalar)
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
+  compound_assign<Policy, OpType::Sub>(*this, scalar);
+  return *this;
+}
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy>& column_vector<Policy>::operator*=(value_type scalar)
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
+  compound_assign<Policy, OpType::Mul>(*this, scalar);
+  return *this;
+}
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy>& column_vector<Policy>::axpy(value_type alpha,
+                                                   const column_vector& x)
+  requires(concepts::ArithmeticColumnPolicy<Policy> &&
+           !concepts::DecimalColumnPolicy<Policy>)
+{
+  using Pipeline = AxpyPipeline<value_type, overflow_mode<Policy>()>;
+  constexpr bool aligned = Policy::assume_aligned;
+  FRANKLIN_ASSERT(present_mask_.size() == x.present_mask_.size());
+  value_type* y_ptr = data_.data();
+  const value_type* x_ptr = x.data_.data();
+  const auto alpha_reg = Pipeline::broadcast(alpha);
+
+  if constexpr (checks_overflow<Pipeline>()) {
+    if (x_ptr != y_ptr) {
+      bitset_and_avx2(present_mask_, x.present_mask_);
+    }
+    vectorize_checked<Policy, Pipeline>(
+        y_ptr, std::min(data_.size(), x.data_.size()), present_mask_,
+        [&](std::size_t offset, __m256i& overflow) {
+          return Pipeline::fma_checked(
+              alpha_reg, load_vector<Pipeline, aligned>(x_ptr + offset),
+              load_vector<Pipeline, aligned>(y_ptr + offset), overflow);
+        });
+    return *this;
+  }
+  if (x_ptr == y_ptr) {
+    // y += alpha * y: one load per vector, and the mask is unchanged
+    vectorize_in_place<Policy, Pipeline>(
+        y_ptr, data_.size(), [&](std::size_t offset) {
+          const auto y = Pipeline::transform_to(
+              load_vector<Pipeline, aligned>(y_ptr + offset));
+          return Pipeline::transform_from(Pipeline::fma(alpha_reg, y, y));
+        });
+    return *this;
+  }
+  vectorize_in_place<Policy, Pipeline>(
+      y_ptr, std::min(data_.size(), x.data_.size()), [&](std::size_t offset) {
+        const auto xv = Pipeline::transform_to(
+            load_vector<Pipeline, aligned>(x_ptr + offset));
+        const auto yv = Pipeline::transform_to(
+            load_vector<Pipeline, aligned>(y_ptr + offset));
+        return Pipeline::transform_from(Pipeline::fma(alpha_reg, xv, yv));
+      });
+  bitset_and_avx2(present_mask_, x.present_mask_);
+  return *this;
+}
+
+template <concepts::ColumnPolicy Policy>
+aggregate_result<typename Policy::value_type>
+column_vector<Policy>::aggregate(std::initializer_list<AggregateOp> ops) const
+  requires concepts::ArithmeticColumnPolicy<Policy>
+{
+  unsigned flags = 0;
+  for (AggregateOp op : ops) {
+    flags |= aggregate_flag(op);
+  }
+  auto wants = [flags](AggregateOp op) {
+    return (flags & aggregate_flag(op)) != 0;
+  };
+  aggregate_result<value_type> result;
+  if (flags == 0) {
+    return result;
+  }
+
+  if constexpr (concepts::DecimalColumnPolicy<Policy>) {
+    const decimal64_aggregates all =
+        aggregate_decimal64(data_.data(), present_mask_, data_.size());
+    if (wants(AggregateOp::Count) || wants(AggregateOp::Mean)) {
+      result.count = all.count;
+    }
+    if (wants(AggregateOp::Sum) || wants(AggregateOp::Mean)) {
+      const std::int64_t sum =
+          narrow_decimal64_sum<overflow_mode<Policy>()>(all.total);
+      if (wants(AggregateOp::Sum)) {
+        result.sum = sum;
+      }
+      if (wants(AggregateOp::Mean)) {
+        result.total = sum;
+        if (all.count > 0) {
+          result.mean = static_cast<double>(all.total) /
+                        static_cast<double>(all.count);
+        }
+      }
+    }
+    if (wants(AggregateOp::Min)) {
+      result.min = all.min;
+    }
+    if (wants(AggregateOp::Max)) {
+      result.max = all.max;
+    }
+  } else {
+    aggregate_result<value_type> all;
+    if (wants(AggregateOp::Mean)) {
+      aggregate_lanes<true>(data_.data(), present_mask_, data_.size(), all);
+      result.mean = all.mean;
+      result.total = all.total;
+    } else {
+      aggregate_lanes<false>(data_.data(), present_mask_, data_.size(), all);
+    }
+    if (wants(AggregateOp::Count) || wants(AggregateOp::Mean)) {
+      result.count = all.count;
+    }
+    if (wants(AggregateOp::Sum)) {
+      result.sum = all.sum;
+    }
+    if (wants(AggregateOp::Min)) {
+      result.min = all.min;
+    }
+    if (wants(AggregateOp::Max)) {
+      result.max = all.max;
+    }
+  }
+  return result;
+}
+
+template <concepts::ColumnPolicy Policy>
+double column_vector<Policy>::dot(const column_vector& other) const {
+  static_assert(!std::is_integral_v<value_type>,
+                "dot() is defined for Float32 and BF16 columns");
+  FRANKLIN_ASSERT(data_.size() == other.data_.size());
+  return dot_float_lanes(data_.data(), other.data_.data(), present_mask_,
+                         other.present_mask_, data_.size());
+}
+
+template <concepts::ColumnPolicy Policy>
+double column_vector<Policy>::l2_norm() const {
+  static_assert(!std::is_integral_v<value_type>,
+                "l2_norm() is defined for Float32 and BF16 columns");
+  return std::sqrt(dot_float_lanes(data_.data(), data_.data(), present_mask_,
+                                   present_mask_, data_.size()));
+}
+
+template <concepts::ColumnPolicy Policy>
+double column_vector<Policy>::mean() const {
+  static_assert(!std::is_integral_v<value_type>,
+                "mean() is defined for Float32 and BF16 columns");
+  const float_moments m =
+      moments_float_lanes(data_.data(), present_mask_, data_.size());
+  return m.count == 0 ? std::numeric_limits<double>::quiet_NaN() : m.mean;
+}
+
+template <concepts::ColumnPolicy Policy>
+double column_vector<Policy>::variance() const {
+  static_assert(!std::is_integral_v<value_type>,
+                "variance() is defined for Float32 and BF16 columns");
+  const float_moments m =
+      moments_float_lanes(data_.data(), present_mask_, data_.size());
+  if (m.count < 2) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  // Merging can leave M2 a rounding error below zero for constant columns
+  return std::max(m.m2, 0.0) / (m.count - 1);
+}
+
+template <concepts::ColumnPolicy Policy>
+double column_vector<Policy>::stddev() const {
+  return std::sqrt(variance());
+}
+
+template <concepts::ColumnPolicy Policy>
+typename Policy::value_type column_vector<Policy>::product() const
+  requires(concepts::ArithmeticColumnPolicy<Policy> &&
+           !concepts::DecimalColumnPolicy<Policy>)
+{
   if constexpr (std::is_same_v<value_type, std::int32_t>) {
     return reduce_int32<ReductionOp::Product>(data_.data(), present_mask_,
                                               data_.size());
@@ -1567,6 +3745,9 @@ typename Policy::value_type column_vector<Policy>::min() const {
   if constexpr (std::is_same_v<value_type, std::int32_t>) {
     return reduce_int32<ReductionOp::Min>(data_.data(), present_mask_,
                                           data_.size());
+  } else if constexpr (std::is_same_v<value_type, std::int64_t>) {
+    return reduce_int64<ReductionOp::Min>(data_.data(), present_mask_,
+                                          data_.size());
   } else if constexpr (std::is_same_v<value_type, float>) {
     return reduce_float32<ReductionOp::Min>(data_.data(), present_mask_,
                                             data_.size());
@@ -1583,6 +3764,9 @@ typename Policy::value_type column_vector<Policy>::max() const {
   if constexpr (std::is_same_v<value_type, std::int32_t>) {
     return reduce_int32<ReductionOp::Max>(data_.data(), present_mask_,
                                           data_.size());
+  } else if constexpr (std::is_same_v<value_type, std::int64_t>) {
+    return reduce_int64<ReductionOp::Max>(data_.data(), present_mask_,
+                                          data_.size());
   } else if constexpr (std::is_same_v<value_type, float>) {
     return reduce_float32<ReductionOp::Max>(data_.data(), present_mask_,
                                             data_.size());
@@ -1594,6 +3778,240 @@ typename Policy::value_type column_vector<Policy>::max() const {
   }
 }
 
+// A Decimal64 column at the scale of ToPolicy, rounded with ToPolicy's
+// rounding mode when the scale shrinks. Growing the scale multiplies by a
+// power of ten, whose overflow is handled with ToPolicy's overflow mode.
+template <concepts::DecimalColumnPolicy ToPolicy,
+          concepts::DecimalColumnPolicy FromPolicy>
+column_vector<ToPolicy> rescale(const column_vector<FromPolicy>& column) {
+  using Pipeline = column_pipeline_t<ToPolicy, OpType::Mul>;
+  constexpr bool aligned = FromPolicy::assume_aligned;
+  const std::size_t n = column.data().size();
+  column_vector<ToPolicy> result(n);
+  result.present_mask() = column.present_mask();
+  const std::int64_t* in_ptr = column.data().data();
+  std::int64_t* out_ptr = result.data().data();
+
+  if constexpr (ToPolicy::scale <= FromPolicy::scale) {
+    constexpr unsigned k = FromPolicy::scale - ToPolicy::scale;
+    vectorize_in_place<ToPolicy, Pipeline>(
+        out_ptr, n, [&](std::size_t offset) {
+          const __m256i x = load_vector<Pipeline, aligned>(in_ptr + offset);
+          if constexpr (k == 0) {
+            return x;
+          } else {
+            constexpr pow10_divisor divisor = pow10_divisor::make(k);
+            return divide_pow10_epi64<ToPolicy::rounding>(x, divisor);
+          }
+        });
+  } else {
+    // |x| * 10^k fits iff |x| <= INT64_MAX / 10^k, which also holds for
+    // INT64_MIN since 2^63 is not a multiple of 10^k
+    constexpr std::int64_t factor =
+        pow10_i64(ToPolicy::scale - FromPolicy::scale);
+    const __m256i factor_vec = _mm256_set1_epi64x(factor);
+    const __m256i limit =
+        _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::max() / factor);
+    auto compute = [&](std::size_t offset, __m256i& overflow) {
+      const __m256i x = load_vector<Pipeline, aligned>(in_ptr + offset);
+      const __m256i negative = negative_epi64(x);
+      const __m256i too_large =
+          cmpgt_epu64(abs_epi64(x, negative), limit);
+      overflow = _mm256_or_si256(overflow, too_large);
+      const __m256i r = mullo_epi64(x, factor_vec);
+      if constexpr (overflow_mode<ToPolicy>() == OverflowMode::Saturate) {
+        const __m256i bound = _mm256_xor_si256(
+            negative,
+            _mm256_set1_epi64x(std::numeric_limits<long long>::max()));
+        return _mm256_blendv_epi8(r, bound, too_large);
+      } else {
+        return r;
+      }
+    };
+    if constexpr (checks_overflow<Pipeline>()) {
+      vectorize_checked<ToPolicy, Pipeline>(out_ptr, n, result.present_mask(),
+                                            compute);
+    } else {
+      vectorize_in_place<ToPolicy, Pipeline>(
+          out_ptr, n, [&](std::size_t offset) {
+            __m256i ignored = _mm256_setzero_si256();
+            return compute(offset, ignored);
+          });
+    }
+  }
+  return result;
+}
+
+// 8 dates or timestamps from ptr as days. Timestamps also yield the time of
+// day of each half (4 int64 lanes each) and their raw values.
+template <concepts::TemporalColumnPolicy Policy, bool Aligned>
+FRANKLIN_FORCE_INLINE __m256i
+load_days(const typename Policy::value_type* ptr, __m256i (&micros)[2],
+          __m256i (&time_of_day)[2]) {
+  auto load = [](const auto* p) {
+    const auto* v = reinterpret_cast<const __m256i*>(p);
+    return Aligned ? _mm256_load_si256(v) : _mm256_loadu_si256(v);
+  };
+  if constexpr (Policy::policy_id == DataTypeEnum::Date32) {
+    return load(ptr);
+  } else {
+    micros[0] = load(ptr);
+    micros[1] = load(ptr + 4);
+    const __m128i low = days_from_micros_epi64(micros[0], time_of_day[0]);
+    const __m128i high = days_from_micros_epi64(micros[1], time_of_day[1]);
+    return _mm256_set_m128i(high, low);
+  }
+}
+
+template <DatePart Part, concepts::TemporalColumnPolicy Policy>
+void extract_into(const column_vector<Policy>& column, std::int32_t* out) {
+  constexpr bool is_date = Policy::policy_id == DataTypeEnum::Date32;
+  const auto* in = column.data().data();
+  const std::size_t n = column.data().size();
+  assume_padded<Policy>(n);
+
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i micros[2];
+    __m256i time_of_day[2];
+    const __m256i days =
+        load_days<Policy, Policy::assume_aligned>(in + i, micros, time_of_day);
+    __m256i result;
+    if constexpr (Part == DatePart::Hour) {
+      result = _mm256_set_m128i(hour_epi64(time_of_day[1]),
+                                hour_epi64(time_of_day[0]));
+    } else {
+      result = date_part_epi32<Part>(days);
+    }
+    _mm256_store_si256(reinterpret_cast<__m256i*>(out + i), result);
+  }
+  for (; i < n; ++i) {
+    if constexpr (is_date) {
+      out[i] = date_part(in[i], Part);
+    } else {
+      out[i] = timestamp_part(in[i], Part);
+    }
+  }
+}
+
+template <TimeUnit Unit, concepts::TemporalColumnPolicy Policy>
+void trunc_into(const column_vector<Policy>& column,
+                typename Policy::value_type* out) {
+  constexpr bool is_date = Policy::policy_id == DataTypeEnum::Date32;
+  const auto* in = column.data().data();
+  const std::size_t n = column.data().size();
+  assume_padded<Policy>(n);
+
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i micros[2];
+    __m256i time_of_day[2];
+    const __m256i days =
+        load_days<Policy, Policy::assume_aligned>(in + i, micros, time_of_day);
+    auto* dst = reinterpret_cast<__m256i*>(out + i);
+    if constexpr (is_date) {
+      _mm256_store_si256(dst, trunc_days_epi32<Unit>(days));
+    } else if constexpr (Unit == TimeUnit::Hour) {
+      // Start of the day plus whole hours; micros_per_hour is
+      // 2^10 * 3515625, a factor _mm256_mul_epi32 can take
+      for (int h = 0; h < 2; ++h) {
+        const __m256i hours = _mm256_slli_epi64(
+            _mm256_mul_epi32(_mm256_cvtepi32_epi64(hour_epi64(time_of_day[h])),
+                             _mm256_set1_epi64x(3515625)),
+            10);
+        _mm256_store_si256(
+            dst + h, _mm256_add_epi64(
+                         _mm256_sub_epi64(micros[h], time_of_day[h]), hours));
+      }
+    } else {
+      const __m256i start = trunc_days_epi32<Unit>(days);
+      _mm256_store_si256(
+          dst, micros_from_days_epi32(_mm256_castsi256_si128(start)));
+      _mm256_store_si256(
+          dst + 1, micros_from_days_epi32(_mm256_extracti128_si256(start, 1)));
+    }
+  }
+  for (; i < n; ++i) {
+    if constexpr (is_date) {
+      out[i] = trunc_days(in[i], Unit);
+    } else {
+      out[i] = trunc_micros(in[i], Unit);
+    }
+  }
+}
+
+// One calendar field of every date or timestamp, as an Int32 column with
+// the validity of the input. DatePart::Hour needs a timestamp column.
+template <concepts::TemporalColumnPolicy Policy>
+column_vector<Int32DefaultPolicy> extract(const column_vector<Policy>& column,
+                                          DatePart part) {
+  constexpr bool is_date = Policy::policy_id == DataTypeEnum::Date32;
+  if (is_date && part == DatePart::Hour) {
+    throw std::runtime_error("hour() needs a timestamp column");
+  }
+  column_vector<Int32DefaultPolicy> result(column.data().size());
+  // A timestamp column has fewer padding elements than the result
+  result.present_mask() = column.present_mask();
+  result.present_mask().resize(result.data().size(), false);
+  std::int32_t* out = result.data().data();
+
+  switch (part) {
+  case DatePart::Year:
+    extract_into<DatePart::Year>(column, out);
+    break;
+  case DatePart::Month:
+    extract_into<DatePart::Month>(column, out);
+    break;
+  case DatePart::Day:
+    extract_into<DatePart::Day>(column, out);
+    break;
+  case DatePart::DayOfWeek:
+    extract_into<DatePart::DayOfWeek>(column, out);
+    break;
+  case DatePart::Hour:
+    if constexpr (!is_date) {
+      extract_into<DatePart::Hour>(column, out);
+    }
+    break;
+  }
+  return result;
+}
+
+// Every date or timestamp rounded down to the start of its unit, with the
+// validity of the input. TimeUnit::Hour needs a timestamp column.
+template <concepts::TemporalColumnPolicy Policy>
+column_vector<Policy> date_trunc(const column_vector<Policy>& column,
+                                 TimeUnit unit) {
+  constexpr bool is_date = Policy::policy_id == DataTypeEnum::Date32;
+  if (is_date && unit == TimeUnit::Hour) {
+    throw std::runtime_error("date_trunc(hour) needs a timestamp column");
+  }
+  column_vector<Policy> result(column.data().size());
+  result.present_mask() = column.present_mask();
+  auto* out = result.data().data();
+
+  switch (unit) {
+  case TimeUnit::Hour:
+    if constexpr (!is_date) {
+      trunc_into<TimeUnit::Hour>(column, out);
+    }
+    break;
+  case TimeUnit::Day:
+    trunc_into<TimeUnit::Day>(column, out);
+    break;
+  case TimeUnit::Week:
+    trunc_into<TimeUnit::Week>(column, out);
+    break;
+  case TimeUnit::Month:
+    trunc_into<TimeUnit::Month>(column, out);
+    break;
+  case TimeUnit::Year:
+    trunc_into<TimeUnit::Year>(column, out);
+    break;
+  }
+  return result;
+}
+
 } // namespace franklin
 
 #endif // FRANKLIN_CONTAINER_COLUMN_HPP
@@ -0,0 +1,92 @@
+// The accurate summation modes under the flags of the opt configuration
+// (-O3 -ffast-math, see .bazelrc), which let the compiler reassociate
+// floating-point arithmetic and assume that no value is inf or NaN. The
+// compensated sum must not be simplified back to a naive one, and must keep
+// its IEEE results for non-finite values.
+//
+// This file is itself compiled with -ffast-math, so results are checked
+// through their bit patterns: std::isnan() and comparisons with infinity may
+// be folded away here.
+
+#include "container/column.hpp"
+#include <bit>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+
+#ifndef __FAST_MATH__
+#error "column_fast_math_test must be compiled with -ffast-math"
+#endif
+
+namespace franklin {
+namespace {
+
+using FloatColumn = column_vector<Float32DefaultPolicy>;
+
+constexpr std::uint32_t exponent_bits = 0x7f800000;
+constexpr std::uint32_t positive_inf = 0x7f800000;
+constexpr std::uint32_t negative_inf = 0xff800000;
+
+bool is_nan(float v) {
+  const auto bits = std::bit_cast<std::uint32_t>(v);
+  return (bits & exponent_bits) == exponent_bits && (bits & 0x007fffff) != 0;
+}
+
+// Bit pattern of a float built at run time, so that the compiler cannot
+// reason about the value
+float from_bits(std::uint32_t bits) {
+  volatile std::uint32_t opaque = bits;
+  return std::bit_cast<float>(static_cast<std::uint32_t>(opaque));
+}
+
+TEST(FastMathTest, CompensatedSumKeepsItsErrorTerm) {
+  // Cancellation within one lane: 1e8 + 1 - 1e8
+  FloatColumn b(21, 0.0f);
+  b.data()[0] = 1e8f;
+  b.data()[8] = 1.0f;
+  b.data()[16] = -1e8f;
+  EXPECT_EQ(b.sum(SummationMode::Compensated), 1.0f);
+  EXPECT_EQ(b.sum(SummationMode::Float64), 1.0f);
+
+  // Four million prices, as in Float32SumModesBoundTheError
+  const std::size_t size = std::size_t{1} << 22;
+  FloatColumn a(size);
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> dist(90.0f, 110.0f);
+  long double exact = 0.0L;
+  for (std::size_t i = 0; i < size; ++i) {
+    a.data()[i] = dist(rng);
+    exact += a.data()[i];
+  }
+  const double error =
+      std::abs(static_cast<double>(a.sum(SummationMode::Compensated) - exact) /
+               static_cast<double>(exact));
+  EXPECT_LT(error, 1e-7);
+}
+
+TEST(FastMathTest, CompensatedSumFollowsIeeeForNonFiniteValues) {
+  const float inf = from_bits(positive_inf);
+  const float nan = from_bits(0x7fc00000);
+  auto sum = [](std::initializer_list<float> values, std::size_t stride) {
+    FloatColumn col(100, 1.0f);
+    std::size_t i = 3;
+    for (float v : values) {
+      col.data()[i] = v;
+      i += stride;
+    }
+    return std::bit_cast<std::uint32_t>(col.sum(SummationMode::Compensated));
+  };
+  for (std::size_t stride : {8, 13}) {
+    SCOPED_TRACE(stride);
+    EXPECT_EQ(sum({inf}, stride), positive_inf);
+    EXPECT_EQ(sum({-inf}, stride), negative_inf);
+    EXPECT_EQ(sum({inf, 5.0f, inf}, stride), positive_inf);
+    EXPECT_TRUE(is_nan(std::bit_cast<float>(sum({inf, -inf}, stride))));
+    EXPECT_TRUE(is_nan(std::bit_cast<float>(sum({nan}, stride))));
+    EXPECT_EQ(sum({from_bits(0x7f61b1e6), from_bits(0x7f61b1e6)}, stride),
+              positive_inf); // 3e38 + 3e38
+  }
+}
+
+} // namespace
+} // namespace franklin
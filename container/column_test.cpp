@@ -1,17 +1,23 @@
 #include "container/column.hpp"
 #include "core/bf16.hpp"
+#include <algorithm>
+#include <bit>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <gtest/gtest.h>
+#include <limits>
 #include <memory>
+#include <random>
+#include <utility>
 
 namespace franklin {
 
 // Test policy for column_vector with int32_t
 struct Int32ColumnPolicy {
   using value_type = std::int32_t;
-  using allocator_type = std::allocator<std::int32_t>;
+  using allocator_type = memory::aligned_allocator<std::int32_t, 64>;
   static constexpr bool is_view = false;
   static constexpr bool allow_missing = true;
   static constexpr bool use_avx512 = false;
@@ -22,7 +28,7 @@ struct Int32ColumnPolicy {
 // Test policy for column_vector with float
 struct FloatColumnPolicy {
   using value_type = float;
-  using allocator_type = std::allocator<float>;
+  using allocator_type = memory::aligned_allocator<float, 64>;
   static constexpr bool is_view = false;
   static constexpr bool allow_missing = true;
   static constexpr bool use_avx512 = false;
@@ -33,7 +39,7 @@ struct FloatColumnPolicy {
 // Test policy for column_vector with bf16
 struct BF16ColumnPolicy {
   using value_type = bf16;
-  using allocator_type = std::allocator<bf16>;
+  using allocator_type = memory::aligned_allocator<bf16, 64>;
   static constexpr bool is_view = false;
   static constexpr bool allow_missing = true;
   static constexpr bool use_avx512 = false;
@@ -41,10 +47,39 @@ struct BF16ColumnPolicy {
   static constexpr DataTypeEnum::Enum policy_id = DataTypeEnum::BF16Default;
 };
 
+// Test policy without alignment guarantees: kernels must use unaligned loads
+struct UnalignedFloatColumnPolicy {
+  using value_type = float;
+  using allocator_type = std::allocator<float>;
+  static constexpr bool is_view = false;
+  static constexpr bool allow_missing = true;
+  static constexpr bool use_avx512 = false;
+  static constexpr bool assume_aligned = false;
+  static constexpr DataTypeEnum::Enum policy_id = DataTypeEnum::Float32Default;
+};
+
+// Test policies with a compile-time column width (padded to 32 / 64 elements)
+struct FixedFloatColumnPolicy : Float32DefaultPolicy {
+  static constexpr std::size_t fixed_size = 20;
+};
+
+struct FixedBF16ColumnPolicy : BF16DefaultPolicy {
+  static constexpr std::size_t fixed_size = 40;
+};
+
 using Int32Column = column_vector<Int32ColumnPolicy>;
 using FloatColumn = column_vector<FloatColumnPolicy>;
 using BF16Column = column_vector<BF16ColumnPolicy>;
 
+// Bit pattern of a value, for exact comparison of any column type
+template <typename T> auto bits_of(T v) {
+  if constexpr (sizeof(T) == 2) {
+    return std::bit_cast<std::uint16_t>(v);
+  } else {
+    return std::bit_cast<std::uint32_t>(v);
+  }
+}
+
 // ============================================================================
 // Construction Tests
 // ============================================================================
@@ -532,6 +567,65 @@ TEST(ColumnVectorTest, BF16ConversionRoundTrip) {
       << "BF16 round-trip conversion should preserve approximate value";
 }
 
+TEST(ColumnVectorTest, BF16EmulatedConversionRoundsToNearestEven) {
+  // Inputs and the bf16 bits vcvtneps2bf16 gives for them
+  const std::uint32_t inputs[8] = {
+      0x3f808000, // tie, even kept bit: rounds down
+      0x3f818000, // tie, odd kept bit: rounds up
+      0x3f808001, // above the tie: rounds up
+      0x7f7fffff, // largest float: rounds to infinity
+      0x807fffff, // negative denormal: flushed to -0
+      0x7f800001, // signaling NaN: quieted, not rounded to infinity
+      0xff800000, // -infinity
+      0xbfc00000, // -1.5, exact
+  };
+  const std::uint16_t expected[8] = {0x3f80, 0x3f82, 0x3f81, 0x7f80,
+                                     0x8000, 0x7fc0, 0xff80, 0xbfc0};
+  alignas(16) std::uint16_t narrowed[8];
+  const __m256 values = _mm256_castsi256_ps(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(inputs)));
+  _mm_store_si128(reinterpret_cast<__m128i*>(narrowed),
+                  BF16EmulatedConversion::narrow(values));
+  alignas(32) float widened[8];
+  _mm256_store_ps(widened, BF16EmulatedConversion::widen(_mm_load_si128(
+                               reinterpret_cast<const __m128i*>(narrowed))));
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(narrowed[i], expected[i]) << "lane " << i;
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(widened[i]),
+              std::uint32_t{expected[i]} << 16);
+  }
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+  // Bit-identical to the native instruction
+  for (std::uint32_t seed = 0; seed < (1u << 16); ++seed) {
+    alignas(32) std::uint32_t bits[8];
+    for (std::uint32_t j = 0; j < 8; ++j) {
+      bits[j] = (seed * 0x9e3779b9u) ^ (j * 0x85ebca6bu) ^ (seed << 16);
+    }
+    const __m256 v = _mm256_castsi256_ps(
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(bits)));
+    const __m128i diff = _mm_xor_si128(BF16NativeConversion::narrow(v),
+                                       BF16EmulatedConversion::narrow(v));
+    ASSERT_TRUE(_mm_testz_si128(diff, diff)) << "seed " << seed;
+  }
+#endif
+
+  // The emulated pipeline matches the default one through a whole kernel
+  const std::size_t size = 1003;
+  BF16Column a(size);
+  BF16Column b(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    a.data()[i] = bf16(0.37f * static_cast<float>(i));
+    b.data()[i] = bf16(1.0f / static_cast<float>(i + 1));
+  }
+  BF16Column emulated(size);
+  using EmulatedMul = BF16Pipeline<OpType::Mul, BF16EmulatedConversion>;
+  vectorize<BF16ColumnPolicy, EmulatedMul>(a, b, emulated);
+  const BF16Column product = a * b;
+  for (std::size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(emulated.data()[i].to_bits(), product.data()[i].to_bits());
+  }
+}
+
 // ============================================================================
 // ADVERSARIAL TESTS FOR present() - Logic Errors and Edge Cases
 // ============================================================================
@@ -1072,6 +1166,858 @@ TEST(ColumnOperationsTest, LargeBF16Subtraction) {
   }
 }
 
+// Runs every kernel with the default tunables, whatever the user's tunables
+// file holds: tunables() reads FRANKLIN_TUNABLES_FILE on first use, after
+// this environment is set up
+class DefaultTunablesEnvironment : public ::testing::Environment {
+public:
+  void SetUp() override {
+    ::setenv("FRANKLIN_TUNABLES_FILE", "/dev/null", 1);
+  }
+};
+[[maybe_unused]] const auto* const default_tunables_environment =
+    ::testing::AddGlobalTestEnvironment(new DefaultTunablesEnvironment);
+
+// Restores the process-wide tunables when a test that changes them ends,
+// including through a failed assertion
+class tunables_guard {
+public:
+  tunables_guard() : saved_(tunables()) {}
+  ~tunables_guard() { tunables() = saved_; }
+  tunables_guard(const tunables_guard&) = delete;
+  tunables_guard& operator=(const tunables_guard&) = delete;
+
+private:
+  kernel_tunables saved_;
+};
+
+// Forcing the non-temporal store path must not change any result
+TEST(ColumnOperationsTest, StreamingStoresMatchRegularStores) {
+  const size_t size = 1000;
+  column_vector<Float32DefaultPolicy> a(size);
+  column_vector<Float32DefaultPolicy> b(size);
+  column_vector<BF16DefaultPolicy> c(size);
+
+  for (size_t i = 0; i < size; ++i) {
+    a.data()[i] = static_cast<float>(i) * 0.25f;
+    b.data()[i] = static_cast<float>(i % 7);
+    c.data()[i] = bf16::from_float_trunc(static_cast<float>(i % 64));
+  }
+  b.present_mask().set(3, false);
+
+  tunables_guard guard;
+  tunables().streaming_store_llc_fraction = 1e9;
+  auto regular_sum = a + b;
+  auto regular_scaled = a * 3.0f;
+  auto regular_bf16 = c + c;
+  auto regular_reversed = 10.0f - a;
+  auto regular_reversed_bf16 = bf16::from_float_trunc(100.0f) - c;
+  auto regular_destructive = column_vector<Float32DefaultPolicy>(a) + b;
+
+  tunables().streaming_store_llc_fraction = 0.0;
+  auto streamed_sum = a + b;
+  auto streamed_scaled = a * 3.0f;
+  auto streamed_bf16 = c + c;
+  auto streamed_reversed = 10.0f - a;
+  auto streamed_reversed_bf16 = bf16::from_float_trunc(100.0f) - c;
+  auto streamed_destructive = column_vector<Float32DefaultPolicy>(a) + b;
+
+  for (size_t i = 0; i < size; ++i) {
+    EXPECT_EQ(streamed_sum.data()[i], regular_sum.data()[i]);
+    EXPECT_EQ(streamed_scaled.data()[i], regular_scaled.data()[i]);
+    EXPECT_EQ(streamed_bf16.data()[i].to_bits(),
+              regular_bf16.data()[i].to_bits());
+    EXPECT_EQ(streamed_reversed.data()[i], 10.0f - a.data()[i]);
+    EXPECT_EQ(streamed_reversed.data()[i], regular_reversed.data()[i]);
+    EXPECT_EQ(streamed_reversed_bf16.data()[i].to_bits(),
+              regular_reversed_bf16.data()[i].to_bits());
+    EXPECT_EQ(streamed_destructive.data()[i], regular_sum.data()[i]);
+    EXPECT_EQ(streamed_sum.present(i), regular_sum.present(i));
+  }
+  EXPECT_FALSE(streamed_sum.present(3));
+}
+
+TEST(ColumnOperationsTest, PrefetchDistanceDoesNotChangeResults) {
+  const size_t size = 1000;
+  column_vector<Int32DefaultPolicy> a(size);
+  column_vector<Int32DefaultPolicy> b(size);
+
+  for (size_t i = 0; i < size; ++i) {
+    a.data()[i] = static_cast<int32_t>(i);
+    b.data()[i] = static_cast<int32_t>(i * 3);
+  }
+
+  tunables_guard guard;
+  tunables().prefetch_distance_bytes = 0;
+  auto baseline_sum = a + b;
+  auto baseline_scaled = a * 5;
+
+  // Distances past the end of the buffer must be harmless
+  for (std::size_t distance : {64UL, 1024UL, 1UL << 20}) {
+    tunables().prefetch_distance_bytes = distance;
+    auto sum = a + b;
+    auto scaled = a * 5;
+    auto destructive = a + column_vector<Int32DefaultPolicy>(b);
+    for (size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(sum.data()[i], baseline_sum.data()[i]);
+      EXPECT_EQ(scaled.data()[i], baseline_scaled.data()[i]);
+      EXPECT_EQ(destructive.data()[i], baseline_sum.data()[i]);
+    }
+  }
+}
+
+TEST(ColumnOperationsTest, UnrollFactorDoesNotChangeResults) {
+  // Sizes that leave a remainder for every unroll factor
+  const size_t size = 1000;
+  column_vector<Float32DefaultPolicy> a(size);
+  column_vector<Float32DefaultPolicy> b(size);
+  column_vector<BF16DefaultPolicy> c(size);
+
+  for (size_t i = 0; i < size; ++i) {
+    a.data()[i] = static_cast<float>(i) * 0.5f;
+    b.data()[i] = static_cast<float>(i % 11);
+    c.data()[i] = bf16::from_float_trunc(static_cast<float>(i % 32));
+  }
+
+  tunables_guard guard;
+  for (std::size_t factor : {1UL, 2UL, 4UL, 8UL, 3UL}) {
+    tunables().unroll_factor = factor;
+    auto sum = a + b;
+    auto scaled = a * 2.0f;
+    auto bf16_sum = c + c;
+    // The destructive and in-place kernels
+    auto moved = a + column_vector<Float32DefaultPolicy>(b);
+    auto compound = a;
+    compound += b;
+    compound *= 2.0f;
+    for (size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(sum.data()[i], a.data()[i] + b.data()[i])
+          << "unroll " << factor << " index " << i;
+      EXPECT_EQ(scaled.data()[i], a.data()[i] * 2.0f);
+      EXPECT_EQ(moved.data()[i], a.data()[i] + b.data()[i]);
+      EXPECT_EQ(compound.data()[i], (a.data()[i] + b.data()[i]) * 2.0f);
+      EXPECT_EQ(bf16_sum.data()[i].to_float(),
+                2.0f * c.data()[i].to_float());
+    }
+  }
+}
+
+TEST(ColumnOperationsTest, UnalignedPolicyOperations) {
+  const size_t size = 100;
+  column_vector<UnalignedFloatColumnPolicy> a(size);
+  column_vector<UnalignedFloatColumnPolicy> b(size);
+  for (size_t i = 0; i < size; ++i) {
+    a.data()[i] = static_cast<float>(i);
+    b.data()[i] = 1.5f;
+  }
+
+  auto sum = a + b;
+  auto scaled = a * 2.0f;
+  auto diff = a - column_vector<UnalignedFloatColumnPolicy>(b);
+  for (size_t i = 0; i < size; ++i) {
+    EXPECT_EQ(sum.data()[i], static_cast<float>(i) + 1.5f);
+    EXPECT_EQ(scaled.data()[i], static_cast<float>(i) * 2.0f);
+    EXPECT_EQ(diff.data()[i], static_cast<float>(i) - 1.5f);
+  }
+}
+
+TEST(ColumnOperationsTest, FixedSizePolicyOperations) {
+  column_vector<FixedFloatColumnPolicy> a(20);
+  column_vector<FixedFloatColumnPolicy> b(20);
+  // Always allocated at the padded fixed width
+  ASSERT_EQ(a.data().size(), 32u);
+  for (size_t i = 0; i < 20; ++i) {
+    a.data()[i] = static_cast<float>(i);
+    b.data()[i] = static_cast<float>(2 * i);
+  }
+  b.present_mask().set(7, false);
+
+  auto sum = a + b;
+  auto scaled = a * 3.0f;
+  for (size_t i = 0; i < 20; ++i) {
+    EXPECT_EQ(sum.data()[i], static_cast<float>(3 * i));
+    EXPECT_EQ(scaled.data()[i], static_cast<float>(3 * i));
+    EXPECT_EQ(sum.present(i), i != 7);
+    EXPECT_TRUE(scaled.present(i));
+  }
+  EXPECT_FALSE(sum.present(20));
+
+  column_vector<FixedBF16ColumnPolicy> c(40);
+  ASSERT_EQ(c.data().size(), 64u);
+  for (size_t i = 0; i < 40; ++i) {
+    c.data()[i] = bf16::from_float_trunc(static_cast<float>(i));
+  }
+  auto doubled = c + c;
+  auto shifted = c + bf16::from_float_trunc(1.0f);
+  for (size_t i = 0; i < 40; ++i) {
+    EXPECT_EQ(doubled.data()[i].to_float(), static_cast<float>(2 * i));
+    EXPECT_EQ(shifted.data()[i].to_float(), static_cast<float>(i + 1));
+  }
+}
+
+// Compound assignment computes what the binary operators do, in place
+template <typename Policy>
+void expect_compound_assignment_matches(std::size_t size) {
+  using value_type = typename Policy::value_type;
+  column_vector<Policy> a(size);
+  column_vector<Policy> b(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    a.data()[i] = value_type(static_cast<float>(i % 23) - 11.0f);
+    b.data()[i] = value_type(static_cast<float>(i % 5) + 1.0f);
+    a.present_mask().set(i, i % 3 != 0);
+    b.present_mask().set(i, i % 4 != 0);
+  }
+  const value_type three(3.0f);
+  auto check = [&](const column_vector<Policy>& in_place,
+                   const column_vector<Policy>& expected) {
+    for (std::size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(in_place.present(i), expected.present(i)) << i;
+      if (expected.present(i)) {
+        EXPECT_EQ(bits_of(in_place.data()[i]), bits_of(expected.data()[i]))
+            << i;
+      }
+    }
+  };
+
+  auto c = a;
+  const auto* buffer = c.data().data();
+  c += b;
+  check(c, a + b);
+  c -= b;
+  check(c, a + b - b);
+  c *= b;
+  check(c, (a + b - b) * b);
+  c = a;
+  c += three;
+  check(c, a + three);
+  c -= three;
+  check(c, a + three - three);
+  c *= three;
+  check(c, (a + three - three) * three);
+
+  // Operands that are the same column
+  c = a;
+  c += c;
+  check(c, a + a);
+  c *= c;
+  check(c, (a + a) * (a + a));
+  c -= c;
+  check(c, a - a);
+  EXPECT_EQ(c.data().data(), buffer); // never reallocated
+}
+
+TEST(ColumnOperationsTest, CompoundAssignment) {
+  expect_compound_assignment_matches<Int32DefaultPolicy>(203);
+  expect_compound_assignment_matches<Float32DefaultPolicy>(203);
+  expect_compound_assignment_matches<BF16DefaultPolicy>(203);
+  expect_compound_assignment_matches<FloatColumnPolicy>(203);
+  expect_compound_assignment_matches<UnalignedFloatColumnPolicy>(203);
+  expect_compound_assignment_matches<FixedFloatColumnPolicy>(20);
+}
+
+TEST(ColumnOperationsTest, EvalIntoReusesTheDestination) {
+  column_vector<Float32DefaultPolicy> a(100);
+  column_vector<Float32DefaultPolicy> b(100);
+  for (std::size_t i = 0; i < 100; ++i) {
+    a.data()[i] = static_cast<float>(i);
+    b.data()[i] = 2.0f;
+  }
+  b.present_mask().set(5, false);
+
+  column_vector<Float32DefaultPolicy> dest;
+  eval_into<OpType::Mul>(dest, a, b);
+  const float* buffer = dest.data().data();
+  EXPECT_EQ(dest.data().size(), a.data().size());
+  EXPECT_EQ(dest.data()[10], 20.0f);
+  EXPECT_FALSE(dest.present(5));
+
+  // Same buffer for every later result of the same length
+  eval_into<OpType::Sub>(dest, a, 1.0f);
+  EXPECT_EQ(dest.data()[10], 9.0f);
+  EXPECT_TRUE(dest.present(5));
+  eval_into<OpType::Sub>(dest, 1.0f, a);
+  EXPECT_EQ(dest.data()[10], -9.0f);
+  eval_into<OpType::Add>(dest, a, b);
+  EXPECT_EQ(dest.data()[10], 12.0f);
+  EXPECT_EQ(dest.data().data(), buffer);
+
+  // The destination may be either operand
+  eval_into<OpType::Sub>(dest, a, dest);
+  EXPECT_EQ(dest.data()[10], -2.0f);
+  EXPECT_FALSE(dest.present(5));
+  eval_into<OpType::Mul>(dest, dest, 3.0f);
+  EXPECT_EQ(dest.data()[10], -6.0f);
+  eval_into<OpType::Sub>(dest, 0.0f, dest);
+  EXPECT_EQ(dest.data()[10], 6.0f);
+  eval_into<OpType::Add>(dest, dest, dest);
+  EXPECT_EQ(dest.data()[10], 12.0f);
+  EXPECT_EQ(dest.data().data(), buffer);
+
+  column_vector<BF16DefaultPolicy> halves(40, bf16::from_float_rne(1.5f));
+  column_vector<BF16DefaultPolicy> out;
+  eval_into<OpType::Sub>(out, bf16::from_float_rne(4.0f), halves);
+  EXPECT_EQ(out.data()[39].to_float(), 2.5f);
+  EXPECT_FALSE(out.present(40));
+
+  // An operand dest is sized like any other dest
+  column_vector<Float32DefaultPolicy> longer(100, 1.0f);
+  longer.data().resize(a.data().size() + 64, 1.0f);
+  eval_into<OpType::Add>(longer, a, longer);
+  EXPECT_EQ(longer.data().size(), a.data().size());
+  EXPECT_EQ(longer.data()[10], 11.0f);
+  longer.data().resize(a.data().size() + 64, 1.0f);
+  eval_into<OpType::Add>(longer, longer, a);
+  EXPECT_EQ(longer.data().size(), a.data().size());
+  EXPECT_EQ(longer.data()[10], 21.0f);
+}
+
+TEST(ColumnOperationsTest, AxpyIsFused) {
+  const std::size_t size = 100;
+  column_vector<Float32DefaultPolicy> y(size);
+  column_vector<Float32DefaultPolicy> x(size);
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+  for (std::size_t i = 0; i < size; ++i) {
+    y.data()[i] = dist(rng);
+    x.data()[i] = dist(rng);
+    x.present_mask().set(i, i % 9 != 0);
+  }
+  const float alpha = 0.1f;
+  auto expected = y;
+  y.axpy(alpha, x);
+  for (std::size_t i = 0; i < size; ++i) {
+    // One rounding, as std::fma
+    EXPECT_EQ(y.data()[i], std::fma(alpha, x.data()[i], expected.data()[i]));
+    EXPECT_EQ(y.present(i), i % 9 != 0);
+  }
+  // Aliased: y += alpha * y
+  expected = y;
+  y.axpy(alpha, y);
+  for (std::size_t i = 0; i < size; ++i) {
+    EXPECT_EQ(y.data()[i],
+              std::fma(alpha, expected.data()[i], expected.data()[i]));
+  }
+
+  column_vector<Int32DefaultPolicy> yi(size, 7);
+  column_vector<Int32DefaultPolicy> xi(size, 3);
+  yi.axpy(-2, xi);
+  EXPECT_EQ(yi.data()[size - 1], 1);
+
+  column_vector<BF16DefaultPolicy> yb(size, bf16::from_float_rne(1.0f));
+  column_vector<BF16DefaultPolicy> xb(size, bf16::from_float_rne(3.0f));
+  yb.axpy(bf16::from_float_rne(0.5f), xb);
+  EXPECT_EQ(yb.data()[0].to_float(), 2.5f);
+}
+
+template <OverflowMode Mode> struct OverflowInt32Policy : Int32DefaultPolicy {
+  static constexpr OverflowMode overflow = Mode;
+};
+
+// a op b computed exactly, with what each overflow mode makes of it
+struct int32_reference {
+  std::int32_t wrapped;
+  std::int32_t saturated;
+  bool overflow;
+};
+
+int32_reference int32_fit(std::int64_t exact) {
+  constexpr std::int64_t lo = std::numeric_limits<std::int32_t>::min();
+  constexpr std::int64_t hi = std::numeric_limits<std::int32_t>::max();
+  return {static_cast<std::int32_t>(static_cast<std::uint32_t>(exact)),
+          static_cast<std::int32_t>(std::clamp(exact, lo, hi)),
+          exact < lo || exact > hi};
+}
+
+int32_reference int32_exact(OpType op, std::int32_t a, std::int32_t b) {
+  const std::int64_t x = a;
+  const std::int64_t y = b;
+  return int32_fit(op == OpType::Add   ? x + y
+                   : op == OpType::Sub ? x - y
+                                       : x * y);
+}
+
+template <OverflowMode Mode, typename Column, typename Reference>
+void expect_row(const Column& column, std::size_t i, const Reference& expected,
+                bool valid) {
+  if constexpr (Mode == OverflowMode::Null) {
+    ASSERT_EQ(column.present(i), valid && !expected.overflow) << i;
+    if (column.present(i)) {
+      EXPECT_EQ(column.data()[i], expected.wrapped) << i;
+    }
+    return;
+  } else if constexpr (Mode == OverflowMode::Saturate) {
+    EXPECT_EQ(column.data()[i], expected.saturated) << i;
+  } else {
+    EXPECT_EQ(column.data()[i], expected.wrapped) << i;
+  }
+  EXPECT_EQ(column.present(i), valid) << i;
+}
+
+// Every Int32 arithmetic entry point under Mode, on operands mixing the
+// extremes of the range with small values, against 64-bit arithmetic
+template <OverflowMode Mode, OpType Op> void expect_overflow_mode_matches() {
+  using Column = column_vector<OverflowInt32Policy<Mode>>;
+  constexpr std::int32_t min = std::numeric_limits<std::int32_t>::min();
+  constexpr std::int32_t max = std::numeric_limits<std::int32_t>::max();
+  const std::int32_t pool[] = {min, min + 1, -46341, -65536, -1, 0,
+                               1,   46341,   65536,  max - 1, max};
+  const std::size_t size = 203;
+  Column a(size);
+  Column b(size);
+  std::mt19937 rng(11);
+  std::uniform_int_distribution<std::size_t> pick(0, std::size(pool));
+  std::uniform_int_distribution<std::int32_t> any(min, max);
+  for (std::size_t i = 0; i < size; ++i) {
+    const std::size_t p = pick(rng);
+    const std::size_t q = pick(rng);
+    a.data()[i] = p < std::size(pool) ? pool[p] : any(rng);
+    b.data()[i] = q < std::size(pool) ? pool[q] : any(rng);
+    a.present_mask().set(i, i % 7 != 0);
+    b.present_mask().set(i, i % 11 != 0);
+  }
+  auto expect_rows = [&](const Column& result, auto&& reference,
+                         auto&& valid) {
+    for (std::size_t i = 0; i < size; ++i) {
+      expect_row<Mode>(result, i, reference(i), valid(i));
+    }
+  };
+  auto both = [&](std::size_t i) { return a.present(i) && b.present(i); };
+  auto first = [&](std::size_t i) { return a.present(i); };
+  auto a_op_b = [&](std::size_t i) {
+    return int32_exact(Op, a.data()[i], b.data()[i]);
+  };
+
+  Column result;
+  if constexpr (Op == OpType::Add) {
+    result = a + b;
+  } else if constexpr (Op == OpType::Sub) {
+    result = a - b;
+  } else {
+    result = a * b;
+  }
+  expect_rows(result, a_op_b, both);
+
+  // In place, with dest as the first or the second operand
+  result = a;
+  eval_into<Op>(result, result, b);
+  expect_rows(result, a_op_b, both);
+  result = b;
+  eval_into<Op>(result, a, result);
+  expect_rows(result, a_op_b, both);
+  result = a;
+  eval_into<Op>(result, result, result);
+  expect_rows(
+      result,
+      [&](std::size_t i) { return int32_exact(Op, a.data()[i], a.data()[i]); },
+      first);
+
+  for (std::int32_t scalar : {max, min, -3, 46341}) {
+    eval_into<Op>(result, a, scalar);
+    expect_rows(
+        result,
+        [&](std::size_t i) { return int32_exact(Op, a.data()[i], scalar); },
+        first);
+    eval_into<Op>(result, scalar, a);
+    expect_rows(
+        result,
+        [&](std::size_t i) { return int32_exact(Op, scalar, a.data()[i]); },
+        first);
+    result = a;
+    eval_into<Op>(result, result, scalar);
+    expect_rows(
+        result,
+        [&](std::size_t i) { return int32_exact(Op, a.data()[i], scalar); },
+        first);
+  }
+
+  // y += alpha * x, exact until the result is stored
+  if constexpr (Op == OpType::Add) {
+    for (std::int32_t alpha : {2, -65536}) {
+      result = a;
+      result.axpy(alpha, b);
+      expect_rows(
+          result,
+          [&](std::size_t i) {
+            return int32_fit(std::int64_t{alpha} * b.data()[i] + a.data()[i]);
+          },
+          both);
+    }
+  }
+}
+
+TEST(ColumnOperationsTest, Int32OverflowModes) {
+  expect_overflow_mode_matches<OverflowMode::Wrap, OpType::Add>();
+  expect_overflow_mode_matches<OverflowMode::Wrap, OpType::Mul>();
+  expect_overflow_mode_matches<OverflowMode::Saturate, OpType::Add>();
+  expect_overflow_mode_matches<OverflowMode::Saturate, OpType::Sub>();
+  expect_overflow_mode_matches<OverflowMode::Saturate, OpType::Mul>();
+  expect_overflow_mode_matches<OverflowMode::Null, OpType::Add>();
+  expect_overflow_mode_matches<OverflowMode::Null, OpType::Sub>();
+  expect_overflow_mode_matches<OverflowMode::Null, OpType::Mul>();
+
+  // Moved-from operands reuse their buffer under every mode
+  using Column = column_vector<OverflowInt32Policy<OverflowMode::Null>>;
+  Column a(20, std::numeric_limits<std::int32_t>::max());
+  Column b(20, 1);
+  b.data()[3] = -1;
+  const Column sum = a + Column(b);
+  EXPECT_FALSE(sum.present(0));
+  EXPECT_TRUE(sum.present(3));
+  EXPECT_EQ(sum.data()[3], std::numeric_limits<std::int32_t>::max() - 1);
+  const Column difference = -1 - a;
+  EXPECT_TRUE(difference.present(0));
+  EXPECT_EQ(difference.data()[0], std::numeric_limits<std::int32_t>::min());
+
+  // alpha * x out of range, alpha * x + y in range: not an overflow
+  constexpr std::int32_t big = 1 << 30;
+  Column y(20, -10);
+  y.axpy(2, Column(20, big));
+  EXPECT_TRUE(y.present(0));
+  EXPECT_EQ(y.data()[0], std::numeric_limits<std::int32_t>::max() - 9);
+  using Saturating = column_vector<OverflowInt32Policy<OverflowMode::Saturate>>;
+  Saturating s(20, 10);
+  s.axpy(-2, Saturating(20, big));
+  EXPECT_EQ(s.data()[0], std::numeric_limits<std::int32_t>::min() + 10);
+  s.axpy(3, Saturating(20, -big));
+  EXPECT_EQ(s.data()[0], std::numeric_limits<std::int32_t>::min());
+}
+
+TEST(ColumnOperationsTest, Int32OverflowIsReportedOncePerKernel) {
+  using Column = column_vector<OverflowInt32Policy<OverflowMode::Report>>;
+  constexpr std::int32_t max = std::numeric_limits<std::int32_t>::max();
+  Column a(100, 1);
+  Column b(100, 2);
+  a.data()[40] = max;
+  b.data()[40] = max;
+
+  // Rows that are missing, or only padding, never overflow
+  a.present_mask().set(40, false);
+  a.data()[100] = max;
+  b.data()[100] = max;
+  const Column sum = a + b;
+  EXPECT_EQ(sum.data()[0], 3);
+  EXPECT_EQ(sum.data()[40], -2);
+  EXPECT_NO_THROW(a *= b);
+  EXPECT_NO_THROW(a.axpy(2, b));
+  EXPECT_EQ(a.data()[0], 6);
+
+  a.present_mask().set(40, true);
+  a.data()[40] = max;
+  EXPECT_THROW(a + b, std::runtime_error);
+  EXPECT_THROW(b - (-1 - a), std::runtime_error);
+  EXPECT_THROW(a * 2, std::runtime_error);
+  EXPECT_THROW(eval_into<OpType::Add>(b, a, b), std::runtime_error);
+  b = Column(100, 2);
+  EXPECT_THROW(b.axpy(2, a), std::runtime_error);
+  EXPECT_THROW(a += a, std::runtime_error);
+  // The kernel finished before reporting
+  EXPECT_EQ(a.data()[99], 12);
+  EXPECT_EQ(b.data()[99], 14);
+}
+
+// a op b of two decimals at Scale computed in 128 bits
+struct decimal_reference {
+  std::int64_t wrapped;
+  std::int64_t saturated;
+  bool overflow;
+};
+
+template <unsigned Scale, RoundingMode Rounding>
+decimal_reference decimal_exact(OpType op, std::int64_t a, std::int64_t b) {
+  const __int128 exact =
+      op == OpType::Add   ? static_cast<__int128>(a) + b
+      : op == OpType::Sub ? static_cast<__int128>(a) - b
+                          : multiply_round<Rounding>(a, b, Scale);
+  constexpr __int128 lo = std::numeric_limits<std::int64_t>::min();
+  constexpr __int128 hi = std::numeric_limits<std::int64_t>::max();
+  return {static_cast<std::int64_t>(exact),
+          static_cast<std::int64_t>(std::clamp(exact, lo, hi)),
+          exact < lo || exact > hi};
+}
+
+// Every Decimal64 arithmetic entry point, on operands mixing the extremes of
+// the range, products on either side of 2^63, ties and values of every
+// magnitude, against 128-bit arithmetic
+template <unsigned Scale, RoundingMode Rounding, OverflowMode Mode, OpType Op>
+void expect_decimal_arithmetic_matches() {
+  using Column = column_vector<Decimal64Policy<Scale, Rounding, Mode>>;
+  constexpr std::int64_t min = std::numeric_limits<std::int64_t>::min();
+  constexpr std::int64_t max = std::numeric_limits<std::int64_t>::max();
+  const std::int64_t half = pow10_i64(Scale) / 2;
+  const std::int64_t pool[] = {min,         min + 1,     -3037000500,
+                               -half,       -1,          0,
+                               1,           half,        3 * half,
+                               3037000499,  3037000500,  max - 1,
+                               max};
+  const std::size_t size = 203;
+  Column a(size);
+  Column b(size);
+  std::mt19937_64 rng(13);
+  std::uniform_int_distribution<std::size_t> pick(0, std::size(pool));
+  auto value = [&] {
+    const std::size_t p = pick(rng);
+    return p < std::size(pool)
+               ? pool[p]
+               : static_cast<std::int64_t>(rng()) >> (rng() % 64);
+  };
+  for (std::size_t i = 0; i < size; ++i) {
+    a.data()[i] = value();
+    b.data()[i] = value();
+    a.present_mask().set(i, i % 7 != 0);
+    b.present_mask().set(i, i % 11 != 0);
+  }
+  auto expect_rows = [&](const Column& result, auto&& reference,
+                         auto&& valid) {
+    for (std::size_t i = 0; i < size; ++i) {
+      expect_row<Mode>(result, i, reference(i), valid(i));
+    }
+  };
+  auto exact = [](std::int64_t x, std::int64_t y) {
+    return decimal_exact<Scale, Rounding>(Op, x, y);
+  };
+  auto both = [&](std::size_t i) { return a.present(i) && b.present(i); };
+  auto first = [&](std::size_t i) { return a.present(i); };
+  auto a_op_b = [&](std::size_t i) { return exact(a.data()[i], b.data()[i]); };
+
+  Column result;
+  if constexpr (Op == OpType::Add) {
+    result = a + b;
+  } else if constexpr (Op == OpType::Sub) {
+    result = a - b;
+  } else {
+    result = a * b;
+  }
+  expect_rows(result, a_op_b, both);
+
+  result = b;
+  eval_into<Op>(result, a, result);
+  expect_rows(result, a_op_b, both);
+  result = a;
+  eval_into<Op>(result, result, result);
+  expect_rows(
+      result, [&](std::size_t i) { return exact(a.data()[i], a.data()[i]); },
+      first);
+
+  for (std::int64_t scalar : {max, min, -half - 1, half}) {
+    eval_into<Op>(result, a, scalar);
+    expect_rows(
+        result, [&](std::size_t i) { return exact(a.data()[i], scalar); },
+        first);
+    eval_into<Op>(result, scalar, a);
+    expect_rows(
+        result, [&](std::size_t i) { return exact(scalar, a.data()[i]); },
+        first);
+  }
+}
+
+TEST(ColumnOperationsTest, Decimal64Arithmetic) {
+  using enum OverflowMode;
+  using enum RoundingMode;
+  expect_decimal_arithmetic_matches<2, HalfEven, Wrap, OpType::Add>();
+  expect_decimal_arithmetic_matches<2, HalfEven, Saturate, OpType::Sub>();
+  expect_decimal_arithmetic_matches<4, HalfEven, Null, OpType::Add>();
+  expect_decimal_arithmetic_matches<0, HalfEven, Null, OpType::Mul>();
+  expect_decimal_arithmetic_matches<1, HalfUp, Wrap, OpType::Mul>();
+  expect_decimal_arithmetic_matches<2, HalfEven, Null, OpType::Mul>();
+  expect_decimal_arithmetic_matches<4, TowardZero, Saturate, OpType::Mul>();
+  expect_decimal_arithmetic_matches<6, Floor, Null, OpType::Mul>();
+  expect_decimal_arithmetic_matches<18, Ceiling, Wrap, OpType::Mul>();
+}
+
+TEST(ColumnOperationsTest, Decimal64ProductsRoundToTheScale) {
+  // 0.5 * 0.5, 0.5 * 0.3, -0.5 * 0.5 and -0.5 * 0.3 at one decimal, and
+  // 10^8 * 10^8 whose 128-bit product is divided outside the vector path
+  const std::int64_t a[] = {5, 5, -5, -5, 1'000'000'000};
+  const std::int64_t b[] = {5, 3, 5, 3, 1'000'000'000};
+  auto products = [&]<RoundingMode Rounding>() {
+    column_vector<Decimal64Policy<1, Rounding>> x(5);
+    column_vector<Decimal64Policy<1, Rounding>> y(5);
+    std::copy(std::begin(a), std::end(a), x.data().begin());
+    std::copy(std::begin(b), std::end(b), y.data().begin());
+    const auto z = x * y;
+    return std::vector<std::int64_t>(z.data().begin(), z.data().begin() + 5);
+  };
+  using V = std::vector<std::int64_t>;
+  constexpr std::int64_t big = 100'000'000'000'000'000;
+  EXPECT_EQ(products.operator()<RoundingMode::HalfEven>(),
+            (V{2, 2, -2, -2, big}));
+  EXPECT_EQ(products.operator()<RoundingMode::HalfUp>(),
+            (V{3, 2, -3, -2, big}));
+  EXPECT_EQ(products.operator()<RoundingMode::TowardZero>(),
+            (V{2, 1, -2, -1, big}));
+  EXPECT_EQ(products.operator()<RoundingMode::Floor>(),
+            (V{2, 1, -3, -2, big}));
+  EXPECT_EQ(products.operator()<RoundingMode::Ceiling>(),
+            (V{3, 2, -2, -1, big}));
+}
+
+TEST(ColumnOperationsTest, Decimal64OverflowIsReported) {
+  using Column = column_vector<Decimal64Policy<2>>;
+  constexpr std::int64_t max = std::numeric_limits<std::int64_t>::max();
+  Column a(50, 100);
+  Column b(50, 250);
+  a.data()[30] = max;
+  a.present_mask().set(30, false);
+  const Column product = a * b;
+  EXPECT_EQ(product.data()[0], 250);
+  EXPECT_NO_THROW(a + b);
+
+  a.present_mask().set(30, true);
+  EXPECT_THROW(a + b, std::runtime_error);
+  EXPECT_THROW(a * b, std::runtime_error);
+  EXPECT_THROW(a - (-1), std::runtime_error);
+  EXPECT_THROW(a += a, std::runtime_error);
+}
+
+TEST(ColumnOperationsTest, Decimal64Rescale) {
+  using Cents = Decimal64Policy<2>;
+  column_vector<Cents> cents(6);
+  const std::int64_t values[] = {1234, -1250, 1250, -1, 0, 99};
+  std::copy(std::begin(values), std::end(values), cents.data().begin());
+  cents.present_mask().set(4, false);
+
+  const auto basis_points = rescale<Decimal64Policy<4>>(cents);
+  EXPECT_EQ(basis_points.data()[0], 123400);
+  EXPECT_EQ(basis_points.data()[1], -125000);
+  EXPECT_FALSE(basis_points.present(4));
+
+  const auto units = rescale<Decimal64Policy<0>>(cents);
+  EXPECT_EQ(std::vector<std::int64_t>(units.data().begin(),
+                                      units.data().begin() + 4),
+            (std::vector<std::int64_t>{12, -12, 12, 0}));
+  EXPECT_EQ(units.data()[5], 1);
+  const auto floored =
+      rescale<Decimal64Policy<1, RoundingMode::Floor>>(cents);
+  EXPECT_EQ(floored.data()[1], -125);
+  EXPECT_EQ(floored.data()[3], -1);
+  EXPECT_EQ(floored.data()[5], 9);
+
+  // At 18 decimals the largest value is 9.22..., so 9.23 overflows
+  cents.data()[2] = 923;
+  cents.data()[3] = -922;
+  EXPECT_THROW(rescale<Decimal64Policy<18>>(cents), std::runtime_error);
+  const auto nulled =
+      rescale<Decimal64Policy<18, RoundingMode::HalfEven, OverflowMode::Null>>(
+          cents);
+  EXPECT_FALSE(nulled.present(0));
+  EXPECT_FALSE(nulled.present(2));
+  EXPECT_TRUE(nulled.present(3));
+  EXPECT_EQ(nulled.data()[3], -922 * pow10_i64(16));
+  const auto clamped = rescale<
+      Decimal64Policy<18, RoundingMode::HalfEven, OverflowMode::Saturate>>(
+      cents);
+  EXPECT_EQ(clamped.data()[1], std::numeric_limits<std::int64_t>::min());
+  EXPECT_EQ(clamped.data()[2], std::numeric_limits<std::int64_t>::max());
+}
+
+// Dates and timestamps have min() and max(), but no arithmetic
+template <typename Column, typename T = typename Column::value_type>
+constexpr bool has_arithmetic =
+    requires(const Column& a, T v) { a + a; } ||
+    requires(const Column& a, T v) { a - v; } ||
+    requires(const Column& a, T v) { v * a; } ||
+    requires(Column& a, const Column& b) { a += b; } ||
+    requires(const Column& a) { a.sum(); } ||
+    requires(const Column& a) { a.aggregate({AggregateOp::Sum}); } ||
+    requires(Column& a, const Column& b) { eval_into<OpType::Add>(a, b, b); };
+static_assert(has_arithmetic<column_vector<Int32DefaultPolicy>>);
+static_assert(has_arithmetic<column_vector<Decimal64Policy<2>>>);
+static_assert(!has_arithmetic<column_vector<Date32Policy>>);
+static_assert(!has_arithmetic<column_vector<TimestampMicrosPolicy>>);
+static_assert(requires(const column_vector<Date32Policy>& a) { a.min(); });
+
+TEST(ColumnOperationsTest, DatePartsMatchTheCalendar) {
+  // 1900-02-28 to 2100-03-01 every 37 days, plus the leap days around 2000
+  std::vector<std::int32_t> days;
+  for (std::int32_t d = days_from_civil(1900, 2, 28);
+       d <= days_from_civil(2100, 3, 1); d += 37) {
+    days.push_back(d);
+  }
+  days.push_back(days_from_civil(2000, 2, 29));
+  days.push_back(days_from_civil(2000, 3, 1));
+  days.push_back(days_from_civil(1999, 12, 31));
+
+  column_vector<Date32Policy> dates(days.size());
+  std::copy(days.begin(), days.end(), dates.data().begin());
+  dates.present_mask().set(1, false);
+
+  const auto years = extract(dates, DatePart::Year);
+  const auto months = extract(dates, DatePart::Month);
+  const auto mdays = extract(dates, DatePart::Day);
+  const auto weekdays = extract(dates, DatePart::DayOfWeek);
+  const auto weeks = date_trunc(dates, TimeUnit::Week);
+  const auto month_starts = date_trunc(dates, TimeUnit::Month);
+  const auto year_starts = date_trunc(dates, TimeUnit::Year);
+  for (std::size_t i = 0; i < days.size(); ++i) {
+    const civil_date date = civil_from_days(days[i]);
+    ASSERT_EQ(years.data()[i], date.year) << days[i];
+    ASSERT_EQ(months.data()[i], static_cast<std::int32_t>(date.month));
+    ASSERT_EQ(mdays.data()[i], static_cast<std::int32_t>(date.day));
+    ASSERT_EQ(weekdays.data()[i], day_of_week(days[i]));
+    ASSERT_EQ(weeks.data()[i], trunc_days(days[i], TimeUnit::Week));
+    ASSERT_EQ(month_starts.data()[i],
+              days_from_civil(date.year, date.month, 1));
+    ASSERT_EQ(year_starts.data()[i], days_from_civil(date.year, 1, 1));
+  }
+  EXPECT_EQ(years.data()[days.size() - 3], 2000);
+  EXPECT_EQ(months.data()[days.size() - 3], 2);
+  EXPECT_EQ(mdays.data()[days.size() - 3], 29);
+  EXPECT_FALSE(years.present(1));
+  EXPECT_FALSE(month_starts.present(1));
+  EXPECT_TRUE(years.present(0));
+  EXPECT_FALSE(years.present(days.size()));
+  EXPECT_THROW(extract(dates, DatePart::Hour), std::runtime_error);
+  EXPECT_THROW(date_trunc(dates, TimeUnit::Hour), std::runtime_error);
+}
+
+TEST(ColumnOperationsTest, TimestampPartsAndTruncation) {
+  // 2024-03-10 23:59:59.999999, then steps of 7h 13m across the epoch
+  const std::int64_t base =
+      micros_from_days(days_from_civil(2024, 3, 11)) - 1;
+  constexpr std::int64_t step = 7 * micros_per_hour + 13 * 60'000'000;
+  std::vector<std::int64_t> values = {base, base + 1, -1, 0};
+  for (std::int64_t t = -200 * step; values.size() < 21; t += 37 * step) {
+    values.push_back(t);
+  }
+  column_vector<TimestampMicrosPolicy> ts(values.size());
+  std::copy(values.begin(), values.end(), ts.data().begin());
+  ts.present_mask().set(3, false);
+
+  const auto hours = extract(ts, DatePart::Hour);
+  const auto years = extract(ts, DatePart::Year);
+  const auto weekdays = extract(ts, DatePart::DayOfWeek);
+  // An Int32 column of the same length has the same (padded) size
+  EXPECT_EQ(hours.data().size(),
+            column_vector<Int32DefaultPolicy>(values.size()).data().size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(hours.data()[i], timestamp_part(values[i], DatePart::Hour));
+    ASSERT_EQ(years.data()[i], timestamp_part(values[i], DatePart::Year));
+    ASSERT_EQ(weekdays.data()[i],
+              timestamp_part(values[i], DatePart::DayOfWeek));
+  }
+  EXPECT_EQ(hours.data()[0], 23);
+  EXPECT_EQ(hours.data()[1], 0);
+  EXPECT_EQ(hours.data()[2], 23);
+  EXPECT_EQ(weekdays.data()[0], 0); // a Sunday
+  EXPECT_FALSE(hours.present(3));
+  EXPECT_TRUE(hours.present(20));
+  EXPECT_FALSE(hours.present(21));
+
+  for (TimeUnit unit : {TimeUnit::Hour, TimeUnit::Day, TimeUnit::Week,
+                        TimeUnit::Month, TimeUnit::Year}) {
+    const auto truncated = date_trunc(ts, unit);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      ASSERT_EQ(truncated.data()[i], trunc_micros(values[i], unit))
+          << values[i] << " unit " << static_cast<int>(unit);
+    }
+    EXPECT_FALSE(truncated.present(3));
+  }
+  EXPECT_EQ(date_trunc(ts, TimeUnit::Hour).data()[0],
+            base + 1 - micros_per_hour);
+  EXPECT_EQ(date_trunc(ts, TimeUnit::Month).data()[1],
+            micros_from_days(days_from_civil(2024, 3, 1)));
+}
+
 // ============================================================================
 // SCALAR OPERATION TESTS - COLUMN OP SCALAR AND SCALAR OP COLUMN
 // ============================================================================
@@ -1611,6 +2557,287 @@ TEST(ReductionOperationsTest, BF16Max) {
   EXPECT_NEAR(result.to_float(), 16.0f, 0.5f);
 }
 
+TEST(ReductionOperationsTest, Float32SumModesBoundTheError) {
+  // Four million prices: large enough for fp32 accumulators to drift
+  const std::size_t size = std::size_t{1} << 22;
+  column_vector<Float32DefaultPolicy> a(size);
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> dist(90.0f, 110.0f);
+  long double exact = 0.0L;
+  for (std::size_t i = 0; i < size; ++i) {
+    a.data()[i] = dist(rng);
+    if (i % 97 == 0) {
+      a.data()[i] = 1e30f; // missing rows never contribute
+      a.present_mask().set(i, false);
+    } else {
+      exact += a.data()[i];
+    }
+  }
+  auto error = [&](float sum) {
+    return std::abs(static_cast<double>(sum - exact) / exact);
+  };
+  // The accurate modes are within rounding of the fp32 result
+  EXPECT_LT(error(a.sum(SummationMode::Compensated)), 1e-7);
+  EXPECT_LT(error(a.sum(SummationMode::Float64)), 1e-7);
+  EXPECT_LT(error(a.sum(SummationMode::Pairwise)), 2e-7);
+  EXPECT_EQ(a.sum(SummationMode::Naive), a.sum());
+
+  // Cancellation within one lane: 1e8 + 1 - 1e8
+  column_vector<Float32DefaultPolicy> b(21, 0.0f);
+  b.data()[0] = 1e8f;
+  b.data()[8] = 1.0f;
+  b.data()[16] = -1e8f;
+  EXPECT_EQ(b.sum(), 0.0f);
+  EXPECT_EQ(b.sum(SummationMode::Compensated), 1.0f);
+  EXPECT_EQ(b.sum(SummationMode::Float64), 1.0f);
+
+  // NaN in a present row propagates; all-missing columns sum to zero
+  b.data()[20] = std::numeric_limits<float>::quiet_NaN();
+  EXPECT_TRUE(std::isnan(b.sum(SummationMode::Pairwise)));
+  b.present_mask().set(20, false);
+  EXPECT_FALSE(std::isnan(b.sum(SummationMode::Pairwise)));
+  column_vector<Float32DefaultPolicy> empty(100, 5.0f);
+  empty.present_mask().reset();
+  for (auto mode : {SummationMode::Compensated, SummationMode::Pairwise,
+                    SummationMode::Float64}) {
+    EXPECT_EQ(empty.sum(mode), 0.0f);
+  }
+}
+
+TEST(ReductionOperationsTest, SumModesFollowIeeeForNonFiniteValues) {
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+  // Values placed in the same lane (i % 8 == 3) and in different lanes
+  auto sum = [](SummationMode mode, std::initializer_list<float> values,
+                std::size_t stride) {
+    column_vector<Float32DefaultPolicy> col(100, 1.0f);
+    std::size_t i = 3;
+    for (float v : values) {
+      col.data()[i] = v;
+      i += stride;
+    }
+    return col.sum(mode);
+  };
+  for (auto mode : {SummationMode::Naive, SummationMode::Compensated,
+                    SummationMode::Pairwise, SummationMode::Float64}) {
+    SCOPED_TRACE(static_cast<int>(mode));
+    for (std::size_t stride : {8, 13}) {
+      EXPECT_EQ(sum(mode, {inf}, stride), inf);
+      EXPECT_EQ(sum(mode, {-inf}, stride), -inf);
+      EXPECT_EQ(sum(mode, {inf, 5.0f, inf}, stride), inf);
+      EXPECT_TRUE(std::isnan(sum(mode, {inf, -inf}, stride)));
+      EXPECT_TRUE(std::isnan(sum(mode, {nan}, stride)));
+      EXPECT_TRUE(std::isnan(sum(mode, {inf, nan}, stride)));
+      // Finite values whose sum overflows
+      EXPECT_EQ(sum(mode, {3e38f, 3e38f}, stride), inf);
+      EXPECT_EQ(sum(mode, {-3e38f, -3e38f}, stride), -inf);
+    }
+  }
+}
+
+TEST(ReductionOperationsTest, BF16SumModesRoundOnce) {
+  const std::size_t size = 100000;
+  column_vector<BF16DefaultPolicy> a(size, bf16::from_float_rne(0.01f));
+  const double exact =
+      static_cast<double>(bf16::from_float_rne(0.01f).to_float()) * size;
+  for (auto mode : {SummationMode::Compensated, SummationMode::Pairwise,
+                    SummationMode::Float64}) {
+    // Only the final conversion to bf16 rounds: within half a bf16 ulp
+    const float sum = a.sum(mode).to_float();
+    EXPECT_LE(std::abs(sum - exact), exact * 0x1p-9) << static_cast<int>(mode);
+  }
+}
+
+template <typename Column> void expect_aggregates_match(const Column& col) {
+  const auto all =
+      col.aggregate({AggregateOp::Sum, AggregateOp::Min, AggregateOp::Max,
+                     AggregateOp::Count, AggregateOp::Mean});
+  EXPECT_EQ(bits_of(all.sum), bits_of(col.sum()));
+  EXPECT_EQ(bits_of(all.min), bits_of(col.min()));
+  EXPECT_EQ(bits_of(all.max), bits_of(col.max()));
+  EXPECT_EQ(all.count, col.present_mask().count());
+
+  // Unrequested fields keep their defaults
+  const auto some = col.aggregate({AggregateOp::Max, AggregateOp::Count});
+  EXPECT_EQ(bits_of(some.max), bits_of(col.max()));
+  EXPECT_EQ(some.count, all.count);
+  EXPECT_EQ(bits_of(some.sum), bits_of(typename Column::value_type{}));
+  EXPECT_TRUE(std::isnan(some.mean));
+}
+
+TEST(ReductionOperationsTest, AggregatesInOnePassMatchTheReductions) {
+  const std::size_t size = 10001;
+  column_vector<Int32DefaultPolicy> ints(size);
+  column_vector<Float32DefaultPolicy> floats(size);
+  column_vector<BF16DefaultPolicy> halves(size);
+  std::mt19937 rng(5);
+  std::uniform_int_distribution<std::int32_t> dist(-1000, 1000);
+  long long int_sum = 0;
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    const std::int32_t v = dist(rng);
+    ints.data()[i] = v;
+    floats.data()[i] = static_cast<float>(v) * 0.25f;
+    halves.data()[i] = bf16::from_float_rne(static_cast<float>(v));
+    const bool present = i % 7 != 3;
+    ints.present_mask().set(i, present);
+    floats.present_mask().set(i, present);
+    halves.present_mask().set(i, present);
+    if (present) {
+      int_sum += v;
+      ++count;
+    }
+  }
+  expect_aggregates_match(ints);
+  expect_aggregates_match(floats);
+  expect_aggregates_match(halves);
+
+  const double mean = static_cast<double>(int_sum) / count;
+  EXPECT_DOUBLE_EQ(ints.aggregate({AggregateOp::Mean}).mean, mean);
+  EXPECT_DOUBLE_EQ(floats.aggregate({AggregateOp::Mean}).mean, mean * 0.25);
+  EXPECT_EQ(ints.aggregate({AggregateOp::Mean}).count, count);
+  EXPECT_EQ(ints.aggregate({AggregateOp::Mean}).total, int_sum);
+}
+
+TEST(ReductionOperationsTest, AggregateEdgeCases) {
+  // The Int32 mean does not wrap with the sum
+  column_vector<Int32DefaultPolicy> big(1000,
+                                        std::numeric_limits<int32_t>::max());
+  EXPECT_DOUBLE_EQ(big.aggregate({AggregateOp::Mean}).mean,
+                   std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(big.aggregate({AggregateOp::Mean}).total,
+            std::int64_t{std::numeric_limits<int32_t>::max()} * 1000);
+
+  // No present value: identities, a zero count and a NaN mean
+  column_vector<Float32DefaultPolicy> none(100, 2.0f);
+  none.present_mask().reset();
+  const auto result =
+      none.aggregate({AggregateOp::Sum, AggregateOp::Min, AggregateOp::Count,
+                      AggregateOp::Mean});
+  EXPECT_EQ(result.sum, 0.0f);
+  EXPECT_EQ(result.min, none.min());
+  EXPECT_EQ(result.count, 0u);
+  EXPECT_TRUE(std::isnan(result.mean));
+  EXPECT_EQ(none.aggregate({}).count, 0u);
+
+  // Without alignment guarantees, and with a partial last vector
+  column_vector<UnalignedFloatColumnPolicy> odd(13);
+  for (std::size_t i = 0; i < 13; ++i) {
+    odd.data()[i] = static_cast<float>(i) - 6.0f;
+  }
+  odd.present_mask().set(0, false);
+  const auto tail = odd.aggregate({AggregateOp::Max, AggregateOp::Mean});
+  EXPECT_EQ(tail.max, 6.0f);
+  EXPECT_EQ(tail.count, 12u);
+  EXPECT_DOUBLE_EQ(tail.mean, 0.5);
+  EXPECT_EQ(tail.min, odd.aggregate({}).min);
+}
+
+TEST(ReductionOperationsTest, Float32StatisticsInOnePass) {
+  // Large offset, small spread: the sum-of-squares formula cancels here
+  const std::size_t size = 300001;
+  column_vector<Float32DefaultPolicy> a(size);
+  column_vector<Float32DefaultPolicy> b(size);
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  long double dot = 0.0L, norm = 0.0L, sum = 0.0L;
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    a.data()[i] = 1e4f + dist(rng);
+    b.data()[i] = dist(rng);
+    if (i % 31 == 0) {
+      a.data()[i] = std::numeric_limits<float>::quiet_NaN();
+      a.present_mask().set(i, false);
+    }
+    if (i % 17 == 0) {
+      b.data()[i] = std::numeric_limits<float>::infinity();
+      b.present_mask().set(i, false);
+    }
+    if (a.present(i)) {
+      sum += a.data()[i];
+      norm += static_cast<long double>(a.data()[i]) * a.data()[i];
+      ++count;
+      if (b.present(i)) {
+        dot += static_cast<long double>(a.data()[i]) * b.data()[i];
+      }
+    }
+  }
+  const long double mean = sum / count;
+  long double m2 = 0.0L;
+  for (std::size_t i = 0; i < size; ++i) {
+    if (a.present(i)) {
+      m2 += (a.data()[i] - mean) * (a.data()[i] - mean);
+    }
+  }
+  const double variance = static_cast<double>(m2 / (count - 1));
+
+  EXPECT_NEAR(a.dot(b), static_cast<double>(dot), 1e-6 * std::sqrt(norm));
+  EXPECT_EQ(a.dot(b), b.dot(a));
+  EXPECT_NEAR(a.l2_norm(), std::sqrt(static_cast<double>(norm)),
+              1e-7 * std::sqrt(static_cast<double>(norm)));
+  EXPECT_NEAR(a.mean(), static_cast<double>(mean), 1e-9 * 1e4);
+  EXPECT_NEAR(a.variance(), variance, 1e-4 * variance);
+  EXPECT_NEAR(a.stddev(), std::sqrt(variance), 1e-4 * std::sqrt(variance));
+}
+
+TEST(ReductionOperationsTest, StatisticsEdgeCases) {
+  column_vector<Float32DefaultPolicy> none(40, 3.0f);
+  none.present_mask().reset();
+  EXPECT_EQ(none.dot(none), 0.0);
+  EXPECT_EQ(none.l2_norm(), 0.0);
+  EXPECT_TRUE(std::isnan(none.mean()));
+  EXPECT_TRUE(std::isnan(none.variance()));
+
+  // One present value: a mean but no sample variance
+  none.present_mask().set(37, true);
+  EXPECT_EQ(none.mean(), 3.0);
+  EXPECT_TRUE(std::isnan(none.variance()));
+
+  // Constant columns have exactly zero variance
+  column_vector<Float32DefaultPolicy> constant(1000, 0.1f);
+  EXPECT_EQ(constant.variance(), 0.0);
+  EXPECT_EQ(constant.stddev(), 0.0);
+
+  column_vector<Float32DefaultPolicy> small(5);
+  for (int i = 0; i < 5; ++i) {
+    small.data()[i] = static_cast<float>(i + 1);
+  }
+  EXPECT_EQ(small.dot(small), 55.0);
+  EXPECT_EQ(small.mean(), 3.0);
+  EXPECT_EQ(small.variance(), 2.5);
+
+  // NaN in a present row propagates
+  small.data()[2] = std::numeric_limits<float>::quiet_NaN();
+  EXPECT_TRUE(std::isnan(small.dot(small)));
+  EXPECT_TRUE(std::isnan(small.variance()));
+}
+
+TEST(ReductionOperationsTest, BF16StatisticsAccumulateInFloat32) {
+  const std::size_t size = 10007;
+  column_vector<BF16DefaultPolicy> a(size);
+  column_vector<BF16DefaultPolicy> b(size);
+  double dot = 0.0, sum = 0.0;
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    a.data()[i] = bf16::from_float_rne(static_cast<float>(i % 10) * 0.5f);
+    b.data()[i] = bf16::from_float_rne(static_cast<float>(i % 7) - 3.0f);
+    a.present_mask().set(i, i % 5 != 0);
+    b.present_mask().set(i, i % 3 != 0);
+    if (a.present(i)) {
+      sum += a.data()[i].to_float();
+      ++count;
+      if (b.present(i)) {
+        dot += a.data()[i].to_float() * b.data()[i].to_float();
+      }
+    }
+  }
+  // Every value and product is exact in fp32, so only the fp32 partial sums
+  // round; a bf16 accumulator would be off by far more
+  EXPECT_NEAR(a.dot(b), dot, 1e-6 * std::abs(dot) + 1e-3);
+  EXPECT_NEAR(a.mean(), sum / count, 1e-6);
+  EXPECT_GT(a.variance(), 0.0);
+}
+
 // Test any() and all() operations
 TEST(ReductionOperationsTest, AnyAllPresent) {
   column_vector<Int32DefaultPolicy> a(16);
@@ -1732,6 +2959,107 @@ TEST(ReductionOperationsTest, Int32SumNegative) {
   EXPECT_EQ(result, -4);
 }
 
+TEST(ReductionOperationsTest, Decimal64SumIsExact) {
+  constexpr std::int64_t max = std::numeric_limits<std::int64_t>::max();
+  column_vector<Decimal64Policy<2>> column(1001, 0);
+  for (std::size_t i = 0; i < 1001; ++i) {
+    column.data()[i] = i % 2 == 0 ? max - 7 : -(max - 8);
+  }
+  // Partial sums leave the int64 range in every lane; the total is 500 + max
+  // - 7 minus the 500 rows of 8 less
+  column.present_mask().set(1000, false);
+  EXPECT_EQ(column.sum(), 500);
+  EXPECT_EQ(column.min(), -(max - 8));
+  EXPECT_EQ(column.max(), max - 7);
+  column.present_mask().set(1000, true);
+  EXPECT_THROW(column.sum(), std::runtime_error);
+
+  column_vector<Decimal64Policy<2, RoundingMode::HalfEven,
+                                OverflowMode::Saturate>>
+      saturating(9, max);
+  EXPECT_EQ(saturating.sum(), max);
+  saturating.present_mask().set(0, false);
+  saturating.data()[8] = std::numeric_limits<std::int64_t>::min();
+  EXPECT_EQ(saturating.sum(), max);
+
+  column_vector<Decimal64Policy<2>> empty(5, 3);
+  for (std::size_t i = 0; i < 5; ++i) {
+    empty.present_mask().set(i, false);
+  }
+  EXPECT_EQ(empty.sum(), 0);
+  EXPECT_EQ(empty.min(), max);
+}
+
+TEST(ReductionOperationsTest, Decimal64AggregatesMatchTheReductions) {
+  constexpr std::int64_t max = std::numeric_limits<std::int64_t>::max();
+  column_vector<Decimal64Policy<2>> column(1003);
+  std::mt19937 rng(13);
+  std::uniform_int_distribution<std::int64_t> dist(-1'000'000, 1'000'000);
+  long double total = 0;
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < 1003; ++i) {
+    column.data()[i] = dist(rng);
+    column.present_mask().set(i, i % 5 != 2);
+    if (i % 5 != 2) {
+      total += column.data()[i];
+      ++count;
+    }
+  }
+  const auto all =
+      column.aggregate({AggregateOp::Sum, AggregateOp::Min, AggregateOp::Max,
+                        AggregateOp::Mean});
+  EXPECT_EQ(all.sum, column.sum());
+  EXPECT_EQ(all.min, column.min());
+  EXPECT_EQ(all.max, column.max());
+  EXPECT_EQ(all.count, count);
+  EXPECT_EQ(all.total, column.sum());
+  EXPECT_DOUBLE_EQ(all.mean, static_cast<double>(total / count));
+
+  // Exact through partial sums out of range; the overflow mode applies to
+  // the total only when the sum or the mean is requested
+  // (six max - 1 and six -(max - 2): the total is 6)
+  column_vector<Decimal64Policy<2>> big(12, max - 1);
+  for (std::size_t i = 1; i < 12; i += 2) {
+    big.data()[i] = -(max - 2);
+  }
+  EXPECT_EQ(big.sum(), 6);
+  EXPECT_EQ(big.aggregate({AggregateOp::Sum}).sum, big.sum());
+  big.data()[11] = max;
+  big.data()[10] = max;
+  EXPECT_THROW(big.sum(), std::runtime_error);
+  EXPECT_THROW(big.aggregate({AggregateOp::Sum}), std::runtime_error);
+  EXPECT_THROW(big.aggregate({AggregateOp::Mean}), std::runtime_error);
+  EXPECT_EQ(big.aggregate({AggregateOp::Max, AggregateOp::Count}).max, max);
+
+  big.present_mask().reset();
+  const auto none = big.aggregate({AggregateOp::Sum, AggregateOp::Min,
+                                   AggregateOp::Mean});
+  EXPECT_EQ(none.sum, 0);
+  EXPECT_EQ(none.min, max);
+  EXPECT_TRUE(std::isnan(none.mean));
+}
+
+// Products and axpy of decimals have no kernels
+template <typename Column>
+constexpr bool has_product = requires(const Column& a) { a.product(); };
+template <typename Column>
+constexpr bool has_axpy = requires(Column& a) { a.axpy({}, a); };
+static_assert(has_product<column_vector<Int32DefaultPolicy>>);
+static_assert(has_axpy<column_vector<Float32DefaultPolicy>>);
+static_assert(!has_product<column_vector<Decimal64Policy<2>>>);
+static_assert(!has_axpy<column_vector<Decimal64Policy<2>>>);
+
+TEST(ReductionOperationsTest, TimestampMinMax) {
+  column_vector<TimestampMicrosPolicy> ts(5);
+  const std::int64_t values[] = {micros_per_day * 20000, -5, 7,
+                                 std::numeric_limits<std::int64_t>::min(),
+                                 micros_per_day};
+  std::copy(std::begin(values), std::end(values), ts.data().begin());
+  ts.present_mask().set(3, false);
+  EXPECT_EQ(ts.min(), -5);
+  EXPECT_EQ(ts.max(), micros_per_day * 20000);
+}
+
 TEST(ReductionOperationsTest, Int32MinNegative) {
   column_vector<Int32DefaultPolicy> a(8);
 
@@ -1743,6 +3071,52 @@ TEST(ReductionOperationsTest, Int32MinNegative) {
   EXPECT_EQ(a.max(), 3);
 }
 
+TEST(ComparisonTest, MatchesScalarComparisons) {
+  constexpr std::size_t n = 1003;
+  column_vector<Float32DefaultPolicy> a(n), b(n);
+  column_vector<Int32DefaultPolicy> i32(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    a.data()[i] = static_cast<float>(i % 11) - 5.0f;
+    b.data()[i] = static_cast<float>(i % 7) - 3.0f;
+    i32.data()[i] = static_cast<int32_t>(i % 9) - 4;
+  }
+  a.data()[20] = std::numeric_limits<float>::quiet_NaN();
+  a.present_mask().set(3, false);
+  b.present_mask().set(64, false);
+  i32.present_mask().set(1000, false);
+
+  const std::pair<CompareOp, bool (*)(float, float)> ops[] = {
+      {CompareOp::Lt, [](float x, float y) { return x < y; }},
+      {CompareOp::Le, [](float x, float y) { return x <= y; }},
+      {CompareOp::Gt, [](float x, float y) { return x > y; }},
+      {CompareOp::Ge, [](float x, float y) { return x >= y; }},
+      {CompareOp::Eq, [](float x, float y) { return x == y; }},
+      {CompareOp::Ne, [](float x, float y) { return x != y; }},
+  };
+  for (const auto& [op, expected] : ops) {
+    const auto columns = compare(op, a, b);
+    const auto column_scalar = compare(op, a, 1.0f);
+    const auto scalar_column = compare(op, 1.0f, a);
+    const auto ints = compare(op, i32, 2);
+    ASSERT_EQ(columns.size(), a.present_mask().size());
+    for (std::size_t i = 0; i < n; ++i) {
+      const bool both = a.present(i) && b.present(i);
+      EXPECT_EQ(columns.test(i), both && expected(a.data()[i], b.data()[i]))
+          << "row " << i;
+      EXPECT_EQ(column_scalar.test(i),
+                a.present(i) && expected(a.data()[i], 1.0f))
+          << "row " << i;
+      EXPECT_EQ(scalar_column.test(i),
+                a.present(i) && expected(1.0f, a.data()[i]))
+          << "row " << i;
+      EXPECT_EQ(ints.test(i),
+                i32.present(i) &&
+                    expected(static_cast<float>(i32.data()[i]), 2.0f))
+          << "row " << i;
+    }
+  }
+}
+
 } // namespace franklin
 
 int main(int argc, char** argv) {
@@ -12,17 +12,18 @@
 namespace franklin {
 
 namespace detail {
-// AVX512 VPOPCNTDQ-optimized helper for counting set bits
-// Process 4 blocks (32 bytes = 256 bits) at a time using _mm256_popcnt_epi64
-// Returns the total count of set bits in the first num_blocks blocks
+// Count of set bits in the first num_blocks blocks. With AVX512 VPOPCNTDQ
+// (and VL), 4 blocks (256 bits) are counted at a time with
+// _mm256_popcnt_epi64; other targets, including plain AVX2 builds, use the
+// scalar popcount instruction.
 inline std::uint64_t simd_count_blocks(const std::uint64_t* data,
                                        std::size_t num_blocks) {
+  std::uint64_t result = 0;
+  std::size_t i = 0;
+#if defined(__AVX512VPOPCNTDQ__) && defined(__AVX512VL__)
   __m256i vec_count = _mm256_setzero_si256();
-  const std::size_t simd_blocks = num_blocks / 4;
-
-  for (std::size_t i = 0; i < simd_blocks; ++i) {
-    __m256i vec =
-        _mm256_load_si256(reinterpret_cast<const __m256i*>(data + i * 4));
+  for (; i + 4 <= num_blocks; i += 4) {
+    __m256i vec = _mm256_load_si256(reinterpret_cast<const __m256i*>(data + i));
     __m256i popcount = _mm256_popcnt_epi64(vec);
     vec_count = _mm256_add_epi64(vec_count, popcount);
   }
@@ -30,10 +31,11 @@ inline std::uint64_t simd_count_blocks(const std::uint64_t* data,
   // Extract and sum the 4 accumulated counts
   alignas(32) std::uint64_t counts[4];
   _mm256_store_si256(reinterpret_cast<__m256i*>(counts), vec_count);
-  std::uint64_t result = counts[0] + counts[1] + counts[2] + counts[3];
+  result = counts[0] + counts[1] + counts[2] + counts[3];
+#endif
 
   // Handle remaining full blocks with scalar popcount
-  for (std::size_t i = simd_blocks * 4; i < num_blocks; ++i) {
+  for (; i < num_blocks; ++i) {
     result += std::popcount(data[i]);
   }
 
@@ -275,7 +277,7 @@ public:
     const size_type remainder = num_bits_ & (bits_per_block - 1);
     const block_type* data = blocks_.data();
 
-    // AVX512 VPOPCNTDQ-optimized counting via helper function
+    // Full blocks via simd_count_blocks (VPOPCNTDQ where available)
     // Overflow analysis:
     // - Each popcnt returns max 64
     // - Each uint64_t accumulator can hold (2^64-1)/64 =
@@ -518,6 +520,10 @@ public:
     return blocks_;
   }
 
+  // Mutable block access for bulk producers (predicate kernels, loaders).
+  // Callers are responsible for keeping bits at positions >= size() cleared.
+  std::vector<block_type, allocator_type>& blocks() noexcept { return blocks_; }
+
 private:
   // OPTIMIZATION 15: Replace division with bit shift
   // Always round up to cache line boundaries (8 blocks = 64 bytes)
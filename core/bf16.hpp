@@ -1,8 +1,13 @@
 #pragma once
 
+#include "core/compiler_macros.hpp"
 #include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace franklin {
 
@@ -68,9 +73,266 @@ struct bf16 {
 
   // Construct from float
   explicit bf16(float value) noexcept : bf16(from_float_trunc(value)) {}
+
+  // Rounding of float32 values that bf16 cannot represent exactly
+  enum class rounding {
+    truncate,     // drop the low 16 bits, like from_float_trunc
+    nearest_even, // like vcvtneps2bf16: ties to even, denormals flushed to
+                  // signed zero, NaNs quieted
+    stochastic,   // round away from zero with probability proportional to
+                  // the dropped bits; unbiased on average
+  };
+
+  // Convert from float32, rounding to nearest even
+  static constexpr bf16 from_float_rne(float value) noexcept;
+
+  // Convert n values in bulk. Stochastic rounding draws its random bits from
+  // a hash of `seed` and the element index, so results are reproducible and
+  // do not depend on the instruction set.
+  static void convert(const float* src, bf16* dst, std::size_t n,
+                      rounding mode = rounding::nearest_even,
+                      std::uint64_t seed = 0) noexcept;
+  static void convert(const bf16* src, float* dst, std::size_t n) noexcept;
 };
 
 static_assert(sizeof(bf16) == sizeof(std::uint16_t),
               "bf16 must be exactly 16 bits");
 
+namespace detail {
+
+// Scalar conversions with the semantics of bf16::rounding
+constexpr std::uint16_t bf16_bits_rne(std::uint32_t bits) noexcept {
+  if ((bits & 0x7fffffffu) > 0x7f800000u) {
+    return static_cast<std::uint16_t>((bits >> 16) | 0x40); // quiet NaN
+  }
+  if ((bits & 0x7f800000u) == 0) {
+    return static_cast<std::uint16_t>((bits >> 16) & 0x8000); // signed zero
+  }
+  return static_cast<std::uint16_t>((bits + 0x7fff + ((bits >> 16) & 1)) >>
+                                    16);
+}
+
+constexpr std::uint16_t bf16_bits_stochastic(std::uint32_t bits,
+                                             std::uint32_t random) noexcept {
+  if ((bits & 0x7fffffffu) > 0x7f800000u) {
+    return static_cast<std::uint16_t>((bits >> 16) | 0x40);
+  }
+  // Magnitude and sign are separate, so adding to the bits rounds away
+  // from zero; a carry into the exponent moves to the next binade
+  return static_cast<std::uint16_t>((bits + (random & 0xffff)) >> 16);
+}
+
+// Random bits for element `index` (murmur3 finalizer)
+constexpr std::uint32_t bf16_random_bits(std::uint32_t key,
+                                         std::size_t index) noexcept {
+  std::uint32_t x = static_cast<std::uint32_t>(index) ^ key;
+  x ^= x >> 16;
+  x *= 0x85ebca6bu;
+  x ^= x >> 13;
+  x *= 0xc2b2ae35u;
+  x ^= x >> 16;
+  return x;
+}
+
+constexpr std::uint32_t bf16_random_key(std::uint64_t seed) noexcept {
+  return static_cast<std::uint32_t>(seed) ^
+         static_cast<std::uint32_t>(seed >> 32) * 0x9e3779b9u;
+}
+
+#if defined(__AVX2__)
+// The upper 16 bits of each 32-bit lane, packed into 128 bits: bytes 2-3,
+// 6-7, ... of each 128-bit half, then the two halves' low quarters
+FRANKLIN_FORCE_INLINE __m128i bf16_upper_halves(__m256i lanes) {
+  const __m256i upper = _mm256_shuffle_epi8(
+      lanes, _mm256_setr_epi8(2, 3, 6, 7, 10, 11, 14, 15, -1, -1, -1, -1, -1,
+                              -1, -1, -1, 2, 3, 6, 7, 10, 11, 14, 15, -1, -1,
+                              -1, -1, -1, -1, -1, -1));
+  return _mm256_castsi256_si128(_mm256_permute4x64_epi64(upper, 0x08));
+}
+#endif
+
+} // namespace detail
+
+#if defined(__AVX2__)
+
+// BF16 <-> FP32 conversion of 8 lanes. Both variants give the results of
+// vcvtneps2bf16: round to nearest even, denormals flushed to signed zero,
+// NaNs kept as quiet NaNs.
+
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+// Native AVX-512 BF16 instructions
+struct BF16NativeConversion {
+  FRANKLIN_FORCE_INLINE static __m256 widen(__m128i bf16_reg) {
+    return _mm256_cvtpbh_ps(reinterpret_cast<__m128bh>(bf16_reg));
+  }
+
+  FRANKLIN_FORCE_INLINE static __m128i narrow(__m256 fp32_reg) {
+    return reinterpret_cast<__m128i>(_mm256_cvtneps_pbh(fp32_reg));
+  }
+};
+#endif
+
+// AVX2 emulation, for hosts without AVX-512 BF16
+struct BF16EmulatedConversion {
+  // vpmovzxwd, then move the bits to the top half of each lane
+  FRANKLIN_FORCE_INLINE static __m256 widen(__m128i bf16_reg) {
+    return _mm256_castsi256_ps(
+        _mm256_slli_epi32(_mm256_cvtepu16_epi32(bf16_reg), 16));
+  }
+
+  FRANKLIN_FORCE_INLINE static __m128i narrow(__m256 fp32_reg) {
+    const __m256i bits = _mm256_castps_si256(fp32_reg);
+    const __m256i sign = _mm256_set1_epi32(static_cast<int>(0x80000000u));
+    // Zero exponent: flush to zero, keeping the sign
+    const __m256i denormal = _mm256_cmpeq_epi32(
+        _mm256_and_si256(bits, _mm256_set1_epi32(0x7f800000)),
+        _mm256_setzero_si256());
+    const __m256i flushed =
+        _mm256_andnot_si256(_mm256_andnot_si256(sign, denormal), bits);
+    // Round to nearest even: add 0x7fff plus the lowest kept bit; carries
+    // into the exponent round up to the next binade or to infinity
+    const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(flushed, 16),
+                                         _mm256_set1_epi32(1));
+    const __m256i rounded = _mm256_add_epi32(
+        flushed, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7fff)));
+    // NaN: set the quiet bit and truncate instead, so it cannot round to
+    // infinity
+    const __m256 nan = _mm256_cmp_ps(fp32_reg, fp32_reg, _CMP_UNORD_Q);
+    const __m256i quiet =
+        _mm256_or_si256(bits, _mm256_set1_epi32(0x00400000));
+    const __m256i result = _mm256_castps_si256(
+        _mm256_blendv_ps(_mm256_castsi256_ps(rounded),
+                         _mm256_castsi256_ps(quiet), nan));
+    return detail::bf16_upper_halves(result);
+  }
+};
+
+// Conversion used by the BF16 kernels: native when the target has AVX-512
+// BF16, emulated otherwise or when FRANKLIN_BF16_EMULATED is defined
+#if defined(__AVX512BF16__) && defined(__AVX512VL__) &&                       \
+    !defined(FRANKLIN_BF16_EMULATED)
+using BF16DefaultConversion = BF16NativeConversion;
+#else
+using BF16DefaultConversion = BF16EmulatedConversion;
+#endif
+
+namespace detail {
+
+// Vector equivalent of bf16_random_bits for elements index .. index + 7
+FRANKLIN_FORCE_INLINE __m256i bf16_random_bits(__m256i key,
+                                               std::size_t index) {
+  const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  __m256i x = _mm256_xor_si256(
+      _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(index)), lanes),
+      key);
+  x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+  x = _mm256_mullo_epi32(x, _mm256_set1_epi32(static_cast<int>(0x85ebca6bu)));
+  x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 13));
+  x = _mm256_mullo_epi32(x, _mm256_set1_epi32(static_cast<int>(0xc2b2ae35u)));
+  return _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+}
+
+// Narrow 8 lanes with the given rounding
+template <bf16::rounding Mode>
+FRANKLIN_FORCE_INLINE __m128i bf16_narrow(__m256 values, __m256i key,
+                                          std::size_t index) {
+  if constexpr (Mode == bf16::rounding::truncate) {
+    return bf16_upper_halves(_mm256_castps_si256(values));
+  } else if constexpr (Mode == bf16::rounding::nearest_even) {
+    return BF16DefaultConversion::narrow(values);
+  } else {
+    const __m256i bits = _mm256_castps_si256(values);
+    const __m256i random = _mm256_and_si256(bf16_random_bits(key, index),
+                                            _mm256_set1_epi32(0xffff));
+    const __m256 nan = _mm256_cmp_ps(values, values, _CMP_UNORD_Q);
+    const __m256i quiet =
+        _mm256_or_si256(bits, _mm256_set1_epi32(0x00400000));
+    const __m256i result = _mm256_castps_si256(_mm256_blendv_ps(
+        _mm256_castsi256_ps(_mm256_add_epi32(bits, random)),
+        _mm256_castsi256_ps(quiet), nan));
+    return bf16_upper_halves(result);
+  }
+}
+
+} // namespace detail
+
+#endif // defined(__AVX2__)
+
+namespace detail {
+
+template <bf16::rounding Mode>
+inline void bf16_convert(const float* src, bf16* dst, std::size_t n,
+                         std::uint64_t seed) noexcept {
+  const std::uint32_t key = bf16_random_key(seed);
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  // Two cache lines of input, one of output per iteration
+  const __m256i key_reg = _mm256_set1_epi32(static_cast<int>(key));
+  for (; i + 32 <= n; i += 32) {
+    const __m256 v0 = _mm256_loadu_ps(src + i);
+    const __m256 v1 = _mm256_loadu_ps(src + i + 8);
+    const __m256 v2 = _mm256_loadu_ps(src + i + 16);
+    const __m256 v3 = _mm256_loadu_ps(src + i + 24);
+    auto* out = reinterpret_cast<__m128i*>(dst + i);
+    _mm_storeu_si128(out, bf16_narrow<Mode>(v0, key_reg, i));
+    _mm_storeu_si128(out + 1, bf16_narrow<Mode>(v1, key_reg, i + 8));
+    _mm_storeu_si128(out + 2, bf16_narrow<Mode>(v2, key_reg, i + 16));
+    _mm_storeu_si128(out + 3, bf16_narrow<Mode>(v3, key_reg, i + 24));
+  }
+#endif
+  for (; i < n; ++i) {
+    const auto bits = std::bit_cast<std::uint32_t>(src[i]);
+    if constexpr (Mode == bf16::rounding::truncate) {
+      dst[i] = bf16::from_bits(static_cast<std::uint16_t>(bits >> 16));
+    } else if constexpr (Mode == bf16::rounding::nearest_even) {
+      dst[i] = bf16::from_bits(bf16_bits_rne(bits));
+    } else {
+      dst[i] = bf16::from_bits(
+          bf16_bits_stochastic(bits, bf16_random_bits(key, i)));
+    }
+  }
+}
+
+} // namespace detail
+
+constexpr bf16 bf16::from_float_rne(float value) noexcept {
+  return from_bits(detail::bf16_bits_rne(std::bit_cast<std::uint32_t>(value)));
+}
+
+inline void bf16::convert(const float* src, bf16* dst, std::size_t n,
+                          rounding mode, std::uint64_t seed) noexcept {
+  switch (mode) {
+  case rounding::truncate:
+    detail::bf16_convert<rounding::truncate>(src, dst, n, seed);
+    break;
+  case rounding::nearest_even:
+    detail::bf16_convert<rounding::nearest_even>(src, dst, n, seed);
+    break;
+  case rounding::stochastic:
+    detail::bf16_convert<rounding::stochastic>(src, dst, n, seed);
+    break;
+  }
+}
+
+inline void bf16::convert(const bf16* src, float* dst, std::size_t n) noexcept {
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  // One cache line of input, two of output per iteration
+  for (; i + 32 <= n; i += 32) {
+    const auto* in = reinterpret_cast<const __m128i*>(src + i);
+    const __m128i h0 = _mm_loadu_si128(in);
+    const __m128i h1 = _mm_loadu_si128(in + 1);
+    const __m128i h2 = _mm_loadu_si128(in + 2);
+    const __m128i h3 = _mm_loadu_si128(in + 3);
+    _mm256_storeu_ps(dst + i, BF16DefaultConversion::widen(h0));
+    _mm256_storeu_ps(dst + i + 8, BF16DefaultConversion::widen(h1));
+    _mm256_storeu_ps(dst + i + 16, BF16DefaultConversion::widen(h2));
+    _mm256_storeu_ps(dst + i + 24, BF16DefaultConversion::widen(h3));
+  }
+#endif
+  for (; i < n; ++i) {
+    dst[i] = src[i].to_float();
+  }
+}
+
 } // namespace franklin
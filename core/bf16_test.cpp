@@ -1,8 +1,10 @@
 #include "core/bf16.hpp"
+#include <algorithm>
 #include <bit>
 #include <cmath>
 #include <gtest/gtest.h>
 #include <immintrin.h>
+#include <vector>
 
 namespace franklin {
 namespace {
@@ -257,5 +259,105 @@ TEST(BF16Test, TiesToEvenRounding) {
   }
 }
 
+// Float bit patterns covering every exponent plus the special cases
+std::vector<float> test_floats(std::size_t count) {
+  std::vector<float> values(count);
+  std::uint32_t state = 12345;
+  for (std::size_t i = 0; i < count; ++i) {
+    state = state * 1664525u + 1013904223u;
+    values[i] = std::bit_cast<float>(state);
+  }
+  const std::uint32_t specials[] = {0x3f808000, 0x3f818000, 0x7f7fffff,
+                                    0x807fffff, 0x7f800001, 0xffc00001,
+                                    0x7f800000, 0x00000000, 0x80000000};
+  for (std::size_t i = 0; i < std::size(specials) && i < count; ++i) {
+    values[i * 7 % count] = std::bit_cast<float>(specials[i]);
+  }
+  return values;
+}
+
+TEST(BF16Test, BulkConversionRoundsToNearestEven) {
+  // Scalar reference for the rules of rounding::nearest_even
+  EXPECT_EQ(bf16::from_float_rne(std::bit_cast<float>(0x3f808000u)).to_bits(),
+            0x3f80);
+  EXPECT_EQ(bf16::from_float_rne(std::bit_cast<float>(0x3f818000u)).to_bits(),
+            0x3f82);
+  EXPECT_EQ(bf16::from_float_rne(std::bit_cast<float>(0x807fffffu)).to_bits(),
+            0x8000);
+  EXPECT_EQ(bf16::from_float_rne(std::bit_cast<float>(0x7f800001u)).to_bits(),
+            0x7fc0);
+  EXPECT_EQ(bf16::from_float_rne(std::bit_cast<float>(0x7f7fffffu)).to_bits(),
+            0x7f80);
+
+  // Vector body and scalar tail agree with the reference, at any alignment
+  const auto values = test_floats(1037);
+  for (std::size_t offset : {0, 1, 3}) {
+    const std::size_t n = values.size() - offset;
+    std::vector<bf16> out(n);
+    bf16::convert(values.data() + offset, out.data(), n);
+    for (std::size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(out[i].to_bits(),
+                bf16::from_float_rne(values[offset + i]).to_bits())
+          << std::hex << std::bit_cast<std::uint32_t>(values[offset + i]);
+    }
+  }
+
+  std::vector<bf16> truncated(values.size());
+  bf16::convert(values.data(), truncated.data(), values.size(),
+                bf16::rounding::truncate);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(truncated[i].to_bits(),
+              bf16::from_float_trunc(values[i]).to_bits());
+  }
+
+  // Widening is exact
+  std::vector<float> widened(values.size());
+  bf16::convert(truncated.data(), widened.data(), truncated.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(std::bit_cast<std::uint32_t>(widened[i]),
+              std::uint32_t{truncated[i].to_bits()} << 16);
+  }
+}
+
+TEST(BF16Test, StochasticRoundingIsUnbiased) {
+  // 30% of the way from 1.0 to the next bf16 value, 1.0078125
+  const float value = 1.0f + 0.3f * 0.0078125f;
+  const std::vector<float> values(100003, value);
+  std::vector<bf16> out(values.size());
+  bf16::convert(values.data(), out.data(), out.size(),
+                bf16::rounding::stochastic, 42);
+  std::size_t up = 0;
+  for (const bf16 v : out) {
+    ASSERT_TRUE(v.to_bits() == 0x3f80 || v.to_bits() == 0x3f81);
+    up += v.to_bits() == 0x3f81;
+  }
+  EXPECT_NEAR(static_cast<double>(up) / out.size(), 0.3, 0.01);
+
+  // Reproducible for a seed, independent of the vector width
+  std::vector<bf16> again(out.size());
+  bf16::convert(values.data(), again.data(), 31, bf16::rounding::stochastic,
+                42); // scalar tail only
+  for (std::size_t i = 0; i < 31; ++i) {
+    ASSERT_EQ(again[i].to_bits(), out[i].to_bits());
+  }
+  bf16::convert(values.data(), again.data(), again.size(),
+                bf16::rounding::stochastic, 43);
+  EXPECT_FALSE(std::equal(out.begin(), out.end(), again.begin(),
+                          [](bf16 a, bf16 b) {
+                            return a.to_bits() == b.to_bits();
+                          }));
+
+  // Exact values, infinities and NaNs are never perturbed
+  const auto specials = test_floats(64);
+  std::vector<bf16> special_out(specials.size());
+  bf16::convert(specials.data(), special_out.data(), specials.size(),
+                bf16::rounding::stochastic, 7);
+  EXPECT_EQ(special_out[28].to_bits(), 0x7fc0); // NaN stays NaN
+  EXPECT_EQ(special_out[35].to_bits(), 0xffc0);
+  EXPECT_EQ(special_out[42].to_bits(), 0x7f80); // infinity
+  EXPECT_EQ(special_out[49].to_bits(), 0x0000);
+  EXPECT_EQ(special_out[56].to_bits(), 0x8000);
+}
+
 } // namespace
 } // namespace franklin
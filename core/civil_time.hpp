@@ -0,0 +1,399 @@
+#ifndef FRANKLIN_CORE_CIVIL_TIME_HPP
+#define FRANKLIN_CORE_CIVIL_TIME_HPP
+
+#include "core/compiler_macros.hpp"
+#include <cstdint>
+#include <immintrin.h>
+
+namespace franklin {
+
+// Dates are days since 1970-01-01 and timestamps microseconds since
+// 1970-01-01 00:00:00 UTC, both in the proleptic Gregorian calendar.
+//
+// Days convert to year, month and day with the algorithm of Neri and
+// Schneider ("Euclidean affine functions and their application to calendar
+// algorithms", 2022): unsigned 32-bit arithmetic in a calendar whose years
+// start on March 1st, where every division is by a constant and becomes a
+// multiply and a shift. It has no branches and no tables, so it runs on 8
+// lanes at once.
+//
+// The epoch is shifted by a multiple of 400 years to keep the arithmetic
+// unsigned. The shift below covers every timestamp (about +-292,000 years);
+// dates outside [min_civil_days, max_civil_days] give unspecified fields.
+
+// Calendar fields computed by extract()
+enum class DatePart {
+  Year,
+  Month,     // 1 to 12
+  Day,       // day of the month, 1 to 31
+  DayOfWeek, // 0 (Sunday) to 6 (Saturday)
+  Hour,      // 0 to 23, timestamps only
+};
+
+// Units date_trunc() rounds down to
+enum class TimeUnit {
+  Hour, // timestamps only
+  Day,
+  Week, // weeks start on Monday
+  Month,
+  Year,
+};
+
+inline constexpr std::int64_t micros_per_hour = 3'600'000'000;
+inline constexpr std::int64_t micros_per_day = 24 * micros_per_hour;
+
+namespace civil_detail {
+
+// Epoch shift of s = 731 periods of 400 years: K moves 1970-01-01 to
+// 0000-03-01 and then s periods further, L is the same shift in years
+inline constexpr std::uint32_t periods = 731;
+inline constexpr std::uint32_t K = 719468 + 146097 * periods;
+inline constexpr std::uint32_t L = 400 * periods;
+
+// (N + offset) % 7 is the weekday of shifted day N, counted from Sunday or
+// from Monday; 1970-01-01 was a Thursday
+inline constexpr std::uint32_t sunday_offset = (4 + 7 - K % 7) % 7;
+inline constexpr std::uint32_t monday_offset = (3 + 7 - K % 7) % 7;
+
+} // namespace civil_detail
+
+// 4 * N + 3 must fit in 32 bits for shifted days N = days + K
+inline constexpr std::int32_t min_civil_days =
+    -static_cast<std::int32_t>(civil_detail::K);
+inline constexpr std::int32_t max_civil_days =
+    static_cast<std::int32_t>((0xFFFFFFFFu - 3) / 4 - civil_detail::K);
+
+struct civil_date {
+  std::int32_t year;
+  std::uint32_t month; // 1 to 12
+  std::uint32_t day;   // 1 to 31
+
+  bool operator==(const civil_date&) const = default;
+};
+
+// ============================================================================
+// Scalar
+// ============================================================================
+
+constexpr civil_date civil_from_days(std::int32_t days) noexcept {
+  using namespace civil_detail;
+  const std::uint32_t N = static_cast<std::uint32_t>(days) + K;
+  // Century, and day of the century
+  const std::uint32_t N_1 = 4 * N + 3;
+  const std::uint32_t C = N_1 / 146097;
+  const std::uint32_t N_C = N_1 % 146097 / 4;
+  // Year of the century, and day of the year (from March 1st)
+  const std::uint32_t N_2 = 4 * N_C + 3;
+  const std::uint64_t P_2 = std::uint64_t{2939745} * N_2;
+  const auto Z = static_cast<std::uint32_t>(P_2 >> 32);
+  const std::uint32_t N_Y = static_cast<std::uint32_t>(P_2) / 2939745 / 4;
+  const std::uint32_t Y = 100 * C + Z;
+  // Month (March is 3) and day
+  const std::uint32_t N_3 = 2141 * N_Y + 197913;
+  const std::uint32_t M = N_3 >> 16;
+  const std::uint32_t D = (N_3 & 0xFFFF) / 2141;
+  // January and February belong to the next civil year
+  const bool J = N_Y >= 306;
+  return {static_cast<std::int32_t>(Y - L + J), J ? M - 12 : M, D + 1};
+}
+
+constexpr std::int32_t days_from_civil(std::int32_t year, std::uint32_t month,
+                                       std::uint32_t day) noexcept {
+  using namespace civil_detail;
+  const bool J = month <= 2;
+  const std::uint32_t Y = static_cast<std::uint32_t>(year) + L - J;
+  const std::uint32_t M = J ? month + 12 : month;
+  const std::uint32_t C = Y / 100;
+  // 1461 * Y / 4, without the product leaving 32 bits
+  const std::uint32_t y_star = 365 * Y + Y / 4 - C + C / 4;
+  const std::uint32_t m_star = (979 * M - 2919) / 32;
+  return static_cast<std::int32_t>(y_star + m_star + day - 1 - K);
+}
+
+constexpr bool is_leap_year(std::int32_t year) noexcept {
+  return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+}
+
+constexpr std::int32_t day_of_week(std::int32_t days) noexcept {
+  const std::uint32_t N = static_cast<std::uint32_t>(days) + civil_detail::K;
+  return static_cast<std::int32_t>((N + civil_detail::sunday_offset) % 7);
+}
+
+constexpr std::int32_t trunc_days(std::int32_t days, TimeUnit unit) noexcept {
+  switch (unit) {
+  case TimeUnit::Week: {
+    const std::uint32_t N =
+        static_cast<std::uint32_t>(days) + civil_detail::K;
+    return days -
+           static_cast<std::int32_t>((N + civil_detail::monday_offset) % 7);
+  }
+  case TimeUnit::Month: {
+    const civil_date date = civil_from_days(days);
+    return days - static_cast<std::int32_t>(date.day - 1);
+  }
+  case TimeUnit::Year: {
+    // From March 1st, which exists for every year in range
+    const std::int32_t year = civil_from_days(days).year;
+    return days_from_civil(year, 3, 1) - 59 - is_leap_year(year);
+  }
+  default:
+    return days;
+  }
+}
+
+// floor(micros / micros_per_day), which fits in an int32 for every int64
+constexpr std::int32_t days_from_micros(std::int64_t micros) noexcept {
+  const std::int64_t q = micros / micros_per_day;
+  return static_cast<std::int32_t>(q - (q * micros_per_day > micros));
+}
+
+// Wraps for the first day of the int64 range, which starts before it, as the
+// vector code does
+constexpr std::int64_t micros_from_days(std::int32_t days) noexcept {
+  return static_cast<std::int64_t>(static_cast<std::uint64_t>(days) *
+                                   micros_per_day);
+}
+
+constexpr std::int32_t date_part(std::int32_t days, DatePart part) noexcept {
+  switch (part) {
+  case DatePart::Year:
+    return civil_from_days(days).year;
+  case DatePart::Month:
+    return static_cast<std::int32_t>(civil_from_days(days).month);
+  case DatePart::Day:
+    return static_cast<std::int32_t>(civil_from_days(days).day);
+  case DatePart::DayOfWeek:
+    return day_of_week(days);
+  default:
+    return 0;
+  }
+}
+
+constexpr std::int32_t timestamp_part(std::int64_t micros,
+                                      DatePart part) noexcept {
+  const std::int32_t days = days_from_micros(micros);
+  if (part == DatePart::Hour) {
+    const std::uint64_t time_of_day = static_cast<std::uint64_t>(micros) -
+                                      static_cast<std::uint64_t>(
+                                          micros_from_days(days));
+    return static_cast<std::int32_t>(time_of_day / micros_per_hour);
+  }
+  return date_part(days, part);
+}
+
+constexpr std::int64_t trunc_micros(std::int64_t micros,
+                                    TimeUnit unit) noexcept {
+  const std::int32_t days = days_from_micros(micros);
+  if (unit == TimeUnit::Hour) {
+    const auto day_start =
+        static_cast<std::uint64_t>(micros_from_days(days));
+    const std::uint64_t time_of_day =
+        static_cast<std::uint64_t>(micros) - day_start;
+    return static_cast<std::int64_t>(
+        day_start + time_of_day / micros_per_hour * micros_per_hour);
+  }
+  return micros_from_days(trunc_days(days, unit));
+}
+
+// ============================================================================
+// 8 dates (int32 lanes)
+// ============================================================================
+
+namespace civil_detail {
+
+// High 32 bits of the unsigned products of 8 lanes with m
+FRANKLIN_FORCE_INLINE __m256i mulhi_epu32(__m256i a, __m256i m) {
+  const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(a, m), 32);
+  const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+  return _mm256_blend_epi32(even, odd, 0b10101010);
+}
+
+// x % 7 for x < 2^31
+FRANKLIN_FORCE_INLINE __m256i mod7_epu32(__m256i x) {
+  const __m256i q = _mm256_srli_epi32(
+      mulhi_epu32(x, _mm256_set1_epi32(static_cast<int>(0x92492493u))), 2);
+  return _mm256_sub_epi32(x, _mm256_mullo_epi32(q, _mm256_set1_epi32(7)));
+}
+
+// Intermediate values of civil_from_days
+struct civil_lanes {
+  __m256i N;   // shifted day
+  __m256i Y;   // year, shifted by L, in years starting on March 1st
+  __m256i N_Y; // day of that year, 0 to 365
+};
+
+// The division steps of civil_from_days, with the divisors as multiplies
+// checked exhaustively over their domains: 4N + 3 < 2^32 for 146097, and
+// the 146097 values of N_C for the year fraction
+FRANKLIN_FORCE_INLINE civil_lanes civil_split_epi32(__m256i days) {
+  const __m256i N = _mm256_add_epi32(days, _mm256_set1_epi32(K));
+  const __m256i N_1 = _mm256_or_si256(_mm256_slli_epi32(N, 2),
+                                      _mm256_set1_epi32(3));
+  const __m256i C = _mm256_srli_epi32(
+      mulhi_epu32(N_1, _mm256_set1_epi32(963315389)), 15);
+  // 4 * N_C + 3
+  const __m256i N_2 = _mm256_or_si256(
+      _mm256_sub_epi32(N_1, _mm256_mullo_epi32(C, _mm256_set1_epi32(146097))),
+      _mm256_set1_epi32(3));
+
+  // 2939745 * N_2 is 42 bits wide: Z is its high half, the day of the year
+  // comes from the low half
+  const __m256i factor = _mm256_set1_epi32(2939745);
+  const __m256i even = _mm256_mul_epu32(N_2, factor);
+  const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(N_2, 32), factor);
+  const __m256i Z =
+      _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0b10101010);
+  const __m256i low =
+      _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0b10101010);
+  const __m256i N_Y =
+      _mm256_srli_epi32(mulhi_epu32(low, _mm256_set1_epi32(1461)), 2);
+
+  const __m256i Y =
+      _mm256_add_epi32(_mm256_mullo_epi32(C, _mm256_set1_epi32(100)), Z);
+  return {N, Y, N_Y};
+}
+
+// All ones where the day falls in January or February
+FRANKLIN_FORCE_INLINE __m256i january_or_february(__m256i N_Y) {
+  return _mm256_cmpgt_epi32(N_Y, _mm256_set1_epi32(305));
+}
+
+// Day of the month minus one, and (shifted) month from 3 to 14
+FRANKLIN_FORCE_INLINE __m256i month_and_day(__m256i N_Y, __m256i& day0) {
+  const __m256i N_3 = _mm256_add_epi32(
+      _mm256_mullo_epi32(N_Y, _mm256_set1_epi32(2141)),
+      _mm256_set1_epi32(197913));
+  // (N_3 & 0xFFFF) / 2141, as a product below 2^32
+  day0 = _mm256_srli_epi32(
+      _mm256_mullo_epi32(_mm256_and_si256(N_3, _mm256_set1_epi32(0xFFFF)),
+                         _mm256_set1_epi32(31345)),
+      26);
+  return _mm256_srli_epi32(N_3, 16);
+}
+
+// All ones where the (shifted, hence non-negative) year is a leap year:
+// divisible by 4, and by 16 if divisible by 25. Divisibility by 25 is
+// Y * 25^-1 mod 2^32 <= (2^32 - 1) / 25.
+FRANKLIN_FORCE_INLINE __m256i leap_year(__m256i Y) {
+  const __m256i p = _mm256_mullo_epi32(
+      Y, _mm256_set1_epi32(static_cast<int>(0xC28F5C29u)));
+  const __m256i by_25 = _mm256_cmpeq_epi32(
+      _mm256_min_epu32(p, _mm256_set1_epi32(0x0A3D70A3)), p);
+  const __m256i mask = _mm256_blendv_epi8(_mm256_set1_epi32(3),
+                                          _mm256_set1_epi32(15), by_25);
+  return _mm256_cmpeq_epi32(_mm256_and_si256(Y, mask),
+                            _mm256_setzero_si256());
+}
+
+} // namespace civil_detail
+
+template <DatePart Part>
+FRANKLIN_FORCE_INLINE __m256i date_part_epi32(__m256i days) {
+  using namespace civil_detail;
+  static_assert(Part != DatePart::Hour, "dates have no hour");
+  if constexpr (Part == DatePart::DayOfWeek) {
+    return mod7_epu32(_mm256_add_epi32(
+        days, _mm256_set1_epi32(static_cast<int>(K + sunday_offset))));
+  } else {
+    const civil_lanes c = civil_split_epi32(days);
+    const __m256i J = january_or_february(c.N_Y);
+    if constexpr (Part == DatePart::Year) {
+      // Y - L + 1 in January and February (J is -1 there)
+      return _mm256_sub_epi32(_mm256_sub_epi32(c.Y, _mm256_set1_epi32(L)), J);
+    } else {
+      __m256i day0;
+      const __m256i M = month_and_day(c.N_Y, day0);
+      if constexpr (Part == DatePart::Month) {
+        return _mm256_sub_epi32(
+            M, _mm256_and_si256(J, _mm256_set1_epi32(12)));
+      } else {
+        return _mm256_add_epi32(day0, _mm256_set1_epi32(1));
+      }
+    }
+  }
+}
+
+template <TimeUnit Unit>
+FRANKLIN_FORCE_INLINE __m256i trunc_days_epi32(__m256i days) {
+  using namespace civil_detail;
+  static_assert(Unit != TimeUnit::Hour, "dates have no hour");
+  if constexpr (Unit == TimeUnit::Day) {
+    return days;
+  } else if constexpr (Unit == TimeUnit::Week) {
+    const __m256i shifted = _mm256_add_epi32(
+        days, _mm256_set1_epi32(static_cast<int>(K + monday_offset)));
+    return _mm256_sub_epi32(days, mod7_epu32(shifted));
+  } else if constexpr (Unit == TimeUnit::Month) {
+    const civil_lanes c = civil_split_epi32(days);
+    __m256i day0;
+    month_and_day(c.N_Y, day0);
+    return _mm256_sub_epi32(days, day0);
+  } else {
+    // Day of the civil year: N_Y - 306 in January and February, else
+    // N_Y + 59 (+1 in leap years) since the year started on March 1st
+    const civil_lanes c = civil_split_epi32(days);
+    const __m256i J = january_or_february(c.N_Y);
+    const __m256i march = _mm256_sub_epi32(
+        _mm256_add_epi32(c.N_Y, _mm256_set1_epi32(59)), leap_year(c.Y));
+    const __m256i day_of_year = _mm256_blendv_epi8(
+        march, _mm256_sub_epi32(c.N_Y, _mm256_set1_epi32(306)), J);
+    return _mm256_sub_epi32(days, day_of_year);
+  }
+}
+
+// ============================================================================
+// 4 timestamps (int64 lanes)
+// ============================================================================
+
+// floor(micros / micros_per_day) of 4 lanes as int32, and the time of day
+// in [0, micros_per_day) as int64. micros_per_day is 2^13 * 10546875: the
+// shift floors exactly and leaves |v| < 2^50. The quotient by 10546875 goes
+// through the fp64 reciprocal: its error is below the spacing 1 / 10546875
+// of the exact quotients, so only exact multiples could floor one low, and
+// none of the 2^51 / 10546875 of them does (checked exhaustively).
+FRANKLIN_FORCE_INLINE __m128i days_from_micros_epi64(__m256i micros,
+                                                     __m256i& time_of_day) {
+  const __m256i negative =
+      _mm256_cmpgt_epi64(_mm256_setzero_si256(), micros);
+  const __m256i v = _mm256_or_si256(_mm256_srli_epi64(micros, 13),
+                                    _mm256_slli_epi64(negative, 51));
+  // int64 -> fp64 for |v| < 2^51 through the bits of 1.5 * 2^52 + v
+  const __m256d magic = _mm256_set1_pd(6755399441055744.0);
+  const __m256d v_pd = _mm256_sub_pd(
+      _mm256_castsi256_pd(_mm256_add_epi64(v, _mm256_castpd_si256(magic))),
+      magic);
+  const __m256d q = _mm256_round_pd(
+      _mm256_mul_pd(v_pd, _mm256_set1_pd(1.0 / 10546875.0)),
+      _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+  const __m128i days = _mm256_cvttpd_epi32(q);
+
+  const __m256i day_start = _mm256_slli_epi64(
+      _mm256_mul_epi32(_mm256_cvtepi32_epi64(days),
+                       _mm256_set1_epi64x(10546875)),
+      13);
+  time_of_day = _mm256_sub_epi64(micros, day_start);
+  return days;
+}
+
+FRANKLIN_FORCE_INLINE __m256i micros_from_days_epi32(__m128i days) {
+  return _mm256_slli_epi64(_mm256_mul_epi32(_mm256_cvtepi32_epi64(days),
+                                            _mm256_set1_epi64x(10546875)),
+                           13);
+}
+
+// time_of_day / micros_per_hour for times of day in [0, micros_per_day),
+// through the reciprocal as above
+FRANKLIN_FORCE_INLINE __m128i hour_epi64(__m256i time_of_day) {
+  const __m256d magic = _mm256_set1_pd(6755399441055744.0);
+  const __m256d t = _mm256_sub_pd(
+      _mm256_castsi256_pd(
+          _mm256_add_epi64(time_of_day, _mm256_castpd_si256(magic))),
+      magic);
+  // t >= 0, so truncation floors
+  return _mm256_cvttpd_epi32(
+      _mm256_mul_pd(t, _mm256_set1_pd(1.0 / micros_per_hour)));
+}
+
+} // namespace franklin
+
+#endif // FRANKLIN_CORE_CIVIL_TIME_HPP
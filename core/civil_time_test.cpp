@@ -0,0 +1,199 @@
+#include "core/civil_time.hpp"
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <immintrin.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace franklin {
+namespace {
+
+constexpr std::int64_t min64 = std::numeric_limits<std::int64_t>::min();
+constexpr std::int64_t max64 = std::numeric_limits<std::int64_t>::max();
+
+static_assert(civil_from_days(0) == civil_date{1970, 1, 1});
+static_assert(civil_from_days(-1) == civil_date{1969, 12, 31});
+static_assert(days_from_civil(2000, 3, 1) == 11017);
+static_assert(day_of_week(0) == 4); // Thursday
+
+TEST(CivilTimeTest, MatchesChrono) {
+  using namespace std::chrono;
+  // Every day from year -2000 to 4000, which spans all the cases of the
+  // leap year rule
+  const int first = sys_days{year{-2000} / 1 / 1}.time_since_epoch().count();
+  const int last = sys_days{year{4000} / 12 / 31}.time_since_epoch().count();
+  for (int d = first; d <= last; ++d) {
+    const year_month_day ymd{sys_days{days{d}}};
+    const civil_date date = civil_from_days(d);
+    ASSERT_EQ(date.year, static_cast<int>(ymd.year())) << d;
+    ASSERT_EQ(date.month, static_cast<unsigned>(ymd.month())) << d;
+    ASSERT_EQ(date.day, static_cast<unsigned>(ymd.day())) << d;
+    ASSERT_EQ(days_from_civil(date.year, date.month, date.day), d);
+
+    const weekday wd{sys_days{days{d}}};
+    ASSERT_EQ(day_of_week(d), static_cast<int>(wd.c_encoding())) << d;
+    const int monday = (wd - Monday).count();
+    ASSERT_EQ(trunc_days(d, TimeUnit::Week), d - monday) << d;
+    ASSERT_EQ(trunc_days(d, TimeUnit::Month),
+              sys_days{ymd.year() / ymd.month() / 1}.time_since_epoch().count())
+        << d;
+    ASSERT_EQ(trunc_days(d, TimeUnit::Year),
+              sys_days{ymd.year() / 1 / 1}.time_since_epoch().count())
+        << d;
+  }
+}
+
+TEST(CivilTimeTest, RoundTripsOverTheWholeRange) {
+  std::mt19937 rng(3);
+  std::uniform_int_distribution<std::int32_t> dist(min_civil_days,
+                                                   max_civil_days);
+  std::vector<std::int32_t> values = {min_civil_days, max_civil_days};
+  for (int i = 0; i < 100000; ++i) {
+    values.push_back(dist(rng));
+  }
+  for (const std::int32_t d : values) {
+    const civil_date date = civil_from_days(d);
+    ASSERT_EQ(days_from_civil(date.year, date.month, date.day), d) << d;
+    ASSERT_GE(date.month, 1u);
+    ASSERT_LE(date.month, 12u);
+    ASSERT_GE(date.day, 1u);
+    ASSERT_LE(date.day, 31u);
+  }
+  // The earliest timestamp is in range
+  EXPECT_GE(days_from_micros(min64), min_civil_days);
+}
+
+TEST(CivilTimeTest, SplitsTimestamps) {
+  EXPECT_EQ(days_from_micros(0), 0);
+  EXPECT_EQ(days_from_micros(-1), -1);
+  EXPECT_EQ(days_from_micros(micros_per_day), 1);
+  EXPECT_EQ(days_from_micros(-micros_per_day), -1);
+  EXPECT_EQ(days_from_micros(-micros_per_day - 1), -2);
+  // 2024-02-29 13:45:00.5
+  const std::int64_t t = micros_from_days(days_from_civil(2024, 2, 29)) +
+                         13 * micros_per_hour + 2'700'500'000;
+  EXPECT_EQ(timestamp_part(t, DatePart::Year), 2024);
+  EXPECT_EQ(timestamp_part(t, DatePart::Month), 2);
+  EXPECT_EQ(timestamp_part(t, DatePart::Day), 29);
+  EXPECT_EQ(timestamp_part(t, DatePart::DayOfWeek), 4);
+  EXPECT_EQ(timestamp_part(t, DatePart::Hour), 13);
+  EXPECT_EQ(trunc_micros(t, TimeUnit::Hour),
+            t - 2'700'500'000);
+  EXPECT_EQ(trunc_micros(t, TimeUnit::Day), t - 13 * micros_per_hour -
+                                                2'700'500'000);
+  EXPECT_EQ(trunc_micros(t, TimeUnit::Month),
+            micros_from_days(days_from_civil(2024, 2, 1)));
+  // Before the epoch, hours still count from midnight
+  EXPECT_EQ(timestamp_part(-1, DatePart::Hour), 23);
+  EXPECT_EQ(trunc_micros(-1, TimeUnit::Hour), -micros_per_hour);
+}
+
+template <DatePart Part> void expect_vector_part_matches(
+    const std::vector<std::int32_t>& days) {
+  for (std::size_t i = 0; i + 8 <= days.size(); i += 8) {
+    alignas(32) std::int32_t out[8];
+    _mm256_store_si256(
+        reinterpret_cast<__m256i*>(out),
+        date_part_epi32<Part>(_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(days.data() + i))));
+    for (std::size_t j = 0; j < 8; ++j) {
+      ASSERT_EQ(out[j], date_part(days[i + j], Part))
+          << days[i + j] << " part " << static_cast<int>(Part);
+    }
+  }
+}
+
+template <TimeUnit Unit> void expect_vector_trunc_matches(
+    const std::vector<std::int32_t>& days) {
+  for (std::size_t i = 0; i + 8 <= days.size(); i += 8) {
+    alignas(32) std::int32_t out[8];
+    _mm256_store_si256(
+        reinterpret_cast<__m256i*>(out),
+        trunc_days_epi32<Unit>(_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(days.data() + i))));
+    for (std::size_t j = 0; j < 8; ++j) {
+      ASSERT_EQ(out[j], trunc_days(days[i + j], Unit))
+          << days[i + j] << " unit " << static_cast<int>(Unit);
+    }
+  }
+}
+
+TEST(CivilTimeTest, VectorDatesMatchScalar) {
+  // One whole 400-year cycle reaches every day of the century and of the
+  // year that the multiply-and-shift divisions see, then the edges and
+  // random days of the whole range
+  std::vector<std::int32_t> days;
+  for (std::int32_t d = -146097 / 2; d < 146097 / 2 + 8; ++d) {
+    days.push_back(d);
+  }
+  for (std::int32_t d = 0; d < 8; ++d) {
+    days.push_back(min_civil_days + d);
+    days.push_back(max_civil_days - d);
+  }
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<std::int32_t> dist(min_civil_days,
+                                                   max_civil_days);
+  for (int i = 0; i < 100000; ++i) {
+    days.push_back(dist(rng));
+  }
+
+  expect_vector_part_matches<DatePart::Year>(days);
+  expect_vector_part_matches<DatePart::Month>(days);
+  expect_vector_part_matches<DatePart::Day>(days);
+  expect_vector_part_matches<DatePart::DayOfWeek>(days);
+  expect_vector_trunc_matches<TimeUnit::Week>(days);
+  expect_vector_trunc_matches<TimeUnit::Month>(days);
+  expect_vector_trunc_matches<TimeUnit::Year>(days);
+}
+
+TEST(CivilTimeTest, VectorTimestampsMatchScalar) {
+  std::vector<std::int64_t> values = {0, -1, 1, min64, max64, min64 + 1,
+                                      max64 - 1};
+  for (std::int64_t k : {-3, -2, -1, 0, 1, 2, 3, 1000000, -1000000}) {
+    for (std::int64_t delta : {-1, 0, 1}) {
+      values.push_back(k * micros_per_day + delta);
+      values.push_back(k * micros_per_hour + delta);
+    }
+  }
+  // Exact multiples are where a reciprocal quotient comes out low
+  for (std::int64_t k = -1000000; k <= 1000000; k += 37) {
+    values.push_back(k * micros_per_day);
+    values.push_back(k * micros_per_day + k % 24 * micros_per_hour);
+  }
+  std::mt19937_64 rng(11);
+  for (int i = 0; i < 100000; ++i) {
+    const auto bits = static_cast<std::int64_t>(rng());
+    values.push_back(bits);
+    values.push_back(bits >> (rng() % 63));
+  }
+  while (values.size() % 4 != 0) {
+    values.push_back(0);
+  }
+
+  for (std::size_t i = 0; i < values.size(); i += 4) {
+    __m256i time_of_day;
+    const __m128i days = days_from_micros_epi64(
+        _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(values.data() + i)),
+        time_of_day);
+    alignas(16) std::int32_t day_out[4];
+    alignas(16) std::int32_t hour_out[4];
+    alignas(32) std::int64_t start_out[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(day_out), days);
+    _mm_store_si128(reinterpret_cast<__m128i*>(hour_out),
+                    hour_epi64(time_of_day));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(start_out),
+                       micros_from_days_epi32(days));
+    for (std::size_t j = 0; j < 4; ++j) {
+      const std::int64_t t = values[i + j];
+      ASSERT_EQ(day_out[j], days_from_micros(t)) << t;
+      ASSERT_EQ(hour_out[j], timestamp_part(t, DatePart::Hour)) << t;
+      ASSERT_EQ(start_out[j], trunc_micros(t, TimeUnit::Day)) << t;
+    }
+  }
+}
+
+} // namespace
+} // namespace franklin
@@ -15,6 +15,9 @@ public:
     Int32Default,
     Float32Default,
     BF16Default,
+    Decimal64,       // any scale; the scale is part of the column policy
+    Date32,          // days since 1970-01-01
+    TimestampMicros, // microseconds since 1970-01-01 00:00:00 UTC
     Unknown = std::numeric_limits<std::underlying_type_t<Enum>>::max()
   };
 
@@ -29,6 +32,12 @@ public:
       return "Float32Default"sv;
     case BF16Default:
       return "BF16Default"sv;
+    case Decimal64:
+      return "Decimal64"sv;
+    case Date32:
+      return "Date32"sv;
+    case TimestampMicros:
+      return "TimestampMicros"sv;
     case Unknown:
       [[fallthrough]];
     default:
@@ -0,0 +1,116 @@
+#ifndef FRANKLIN_CORE_DECIMAL_HPP
+#define FRANKLIN_CORE_DECIMAL_HPP
+
+#include "core/compiler_macros.hpp"
+#include "core/decimal_scalar.hpp"
+#include <cstdint>
+#include <immintrin.h>
+#include <limits>
+
+namespace franklin {
+
+// Vectorized counterparts of the scalar decimal helpers in
+// core/decimal_scalar.hpp, on four int64 lanes. Needs AVX2 (and AVX-512DQ/VL
+// for the native 64-bit multiply).
+
+// ============================================================================
+// Int64 lanes
+// ============================================================================
+
+// All ones in the lanes of x that are negative
+FRANKLIN_FORCE_INLINE __m256i negative_epi64(__m256i x) {
+  return _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+}
+
+// |x|, with |INT64_MIN| = 2^63 read as unsigned
+FRANKLIN_FORCE_INLINE __m256i abs_epi64(__m256i x, __m256i negative) {
+  return _mm256_sub_epi64(_mm256_xor_si256(x, negative), negative);
+}
+
+// Unsigned a > b
+FRANKLIN_FORCE_INLINE __m256i cmpgt_epu64(__m256i a, __m256i b) {
+  const __m256i bias =
+      _mm256_set1_epi64x(std::numeric_limits<long long>::min());
+  return _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias),
+                            _mm256_xor_si256(b, bias));
+}
+
+// Low 64 bits of a * b
+FRANKLIN_FORCE_INLINE __m256i mullo_epi64(__m256i a, __m256i b) {
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+  return _mm256_mullo_epi64(a, b);
+#else
+  const __m256i cross =
+      _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                       _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+  return _mm256_add_epi64(_mm256_mul_epu32(a, b),
+                          _mm256_slli_epi64(cross, 32));
+#endif
+}
+
+// High 64 bits of the unsigned 128-bit product a * b, from the four 32x32
+// partial products; neither partial sum can carry out of 64 bits
+FRANKLIN_FORCE_INLINE __m256i mulhi_epu64(__m256i a, __m256i b) {
+  const __m256i low32 = _mm256_set1_epi64x(0xffffffff);
+  const __m256i a_hi = _mm256_srli_epi64(a, 32);
+  const __m256i b_hi = _mm256_srli_epi64(b, 32);
+  const __m256i ll = _mm256_mul_epu32(a, b);
+  const __m256i lh = _mm256_mul_epu32(a, b_hi);
+  const __m256i hl = _mm256_mul_epu32(a_hi, b);
+  const __m256i hh = _mm256_mul_epu32(a_hi, b_hi);
+  const __m256i mid = _mm256_add_epi64(lh, _mm256_srli_epi64(ll, 32));
+  const __m256i mid2 = _mm256_add_epi64(hl, _mm256_and_si256(mid, low32));
+  return _mm256_add_epi64(
+      _mm256_add_epi64(hh, _mm256_srli_epi64(mid, 32)),
+      _mm256_srli_epi64(mid2, 32));
+}
+
+// Magnitudes u <= 2^63 divided by 10^k and rounded with Mode, for dividends
+// whose sign is `negative`
+template <RoundingMode Mode>
+FRANKLIN_FORCE_INLINE __m256i divide_pow10_epu64(__m256i u, __m256i negative,
+                                                 const pow10_divisor& div) {
+  const __m256i d = _mm256_set1_epi64x(static_cast<long long>(div.d));
+  const __m256i q = _mm256_srl_epi64(
+      mulhi_epu64(u, _mm256_set1_epi64x(static_cast<long long>(div.magic))),
+      _mm_cvtsi32_si128(static_cast<int>(div.shift)));
+  // q * d <= u, and r < d < 2^60 compares as signed
+  const __m256i r = _mm256_sub_epi64(u, mullo_epi64(q, d));
+  __m256i away;
+  if constexpr (Mode == RoundingMode::HalfEven ||
+                Mode == RoundingMode::HalfUp) {
+    // Compare 2r with d: both below 2^61
+    const __m256i twice = _mm256_add_epi64(r, r);
+    away = _mm256_cmpgt_epi64(twice, d);
+    const __m256i tie = _mm256_cmpeq_epi64(twice, d);
+    if constexpr (Mode == RoundingMode::HalfEven) {
+      const __m256i odd = _mm256_cmpeq_epi64(
+          _mm256_and_si256(q, _mm256_set1_epi64x(1)), _mm256_set1_epi64x(1));
+      away = _mm256_or_si256(away, _mm256_and_si256(tie, odd));
+    } else {
+      away = _mm256_or_si256(away, tie);
+    }
+  } else if constexpr (Mode == RoundingMode::TowardZero) {
+    return q;
+  } else {
+    const __m256i inexact = _mm256_xor_si256(
+        _mm256_cmpeq_epi64(r, _mm256_setzero_si256()), _mm256_set1_epi64x(-1));
+    away = Mode == RoundingMode::Floor ? _mm256_and_si256(inexact, negative)
+                                       : _mm256_andnot_si256(negative, inexact);
+  }
+  return _mm256_sub_epi64(q, away);
+}
+
+// x / 10^k rounded with Mode on 4 int64 lanes; exact for every int64
+template <RoundingMode Mode>
+FRANKLIN_FORCE_INLINE __m256i divide_pow10_epi64(__m256i x,
+                                                 const pow10_divisor& div) {
+  const __m256i negative = negative_epi64(x);
+  const __m256i q =
+      divide_pow10_epu64<Mode>(abs_epi64(x, negative), negative, div);
+  return _mm256_sub_epi64(_mm256_xor_si256(q, negative), negative);
+}
+
+} // namespace franklin
+
+#endif // FRANKLIN_CORE_DECIMAL_HPP
@@ -0,0 +1,231 @@
+#ifndef FRANKLIN_CORE_DECIMAL_SCALAR_HPP
+#define FRANKLIN_CORE_DECIMAL_SCALAR_HPP
+
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace franklin {
+
+// Fixed-point decimals: an int64 raw value and a scale, the value being
+// raw / 10^scale, so 12.34 is 1234 at scale 2. Sums and differences at one
+// scale are exact; products and conversions to a smaller scale have more
+// fractional digits than the result keeps and round with a RoundingMode.
+
+enum class RoundingMode {
+  HalfEven,   // to nearest, ties to even (banker's rounding)
+  HalfUp,     // to nearest, ties away from zero
+  TowardZero, // truncate
+  Floor,      // toward negative infinity
+  Ceiling,    // toward positive infinity
+};
+
+// 10^18 is the largest power of ten in an int64
+inline constexpr unsigned max_decimal_scale = 18;
+
+constexpr std::int64_t pow10_i64(unsigned k) noexcept {
+  std::int64_t p = 1;
+  for (unsigned i = 0; i < k; ++i) {
+    p *= 10;
+  }
+  return p;
+}
+
+// A decimal scalar, e.g. a literal. Columns keep their scale in the policy
+// and store only the raw values.
+struct decimal64 {
+  std::int64_t raw = 0;
+  unsigned scale = 0;
+
+  // "-12.340" -> {-12340, 3}; nullopt for malformed text, more than
+  // max_decimal_scale fractional digits or values out of range
+  static std::optional<decimal64> parse(std::string_view text) noexcept;
+
+  // The same value at another scale, rounded when the scale shrinks; nullopt
+  // when it does not fit
+  std::optional<std::int64_t>
+  rescaled(unsigned to,
+           RoundingMode rounding = RoundingMode::HalfEven) const noexcept;
+
+  double to_double() const noexcept {
+    return static_cast<double>(raw) / static_cast<double>(pow10_i64(scale));
+  }
+
+  std::string to_string() const;
+
+  bool operator==(const decimal64&) const = default;
+};
+
+// ============================================================================
+// Division by 10^k
+// ============================================================================
+
+// u / 10^k for u <= 2^63 as a multiply-high and a shift (Granlund and
+// Montgomery): with 2^(l-1) < d <= 2^l and magic = floor(2^(63+l) / d) + 1,
+// floor(u / d) == (magic * u) >> (63 + l) for every 63-bit u and for 2^63,
+// and magic fits in 64 bits since d is not a power of two.
+struct pow10_divisor {
+  std::uint64_t d;     // 10^k, k >= 1
+  std::uint64_t magic; // floor(2^(63+l) / d) + 1
+  unsigned shift;      // l - 1, applied to the high half of magic * u
+
+  static constexpr pow10_divisor make(unsigned k) noexcept {
+    const auto d = static_cast<std::uint64_t>(pow10_i64(k));
+    const unsigned l = std::bit_width(d - 1);
+    const auto magic = static_cast<std::uint64_t>(
+        ((static_cast<unsigned __int128>(1) << (63 + l)) / d) + 1);
+    return {d, magic, l - 1};
+  }
+};
+
+// Whether a quotient of magnitude q with remainder r of division by d moves
+// one away from zero under Mode; `negative` is the sign of the dividend
+template <RoundingMode Mode>
+constexpr bool round_away(std::uint64_t q, std::uint64_t r, std::uint64_t d,
+                          bool negative) noexcept {
+  if constexpr (Mode == RoundingMode::HalfEven) {
+    return r > d - r || (r == d - r && (q & 1) != 0);
+  } else if constexpr (Mode == RoundingMode::HalfUp) {
+    return r >= d - r;
+  } else if constexpr (Mode == RoundingMode::TowardZero) {
+    return false;
+  } else if constexpr (Mode == RoundingMode::Floor) {
+    return negative && r != 0;
+  } else {
+    return !negative && r != 0;
+  }
+}
+
+// x / 10^k rounded with Mode, exact for every int64 x
+template <RoundingMode Mode>
+constexpr std::int64_t divide_pow10(std::int64_t x, unsigned k) noexcept {
+  if (k == 0) {
+    return x;
+  }
+  const auto d = static_cast<std::uint64_t>(pow10_i64(k));
+  const bool negative = x < 0;
+  const auto bits = static_cast<std::uint64_t>(x);
+  const std::uint64_t u = negative ? 0 - bits : bits;
+  std::uint64_t q = u / d;
+  q += round_away<Mode>(q, u - q * d, d, negative);
+  return negative ? static_cast<std::int64_t>(0 - q)
+                  : static_cast<std::int64_t>(q);
+}
+
+inline std::int64_t divide_pow10(std::int64_t x, unsigned k,
+                                 RoundingMode rounding) noexcept {
+  switch (rounding) {
+  case RoundingMode::HalfEven:
+    return divide_pow10<RoundingMode::HalfEven>(x, k);
+  case RoundingMode::HalfUp:
+    return divide_pow10<RoundingMode::HalfUp>(x, k);
+  case RoundingMode::TowardZero:
+    return divide_pow10<RoundingMode::TowardZero>(x, k);
+  case RoundingMode::Floor:
+    return divide_pow10<RoundingMode::Floor>(x, k);
+  case RoundingMode::Ceiling:
+    return divide_pow10<RoundingMode::Ceiling>(x, k);
+  }
+  return x;
+}
+
+// a * b / 10^k rounded with Mode, exact for every pair of int64: the
+// product of two decimals at scale k, back at scale k. The result may not
+// fit in an int64.
+template <RoundingMode Mode>
+constexpr __int128 multiply_round(std::int64_t a, std::int64_t b,
+                                  unsigned k) noexcept {
+  const __int128 product = static_cast<__int128>(a) * b;
+  if (k == 0) {
+    return product;
+  }
+  // |a * b| <= 2^126, so the magnitude and the quotient are signed-safe
+  const bool negative = product < 0;
+  const auto u = static_cast<unsigned __int128>(negative ? -product : product);
+  const auto d = static_cast<std::uint64_t>(pow10_i64(k));
+  unsigned __int128 q = u / d;
+  const auto r = static_cast<std::uint64_t>(u - q * d);
+  q += round_away<Mode>(static_cast<std::uint64_t>(q), r, d, negative);
+  return negative ? -static_cast<__int128>(q) : static_cast<__int128>(q);
+}
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+inline std::optional<decimal64>
+decimal64::parse(std::string_view text) noexcept {
+  const bool negative = !text.empty() && text.front() == '-';
+  if (negative || (!text.empty() && text.front() == '+')) {
+    text.remove_prefix(1);
+  }
+  const std::size_t dot = text.find('.');
+  std::string_view whole = text.substr(0, dot);
+  std::string_view fraction =
+      dot == std::string_view::npos ? std::string_view{} : text.substr(dot + 1);
+  if ((whole.empty() && fraction.empty()) ||
+      fraction.size() > max_decimal_scale) {
+    return std::nullopt;
+  }
+  // Accumulate the magnitude negatively, so INT64_MIN parses
+  std::int64_t raw = 0;
+  for (std::string_view part : {whole, fraction}) {
+    for (char c : part) {
+      if (c < '0' || c > '9' ||
+          __builtin_mul_overflow(raw, 10, &raw) ||
+          __builtin_sub_overflow(raw, c - '0', &raw)) {
+        return std::nullopt;
+      }
+    }
+  }
+  if (!negative && raw == std::numeric_limits<std::int64_t>::min()) {
+    return std::nullopt;
+  }
+  return decimal64{negative ? raw : -raw,
+                   static_cast<unsigned>(fraction.size())};
+}
+
+inline std::optional<std::int64_t>
+decimal64::rescaled(unsigned to, RoundingMode rounding) const noexcept {
+  if (to > max_decimal_scale) {
+    return std::nullopt;
+  }
+  if (to <= scale) {
+    return divide_pow10(raw, scale - to, rounding);
+  }
+  std::int64_t result = 0;
+  if (__builtin_mul_overflow(raw, pow10_i64(to - scale), &result)) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+inline std::string decimal64::to_string() const {
+  const bool negative = raw < 0;
+  const std::uint64_t magnitude =
+      negative ? 0 - static_cast<std::uint64_t>(raw)
+               : static_cast<std::uint64_t>(raw);
+  char digits[24];
+  const auto end =
+      std::to_chars(digits, digits + sizeof(digits), magnitude).ptr;
+  std::string text(digits, end);
+  if (scale > 0) {
+    if (text.size() <= scale) {
+      text.insert(0, scale + 1 - text.size(), '0');
+    }
+    text.insert(text.size() - scale, 1, '.');
+  }
+  if (negative) {
+    text.insert(0, 1, '-');
+  }
+  return text;
+}
+
+} // namespace franklin
+
+#endif // FRANKLIN_CORE_DECIMAL_SCALAR_HPP
@@ -0,0 +1,136 @@
+#include "core/decimal.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <immintrin.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace franklin {
+namespace {
+
+constexpr std::int64_t min64 = std::numeric_limits<std::int64_t>::min();
+constexpr std::int64_t max64 = std::numeric_limits<std::int64_t>::max();
+
+TEST(DecimalTest, ParsesAndPrints) {
+  EXPECT_EQ(decimal64::parse("12.34"), (decimal64{1234, 2}));
+  EXPECT_EQ(decimal64::parse("-0.050"), (decimal64{-50, 3}));
+  EXPECT_EQ(decimal64::parse("+7"), (decimal64{7, 0}));
+  EXPECT_EQ(decimal64::parse(".5"), (decimal64{5, 1}));
+  EXPECT_EQ(decimal64::parse("-9223372036854775808"), (decimal64{min64, 0}));
+  EXPECT_EQ(decimal64::parse("9223372036854775808"), std::nullopt);
+  EXPECT_EQ(decimal64::parse("0.1234567890123456789"), std::nullopt);
+  for (const char* bad : {"", "-", ".", "1.2.3", "1e5", "12a", "1_000"}) {
+    EXPECT_EQ(decimal64::parse(bad), std::nullopt) << bad;
+  }
+
+  EXPECT_EQ((decimal64{1234, 2}).to_string(), "12.34");
+  EXPECT_EQ((decimal64{-5, 3}).to_string(), "-0.005");
+  EXPECT_EQ((decimal64{min64, 4}).to_string(), "-922337203685477.5808");
+  EXPECT_EQ((decimal64{42, 0}).to_string(), "42");
+  EXPECT_DOUBLE_EQ((decimal64{-1250, 3}).to_double(), -1.25);
+}
+
+TEST(DecimalTest, RescalesWithEachRoundingMode) {
+  // value, then the results of HalfEven, HalfUp, TowardZero, Floor, Ceiling
+  // at one fractional digit fewer
+  const std::int64_t cases[][6] = {
+      {25, 2, 3, 2, 2, 3},      {35, 4, 4, 3, 3, 4},
+      {-25, -2, -3, -2, -3, -2}, {-35, -4, -4, -3, -4, -3},
+      {26, 3, 3, 2, 2, 3},      {-24, -2, -2, -2, -3, -2},
+      {20, 2, 2, 2, 2, 2},      {-20, -2, -2, -2, -2, -2}};
+  const RoundingMode modes[] = {RoundingMode::HalfEven, RoundingMode::HalfUp,
+                                RoundingMode::TowardZero, RoundingMode::Floor,
+                                RoundingMode::Ceiling};
+  for (const auto& c : cases) {
+    for (int m = 0; m < 5; ++m) {
+      EXPECT_EQ((decimal64{c[0], 1}).rescaled(0, modes[m]), c[m + 1])
+          << c[0] << " mode " << m;
+    }
+  }
+  EXPECT_EQ((decimal64{1234, 2}).rescaled(4), 123400);
+  EXPECT_EQ((decimal64{max64 / 10, 0}).rescaled(1), max64 / 10 * 10);
+  EXPECT_EQ((decimal64{max64 / 10 + 1, 0}).rescaled(1), std::nullopt);
+  EXPECT_EQ((decimal64{1, 0}).rescaled(19), std::nullopt);
+}
+
+TEST(DecimalTest, MultipliesInto128Bits) {
+  // 0.25 * 0.10 = 0.025 at two decimals
+  EXPECT_EQ(multiply_round<RoundingMode::HalfEven>(25, 10, 2), 2);
+  EXPECT_EQ(multiply_round<RoundingMode::HalfUp>(25, 10, 2), 3);
+  EXPECT_EQ(multiply_round<RoundingMode::Floor>(-25, 10, 2), -3);
+  EXPECT_EQ(multiply_round<RoundingMode::Ceiling>(-25, 10, 2), -2);
+  // 9.22... * 9.22... at 18 decimals is 85.07..., beyond an int64
+  const __int128 square = multiply_round<RoundingMode::TowardZero>(
+      max64, max64, max_decimal_scale);
+  EXPECT_EQ(square, static_cast<__int128>(max64) * max64 /
+                        pow10_i64(max_decimal_scale));
+  EXPECT_EQ(multiply_round<RoundingMode::HalfEven>(min64, -1, 0),
+            -static_cast<__int128>(min64));
+}
+
+template <RoundingMode Mode> void expect_vector_division_matches() {
+  std::mt19937_64 rng(5);
+  std::vector<std::int64_t> values = {0,         1,          -1,     5,
+                                      -5,        15,         -15,    25,
+                                      max64,     min64,      max64 - 1,
+                                      min64 + 1, 999999999,  -1000000000};
+  for (int i = 0; i < 4000; ++i) {
+    // Uniform bits, and values of every magnitude
+    const auto bits = static_cast<std::int64_t>(rng());
+    values.push_back(bits);
+    values.push_back(bits >> (rng() % 63));
+  }
+  for (unsigned k = 1; k <= max_decimal_scale; ++k) {
+    const auto divisor = pow10_divisor::make(k);
+    // Ties at this k
+    const std::int64_t half = pow10_i64(k) / 2;
+    values.push_back(3 * pow10_i64(k) + half);
+    values.push_back(-4 * pow10_i64(k) - half);
+    for (std::size_t i = 0; i + 4 <= values.size(); i += 4) {
+      const __m256i x = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(values.data() + i));
+      alignas(32) std::int64_t out[4];
+      _mm256_store_si256(reinterpret_cast<__m256i*>(out),
+                         divide_pow10_epi64<Mode>(x, divisor));
+      for (std::size_t j = 0; j < 4; ++j) {
+        ASSERT_EQ(out[j], divide_pow10<Mode>(values[i + j], k))
+            << values[i + j] << " / 10^" << k;
+      }
+    }
+  }
+}
+
+TEST(DecimalTest, VectorDivisionMatchesScalar) {
+  expect_vector_division_matches<RoundingMode::HalfEven>();
+  expect_vector_division_matches<RoundingMode::HalfUp>();
+  expect_vector_division_matches<RoundingMode::TowardZero>();
+  expect_vector_division_matches<RoundingMode::Floor>();
+  expect_vector_division_matches<RoundingMode::Ceiling>();
+}
+
+TEST(DecimalTest, VectorProductsMatchInt128) {
+  std::mt19937_64 rng(9);
+  for (int i = 0; i < 10000; ++i) {
+    alignas(32) std::uint64_t a[4];
+    alignas(32) std::uint64_t b[4];
+    for (int j = 0; j < 4; ++j) {
+      a[j] = rng() >> (rng() % 64);
+      b[j] = rng() >> (rng() % 64);
+    }
+    const __m256i va = _mm256_load_si256(reinterpret_cast<const __m256i*>(a));
+    const __m256i vb = _mm256_load_si256(reinterpret_cast<const __m256i*>(b));
+    alignas(32) std::uint64_t lo[4];
+    alignas(32) std::uint64_t hi[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lo), mullo_epi64(va, vb));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(hi), mulhi_epu64(va, vb));
+    for (int j = 0; j < 4; ++j) {
+      const auto product = static_cast<unsigned __int128>(a[j]) * b[j];
+      ASSERT_EQ(lo[j], static_cast<std::uint64_t>(product));
+      ASSERT_EQ(hi[j], static_cast<std::uint64_t>(product >> 64));
+    }
+  }
+}
+
+} // namespace
+} // namespace franklin
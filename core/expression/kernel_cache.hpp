@@ -0,0 +1,249 @@
+#ifndef FRANKLIN_CORE_EXPRESSION_KERNEL_CACHE_HPP
+#define FRANKLIN_CORE_EXPRESSION_KERNEL_CACHE_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+namespace franklin::expression {
+
+// Bump whenever the on-disk layout below changes
+inline constexpr std::uint32_t kernel_cache_format_version = 1;
+
+// CPU feature flags of the host (the "flags" line of /proc/cpuinfo). Part of
+// every cache key: code generated for one feature set must not be loaded on a
+// host lacking any of them.
+inline std::string host_cpu_features() {
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    if (line.rfind("flags", 0) == 0) {
+      auto colon = line.find(':');
+      return colon == std::string::npos ? line : line.substr(colon + 1);
+    }
+  }
+  return "unknown";
+}
+
+// FNV-1a, used for file names and payload checksums (not for security: the
+// cache directory must only be writable by the service itself)
+inline std::uint64_t fnv1a64(std::string_view bytes,
+                             std::uint64_t hash = 0xcbf29ce484222325ULL) {
+  for (unsigned char ch : bytes) {
+    hash = (hash ^ ch) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+// host_cpu_features() condensed to 16 hex digits, for cache targets. The
+// flags line runs to well over a kilobyte on recent CPUs and would not fit
+// the entry header next to the shape.
+inline std::string host_cpu_features_digest() {
+  char digest[17];
+  std::snprintf(digest, sizeof(digest), "%016llx",
+                static_cast<unsigned long long>(fnv1a64(host_cpu_features())));
+  return digest;
+}
+
+// Persistent store of JIT-generated machine code.
+//
+// Each entry is one file named after the hash of (shape, target), where the
+// shape identifies the computation (Program::shape()) and the target
+// identifies everything else the bytes depend on: code generator and
+// assembler versions and host CPU features (see host_cpu_features_digest()).
+// A file holds a one-page header followed by the code:
+//
+//   [header | shape | target | zero padding to 4096][code]
+//
+// load() validates the header, the full shape and target strings (so hash
+// collisions are misses, not wrong kernels) and a checksum of the code, then
+// maps the code page(s) read+execute straight from the file. The code must
+// therefore be position independent: no absolute addresses and no references
+// outside itself.
+//
+// Mappings stay valid for the lifetime of the cache. store() writes to a
+// temporary file and renames it into place, so concurrent processes sharing a
+// directory never observe partial entries.
+class kernel_cache {
+public:
+  kernel_cache(std::string directory, std::string target)
+      : directory_(std::move(directory)), target_(std::move(target)) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+  }
+
+  ~kernel_cache() {
+    for (const mapping& map : mappings_) {
+      ::munmap(map.address, map.length);
+    }
+  }
+
+  kernel_cache(const kernel_cache&) = delete;
+  kernel_cache& operator=(const kernel_cache&) = delete;
+
+  const std::string& directory() const noexcept { return directory_; }
+
+  // Executable code previously stored for `shape`, or nullptr on a miss
+  // (absent, stale or corrupt entry)
+  const void* load(std::string_view shape);
+
+  // Persist `size` bytes of position-independent code for `shape`.
+  // Returns false if the entry could not be written, including when shape
+  // and target do not fit the header page together.
+  bool store(std::string_view shape, const void* code, std::size_t size);
+
+  // Path of the entry for `shape`
+  std::string path(std::string_view shape) const;
+
+private:
+  static constexpr std::size_t header_size = 4096;
+  static constexpr char magic[8] = {'F', 'R', 'N', 'K', 'J', 'I', 'T', '\0'};
+
+  struct header {
+    char magic[8];
+    std::uint32_t format_version;
+    std::uint32_t shape_size;
+    std::uint32_t target_size;
+    std::uint32_t reserved;
+    std::uint64_t code_size;
+    std::uint64_t code_checksum;
+  };
+
+  struct mapping {
+    void* address;
+    std::size_t length;
+  };
+
+  // Reads and checks the header of an open entry
+  bool read_header(int fd, std::string_view shape, header& hdr) const;
+
+  std::string directory_;
+  std::string target_;
+  std::mutex mutex_; // guards mappings_
+  std::vector<mapping> mappings_;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+inline std::string kernel_cache::path(std::string_view shape) const {
+  const std::uint64_t hash = fnv1a64(target_, fnv1a64(shape) ^ 0x9e37);
+  char name[32];
+  std::snprintf(name, sizeof(name), "%016llx.fkc",
+                static_cast<unsigned long long>(hash));
+  return directory_ + "/" + name;
+}
+
+inline bool kernel_cache::read_header(int fd, std::string_view shape,
+                                      header& hdr) const {
+  char page0[header_size];
+  if (::pread(fd, page0, header_size, 0) !=
+      static_cast<ssize_t>(header_size)) {
+    return false;
+  }
+  std::memcpy(&hdr, page0, sizeof(hdr));
+  if (std::memcmp(hdr.magic, magic, sizeof(magic)) != 0 ||
+      hdr.format_version != kernel_cache_format_version ||
+      sizeof(hdr) + hdr.shape_size + hdr.target_size > header_size ||
+      hdr.code_size == 0) {
+    return false;
+  }
+
+  const char* strings = page0 + sizeof(hdr);
+  if (std::string_view(strings, hdr.shape_size) != shape ||
+      std::string_view(strings + hdr.shape_size, hdr.target_size) != target_) {
+    return false;
+  }
+
+  // Truncated or over-long files are stale
+  const off_t file_size = ::lseek(fd, 0, SEEK_END);
+  return file_size == static_cast<off_t>(header_size + hdr.code_size);
+}
+
+inline const void* kernel_cache::load(std::string_view shape) {
+  const long page = ::sysconf(_SC_PAGESIZE);
+  if (page <= 0 || header_size % static_cast<std::size_t>(page) != 0) {
+    return nullptr;
+  }
+
+  const std::string file = path(shape);
+  const int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  header hdr{};
+  void* code = MAP_FAILED;
+  if (read_header(fd, shape, hdr)) {
+    code = ::mmap(nullptr, hdr.code_size, PROT_READ | PROT_EXEC, MAP_PRIVATE,
+                  fd, header_size);
+  }
+  ::close(fd);
+  if (code == MAP_FAILED) {
+    return nullptr;
+  }
+
+  const std::string_view bytes(static_cast<const char*>(code), hdr.code_size);
+  if (fnv1a64(bytes) != hdr.code_checksum) {
+    ::munmap(code, hdr.code_size);
+    return nullptr;
+  }
+
+  std::lock_guard lock(mutex_);
+  mappings_.push_back({code, hdr.code_size});
+  return code;
+}
+
+inline bool kernel_cache::store(std::string_view shape, const void* code,
+                                std::size_t size) {
+  if (size == 0 || sizeof(header) + shape.size() + target_.size() >
+                       header_size) {
+    return false;
+  }
+
+  std::vector<char> page0(header_size, 0);
+  header hdr{};
+  std::memcpy(hdr.magic, magic, sizeof(magic));
+  hdr.format_version = kernel_cache_format_version;
+  hdr.shape_size = static_cast<std::uint32_t>(shape.size());
+  hdr.target_size = static_cast<std::uint32_t>(target_.size());
+  hdr.code_size = size;
+  hdr.code_checksum =
+      fnv1a64(std::string_view(static_cast<const char*>(code), size));
+  std::memcpy(page0.data(), &hdr, sizeof(hdr));
+  std::memcpy(page0.data() + sizeof(hdr), shape.data(), shape.size());
+  std::memcpy(page0.data() + sizeof(hdr) + shape.size(), target_.data(),
+              target_.size());
+
+  const std::string file = path(shape);
+  const std::string temporary = file + ".tmp." + std::to_string(::getpid());
+  {
+    std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+    out.write(page0.data(), static_cast<std::streamsize>(page0.size()));
+    out.write(static_cast<const char*>(code),
+              static_cast<std::streamsize>(size));
+    if (!out) {
+      std::remove(temporary.c_str());
+      return false;
+    }
+  }
+  if (std::rename(temporary.c_str(), file.c_str()) != 0) {
+    std::remove(temporary.c_str());
+    return false;
+  }
+  return true;
+}
+
+} // namespace franklin::expression
+
+#endif // FRANKLIN_CORE_EXPRESSION_KERNEL_CACHE_HPP
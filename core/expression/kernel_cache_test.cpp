@@ -0,0 +1,105 @@
+#include "core/expression/kernel_cache.hpp"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace franklin::expression {
+namespace {
+
+// int f() { return 42; }
+constexpr unsigned char kReturn42[] = {0xB8, 0x2A, 0x00, 0x00, 0x00, 0xC3};
+
+// Scratch cache directory, removed on destruction
+class TempDir {
+public:
+  explicit TempDir(const std::string& name)
+      : path_(::testing::TempDir() + name) {
+    std::filesystem::remove_all(path_);
+  }
+  ~TempDir() { std::filesystem::remove_all(path_); }
+
+  const std::string& path() const { return path_; }
+
+private:
+  std::string path_;
+};
+
+TEST(KernelCacheTest, StoredCodeLoadsExecutable) {
+  TempDir dir("kernel_cache_roundtrip");
+  {
+    kernel_cache cache(dir.path(), "test-target");
+    EXPECT_EQ(cache.load("Int32Default:c0 c1 +"), nullptr);
+    ASSERT_TRUE(cache.store("Int32Default:c0 c1 +", kReturn42,
+                            sizeof(kReturn42)));
+  }
+
+  // A fresh instance, as after a restart
+  kernel_cache cache(dir.path(), "test-target");
+  const void* code = cache.load("Int32Default:c0 c1 +");
+  ASSERT_NE(code, nullptr);
+  auto fn = reinterpret_cast<int (*)()>(code);
+  EXPECT_EQ(fn(), 42);
+}
+
+TEST(KernelCacheTest, MissesOnOtherShapeOrTarget) {
+  TempDir dir("kernel_cache_keys");
+  {
+    kernel_cache cache(dir.path(), "avx2");
+    ASSERT_TRUE(cache.store("Float32Default:c0 c1 *", kReturn42,
+                            sizeof(kReturn42)));
+    EXPECT_EQ(cache.load("Float32Default:c0 c1 +"), nullptr);
+  }
+
+  kernel_cache other_cpu(dir.path(), "sse2");
+  EXPECT_EQ(other_cpu.load("Float32Default:c0 c1 *"), nullptr);
+}
+
+TEST(KernelCacheTest, RejectsCorruptEntries) {
+  TempDir dir("kernel_cache_corrupt");
+  kernel_cache cache(dir.path(), "test-target");
+  const std::string shape = "Int32Default:c0 l0 *";
+  ASSERT_TRUE(cache.store(shape, kReturn42, sizeof(kReturn42)));
+
+  // Flip a code byte: the checksum no longer matches
+  {
+    std::fstream file(cache.path(shape),
+                      std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(4096 + 1);
+    file.put(static_cast<char>(0x2B));
+  }
+  EXPECT_EQ(cache.load(shape), nullptr);
+
+  // Truncated entry
+  ASSERT_TRUE(cache.store(shape, kReturn42, sizeof(kReturn42)));
+  std::filesystem::resize_file(cache.path(shape), 4096 + 3);
+  EXPECT_EQ(cache.load(shape), nullptr);
+
+  // Not a cache entry at all
+  std::ofstream(cache.path(shape), std::ios::trunc) << "garbage";
+  EXPECT_EQ(cache.load(shape), nullptr);
+}
+
+TEST(KernelCacheTest, RejectsOversizedKeys) {
+  TempDir dir("kernel_cache_oversized");
+  kernel_cache cache(dir.path(), "test-target");
+  EXPECT_FALSE(cache.store(std::string(8192, 'x'), kReturn42,
+                           sizeof(kReturn42)));
+  EXPECT_FALSE(cache.store("shape", kReturn42, 0));
+}
+
+TEST(KernelCacheTest, CpuFeatureDigestFitsTheHeader) {
+  const std::string digest = host_cpu_features_digest();
+  EXPECT_EQ(digest.size(), 16);
+  EXPECT_EQ(digest, host_cpu_features_digest());
+
+  // A target built from the digest leaves room for long shapes
+  TempDir dir("kernel_cache_digest");
+  kernel_cache cache(dir.path(), "codegen-1;" + digest);
+  const std::string shape = "Float32Default:" + std::string(3000, '+');
+  ASSERT_TRUE(cache.store(shape, kReturn42, sizeof(kReturn42)));
+  EXPECT_NE(cache.load(shape), nullptr);
+}
+
+} // namespace
+} // namespace franklin::expression
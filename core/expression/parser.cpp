@@ -180,7 +180,8 @@ public:
 
   FRANKLIN_FORCE_INLINE static constexpr bool
   is_id_char(const char ch) noexcept {
-    return std::isalnum(ch) || ch == '_';
+    // '.' only appears in literals such as 1.5_f32
+    return std::isalnum(ch) || ch == '_' || ch == '.';
   }
 
   static bool is_literal(std::string_view lexeme) noexcept {
@@ -188,16 +189,28 @@ public:
     if (underscore_pos == std::string::npos)
       return false;
 
-    const bool has_valid_type_suffix = lexeme.ends_with("_i32") ||
-                                       lexeme.ends_with("_f32") ||
-                                       lexeme.ends_with("_bf16");
+    const bool has_valid_type_suffix =
+        lexeme.ends_with("_i32") || lexeme.ends_with("_f32") ||
+        lexeme.ends_with("_bf16") || lexeme.ends_with("_d64");
     if (!has_valid_type_suffix)
       return false;
+    // Digits with at most one decimal point
+    std::size_t digits = 0;
+    std::size_t points = 0;
     for (auto i = 0UL; i < underscore_pos; ++i) {
-      if (!std::isdigit(lexeme[i]))
+      if (std::isdigit(lexeme[i])) {
+        ++digits;
+      } else if (lexeme[i] == '.') {
+        ++points;
+      } else {
         return false;
+      }
     }
-    return true;
+    if (digits == 0 || points > 1 || (points == 1 && lexeme.ends_with("_i32")))
+      return false;
+    // Decimals must fit their int64 at the scale they are written with
+    return !lexeme.ends_with("_d64") ||
+           decimal64::parse(lexeme.substr(0, underscore_pos)).has_value();
   }
 
   static bool is_col_ref(std::string_view lexeme) noexcept {
@@ -209,6 +222,45 @@ public:
     return starts_with_alpha && all_alphanum_or_underscores;
   }
 
+  // Push the call data_[name_start, close], where data_[open] is its '('
+  bool push_call(std::size_t name_start, std::size_t open, std::size_t close,
+                 errors::Errors& errors) {
+    const std::string_view name =
+        data_.substr(name_start, open - name_start);
+    if (!is_col_ref(name)) {
+      errors.error_list.emplace_back(
+          name_start, fmt::format("Invalid function name {}", name));
+      return false;
+    }
+
+    // f() has no arguments, otherwise each comma separates two names
+    std::vector<std::string> args;
+    const std::string_view inside = data_.substr(open + 1, close - open - 1);
+    for (std::size_t start = 0; !inside.empty() && start <= inside.size();) {
+      const std::size_t comma =
+          std::min(inside.find(',', start), inside.size());
+      std::string_view arg = inside.substr(start, comma - start);
+      while (!arg.empty() && std::isspace(arg.front())) {
+        arg.remove_prefix(1);
+      }
+      while (!arg.empty() && std::isspace(arg.back())) {
+        arg.remove_suffix(1);
+      }
+      if (arg.empty() || !is_col_ref(arg)) {
+        errors.error_list.emplace_back(
+            open + 1 + start,
+            fmt::format("Arguments of {}() must be names, found '{}'", name,
+                        arg));
+        return false;
+      }
+      args.emplace_back(arg);
+      start = comma + 1;
+    }
+    expr_st.push_back(
+        std::make_unique<CallNode>(std::string{name}, std::move(args)));
+    return true;
+  }
+
   static ExprNodeType::Enum classify(std::string_view lexeme,
                                      errors::Errors& errors) noexcept {
     // std::cout << fmt::format("Lexeme is {}", lexeme) << std::endl;
@@ -290,8 +342,22 @@ public:
           // position.
           // Empty
         }
+      } else if (ch == SCOPE_OPEN && lex_start) {
+        // A name directly followed by '(' is a call, up to the matching ')'
+        // since arguments have no parentheses of their own
+        const std::size_t close = data_.find(SCOPE_CLOSE, index);
+        if (!push_call(*lex_start, index, close, errors)) [[unlikely]] {
+          return errors;
+        }
+        lex_start.reset();
+        index = close;
       } else {
         try_flush_lexeme();
+        // A lexeme that is neither a literal nor a column leaves no operand
+        // for the operators around it
+        if (errors.has_error()) [[unlikely]] {
+          return errors;
+        }
 
         if (std::isspace(ch)) {
           // Empty
@@ -320,6 +386,9 @@ public:
     }
 
     try_flush_lexeme();
+    if (errors.has_error()) [[unlikely]] {
+      return errors;
+    }
     enqueue_operator(index + 1, '$');
     FRANKLIN_ASSERT(expr_st.size() == 1);
     FRANKLIN_ASSERT(op_st.size() == 1);
@@ -416,6 +485,9 @@ bool ExprNode::operator==(ExprNode const& other) const {
   case ExprNodeType::BINARY_OP:
     return *static_cast<BinaryOpNode const*>(&other) ==
            *static_cast<BinaryOpNode const*>(this);
+  case ExprNodeType::CALL:
+    return *static_cast<CallNode const*>(&other) ==
+           *static_cast<CallNode const*>(this);
   default:
     return false;
   }
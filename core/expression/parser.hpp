@@ -5,6 +5,7 @@
 #include "core/bf16.hpp"
 #include "core/compiler_macros.hpp"
 #include "core/data_type_enum.hpp"
+#include "core/decimal_scalar.hpp"
 #include <charconv>
 #include <fmt/format.h>
 #include <limits>
@@ -13,6 +14,7 @@
 #include <string>
 #include <string_view>
 #include <variant>
+#include <vector>
 
 namespace franklin {
 namespace parser {
@@ -75,7 +77,8 @@ struct ExprNodeType {
     NONE = 0,
     LITERAL = 1,
     COL_REF = 2,
-    BINARY_OP = 3
+    BINARY_OP = 3,
+    CALL = 4
   };
 
   static constexpr std::string_view to_string(Enum e) noexcept {
@@ -88,6 +91,8 @@ struct ExprNodeType {
       return "COL_REF";
     case Enum::BINARY_OP:
       return "BINARY_OP";
+    case Enum::CALL:
+      return "CALL";
     default:
       return "UNKNOWN";
     }
@@ -142,6 +147,7 @@ public:
 // -- int32 literal: 2018_i32
 // -- float32 literal: 2.018_f32
 // -- bf16 literal: 2.0_bf16
+// -- decimal literal: 12.34_d64 (scale 2, from the digits after the point)
 class LiteralNode : public ExprNode {
   std::string_view literal_{};
   DataTypeEnum::Enum type_;
@@ -156,6 +162,8 @@ class LiteralNode : public ExprNode {
       return DataTypeEnum::Float32Default;
     } else if (type_marker == "bf16"sv) {
       return DataTypeEnum::BF16Default;
+    } else if (type_marker == "d64"sv) {
+      return DataTypeEnum::Decimal64;
     } else {
       return DataTypeEnum::Unknown;
     }
@@ -216,6 +224,12 @@ public:
       visitor(bf16::from_float_trunc(value));
       break;
     }
+    case DataTypeEnum::Decimal64: {
+      const auto value = decimal64::parse(literal_);
+      FRANKLIN_ASSERT(value.has_value());
+      visitor(*value);
+      break;
+    }
     default:
       break;
     }
@@ -294,6 +308,42 @@ public:
   }
 };
 
+// A function applied to names: `year(d)` or `date_trunc(month, ts)`. The
+// parser does not know the functions; arguments are column names or
+// keywords, never expressions.
+class CallNode final : public ExprNode {
+  std::string name_;
+  std::vector<std::string> args_;
+
+public:
+  CallNode(std::string name, std::vector<std::string> args)
+      : name_(std::move(name)), args_(std::move(args)) {}
+
+  const std::string& name() const noexcept { return name_; }
+  const std::vector<std::string>& args() const noexcept { return args_; }
+
+  virtual bool operator==(CallNode const& other) const noexcept {
+    return name_ == other.name_ && args_ == other.args_;
+  }
+
+  virtual std::string to_string() const noexcept override {
+    std::string str = name_ + '(';
+    for (std::size_t i = 0; i < args_.size(); ++i) {
+      str += (i == 0 ? "" : ", ") + args_[i];
+    }
+    return str + ')';
+  }
+
+  virtual ExprNodeType::Enum node_type() const noexcept override {
+    return ExprNodeType::CALL;
+  }
+
+  virtual std::string enriched_representation() const noexcept override {
+    return fmt::format("CallNode(name={},args={})", name_,
+                       to_string().substr(name_.size()));
+  }
+};
+
 using ParseResult =
     std::variant<std::monostate, std::unique_ptr<ExprNode>, errors::Errors>;
 
@@ -4,7 +4,9 @@
 #include <cstdint>
 #include <gtest/gtest.h>
 #include <limits>
+#include <string>
 #include <variant>
+#include <vector>
 
 namespace franklin::parser {
 namespace {
@@ -83,6 +85,60 @@ TEST(ParserTest, LiteralValueParser) {
   }
 }
 
+TEST(ParserTest, DecimalLiterals) {
+  auto const result = LiteralNode::parse_from_data("-12.340_d64");
+  ASSERT_TRUE(std::holds_alternative<LiteralNode>(result));
+  auto const node = std::get<LiteralNode>(result);
+  EXPECT_EQ(node.result(), DataTypeEnum::Decimal64);
+
+  decimal64 d{};
+  node.visit([&d]<typename LiteralT>(LiteralT l) {
+    if constexpr (std::is_same_v<LiteralT, decimal64>) {
+      d = l;
+    }
+  });
+  EXPECT_EQ(d, (decimal64{-12340, 3}));
+
+  {
+    auto parse_result = parse("price*1.075_d64+0.5_f32");
+    ASSERT_TRUE(parse_result_ok(parse_result));
+    EXPECT_EQ(extract_result(std::move(parse_result))->to_string(),
+              "(((price)*(1.075 : Decimal64))+(0.5 : Float32Default))");
+  }
+  // One decimal point, none in Int32 literals, and values that fit
+  EXPECT_FALSE(parse_result_ok(parse("a+1.2.3_d64")));
+  EXPECT_FALSE(parse_result_ok(parse("a+1.5_i32")));
+  EXPECT_FALSE(parse_result_ok(parse("a+99999999999999999999_d64")));
+  EXPECT_FALSE(parse_result_ok(parse("a.b+1_i32")));
+}
+
+TEST(ParserTest, FunctionCalls) {
+  {
+    auto parse_result = parse("year(d)*100_i32+date_trunc( month , ts)");
+    ASSERT_TRUE(parse_result_ok(parse_result));
+    auto root = extract_result(std::move(parse_result));
+    EXPECT_EQ(root->to_string(),
+              "((year(d)*(100 : Int32Default))+date_trunc(month, ts))");
+    const auto& sum = static_cast<const BinaryOpNode&>(*root);
+    ASSERT_EQ(sum.right()->node_type(), ExprNodeType::CALL);
+    const auto& call = static_cast<const CallNode&>(*sum.right());
+    EXPECT_EQ(call.name(), "date_trunc");
+    EXPECT_EQ(call.args(), (std::vector<std::string>{"month", "ts"}));
+    EXPECT_EQ(call, CallNode("date_trunc", {"month", "ts"}));
+  }
+  {
+    auto parse_result = parse("(hour(ts))");
+    ASSERT_TRUE(parse_result_ok(parse_result));
+    EXPECT_EQ(extract_result(std::move(parse_result))->to_string(),
+              "hour(ts)");
+  }
+  // Arguments are names, not expressions
+  EXPECT_FALSE(parse_result_ok(parse("year(a+b)")));
+  EXPECT_FALSE(parse_result_ok(parse("year(1_i32)")));
+  EXPECT_FALSE(parse_result_ok(parse("date_trunc(month,)")));
+  EXPECT_FALSE(parse_result_ok(parse("1_i32(d)")));
+}
+
 TEST(ParserTest, OpPrecedence) {
   {
     const auto input_string = "a*b+c";
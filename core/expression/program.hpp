@@ -0,0 +1,585 @@
+#ifndef FRANKLIN_CORE_EXPRESSION_PROGRAM_HPP
+#define FRANKLIN_CORE_EXPRESSION_PROGRAM_HPP
+
+#include "container/column.hpp"
+#include "core/bf16.hpp"
+#include "core/civil_time.hpp"
+#include "core/data_type_enum.hpp"
+#include "core/expression/parser.hpp"
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace franklin::expression {
+
+// A parsed expression lowered to postfix (stack machine) form.
+//
+// Column references and literals are numbered in order of first appearance
+// and referenced by slot, so the instruction stream only describes the
+// *shape* of the computation. Two expressions that differ only in column
+// names or literal values share a shape, and therefore a compiled kernel.
+//
+// Besides element-wise expressions, a program can describe a filtered
+// reduction such as `sum(a * b where c > 0_f32)`: the value expression,
+// followed by a predicate ending in a single comparison. The comparison
+// yields a lane mask rather than a value, so it is only valid as the last
+// instruction of a reduction.
+struct Instruction {
+  enum class Kind : std::uint8_t {
+    LoadColumn,
+    LoadLiteral,
+    Add,
+    Sub,
+    Mul,
+    CmpLt,
+    CmpLe,
+    CmpGt,
+    CmpGe,
+    CmpEq,
+    CmpNe
+  };
+
+  Kind kind;
+  std::uint16_t slot; // column or literal slot for the Load* kinds, else 0
+
+  bool operator==(const Instruction&) const = default;
+};
+
+// A column slot computed from a bound column by a calendar function, e.g.
+// `year(d)` (extract()) or `date_trunc(month, ts)` (date_trunc()). Such
+// slots are materialized before execution, so kernels only see columns.
+struct CalendarCall {
+  std::string argument; // name of the Date32 or TimestampMicros column
+  std::variant<DatePart, TimeUnit> function;
+
+  bool operator==(const CalendarCall&) const = default;
+};
+
+struct Program {
+  // Element type shared by every operand and the result. The predicate of a
+  // filtered reduction has its own type (e.g. a Float32 sum filtered on an
+  // Int32 column).
+  DataTypeEnum::Enum type = DataTypeEnum::Unknown;
+  DataTypeEnum::Enum predicate_type = DataTypeEnum::Unknown;
+  std::vector<Instruction> code;
+  // Column slot -> column name, or the text of a calendar call
+  std::vector<std::string> columns;
+  // Column slot -> the call computing the slot, if any
+  std::vector<std::optional<CalendarCall>> calls;
+  // Literal slot -> 32-bit pattern: int32 for Int32Default, fp32 for
+  // Float32Default and BF16Default (bf16 literals are widened)
+  std::vector<std::uint32_t> literals;
+  // Deepest operand stack reached while executing `code`
+  std::size_t max_stack_depth = 0;
+
+  // Set for reductions, which produce a single value instead of a column
+  std::optional<ReductionOp> reduction;
+  // Instructions computing the (reduced) value; for filtered reductions the
+  // rest of `code` is the predicate
+  std::size_t value_length = 0;
+
+  bool filtered() const noexcept { return value_length < code.size(); }
+
+  // Canonical key for the computation, e.g. "Float32Default:c0 c1 * l0 +" or
+  // "Float32Default:sum(c0 c1 * where c2 l0 >)"
+  std::string shape() const;
+};
+
+// Returns the element type of a named column, or DataTypeEnum::Unknown if no
+// such column exists.
+using column_type_resolver =
+    std::function<DataTypeEnum::Enum(const std::string& name)>;
+
+// Parse and lower `expression`. Besides the arithmetic expressions of the
+// parser, accepts reductions of the form
+//   sum|product|min|max(<expr> [where <expr> <|<=|>|>=|==|!= <expr>])
+// and calendar calls on Date32 and TimestampMicros columns as operands:
+//   year|month|day|day_of_week|hour(<column>)  (Int32)
+//   date_trunc(hour|day|week|month|year, <column>)  (the column's type)
+// Dates and timestamps take no part in arithmetic or comparisons; they may
+// be the whole expression or the value of min() and max().
+// Throws std::runtime_error on parse errors, unknown columns, mixed operand
+// types and unsupported operators.
+Program compile_program(std::string_view expression,
+                        const column_type_resolver& resolve);
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+inline std::string_view to_string(ReductionOp op) noexcept {
+  switch (op) {
+  case ReductionOp::Sum:
+    return "sum";
+  case ReductionOp::Product:
+    return "product";
+  case ReductionOp::Min:
+    return "min";
+  case ReductionOp::Max:
+    return "max";
+  }
+  return "?";
+}
+
+inline std::string Program::shape() const {
+  std::string key{DataTypeEnum::to_string(type)};
+  key += ':';
+  if (reduction) {
+    key += to_string(*reduction);
+    key += '(';
+  }
+  for (std::size_t i = 0; i < code.size(); ++i) {
+    const Instruction& instr = code[i];
+    if (i == value_length && reduction) {
+      key += "where ";
+      if (predicate_type != type) {
+        key += DataTypeEnum::to_string(predicate_type);
+        key += ':';
+      }
+    }
+    switch (instr.kind) {
+    case Instruction::Kind::LoadColumn:
+      key += 'c';
+      key += std::to_string(instr.slot);
+      break;
+    case Instruction::Kind::LoadLiteral:
+      key += 'l';
+      key += std::to_string(instr.slot);
+      break;
+    case Instruction::Kind::Add:
+      key += '+';
+      break;
+    case Instruction::Kind::Sub:
+      key += '-';
+      break;
+    case Instruction::Kind::Mul:
+      key += '*';
+      break;
+    case Instruction::Kind::CmpLt:
+      key += '<';
+      break;
+    case Instruction::Kind::CmpLe:
+      key += "<=";
+      break;
+    case Instruction::Kind::CmpGt:
+      key += '>';
+      break;
+    case Instruction::Kind::CmpGe:
+      key += ">=";
+      break;
+    case Instruction::Kind::CmpEq:
+      key += "==";
+      break;
+    case Instruction::Kind::CmpNe:
+      key += "!=";
+      break;
+    }
+    key += ' ';
+  }
+  if (!code.empty()) {
+    key.pop_back();
+  }
+  if (reduction) {
+    key += ')';
+  }
+  return key;
+}
+
+namespace detail {
+
+// `agg(value where lhs cmp rhs)`, split at the top-level keywords. The
+// parser has no notion of calls or comparisons, so reductions are recognized
+// here and only the operand expressions are handed to it.
+struct reduction_text {
+  ReductionOp op;
+  std::string_view value;
+  std::string_view lhs;
+  std::optional<Instruction::Kind> comparison;
+  std::string_view rhs;
+};
+
+inline std::optional<DatePart> date_part_function(std::string_view name) {
+  if (name == "year") {
+    return DatePart::Year;
+  } else if (name == "month") {
+    return DatePart::Month;
+  } else if (name == "day") {
+    return DatePart::Day;
+  } else if (name == "day_of_week") {
+    return DatePart::DayOfWeek;
+  } else if (name == "hour") {
+    return DatePart::Hour;
+  }
+  return std::nullopt;
+}
+
+inline std::optional<TimeUnit> time_unit(std::string_view name) {
+  if (name == "hour") {
+    return TimeUnit::Hour;
+  } else if (name == "day") {
+    return TimeUnit::Day;
+  } else if (name == "week") {
+    return TimeUnit::Week;
+  } else if (name == "month") {
+    return TimeUnit::Month;
+  } else if (name == "year") {
+    return TimeUnit::Year;
+  }
+  return std::nullopt;
+}
+
+inline bool is_calendar_function(std::string_view name) {
+  return date_part_function(name) || name == "date_trunc";
+}
+
+inline bool is_temporal(DataTypeEnum::Enum type) {
+  return type == DataTypeEnum::Date32 || type == DataTypeEnum::TimestampMicros;
+}
+
+inline bool is_space(char ch) {
+  return std::isspace(static_cast<unsigned char>(ch)) != 0;
+}
+
+inline bool is_identifier(std::string_view str) {
+  return !str.empty() && std::all_of(str.begin(), str.end(), [](char ch) {
+    return std::isalnum(static_cast<unsigned char>(ch)) || ch == '_';
+  });
+}
+
+inline std::string_view trim(std::string_view str) {
+  while (!str.empty() && is_space(str.front())) {
+    str.remove_prefix(1);
+  }
+  while (!str.empty() && is_space(str.back())) {
+    str.remove_suffix(1);
+  }
+  return str;
+}
+
+// Returns nullopt if `expression` is not a reduction call
+inline std::optional<reduction_text>
+split_reduction(std::string_view expression) {
+  expression = trim(expression);
+  const std::size_t open = expression.find('(');
+  if (open == std::string_view::npos || expression.back() != ')') {
+    return std::nullopt;
+  }
+
+  const std::string_view name = trim(expression.substr(0, open));
+  reduction_text parts{};
+  if (name == "sum") {
+    parts.op = ReductionOp::Sum;
+  } else if (name == "product") {
+    parts.op = ReductionOp::Product;
+  } else if (name == "min") {
+    parts.op = ReductionOp::Min;
+  } else if (name == "max") {
+    parts.op = ReductionOp::Max;
+  } else if (is_identifier(name) && !is_calendar_function(name)) {
+    throw std::runtime_error("Unknown function: " + std::string(name));
+  } else {
+    return std::nullopt;
+  }
+
+  // The call's parentheses must enclose the whole argument
+  const std::string_view args =
+      expression.substr(open + 1, expression.size() - open - 2);
+  int depth = 0;
+  std::size_t where = std::string_view::npos;
+  for (std::size_t i = 0; i < args.size(); ++i) {
+    if (args[i] == '(') {
+      ++depth;
+    } else if (args[i] == ')' && --depth < 0) {
+      throw std::runtime_error("Unbalanced parentheses in " +
+                               std::string(name) + "()");
+    } else if (depth == 0 && where == std::string_view::npos &&
+               args.substr(i, 5) == "where" &&
+               (i == 0 || is_space(args[i - 1]) || args[i - 1] == ')') &&
+               (i + 5 == args.size() || is_space(args[i + 5]) ||
+                args[i + 5] == '(')) {
+      where = i;
+    }
+  }
+  if (depth != 0) {
+    throw std::runtime_error("Unbalanced parentheses in " + std::string(name) +
+                             "()");
+  }
+
+  parts.value = trim(args.substr(0, where));
+  if (where == std::string_view::npos) {
+    return parts;
+  }
+
+  // Two-character operators first, so that `<=` is not read as `<`
+  const std::string_view predicate = trim(args.substr(where + 5));
+  constexpr std::pair<std::string_view, Instruction::Kind> comparisons[] = {
+      {"<=", Instruction::Kind::CmpLe}, {">=", Instruction::Kind::CmpGe},
+      {"==", Instruction::Kind::CmpEq}, {"!=", Instruction::Kind::CmpNe},
+      {"<", Instruction::Kind::CmpLt},  {">", Instruction::Kind::CmpGt}};
+  for (const auto& [token, kind] : comparisons) {
+    depth = 0;
+    for (std::size_t i = 0; i + token.size() <= predicate.size(); ++i) {
+      depth += predicate[i] == '(' ? 1 : predicate[i] == ')' ? -1 : 0;
+      if (depth == 0 && predicate.substr(i, token.size()) == token) {
+        parts.lhs = trim(predicate.substr(0, i));
+        parts.comparison = kind;
+        parts.rhs = trim(predicate.substr(i + token.size()));
+        return parts;
+      }
+    }
+  }
+  throw std::runtime_error("Expected a comparison after 'where': " +
+                           std::string(predicate));
+}
+
+class program_builder {
+  const column_type_resolver& resolve_;
+  Program program_;
+  std::size_t depth_ = 0;
+  // Type being unified: program_.type, or predicate_type within a predicate
+  DataTypeEnum::Enum* current_type_ = &program_.type;
+
+  void push(Instruction instr) {
+    program_.code.push_back(instr);
+    if (instr.kind == Instruction::Kind::LoadColumn ||
+        instr.kind == Instruction::Kind::LoadLiteral) {
+      ++depth_;
+      program_.max_stack_depth = std::max(program_.max_stack_depth, depth_);
+    } else {
+      --depth_;
+    }
+  }
+
+  void unify_type(DataTypeEnum::Enum type, const std::string& what) {
+    DataTypeEnum::Enum& expected = *current_type_;
+    // Literal slots and the kernels hold 32-bit lanes
+    if (type == DataTypeEnum::Decimal64) {
+      throw std::runtime_error("Unsupported type in expression: " + what +
+                               " is Decimal64");
+    }
+    if (expected == DataTypeEnum::Unknown) {
+      expected = type;
+    } else if (expected != type) {
+      throw std::runtime_error(
+          "Type mismatch in expression: " + what + " is " +
+          std::string(DataTypeEnum::to_string(type)) + ", expected " +
+          std::string(DataTypeEnum::to_string(expected)));
+    }
+  }
+
+  void lower_column(const parser::ColRef& ref) {
+    const std::string name = ref.name();
+    DataTypeEnum::Enum type = resolve_(name);
+    if (type == DataTypeEnum::Unknown) {
+      throw std::runtime_error("Unknown variable: " + name);
+    }
+    unify_type(type, "column " + name);
+    load_column(name, std::nullopt);
+  }
+
+  // Push the slot of `name`, allocated on first use
+  void load_column(const std::string& name, std::optional<CalendarCall> call) {
+    auto& columns = program_.columns;
+    auto it = std::find(columns.begin(), columns.end(), name);
+    auto slot = static_cast<std::uint16_t>(it - columns.begin());
+    if (it == columns.end()) {
+      columns.push_back(name);
+      program_.calls.push_back(std::move(call));
+    }
+    push({Instruction::Kind::LoadColumn, slot});
+  }
+
+  void lower_call(const parser::CallNode& node) {
+    const std::string& name = node.name();
+    const auto& args = node.args();
+    CalendarCall call;
+    if (auto part = date_part_function(name)) {
+      if (args.size() != 1) {
+        throw std::runtime_error(name + "() takes one column");
+      }
+      call = {args[0], *part};
+    } else if (name == "date_trunc") {
+      if (args.size() != 2) {
+        throw std::runtime_error("date_trunc() takes a unit and a column");
+      }
+      auto unit = time_unit(args[0]);
+      if (!unit) {
+        throw std::runtime_error("Unknown date_trunc() unit: " + args[0]);
+      }
+      call = {args[1], *unit};
+    } else {
+      throw std::runtime_error("Unknown function: " + name);
+    }
+
+    const DataTypeEnum::Enum type = resolve_(call.argument);
+    if (type == DataTypeEnum::Unknown) {
+      throw std::runtime_error("Unknown variable: " + call.argument);
+    }
+    if (!is_temporal(type)) {
+      throw std::runtime_error(
+          node.to_string() + " needs a Date32 or TimestampMicros column, " +
+          call.argument + " is " + std::string(DataTypeEnum::to_string(type)));
+    }
+    const auto* part = std::get_if<DatePart>(&call.function);
+    const auto* unit = std::get_if<TimeUnit>(&call.function);
+    if (type == DataTypeEnum::Date32 &&
+        (part ? *part == DatePart::Hour : *unit == TimeUnit::Hour)) {
+      throw std::runtime_error(node.to_string() +
+                               " needs a TimestampMicros column");
+    }
+
+    unify_type(part ? DataTypeEnum::Int32Default : type, node.to_string());
+    load_column(node.to_string(), std::move(call));
+  }
+
+  void lower_literal(const parser::LiteralNode& literal) {
+    unify_type(literal.result(), "literal " + literal.to_string());
+
+    std::uint32_t bits = 0;
+    literal.visit([&](auto value) {
+      using T = std::decay_t<decltype(value)>;
+      if constexpr (std::is_same_v<T, std::int32_t>) {
+        bits = std::bit_cast<std::uint32_t>(value);
+      } else if constexpr (std::is_same_v<T, float>) {
+        bits = std::bit_cast<std::uint32_t>(value);
+      } else if constexpr (std::is_same_v<T, bf16>) {
+        bits = std::bit_cast<std::uint32_t>(value.to_float());
+      }
+    });
+
+    auto slot = static_cast<std::uint16_t>(program_.literals.size());
+    program_.literals.push_back(bits);
+    push({Instruction::Kind::LoadLiteral, slot});
+  }
+
+  void lower_binary(const parser::BinaryOpNode& node) {
+    if (node.left() == nullptr || node.right() == nullptr) {
+      throw std::runtime_error("Empty operand in expression");
+    }
+    lower(*node.left());
+    lower(*node.right());
+    if (is_temporal(*current_type_)) {
+      throw std::runtime_error(
+          "Arithmetic on " +
+          std::string(DataTypeEnum::to_string(*current_type_)) +
+          " values is not supported");
+    }
+    switch (node.op()) {
+    case parser::BinaryOp::ADD:
+      push({Instruction::Kind::Add, 0});
+      break;
+    case parser::BinaryOp::SUB:
+      push({Instruction::Kind::Sub, 0});
+      break;
+    case parser::BinaryOp::MUL:
+      push({Instruction::Kind::Mul, 0});
+      break;
+    default: {
+      std::string_view op = parser::BinaryOp::to_string(node.op());
+      throw std::runtime_error("Unsupported operator: " + std::string(op));
+    }
+    }
+  }
+
+public:
+  explicit program_builder(const column_type_resolver& resolve)
+      : resolve_(resolve) {}
+
+  // Parse `text` and lower it onto the end of the program
+  void lower(std::string_view text) {
+    parser::ParseResult parsed = parser::parse(text);
+    if (!parser::parse_result_ok(parsed)) {
+      auto errors = parser::parse_result_extract_errors(parsed);
+      throw std::runtime_error(
+          errors.error_list.empty()
+              ? "Failed to parse expression: " + std::string(text)
+              : errors.error_list.front().desc);
+    }
+    auto root = parser::extract_result(std::move(parsed));
+    if (root == nullptr) {
+      throw std::runtime_error("Empty expression");
+    }
+    lower(*root);
+  }
+
+  void lower_reduction(const reduction_text& parts) {
+    program_.reduction = parts.op;
+    lower(parts.value);
+    program_.value_length = program_.code.size();
+    if (is_temporal(program_.type) && parts.op != ReductionOp::Min &&
+        parts.op != ReductionOp::Max) {
+      throw std::runtime_error(
+          std::string(to_string(parts.op)) + "() of " +
+          std::string(DataTypeEnum::to_string(program_.type)) +
+          " values is not supported");
+    }
+    if (parts.comparison) {
+      current_type_ = &program_.predicate_type;
+      lower(parts.lhs);
+      lower(parts.rhs);
+      if (is_temporal(program_.predicate_type)) {
+        throw std::runtime_error(
+            "Comparisons of " +
+            std::string(DataTypeEnum::to_string(program_.predicate_type)) +
+            " values are not supported");
+      }
+      push({*parts.comparison, 0});
+    }
+  }
+
+  void lower(const parser::ExprNode& node) {
+    switch (node.node_type()) {
+    case parser::ExprNodeType::COL_REF:
+      lower_column(static_cast<const parser::ColRef&>(node));
+      break;
+    case parser::ExprNodeType::LITERAL:
+      lower_literal(static_cast<const parser::LiteralNode&>(node));
+      break;
+    case parser::ExprNodeType::BINARY_OP:
+      lower_binary(static_cast<const parser::BinaryOpNode&>(node));
+      break;
+    case parser::ExprNodeType::CALL:
+      lower_call(static_cast<const parser::CallNode&>(node));
+      break;
+    default:
+      throw std::runtime_error("Unsupported expression node");
+    }
+  }
+
+  Program finish() && {
+    if (!program_.reduction) {
+      program_.value_length = program_.code.size();
+    }
+    return std::move(program_);
+  }
+};
+
+} // namespace detail
+
+inline Program compile_program(std::string_view expression,
+                               const column_type_resolver& resolve) {
+  detail::program_builder builder(resolve);
+  if (auto reduction = detail::split_reduction(expression)) {
+    builder.lower_reduction(*reduction);
+  } else {
+    builder.lower(expression);
+  }
+  Program program = std::move(builder).finish();
+  if (program.columns.empty()) {
+    throw std::runtime_error("Expression references no columns: " +
+                             std::string(expression));
+  }
+  return program;
+}
+
+} // namespace franklin::expression
+
+#endif // FRANKLIN_CORE_EXPRESSION_PROGRAM_HPP
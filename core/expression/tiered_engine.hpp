@@ -0,0 +1,925 @@
+#ifndef FRANKLIN_CORE_EXPRESSION_TIERED_ENGINE_HPP
+#define FRANKLIN_CORE_EXPRESSION_TIERED_ENGINE_HPP
+
+#include "container/column.hpp"
+#include "core/expression/program.hpp"
+#include "core/interpreter.hpp"
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace franklin::expression {
+
+// Fused kernel for one expression shape. Computes the program over n elements
+// (the padded column length) in a single pass:
+//   inputs[slot]   - data pointer of the column in each column slot
+//   literals[slot] - 32-bit literal patterns (see Program::literals)
+//   out            - output data, n elements
+// Validity is handled by the caller.
+using fused_kernel = void (*)(const void* const* inputs,
+                              const std::uint32_t* literals, void* out,
+                              std::size_t n);
+
+// Fused kernel for a (filtered) reduction. Evaluates value and predicate per
+// vector and folds the value into a per-lane accumulator wherever the
+// predicate holds and every input column is present:
+//   masks[slot] - present_mask blocks of the column in each column slot
+//   lanes       - receives the 8 accumulator lanes (one ymm store, 32
+//                 bytes): int32 for Int32 values, fp32 for Float32 and
+//                 BF16 values. The caller combines them.
+using fused_reduction = void (*)(const void* const* inputs,
+                                 const std::uint64_t* const* masks,
+                                 const std::uint32_t* literals, void* lanes,
+                                 std::size_t n);
+
+// Backend turning hot programs into fused kernels, e.g. x86_kernel_compiler
+// (x86_compiler.hpp). compile() runs on the engine's background thread;
+// returned kernels must stay callable for the lifetime of the compiler.
+class kernel_compiler {
+public:
+  virtual ~kernel_compiler() = default;
+
+  // Returns nullptr if the program is not supported by this backend; the shape
+  // then stays in tier 0.
+  virtual fused_kernel compile(const Program& program) = 0;
+
+  // As compile(), for programs with a reduction
+  virtual fused_reduction compile_reduction(const Program&) { return nullptr; }
+
+  // Entry point of a kernel for `program` persisted by an earlier run (see
+  // kernel_cache.hpp), or nullptr. Called when the engine first sees a shape,
+  // so that warm restarts skip tier 0 for everything compiled before.
+  virtual const void* cached(const Program&) { return nullptr; }
+};
+
+// A shape is promoted once it has run at least min_executions times AND
+// processed at least min_rows rows in total, so neither many tiny queries nor
+// a single huge one pays for compilation.
+struct tiering_thresholds {
+  std::uint64_t min_executions = 4;
+  std::uint64_t min_rows = 1 << 16;
+};
+
+// Two-tier expression engine.
+//
+// Tier 0 executes the lowered program one operator at a time with the template
+// kernels from container/column.hpp: no compilation latency, but every
+// intermediate is materialized. Execution counts and row volumes are tracked
+// per expression shape (see Program::shape()); shapes crossing the
+// tiering_thresholds are queued for a background thread, which compiles a
+// fused kernel and publishes it with a single atomic store. Subsequent
+// evaluations of any expression with that shape pick up the kernel without
+// blocking.
+//
+// Reductions (`sum(a * b where c > 0_i32)`, see compile_program()) are
+// evaluated through reduce_as(). In tier 0 the value is materialized, the
+// predicate becomes a selection through the vector compare() kernel, and
+// both are handed to the masked column reductions. In tier 1 the backend's
+// fused_reduction computes them in registers and never writes them out (see
+// x86_kernel_compiler).
+//
+// Without a kernel_compiler every shape stays in tier 0.
+//
+// Columns are bound by reference and must outlive their use by the engine.
+class tiered_engine {
+public:
+  explicit tiered_engine(std::unique_ptr<kernel_compiler> compiler = nullptr,
+                         tiering_thresholds thresholds = {});
+  ~tiered_engine();
+
+  tiered_engine(const tiered_engine&) = delete;
+  tiered_engine& operator=(const tiered_engine&) = delete;
+
+  // Make a column visible to expressions under `name` (non-owning).
+  // Decimal64 columns are not supported: programs hold 32-bit lanes, and a
+  // bound column would lose its scale.
+  template <concepts::ColumnPolicy Policy>
+  void bind(const std::string& name, const column_vector<Policy>& column);
+
+  void unbind(const std::string& name);
+
+  // Evaluate an expression. The result is owned by the caller; release it
+  // with interpreter::delete_erased_column.
+  ErasedColumn eval(std::string_view expression);
+
+  // Evaluate and return the typed result
+  template <concepts::ColumnPolicy Policy>
+  column_vector<Policy> eval_as(std::string_view expression);
+
+  // Evaluate into `dest`, which keeps its buffer when that is large enough,
+  // so a loop evaluating into the same column allocates no output after the
+  // first call (tier 0 still materializes intermediates). dest may be one of
+  // the expression's own columns.
+  template <concepts::ColumnPolicy Policy>
+  void eval_into(column_vector<Policy>& dest, std::string_view expression);
+
+  // Evaluate a reduction. Rows where any input is absent, or where the
+  // predicate does not hold, are skipped; the result of an empty selection is
+  // the identity of the reduction, as for column_vector::sum() etc.
+  template <concepts::ColumnPolicy Policy>
+  typename Policy::value_type reduce_as(std::string_view expression);
+
+  // Tier the expression's shape currently executes in: 0 or 1 (fused)
+  int tier(std::string_view expression);
+
+  // Block until every queued promotion has been compiled (or rejected)
+  void wait_for_promotions();
+
+private:
+  struct shape_entry {
+    Program prototype;
+    std::atomic<fused_kernel> kernel{nullptr};
+    std::atomic<fused_reduction> reduction_kernel{nullptr};
+    std::atomic<std::uint64_t> executions{0};
+    std::atomic<std::uint64_t> rows{0};
+    std::atomic<bool> promotion_requested{false};
+  };
+
+  struct compiled_expression {
+    Program program;
+    shape_entry* shape;
+  };
+
+  // Tier 0 operand stack entry: borrowed input column, materialized
+  // intermediate or scalar
+  template <concepts::ColumnPolicy Policy>
+  using operand = std::variant<const column_vector<Policy>*,
+                               column_vector<Policy>,
+                               typename Policy::value_type>;
+
+  std::shared_ptr<const compiled_expression> lookup(std::string_view expr);
+
+  // Columns of the program's slots, checked for equal lengths; returns the
+  // common (padded) length. Slots of calendar calls are computed from their
+  // bound column and owned by `derived`.
+  std::size_t gather_columns(const Program& program,
+                             std::vector<ErasedColumn>& columns,
+                             std::vector<std::shared_ptr<void>>& derived);
+
+  static ErasedColumn compute_call(const CalendarCall& call,
+                                   ErasedColumn source,
+                                   std::vector<std::shared_ptr<void>>& derived);
+
+  template <concepts::ColumnPolicy Policy>
+  column_vector<Policy> execute(const compiled_expression& compiled);
+
+  template <concepts::ColumnPolicy Policy>
+  void execute_into(column_vector<Policy>& dest,
+                    const compiled_expression& compiled);
+
+  template <concepts::ColumnPolicy Policy>
+  typename Policy::value_type
+  execute_reduction(const compiled_expression& compiled);
+
+  // Tier 1 part of execute_reduction(): runs `kernel` and combines its lanes
+  template <concepts::ColumnPolicy Policy>
+  static typename Policy::value_type
+  reduce_fused(fused_reduction kernel, const Program& program,
+               const std::vector<ErasedColumn>& columns, std::size_t n);
+
+  // Whether tier 1 runs values of `type`: the fused kernels work on 32-bit
+  // lanes and take Int32, Float32 and BF16 (widened to fp32) columns
+  static constexpr bool fusable_type(DataTypeEnum::Enum type) {
+    return type == DataTypeEnum::Int32Default ||
+           type == DataTypeEnum::Float32Default ||
+           type == DataTypeEnum::BF16Default;
+  }
+
+  // Whether tier 1 can run `program`. Other shapes are never promoted and
+  // keep running in tier 0.
+  static bool fusable(const Program& program) {
+    return fusable_type(program.type) &&
+           (!program.filtered() || fusable_type(program.predicate_type));
+  }
+
+  // Run code[begin, end) in tier 0, returning the operand stack. With a
+  // dest, an arithmetic instruction at end - 1 writes its result into dest
+  // and pushes a reference to it.
+  template <concepts::ColumnPolicy Policy>
+  static std::vector<operand<Policy>>
+  run_tier0(const Program& program, const std::vector<ErasedColumn>& columns,
+            std::size_t begin, std::size_t end,
+            column_vector<Policy>* dest = nullptr);
+
+  template <concepts::ColumnPolicy Policy>
+  static column_vector<Policy> materialize(operand<Policy>&& op);
+
+  // Tier 0 predicate of a filtered reduction, with absent operands cleared
+  template <concepts::ColumnPolicy Policy>
+  static dynamic_bitset<BitsetPolicy>
+  run_tier0_predicate(const Program& program,
+                      const std::vector<ErasedColumn>& columns, std::size_t n);
+
+  void record_execution(shape_entry& shape, std::size_t rows);
+  void worker_loop();
+
+  std::unique_ptr<kernel_compiler> compiler_;
+  tiering_thresholds thresholds_;
+
+  // Guards columns_, expressions_ and shapes_
+  std::mutex mutex_;
+  std::unordered_map<std::string, ErasedColumn> columns_;
+  std::unordered_map<std::string, std::shared_ptr<const compiled_expression>>
+      expressions_;
+  std::unordered_map<std::string, std::unique_ptr<shape_entry>> shapes_;
+
+  // Promotion queue, drained by worker_ (started on first promotion)
+  std::mutex queue_mutex_;
+  std::condition_variable queue_cv_;
+  std::condition_variable idle_cv_;
+  std::deque<shape_entry*> queue_;
+  std::size_t in_flight_ = 0;
+  bool stopping_ = false;
+  std::thread worker_;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+inline tiered_engine::tiered_engine(std::unique_ptr<kernel_compiler> compiler,
+                                    tiering_thresholds thresholds)
+    : compiler_(std::move(compiler)), thresholds_(thresholds) {}
+
+inline tiered_engine::~tiered_engine() {
+  {
+    std::lock_guard lock(queue_mutex_);
+    stopping_ = true;
+  }
+  queue_cv_.notify_all();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+template <concepts::ColumnPolicy Policy>
+void tiered_engine::bind(const std::string& name,
+                         const column_vector<Policy>& column) {
+  static_assert(!concepts::DecimalColumnPolicy<Policy>,
+                "Expressions do not support Decimal64 columns");
+  std::lock_guard lock(mutex_);
+  columns_[name] = ErasedColumn(const_cast<column_vector<Policy>*>(&column));
+  // Cached programs may have been typed against the previous binding
+  expressions_.clear();
+}
+
+inline void tiered_engine::unbind(const std::string& name) {
+  std::lock_guard lock(mutex_);
+  columns_.erase(name);
+  expressions_.clear();
+}
+
+inline std::shared_ptr<const tiered_engine::compiled_expression>
+tiered_engine::lookup(std::string_view expr) {
+  std::lock_guard lock(mutex_);
+  std::string key(expr);
+  if (auto it = expressions_.find(key); it != expressions_.end()) {
+    return it->second;
+  }
+
+  Program program = compile_program(expr, [this](const std::string& name) {
+    auto it = columns_.find(name);
+    return it == columns_.end() ? DataTypeEnum::Unknown
+                                : it->second.get_policy();
+  });
+
+  std::string shape_key = program.shape();
+  auto& shape = shapes_[shape_key];
+  if (!shape) {
+    shape = std::make_unique<shape_entry>();
+    shape->prototype = program;
+    const void* code =
+        compiler_ && fusable(program) ? compiler_->cached(program) : nullptr;
+    if (code != nullptr) {
+      if (program.reduction) {
+        shape->reduction_kernel.store(reinterpret_cast<fused_reduction>(code),
+                                      std::memory_order_release);
+      } else {
+        shape->kernel.store(reinterpret_cast<fused_kernel>(code),
+                            std::memory_order_release);
+      }
+      shape->promotion_requested.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  auto compiled = std::make_shared<const compiled_expression>(
+      compiled_expression{std::move(program), shape.get()});
+  expressions_.emplace(std::move(key), compiled);
+  return compiled;
+}
+
+inline std::size_t
+tiered_engine::gather_columns(const Program& program,
+                              std::vector<ErasedColumn>& columns,
+                              std::vector<std::shared_ptr<void>>& derived) {
+  {
+    std::lock_guard lock(mutex_);
+    for (std::size_t slot = 0; slot < program.columns.size(); ++slot) {
+      const auto& call = program.calls[slot];
+      columns.push_back(
+          columns_.at(call ? call->argument : program.columns[slot]));
+    }
+  }
+  for (std::size_t slot = 0; slot < program.columns.size(); ++slot) {
+    if (const auto& call = program.calls[slot]) {
+      columns[slot] = compute_call(*call, columns[slot], derived);
+    }
+  }
+
+  auto length = [](const ErasedColumn& column) -> std::size_t {
+    switch (column.get_policy()) {
+    case DataTypeEnum::Int32Default:
+      return column.get_as<Int32DefaultPolicy>()->data().size();
+    case DataTypeEnum::Float32Default:
+      return column.get_as<Float32DefaultPolicy>()->data().size();
+    case DataTypeEnum::BF16Default:
+      return column.get_as<BF16DefaultPolicy>()->data().size();
+    case DataTypeEnum::Date32:
+      return column.get_as<Date32Policy>()->data().size();
+    case DataTypeEnum::TimestampMicros:
+      return column.get_as<TimestampMicrosPolicy>()->data().size();
+    default:
+      throw std::runtime_error("Unknown policy type in expression");
+    }
+  };
+
+  const std::size_t n = length(columns.front());
+  for (const ErasedColumn& column : columns) {
+    if (length(column) != n) {
+      throw std::runtime_error("Column size mismatch in expression");
+    }
+  }
+  return n;
+}
+
+inline ErasedColumn
+tiered_engine::compute_call(const CalendarCall& call, ErasedColumn source,
+                            std::vector<std::shared_ptr<void>>& derived) {
+  auto keep = [&]<typename P>(column_vector<P>&& column) {
+    auto owned = std::make_shared<column_vector<P>>(std::move(column));
+    derived.push_back(owned);
+    return ErasedColumn(owned.get());
+  };
+  auto apply = [&]<typename P>(const column_vector<P>* typed) {
+    if (const auto* part = std::get_if<DatePart>(&call.function)) {
+      return keep(extract(*typed, *part));
+    }
+    return keep(date_trunc(*typed, std::get<TimeUnit>(call.function)));
+  };
+  switch (source.get_policy()) {
+  case DataTypeEnum::Date32:
+    return apply(source.get_as<Date32Policy>());
+  case DataTypeEnum::TimestampMicros:
+    return apply(source.get_as<TimestampMicrosPolicy>());
+  default:
+    throw std::runtime_error("Calendar function of a column that is not a "
+                             "date or timestamp");
+  }
+}
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy>
+tiered_engine::execute(const compiled_expression& compiled) {
+  column_vector<Policy> out;
+  execute_into(out, compiled);
+  return out;
+}
+
+template <concepts::ColumnPolicy Policy>
+void tiered_engine::execute_into(column_vector<Policy>& dest,
+                                 const compiled_expression& compiled) {
+  using column = column_vector<Policy>;
+  const Program& program = compiled.program;
+
+  std::vector<ErasedColumn> columns;
+  std::vector<std::shared_ptr<void>> derived;
+  columns.reserve(program.columns.size());
+  const std::size_t n = gather_columns(program, columns, derived);
+
+  // Load before recording the execution, which may queue the promotion: the
+  // call that crosses the thresholds then runs in tier 0 however fast the
+  // worker publishes the kernel
+  fused_kernel kernel = compiled.shape->kernel.load(std::memory_order_acquire);
+  record_execution(*compiled.shape, n);
+  if (kernel == nullptr) {
+    auto stack =
+        run_tier0<Policy>(program, columns, 0, program.code.size(), &dest);
+    FRANKLIN_ASSERT(stack.size() == 1);
+    if (std::holds_alternative<column>(stack.back())) {
+      dest = std::move(std::get<column>(stack.back()));
+    } else if (const column* result = std::get<const column*>(stack.back());
+               result != &dest) {
+      dest = *result; // a bare column
+    }
+    return;
+  }
+
+  // Tier 1: one pass over all inputs, then the same validity rule as the
+  // template kernels (intersection of the operands' masks). The kernel reads
+  // every input vector before storing the output vector at the same offset,
+  // so dest may be an input; its mask then is intersected in place.
+  std::vector<const void*> inputs;
+  inputs.reserve(columns.size());
+  bool dest_is_input = false;
+  for (const ErasedColumn& column : columns) {
+    inputs.push_back(column.get_as<Policy>()->data().data());
+    dest_is_input |= column.get_as<Policy>() == &dest;
+  }
+  dest.data().resize(padded_size<Policy>(n));
+  kernel(inputs.data(), program.literals.data(), dest.data().data(), n);
+
+  if (!dest_is_input) {
+    dest.present_mask() = columns.front().get_as<Policy>()->present_mask();
+  }
+  for (const ErasedColumn& column : columns) {
+    if (column.get_as<Policy>() != &dest) {
+      bitset_and_avx2(dest.present_mask(),
+                      column.get_as<Policy>()->present_mask());
+    }
+  }
+}
+
+template <concepts::ColumnPolicy Policy>
+typename Policy::value_type
+tiered_engine::execute_reduction(const compiled_expression& compiled) {
+  const Program& program = compiled.program;
+  const ReductionOp op = *program.reduction;
+
+  std::vector<ErasedColumn> columns;
+  std::vector<std::shared_ptr<void>> derived;
+  columns.reserve(program.columns.size());
+  const std::size_t n = gather_columns(program, columns, derived);
+
+  // Loaded before recording, as in execute_into()
+  fused_reduction kernel =
+      compiled.shape->reduction_kernel.load(std::memory_order_acquire);
+  record_execution(*compiled.shape, n);
+
+  // Only fusable shapes are promoted, so kernel is null for any other type
+  if constexpr (fusable_type(Policy::policy_id)) {
+    if (kernel != nullptr) {
+      return reduce_fused<Policy>(kernel, program, columns, n);
+    }
+  }
+
+  auto stack = run_tier0<Policy>(program, columns, 0, program.value_length);
+  FRANKLIN_ASSERT(stack.size() == 1);
+  column_vector<Policy> value = materialize<Policy>(std::move(stack.back()));
+
+  if (program.filtered()) {
+    dynamic_bitset<BitsetPolicy> selected;
+    switch (program.predicate_type) {
+    case DataTypeEnum::Int32Default:
+      selected = run_tier0_predicate<Int32DefaultPolicy>(program, columns, n);
+      break;
+    case DataTypeEnum::Float32Default:
+      selected =
+          run_tier0_predicate<Float32DefaultPolicy>(program, columns, n);
+      break;
+    case DataTypeEnum::BF16Default:
+      selected = run_tier0_predicate<BF16DefaultPolicy>(program, columns, n);
+      break;
+    default:
+      throw std::runtime_error("Unknown predicate type in reduction");
+    }
+    bitset_and_avx2(value.present_mask(), selected);
+  }
+
+  if constexpr (concepts::TemporalColumnPolicy<Policy>) {
+    // compile_program only accepts min() and max() of these
+    return op == ReductionOp::Min ? value.min() : value.max();
+  } else {
+    switch (op) {
+    case ReductionOp::Sum:
+      return value.sum();
+    case ReductionOp::Product:
+      return value.product();
+    case ReductionOp::Min:
+      return value.min();
+    case ReductionOp::Max:
+      return value.max();
+    }
+    throw std::runtime_error("Unknown reduction");
+  }
+}
+
+// Tier 1: the kernel keeps value, predicate and validity in registers; only
+// its 8 accumulator lanes are combined here
+template <concepts::ColumnPolicy Policy>
+typename Policy::value_type
+tiered_engine::reduce_fused(fused_reduction kernel, const Program& program,
+                            const std::vector<ErasedColumn>& columns,
+                            std::size_t n) {
+  using value_type = typename Policy::value_type;
+  using lane_type =
+      std::conditional_t<std::is_same_v<value_type, bf16>, float, value_type>;
+  static_assert(sizeof(lane_type) == sizeof(std::uint32_t));
+  const ReductionOp op = *program.reduction;
+
+  std::vector<const void*> inputs;
+  std::vector<const std::uint64_t*> masks;
+  inputs.reserve(columns.size());
+  masks.reserve(columns.size());
+  for (const ErasedColumn& column : columns) {
+    auto visit = [&]<typename P>(const column_vector<P>* typed) {
+      inputs.push_back(typed->data().data());
+      masks.push_back(typed->present_mask().blocks().data());
+    };
+    switch (column.get_policy()) {
+    case DataTypeEnum::Int32Default:
+      visit(column.get_as<Int32DefaultPolicy>());
+      break;
+    case DataTypeEnum::Float32Default:
+      visit(column.get_as<Float32DefaultPolicy>());
+      break;
+    case DataTypeEnum::BF16Default:
+      visit(column.get_as<BF16DefaultPolicy>());
+      break;
+    default:
+      FRANKLIN_ASSERT_MSG(false, "fusable() admits no other column types");
+    }
+  }
+
+  // The kernel stores a whole ymm register
+  alignas(32) std::byte bytes[32];
+  kernel(inputs.data(), masks.data(), program.literals.data(), bytes, n);
+  lane_type lanes[8];
+  std::memcpy(lanes, bytes, sizeof(lanes));
+
+  lane_type result = lanes[0];
+  for (std::size_t i = 1; i < 8; ++i) {
+    if constexpr (std::is_same_v<lane_type, std::int32_t>) {
+      // Wrap around like the vector accumulator does
+      const auto lhs = static_cast<std::uint32_t>(result);
+      const auto rhs = static_cast<std::uint32_t>(lanes[i]);
+      if (op == ReductionOp::Sum) {
+        result = static_cast<std::int32_t>(lhs + rhs);
+        continue;
+      }
+      if (op == ReductionOp::Product) {
+        result = static_cast<std::int32_t>(lhs * rhs);
+        continue;
+      }
+    } else {
+      if (op == ReductionOp::Sum) {
+        result = result + lanes[i];
+        continue;
+      }
+      if (op == ReductionOp::Product) {
+        result = result * lanes[i];
+        continue;
+      }
+    }
+    result = op == ReductionOp::Min ? std::min(result, lanes[i])
+                                    : std::max(result, lanes[i]);
+  }
+  if constexpr (std::is_same_v<value_type, bf16>) {
+    return bf16::from_float_rne(result);
+  } else {
+    return result;
+  }
+}
+
+template <concepts::ColumnPolicy Policy>
+std::vector<tiered_engine::operand<Policy>>
+tiered_engine::run_tier0(const Program& program,
+                         const std::vector<ErasedColumn>& columns,
+                         std::size_t begin, std::size_t end,
+                         column_vector<Policy>* dest) {
+  using value_type = typename Policy::value_type;
+  using column = column_vector<Policy>;
+
+  auto literal = [&](std::uint16_t slot) -> value_type {
+    const std::uint32_t bits = program.literals[slot];
+    if constexpr (std::is_same_v<value_type, bf16>) {
+      return bf16::from_float_trunc(std::bit_cast<float>(bits));
+    } else if constexpr (concepts::TemporalColumnPolicy<Policy>) {
+      // There are no date or timestamp literals
+      throw std::runtime_error("Literal of a temporal type");
+    } else {
+      return std::bit_cast<value_type>(bits);
+    }
+  };
+
+  auto apply = [](Instruction::Kind kind, const auto& lhs, const auto& rhs) {
+    switch (kind) {
+    case Instruction::Kind::Add:
+      return lhs + rhs;
+    case Instruction::Kind::Sub:
+      return lhs - rhs;
+    default:
+      return lhs * rhs;
+    }
+  };
+
+  // apply(), written into dest
+  auto apply_into = [&](Instruction::Kind kind, const auto& lhs,
+                        const auto& rhs) {
+    switch (kind) {
+    case Instruction::Kind::Add:
+      franklin::eval_into<OpType::Add>(*dest, lhs, rhs);
+      break;
+    case Instruction::Kind::Sub:
+      franklin::eval_into<OpType::Sub>(*dest, lhs, rhs);
+      break;
+    default:
+      franklin::eval_into<OpType::Mul>(*dest, lhs, rhs);
+      break;
+    }
+    return static_cast<const column*>(dest);
+  };
+
+  auto as_ref = [](const operand<Policy>& op) -> const column& {
+    return std::holds_alternative<const column*>(op)
+               ? *std::get<const column*>(op)
+               : std::get<column>(op);
+  };
+
+  std::vector<operand<Policy>> stack;
+  stack.reserve(program.max_stack_depth);
+
+  for (std::size_t pc = begin; pc < end; ++pc) {
+    const Instruction& instr = program.code[pc];
+    switch (instr.kind) {
+    case Instruction::Kind::LoadColumn:
+      stack.emplace_back(columns[instr.slot].get_as<Policy>());
+      continue;
+    case Instruction::Kind::LoadLiteral:
+      stack.emplace_back(literal(instr.slot));
+      continue;
+    case Instruction::Kind::Add:
+    case Instruction::Kind::Sub:
+    case Instruction::Kind::Mul:
+      break;
+    default:
+      throw std::runtime_error("Comparison outside of a reduction filter");
+    }
+
+    if constexpr (concepts::TemporalColumnPolicy<Policy>) {
+      // compile_program rejects arithmetic on dates and timestamps
+      throw std::runtime_error("Arithmetic on a temporal type");
+    } else {
+      operand<Policy> rhs = std::move(stack.back());
+      stack.pop_back();
+      operand<Policy> lhs = std::move(stack.back());
+      stack.pop_back();
+
+      const bool lhs_scalar = std::holds_alternative<value_type>(lhs);
+      const bool rhs_scalar = std::holds_alternative<value_type>(rhs);
+      if (lhs_scalar && rhs_scalar) {
+        // Constant folding, in fp32 for bf16
+        if constexpr (std::is_same_v<value_type, bf16>) {
+          float folded = apply(instr.kind, std::get<bf16>(lhs).to_float(),
+                               std::get<bf16>(rhs).to_float());
+          stack.emplace_back(bf16::from_float_trunc(folded));
+        } else {
+          stack.emplace_back(value_type(apply(instr.kind,
+                                              std::get<value_type>(lhs),
+                                              std::get<value_type>(rhs))));
+        }
+      } else if (dest != nullptr && pc + 1 == end) {
+        if (rhs_scalar) {
+          stack.emplace_back(
+              apply_into(instr.kind, as_ref(lhs), std::get<value_type>(rhs)));
+        } else if (lhs_scalar) {
+          stack.emplace_back(
+              apply_into(instr.kind, std::get<value_type>(lhs), as_ref(rhs)));
+        } else {
+          stack.emplace_back(apply_into(instr.kind, as_ref(lhs), as_ref(rhs)));
+        }
+      } else if (rhs_scalar) {
+        stack.emplace_back(
+            apply(instr.kind, as_ref(lhs), std::get<value_type>(rhs)));
+      } else if (lhs_scalar) {
+        stack.emplace_back(
+            apply(instr.kind, std::get<value_type>(lhs), as_ref(rhs)));
+      } else {
+        stack.emplace_back(apply(instr.kind, as_ref(lhs), as_ref(rhs)));
+      }
+    }
+  }
+  return stack;
+}
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy> tiered_engine::materialize(operand<Policy>&& op) {
+  using column = column_vector<Policy>;
+  if (std::holds_alternative<column>(op)) {
+    return std::move(std::get<column>(op));
+  }
+  // A bare column reference: the result is a copy. (A lone scalar cannot
+  // occur: compile_program rejects expressions without columns.)
+  FRANKLIN_ASSERT(std::holds_alternative<const column*>(op));
+  return column(*std::get<const column*>(op));
+}
+
+template <concepts::ColumnPolicy Policy>
+dynamic_bitset<BitsetPolicy>
+tiered_engine::run_tier0_predicate(const Program& program,
+                                   const std::vector<ErasedColumn>& columns,
+                                   std::size_t n) {
+  using value_type = typename Policy::value_type;
+  using column = column_vector<Policy>;
+
+  const std::size_t last = program.code.size() - 1;
+  auto stack = run_tier0<Policy>(program, columns, program.value_length, last);
+  FRANKLIN_ASSERT(stack.size() == 2);
+
+  CompareOp op;
+  switch (program.code[last].kind) {
+  case Instruction::Kind::CmpLt:
+    op = CompareOp::Lt;
+    break;
+  case Instruction::Kind::CmpLe:
+    op = CompareOp::Le;
+    break;
+  case Instruction::Kind::CmpGt:
+    op = CompareOp::Gt;
+    break;
+  case Instruction::Kind::CmpGe:
+    op = CompareOp::Ge;
+    break;
+  case Instruction::Kind::CmpEq:
+    op = CompareOp::Eq;
+    break;
+  default:
+    op = CompareOp::Ne;
+    break;
+  }
+
+  // The operands are resolved once; the comparison itself is the vector
+  // kernel from column.hpp, which also clears absent rows
+  auto as_ref = [](const operand<Policy>& op) -> const column& {
+    return std::holds_alternative<const column*>(op)
+               ? *std::get<const column*>(op)
+               : std::get<column>(op);
+  };
+  const bool lhs_scalar = std::holds_alternative<value_type>(stack[0]);
+  const bool rhs_scalar = std::holds_alternative<value_type>(stack[1]);
+  if (lhs_scalar && rhs_scalar) {
+    // A constant predicate selects every row or none
+    const value_type lhs = std::get<value_type>(stack[0]);
+    const value_type rhs = std::get<value_type>(stack[1]);
+    const column probe(1, lhs);
+    return dynamic_bitset<BitsetPolicy>(n, compare(op, probe, rhs).test(0));
+  }
+  if (lhs_scalar) {
+    return compare(op, std::get<value_type>(stack[0]), as_ref(stack[1]));
+  }
+  if (rhs_scalar) {
+    return compare(op, as_ref(stack[0]), std::get<value_type>(stack[1]));
+  }
+  return compare(op, as_ref(stack[0]), as_ref(stack[1]));
+}
+
+inline void tiered_engine::record_execution(shape_entry& shape,
+                                            std::size_t rows) {
+  const auto executions =
+      shape.executions.fetch_add(1, std::memory_order_relaxed) + 1;
+  const auto total_rows =
+      shape.rows.fetch_add(rows, std::memory_order_relaxed) + rows;
+
+  if (compiler_ == nullptr || !fusable(shape.prototype) ||
+      executions < thresholds_.min_executions ||
+      total_rows < thresholds_.min_rows ||
+      shape.promotion_requested.load(std::memory_order_relaxed) ||
+      shape.promotion_requested.exchange(true, std::memory_order_relaxed)) {
+    return;
+  }
+
+  {
+    std::lock_guard lock(queue_mutex_);
+    queue_.push_back(&shape);
+    if (!worker_.joinable()) {
+      worker_ = std::thread([this] { worker_loop(); });
+    }
+  }
+  queue_cv_.notify_one();
+}
+
+inline void tiered_engine::worker_loop() {
+  std::unique_lock lock(queue_mutex_);
+  while (true) {
+    queue_cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+    if (stopping_) {
+      return;
+    }
+    shape_entry* shape = queue_.front();
+    queue_.pop_front();
+    ++in_flight_;
+    lock.unlock();
+
+    // A backend failure leaves the shape in tier 0; promotion_requested stays
+    // set so it is not retried on every evaluation.
+    try {
+      const Program& program = shape->prototype;
+      if (program.reduction) {
+        if (auto kernel = compiler_->compile_reduction(program)) {
+          shape->reduction_kernel.store(kernel, std::memory_order_release);
+        }
+      } else if (auto kernel = compiler_->compile(program)) {
+        shape->kernel.store(kernel, std::memory_order_release);
+      }
+    } catch (...) {
+    }
+
+    lock.lock();
+    --in_flight_;
+    if (queue_.empty() && in_flight_ == 0) {
+      idle_cv_.notify_all();
+    }
+  }
+}
+
+inline void tiered_engine::wait_for_promotions() {
+  std::unique_lock lock(queue_mutex_);
+  idle_cv_.wait(lock, [this] { return queue_.empty() && in_flight_ == 0; });
+}
+
+inline int tiered_engine::tier(std::string_view expression) {
+  auto compiled = lookup(expression);
+  const shape_entry& shape = *compiled->shape;
+  return shape.kernel.load(std::memory_order_acquire) != nullptr ||
+         shape.reduction_kernel.load(std::memory_order_acquire) != nullptr;
+}
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy> tiered_engine::eval_as(std::string_view expression) {
+  auto compiled = lookup(expression);
+  if (compiled->program.type != Policy::policy_id) {
+    throw std::runtime_error("Type mismatch in eval_as");
+  }
+  if (compiled->program.reduction) {
+    throw std::runtime_error("Reductions are evaluated with reduce_as");
+  }
+  return execute<Policy>(*compiled);
+}
+
+template <concepts::ColumnPolicy Policy>
+void tiered_engine::eval_into(column_vector<Policy>& dest,
+                              std::string_view expression) {
+  auto compiled = lookup(expression);
+  if (compiled->program.type != Policy::policy_id) {
+    throw std::runtime_error("Type mismatch in eval_into");
+  }
+  if (compiled->program.reduction) {
+    throw std::runtime_error("Reductions are evaluated with reduce_as");
+  }
+  execute_into<Policy>(dest, *compiled);
+}
+
+template <concepts::ColumnPolicy Policy>
+typename Policy::value_type
+tiered_engine::reduce_as(std::string_view expression) {
+  auto compiled = lookup(expression);
+  if (compiled->program.type != Policy::policy_id) {
+    throw std::runtime_error("Type mismatch in reduce_as");
+  }
+  if (!compiled->program.reduction) {
+    throw std::runtime_error("Not a reduction: " + std::string(expression));
+  }
+  return execute_reduction<Policy>(*compiled);
+}
+
+inline ErasedColumn tiered_engine::eval(std::string_view expression) {
+  auto compiled = lookup(expression);
+  if (compiled->program.reduction) {
+    throw std::runtime_error("Reductions are evaluated with reduce_as");
+  }
+  switch (compiled->program.type) {
+  case DataTypeEnum::Int32Default:
+    return ErasedColumn(new column_vector<Int32DefaultPolicy>(
+        execute<Int32DefaultPolicy>(*compiled)));
+  case DataTypeEnum::Float32Default:
+    return ErasedColumn(new column_vector<Float32DefaultPolicy>(
+        execute<Float32DefaultPolicy>(*compiled)));
+  case DataTypeEnum::BF16Default:
+    return ErasedColumn(new column_vector<BF16DefaultPolicy>(
+        execute<BF16DefaultPolicy>(*compiled)));
+  case DataTypeEnum::Date32:
+    return ErasedColumn(
+        new column_vector<Date32Policy>(execute<Date32Policy>(*compiled)));
+  case DataTypeEnum::TimestampMicros:
+    return ErasedColumn(new column_vector<TimestampMicrosPolicy>(
+        execute<TimestampMicrosPolicy>(*compiled)));
+  default:
+    throw std::runtime_error("Unknown policy type in eval");
+  }
+}
+
+} // namespace franklin::expression
+
+#endif // FRANKLIN_CORE_EXPRESSION_TIERED_ENGINE_HPP
@@ -0,0 +1,602 @@
+#include "core/expression/tiered_engine.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace franklin::expression {
+namespace {
+
+using Float32Column = column_vector<Float32DefaultPolicy>;
+using Int32Column = column_vector<Int32DefaultPolicy>;
+
+// Stand-in for a JIT backend: "fuses" the a + b shape with a plain loop and
+// counts how often the engine asked for a kernel.
+void fused_add_f32(const void* const* inputs, const std::uint32_t*, void* out,
+                   std::size_t n) {
+  auto* lhs = static_cast<const float*>(inputs[0]);
+  auto* rhs = static_cast<const float*>(inputs[1]);
+  auto* dst = static_cast<float*>(out);
+  for (std::size_t i = 0; i < n; ++i) {
+    dst[i] = lhs[i] + rhs[i];
+  }
+}
+
+// sum(a * b where c > l0) over Float32 values and an Int32 filter
+void fused_filtered_dot(const void* const* inputs,
+                        const std::uint64_t* const* masks,
+                        const std::uint32_t* literals, void* lanes,
+                        std::size_t n) {
+  auto* a = static_cast<const float*>(inputs[0]);
+  auto* b = static_cast<const float*>(inputs[1]);
+  auto* c = static_cast<const std::int32_t*>(inputs[2]);
+  auto threshold = static_cast<std::int32_t>(literals[0]);
+  auto* acc = static_cast<float*>(lanes);
+  for (std::size_t lane = 0; lane < 8; ++lane) {
+    acc[lane] = 0.0f;
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    bool present = true;
+    for (std::size_t slot = 0; slot < 3; ++slot) {
+      present &= (masks[slot][i / 64] >> (i % 64)) & 1;
+    }
+    if (present && c[i] > threshold) {
+      acc[i % 8] += a[i] * b[i];
+    }
+  }
+}
+
+class counting_compiler : public kernel_compiler {
+public:
+  explicit counting_compiler(std::atomic<int>& calls) : calls_(calls) {}
+
+  fused_kernel compile(const Program& program) override {
+    ++calls_;
+    return program.shape() == "Float32Default:c0 c1 +" ? &fused_add_f32
+                                                        : nullptr;
+  }
+
+  fused_reduction compile_reduction(const Program& program) override {
+    ++calls_;
+    return program.shape() ==
+                   "Float32Default:sum(c0 c1 * where Int32Default:c2 l0 >)"
+               ? &fused_filtered_dot
+               : nullptr;
+  }
+
+private:
+  std::atomic<int>& calls_;
+};
+
+// sum(c0) of BF16 values, accumulated in 8 fp32 lanes, and min(c0) of any
+// 32-bit column: stand-ins for JIT kernels that store a whole ymm register
+void fused_bf16_sum(const void* const* inputs, const std::uint64_t* const*,
+                    const std::uint32_t*, void* lanes, std::size_t n) {
+  auto* values = static_cast<const bf16*>(inputs[0]);
+  float acc[8] = {};
+  for (std::size_t i = 0; i < n; ++i) {
+    acc[i % 8] += values[i].to_float();
+  }
+  std::memcpy(lanes, acc, sizeof(acc));
+}
+
+void fused_min_i32(const void* const* inputs, const std::uint64_t* const*,
+                   const std::uint32_t*, void* lanes, std::size_t n) {
+  auto* values = static_cast<const std::int32_t*>(inputs[0]);
+  std::int32_t acc[8];
+  std::fill(acc, acc + 8, std::numeric_limits<std::int32_t>::max());
+  for (std::size_t i = 0; i < n; ++i) {
+    acc[i % 8] = std::min(acc[i % 8], values[i]);
+  }
+  std::memcpy(lanes, acc, sizeof(acc));
+}
+
+class reduction_compiler : public kernel_compiler {
+public:
+  fused_kernel compile(const Program&) override { return nullptr; }
+
+  fused_reduction compile_reduction(const Program& program) override {
+    if (program.shape() == "BF16Default:sum(c0)") {
+      return &fused_bf16_sum;
+    }
+    return program.shape() == "Date32:min(c0)" ? &fused_min_i32 : nullptr;
+  }
+};
+
+Float32Column make_column(std::size_t n, float start) {
+  Float32Column column(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    column.data()[i] = start + static_cast<float>(i);
+  }
+  return column;
+}
+
+DataTypeEnum::Enum resolve_all_f32(const std::string&) {
+  return DataTypeEnum::Float32Default;
+}
+
+TEST(ProgramTest, LowersToPostfix) {
+  Program program = compile_program("a * b + 2_f32", resolve_all_f32);
+
+  EXPECT_EQ(program.type, DataTypeEnum::Float32Default);
+  EXPECT_EQ(program.shape(), "Float32Default:c0 c1 * l0 +");
+  ASSERT_EQ(program.columns.size(), 2);
+  EXPECT_EQ(program.columns[0], "a");
+  EXPECT_EQ(program.columns[1], "b");
+  ASSERT_EQ(program.literals.size(), 1);
+  EXPECT_EQ(std::bit_cast<float>(program.literals[0]), 2.0f);
+  EXPECT_EQ(program.max_stack_depth, 2);
+}
+
+TEST(ProgramTest, ShapeIgnoresNamesAndLiteralValues) {
+  Program lhs = compile_program("a + b * 3_f32", resolve_all_f32);
+  Program rhs = compile_program("x + y * 7_f32", resolve_all_f32);
+  EXPECT_EQ(lhs.shape(), rhs.shape());
+
+  // Repeated columns reuse their slot
+  Program repeated = compile_program("a * a", resolve_all_f32);
+  EXPECT_EQ(repeated.shape(), "Float32Default:c0 c0 *");
+  EXPECT_EQ(repeated.columns.size(), 1);
+}
+
+TEST(ProgramTest, RejectsInvalidExpressions) {
+  auto resolve = [](const std::string& name) {
+    return name == "i" ? DataTypeEnum::Int32Default
+                       : DataTypeEnum::Float32Default;
+  };
+  EXPECT_THROW(compile_program("a + i", resolve), std::runtime_error);
+  EXPECT_THROW(compile_program("a + 2_i32", resolve), std::runtime_error);
+  EXPECT_THROW(compile_program("2_f32 + 3_f32", resolve), std::runtime_error);
+  EXPECT_THROW(compile_program("a * 1.25_d64", resolve), std::runtime_error);
+
+  auto unknown = [](const std::string&) { return DataTypeEnum::Unknown; };
+  EXPECT_THROW(compile_program("a + b", unknown), std::runtime_error);
+}
+
+TEST(ProgramTest, LowersFilteredReductions) {
+  auto resolve = [](const std::string& name) {
+    return name == "c" ? DataTypeEnum::Int32Default
+                       : DataTypeEnum::Float32Default;
+  };
+
+  Program program = compile_program("sum(a * b where c > 0_i32)", resolve);
+  ASSERT_TRUE(program.reduction.has_value());
+  EXPECT_EQ(*program.reduction, ReductionOp::Sum);
+  EXPECT_EQ(program.type, DataTypeEnum::Float32Default);
+  EXPECT_EQ(program.predicate_type, DataTypeEnum::Int32Default);
+  EXPECT_EQ(program.value_length, 3);
+  EXPECT_TRUE(program.filtered());
+  EXPECT_EQ(program.shape(),
+            "Float32Default:sum(c0 c1 * where Int32Default:c2 l0 >)");
+
+  Program unfiltered = compile_program("max( (a - b) )", resolve);
+  EXPECT_FALSE(unfiltered.filtered());
+  EXPECT_EQ(unfiltered.shape(), "Float32Default:max(c0 c1 -)");
+
+  Program same_type = compile_program("min(a where b <= a * 2_f32)", resolve);
+  EXPECT_EQ(same_type.shape(), "Float32Default:min(c0 where c1 c0 l0 * <=)");
+
+  EXPECT_THROW(compile_program("sum(a where c)", resolve), std::runtime_error);
+  EXPECT_THROW(compile_program("sum(a where c > 0_f32)", resolve),
+               std::runtime_error);
+  EXPECT_THROW(compile_program("avg(a)", resolve), std::runtime_error);
+}
+
+TEST(ProgramTest, LowersCalendarFunctions) {
+  auto resolve = [](const std::string& name) {
+    if (name == "d") {
+      return DataTypeEnum::Date32;
+    } else if (name == "ts") {
+      return DataTypeEnum::TimestampMicros;
+    }
+    return DataTypeEnum::Int32Default;
+  };
+
+  // Each call is a slot of its own, computed from the bound column
+  Program parts =
+      compile_program("year(d) * 100_i32 + month(d) + year(d)", resolve);
+  EXPECT_EQ(parts.type, DataTypeEnum::Int32Default);
+  EXPECT_EQ(parts.shape(), "Int32Default:c0 l0 * c1 + c0 +");
+  ASSERT_EQ(parts.columns.size(), 2);
+  EXPECT_EQ(parts.columns[0], "year(d)");
+  ASSERT_EQ(parts.calls.size(), 2);
+  EXPECT_EQ(parts.calls[1], (CalendarCall{"d", DatePart::Month}));
+
+  Program trunc = compile_program("max(date_trunc(month, ts))", resolve);
+  EXPECT_EQ(trunc.type, DataTypeEnum::TimestampMicros);
+  EXPECT_EQ(trunc.shape(), "TimestampMicros:max(c0)");
+  EXPECT_EQ(trunc.calls[0], (CalendarCall{"ts", TimeUnit::Month}));
+
+  Program filtered =
+      compile_program("sum(x where hour(ts) >= 9_i32)", resolve);
+  EXPECT_EQ(filtered.predicate_type, DataTypeEnum::Int32Default);
+  EXPECT_FALSE(filtered.calls[0].has_value());
+  EXPECT_TRUE(filtered.calls[1].has_value());
+
+  EXPECT_THROW(compile_program("d + d", resolve), std::runtime_error);
+  EXPECT_THROW(compile_program("sum(ts)", resolve), std::runtime_error);
+  EXPECT_THROW(compile_program("min(x where ts > ts)", resolve),
+               std::runtime_error);
+  EXPECT_THROW(compile_program("hour(d)", resolve), std::runtime_error);
+  EXPECT_THROW(compile_program("date_trunc(minute, ts)", resolve),
+               std::runtime_error);
+  EXPECT_THROW(compile_program("year(x)", resolve), std::runtime_error);
+  EXPECT_THROW(compile_program("year(d, ts)", resolve), std::runtime_error);
+  EXPECT_THROW(compile_program("quarter(d)", resolve), std::runtime_error);
+}
+
+TEST(TieredEngineTest, InterpretsWithoutCompiler) {
+  Float32Column a = make_column(100, 0.0f);
+  Float32Column b = make_column(100, 1.0f);
+  a.present_mask().set(3, false);
+
+  tiered_engine engine;
+  engine.bind("a", a);
+  engine.bind("b", b);
+
+  Float32Column result = engine.eval_as<Float32DefaultPolicy>("a * b + 1_f32");
+  for (std::size_t i = 0; i < 100; ++i) {
+    const float x = static_cast<float>(i);
+    EXPECT_FLOAT_EQ(result.data()[i], x * (x + 1.0f) + 1.0f);
+  }
+  EXPECT_FALSE(result.present_mask()[3]);
+  EXPECT_TRUE(result.present_mask()[4]);
+
+  // Literal on the left, constant folding and a bare column
+  Float32Column folded =
+      engine.eval_as<Float32DefaultPolicy>("2_f32 * 3_f32 - a");
+  EXPECT_FLOAT_EQ(folded.data()[10], -4.0f);
+  Float32Column copy = engine.eval_as<Float32DefaultPolicy>("b");
+  EXPECT_FLOAT_EQ(copy.data()[10], 11.0f);
+
+  EXPECT_EQ(engine.tier("a * b + 1_f32"), 0);
+}
+
+TEST(TieredEngineTest, InterpretsInt32) {
+  Int32Column a(64, 7);
+  Int32Column b(64, 3);
+
+  tiered_engine engine;
+  engine.bind("a", a);
+  engine.bind("b", b);
+
+  ErasedColumn erased = engine.eval("a - b * 2_i32");
+  ASSERT_EQ(erased.get_policy(), DataTypeEnum::Int32Default);
+  EXPECT_EQ(erased.get_as<Int32DefaultPolicy>()->data()[5], 1);
+  interpreter::delete_erased_column(erased);
+}
+
+TEST(TieredEngineTest, EvaluatesIntoADestination) {
+  constexpr std::size_t n = 1000;
+  Float32Column a = make_column(n, 0.0f);
+  Float32Column b = make_column(n, 0.5f);
+  b.present_mask().set(7, false);
+
+  std::atomic<int> compiles{0};
+  tiered_engine engine(std::make_unique<counting_compiler>(compiles),
+                       tiering_thresholds{.min_executions = 2, .min_rows = 1});
+  engine.bind("a", a);
+  engine.bind("b", b);
+
+  // The first call sizes the destination; later ones reuse its buffer, in
+  // tier 0 and after promotion
+  Float32Column dest;
+  engine.eval_into(dest, "a + b");
+  const float* buffer = dest.data().data();
+  for (int i = 0; i < 3; ++i) {
+    engine.eval_into(dest, "a + b");
+    engine.wait_for_promotions();
+  }
+  ASSERT_EQ(engine.tier("a + b"), 1);
+  engine.eval_into(dest, "a + b");
+  EXPECT_EQ(dest.data().data(), buffer);
+  EXPECT_FLOAT_EQ(dest.data()[10], 20.5f);
+  EXPECT_FALSE(dest.present(7));
+  EXPECT_TRUE(dest.present(8));
+
+  engine.eval_into(dest, "2_f32 - a * b");
+  EXPECT_EQ(dest.data().data(), buffer);
+  EXPECT_FLOAT_EQ(dest.data()[2], 2.0f - 2.0f * 2.5f);
+  engine.eval_into(dest, "b");
+  EXPECT_EQ(dest.data().data(), buffer);
+  EXPECT_FLOAT_EQ(dest.data()[2], 2.5f);
+
+  // Into one of the expression's own columns, in both tiers
+  engine.eval_into(b, "b * 2_f32 + a");
+  EXPECT_FLOAT_EQ(b.data()[3], 2 * 3.5f + 3.0f);
+  EXPECT_FALSE(b.present(7));
+  engine.eval_into(b, "a + b");
+  EXPECT_FLOAT_EQ(b.data()[3], 13.0f);
+  a.present_mask().set(9, false);
+  engine.eval_into(a, "a + b");
+  EXPECT_FLOAT_EQ(a.data()[3], 16.0f);
+  EXPECT_FALSE(a.present(7));
+  EXPECT_FALSE(a.present(9));
+
+  Int32Column ints;
+  EXPECT_THROW(engine.eval_into(ints, "a + b"), std::runtime_error);
+}
+
+TEST(TieredEngineTest, PromotesHotShapes) {
+  constexpr std::size_t n = 1000;
+  Float32Column a = make_column(n, 0.0f);
+  Float32Column b = make_column(n, 0.5f);
+  b.present_mask().set(7, false);
+
+  std::atomic<int> compiles{0};
+  tiered_engine engine(std::make_unique<counting_compiler>(compiles),
+                       tiering_thresholds{.min_executions = 3,
+                                          .min_rows = 2000});
+  engine.bind("a", a);
+  engine.bind("b", b);
+
+  Float32Column interpreted = engine.eval_as<Float32DefaultPolicy>("a + b");
+  EXPECT_EQ(engine.tier("a + b"), 0);
+
+  for (int i = 0; i < 2; ++i) {
+    engine.eval_as<Float32DefaultPolicy>("a + b");
+  }
+  engine.wait_for_promotions();
+  EXPECT_EQ(compiles.load(), 1);
+  EXPECT_EQ(engine.tier("a + b"), 1);
+
+  Float32Column fused = engine.eval_as<Float32DefaultPolicy>("a + b");
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_FLOAT_EQ(fused.data()[i], interpreted.data()[i]);
+    EXPECT_EQ(fused.present_mask()[i], interpreted.present_mask()[i]);
+  }
+  EXPECT_FALSE(fused.present_mask()[7]);
+
+  // Further evaluations do not recompile
+  engine.eval_as<Float32DefaultPolicy>("a + b");
+  engine.wait_for_promotions();
+  EXPECT_EQ(compiles.load(), 1);
+}
+
+TEST(TieredEngineTest, KernelsAreSharedByShape) {
+  Float32Column a = make_column(256, 0.0f);
+  Float32Column b = make_column(256, 1.0f);
+
+  std::atomic<int> compiles{0};
+  tiered_engine engine(std::make_unique<counting_compiler>(compiles),
+                       tiering_thresholds{.min_executions = 1, .min_rows = 1});
+  engine.bind("a", a);
+  engine.bind("b", b);
+  engine.bind("x", b);
+  engine.bind("y", a);
+
+  engine.eval_as<Float32DefaultPolicy>("a + b");
+  engine.wait_for_promotions();
+  ASSERT_EQ(engine.tier("x + y"), 1);
+
+  Float32Column result = engine.eval_as<Float32DefaultPolicy>("x + y");
+  EXPECT_FLOAT_EQ(result.data()[100], 201.0f);
+  EXPECT_EQ(compiles.load(), 1);
+}
+
+TEST(TieredEngineTest, UnsupportedShapesStayInterpreted) {
+  Float32Column a = make_column(256, 1.0f);
+
+  std::atomic<int> compiles{0};
+  tiered_engine engine(std::make_unique<counting_compiler>(compiles),
+                       tiering_thresholds{.min_executions = 1, .min_rows = 1});
+  engine.bind("a", a);
+
+  for (int i = 0; i < 3; ++i) {
+    Float32Column result = engine.eval_as<Float32DefaultPolicy>("a * a");
+    EXPECT_FLOAT_EQ(result.data()[2], 9.0f);
+    engine.wait_for_promotions();
+  }
+  EXPECT_EQ(engine.tier("a * a"), 0);
+  EXPECT_EQ(compiles.load(), 1);
+}
+
+TEST(TieredEngineTest, InterpretsReductions) {
+  constexpr std::size_t n = 100;
+  Float32Column a = make_column(n, 0.0f);
+  Float32Column b(n, 2.0f);
+  Int32Column c(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    c.data()[i] = static_cast<std::int32_t>(i % 3) - 1;
+  }
+  a.present_mask().set(4, false); // c[4] == 0: excluded by the filter anyway
+  c.present_mask().set(5, false); // c[5] == 1: excluded as absent
+
+  tiered_engine engine;
+  engine.bind("a", a);
+  engine.bind("b", b);
+  engine.bind("c", c);
+
+  float expected = 0.0f;
+  float expected_max = std::numeric_limits<float>::lowest();
+  for (std::size_t i = 0; i < n; ++i) {
+    if (c.data()[i] > 0 && i != 5) {
+      expected += static_cast<float>(i) * 2.0f;
+      expected_max = std::max(expected_max, static_cast<float>(i));
+    }
+  }
+
+  EXPECT_FLOAT_EQ(
+      engine.reduce_as<Float32DefaultPolicy>("sum(a * b where c > 0_i32)"),
+      expected);
+  EXPECT_FLOAT_EQ(
+      engine.reduce_as<Float32DefaultPolicy>("max(a where c >= 1_i32)"),
+      expected_max);
+  EXPECT_EQ(engine.reduce_as<Int32DefaultPolicy>("sum(c)"), -2);
+  // Constant predicates select every present row or none
+  EXPECT_EQ(engine.reduce_as<Int32DefaultPolicy>("sum(c where 1_i32 < 2_i32)"),
+            -2);
+  EXPECT_EQ(engine.reduce_as<Int32DefaultPolicy>("sum(c where 2_i32 < 1_i32)"),
+            0);
+  EXPECT_EQ(
+      engine.reduce_as<Int32DefaultPolicy>("min(c * 2_i32 where 1_i32 < c)"),
+      std::numeric_limits<std::int32_t>::max());
+
+  EXPECT_THROW(engine.eval("sum(a)"), std::runtime_error);
+  EXPECT_THROW(engine.reduce_as<Float32DefaultPolicy>("a + b"),
+               std::runtime_error);
+}
+
+TEST(TieredEngineTest, PromotesFilteredReductions) {
+  constexpr std::size_t n = 1000;
+  Float32Column a = make_column(n, 0.0f);
+  Float32Column b = make_column(n, 1.0f);
+  Int32Column c(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    c.data()[i] = static_cast<std::int32_t>(i % 7) - 3;
+  }
+  b.present_mask().set(10, false);
+
+  std::atomic<int> compiles{0};
+  tiered_engine engine(std::make_unique<counting_compiler>(compiles),
+                       tiering_thresholds{.min_executions = 2, .min_rows = 1});
+  engine.bind("a", a);
+  engine.bind("b", b);
+  engine.bind("c", c);
+
+  constexpr std::string_view query = "sum(a * b where c > 0_i32)";
+  const float interpreted = engine.reduce_as<Float32DefaultPolicy>(query);
+  engine.reduce_as<Float32DefaultPolicy>(query);
+  engine.wait_for_promotions();
+  ASSERT_EQ(engine.tier(query), 1);
+
+  const float fused = engine.reduce_as<Float32DefaultPolicy>(query);
+  EXPECT_NEAR(fused, interpreted, 1e-6f * interpreted);
+  EXPECT_EQ(compiles.load(), 1);
+}
+
+// Serves the a + b kernel as if a previous run had persisted it
+class warm_cache_compiler : public counting_compiler {
+public:
+  using counting_compiler::counting_compiler;
+
+  const void* cached(const Program& program) override {
+    return program.shape() == "Float32Default:c0 c1 +"
+               ? reinterpret_cast<const void*>(&fused_add_f32)
+               : nullptr;
+  }
+};
+
+TEST(TieredEngineTest, FusedReductionsReadWholeRegisters) {
+  constexpr std::size_t n = 64;
+  column_vector<BF16DefaultPolicy> a(n);
+  column_vector<Date32Policy> d(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    a.data()[i] = bf16::from_float_trunc(static_cast<float>(i % 4));
+    d.data()[i] = static_cast<std::int32_t>(i);
+  }
+
+  tiered_engine engine(std::make_unique<reduction_compiler>(),
+                       tiering_thresholds{.min_executions = 1, .min_rows = 1});
+  engine.bind("a", a);
+  engine.bind("d", d);
+
+  const bf16 interpreted = engine.reduce_as<BF16DefaultPolicy>("sum(a)");
+  engine.wait_for_promotions();
+  ASSERT_EQ(engine.tier("sum(a)"), 1);
+  const bf16 fused = engine.reduce_as<BF16DefaultPolicy>("sum(a)");
+  EXPECT_EQ(fused.to_float(), 96.0f);
+  EXPECT_EQ(fused.to_float(), interpreted.to_float());
+
+  // Fused kernels only take Int32, Float32 and BF16 columns: the Date32 shape
+  // is never promoted, although the backend would hand out a kernel for it
+  EXPECT_EQ(engine.reduce_as<Date32Policy>("min(d)"), 0);
+  engine.wait_for_promotions();
+  EXPECT_EQ(engine.tier("min(d)"), 0);
+  EXPECT_EQ(engine.reduce_as<Date32Policy>("min(d)"), 0);
+}
+
+TEST(TieredEngineTest, CachedKernelsSkipTier0) {
+  Float32Column a = make_column(64, 0.0f);
+  Float32Column b = make_column(64, 1.0f);
+
+  std::atomic<int> compiles{0};
+  tiered_engine engine(std::make_unique<warm_cache_compiler>(compiles),
+                       tiering_thresholds{.min_executions = 1, .min_rows = 1});
+  engine.bind("a", a);
+  engine.bind("b", b);
+
+  EXPECT_EQ(engine.tier("a + b"), 1);
+  Float32Column result = engine.eval_as<Float32DefaultPolicy>("a + b");
+  EXPECT_FLOAT_EQ(result.data()[3], 7.0f);
+
+  // Already promoted: nothing is compiled
+  engine.wait_for_promotions();
+  EXPECT_EQ(compiles.load(), 0);
+  EXPECT_EQ(engine.tier("a * b"), 0);
+}
+
+TEST(TieredEngineTest, EvaluatesCalendarFunctions) {
+  constexpr std::size_t n = 100;
+  column_vector<Date32Policy> d(n);
+  column_vector<TimestampMicrosPolicy> ts(n);
+  Int32Column x(n, 1);
+  const std::int32_t start = days_from_civil(2024, 2, 20);
+  for (std::size_t i = 0; i < n; ++i) {
+    d.data()[i] = start + static_cast<std::int32_t>(i);
+    // One hour apart, from midnight
+    ts.data()[i] = micros_from_days(start) +
+                   static_cast<std::int64_t>(i) * micros_per_hour + 1;
+  }
+
+  tiered_engine engine;
+  engine.bind("d", d);
+  engine.bind("ts", ts);
+  engine.bind("x", x);
+
+  Int32Column ym = engine.eval_as<Int32DefaultPolicy>(
+      "year(d) * 100_i32 + month(d)");
+  EXPECT_EQ(ym.data()[0], 202402);
+  EXPECT_EQ(ym.data()[10], 202403);
+
+  // Hours 9 to 23 of the first four days; the fifth stops at 03:00
+  EXPECT_EQ(engine.reduce_as<Int32DefaultPolicy>(
+                "sum(x where hour(ts) >= 9_i32)"),
+            4 * 15);
+
+  ErasedColumn erased = engine.eval("date_trunc(day, ts)");
+  ASSERT_EQ(erased.get_policy(), DataTypeEnum::TimestampMicros);
+  EXPECT_EQ(erased.get_as<TimestampMicrosPolicy>()->data()[30],
+            micros_from_days(start + 1));
+  interpreter::delete_erased_column(erased);
+
+  EXPECT_EQ(engine.reduce_as<Date32Policy>("max(date_trunc(month, d))"),
+            days_from_civil(2024, 5, 1));
+  EXPECT_EQ(engine.reduce_as<TimestampMicrosPolicy>("min(ts)"),
+            micros_from_days(start) + 1);
+  EXPECT_EQ(engine.tier("year(d) * 100_i32 + month(d)"), 0);
+}
+
+TEST(TieredEngineTest, RejectsMismatchedColumns) {
+  Float32Column a = make_column(64, 0.0f);
+  Float32Column b = make_column(128, 0.0f);
+
+  tiered_engine engine;
+  engine.bind("a", a);
+  engine.bind("b", b);
+  EXPECT_THROW(engine.eval("a + b"), std::runtime_error);
+  EXPECT_THROW(engine.eval("a + c"), std::runtime_error);
+  EXPECT_THROW(engine.eval_as<Int32DefaultPolicy>("a"), std::runtime_error);
+}
+
+TEST(TieredEngineTest, RejectsDecimalLiterals) {
+  // The parser reads _d64 literals, but programs hold 32-bit lanes
+  Float32Column a = make_column(64, 0.0f);
+  tiered_engine engine;
+  engine.bind("a", a);
+  for (const char* expression : {"a * 1.25_d64", "sum(a where a > 1.5_d64)"}) {
+    SCOPED_TRACE(expression);
+    try {
+      engine.eval_as<Float32DefaultPolicy>(expression);
+      ADD_FAILURE() << "Decimal64 literal accepted";
+    } catch (const std::runtime_error& error) {
+      EXPECT_NE(std::string(error.what()).find("is Decimal64"),
+                std::string::npos)
+          << error.what();
+    }
+  }
+}
+
+} // namespace
+} // namespace franklin::expression
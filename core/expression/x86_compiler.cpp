@@ -0,0 +1,759 @@
+#include "core/expression/x86_compiler.hpp"
+#include "core/expression/kernel_cache.hpp"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+namespace franklin::expression {
+
+namespace {
+
+// Part of the kernel cache key. Bump whenever the generated code or the
+// fused_kernel/fused_reduction ABI changes, so that stale entries are ignored.
+constexpr std::string_view kCodegenVersion = "franklin-x86-1";
+
+// ============================================================================
+// Encoder
+// ============================================================================
+
+// General purpose registers by encoding: the low three bits go into the
+// ModRM/SIB byte, the fourth into the REX or VEX prefix. Vector registers
+// are plain numbers 0-15 (ymm<n>).
+enum gp : std::uint8_t {
+  rax,
+  rcx,
+  rdx,
+  rbx,
+  rsp,
+  rbp,
+  rsi,
+  rdi,
+  r8,
+  r9,
+  r10,
+  r11,
+  r12,
+  r13,
+  r14,
+  r15
+};
+
+// Jump target. rel32 fields referring to it are patched when it is bound.
+struct label {
+  std::size_t position = 0;
+  bool bound = false;
+  std::vector<std::size_t> uses; // offsets of rel32 fields
+};
+
+// [base + index * scale + disp]
+struct mem {
+  gp base;
+  int index = -1; // a gp, or none
+  std::uint8_t scale = 1;
+  std::int32_t disp = 0;
+};
+
+mem ptr(gp base, std::int32_t disp = 0) { return {base, -1, 1, disp}; }
+mem ptr(gp base, gp index, std::uint8_t scale) {
+  return {base, index, scale, 0};
+}
+
+// Just the instructions the kernels below use, named after their mnemonics.
+// Vector instructions always take the three-byte VEX prefix; register
+// operands are (destination, first source, second source) as in Intel
+// syntax.
+class assembler {
+public:
+  std::vector<std::uint8_t> code;
+
+  void bind(label& target) {
+    target.position = code.size();
+    target.bound = true;
+    for (std::size_t use : target.uses) {
+      patch_rel32(use, target.position);
+    }
+  }
+
+  // General purpose
+
+  void push(gp reg) {
+    if (reg >= 8) {
+      byte(0x41);
+    }
+    byte(0x50 + (reg & 7));
+  }
+
+  void pop(gp reg) {
+    if (reg >= 8) {
+      byte(0x41);
+    }
+    byte(0x58 + (reg & 7));
+  }
+
+  void mov(gp dst, const mem& src) { // 64-bit load
+    rex(true, dst, src);
+    byte(0x8B);
+    modrm(dst, src);
+  }
+
+  void mov(gp dst, gp src) { // 64-bit
+    rex(true, src, dst);
+    byte(0x89);
+    modrm(src, dst);
+  }
+
+  void mov32(gp dst, std::uint32_t imm) {
+    rex(false, 0, dst);
+    byte(static_cast<std::uint8_t>(0xB8 + (dst & 7)));
+    dword(imm);
+  }
+
+  void movzx8(gp dst, const mem& src) { // zero-extending byte load, 32-bit
+    rex(false, dst, src);
+    byte(0x0F);
+    byte(0xB6);
+    modrm(dst, src);
+  }
+
+  void and8(gp dst, const mem& src) { // low byte of dst &= byte [src]
+    // Always with REX, which selects spl/bpl/sil/dil rather than ah-bh
+    byte(static_cast<std::uint8_t>(0x40 | (dst >= 8 ? 4 : 0) |
+                                   (index_extended(src) ? 2 : 0) |
+                                   (src.base >= 8 ? 1 : 0)));
+    byte(0x22);
+    modrm(dst, src);
+  }
+
+  void and_(gp dst, std::int8_t imm) { // 64-bit, sign-extended immediate
+    rex(true, 0, dst);
+    byte(0x83);
+    modrm(4, dst);
+    byte(static_cast<std::uint8_t>(imm));
+  }
+
+  void add(gp dst, std::int8_t imm) {
+    rex(true, 0, dst);
+    byte(0x83);
+    modrm(0, dst);
+    byte(static_cast<std::uint8_t>(imm));
+  }
+
+  void shr(gp dst, std::uint8_t imm) {
+    rex(true, 0, dst);
+    byte(0xC1);
+    modrm(5, dst);
+    byte(imm);
+  }
+
+  void cmp(gp lhs, gp rhs) {
+    rex(true, rhs, lhs);
+    byte(0x39);
+    modrm(rhs, lhs);
+  }
+
+  void xor32(gp dst, gp src) {
+    rex(false, src, dst);
+    byte(0x31);
+    modrm(src, dst);
+  }
+
+  void jz(label& target) { jcc(0x84, target); }
+  void jb(label& target) { jcc(0x82, target); }
+
+  void ret() { byte(0xC3); }
+
+  // Data
+
+  void align(std::size_t alignment) { // padded with int3
+    while (code.size() % alignment != 0) {
+      byte(0xCC);
+    }
+  }
+
+  void dd(std::uint32_t value) { dword(value); }
+
+  // Vector, 256-bit unless noted
+
+  void vmovups(int dst, const mem& src) { vex(0, 1, 0x10, dst, 0, src); }
+  void vmovups(const mem& dst, int src) { vex(0, 1, 0x11, src, 0, dst); }
+  void vbroadcastss(int dst, const mem& src) {
+    vex(1, 2, 0x18, dst, 0, src);
+  }
+  void vpbroadcastd(int dst, const mem& src) {
+    vex(1, 2, 0x58, dst, 0, src);
+  }
+  void vpbroadcastd(int dst, int src) { vex(1, 2, 0x58, dst, 0, src); }
+  void vmovaps(int dst, int src) { vex(0, 1, 0x28, dst, 0, src); }
+
+  void vmovd(int dst, gp src) { // xmm <- 32-bit gp
+    vex_prefix(1, 1, false, dst, 0, false, src >= 8);
+    byte(0x6E);
+    modrm(dst, src);
+  }
+
+  void vaddps(int dst, int lhs, int rhs) { vex(0, 1, 0x58, dst, lhs, rhs); }
+  void vsubps(int dst, int lhs, int rhs) { vex(0, 1, 0x5C, dst, lhs, rhs); }
+  void vmulps(int dst, int lhs, int rhs) { vex(0, 1, 0x59, dst, lhs, rhs); }
+  void vpaddd(int dst, int lhs, int rhs) { vex(1, 1, 0xFE, dst, lhs, rhs); }
+  void vpsubd(int dst, int lhs, int rhs) { vex(1, 1, 0xFA, dst, lhs, rhs); }
+  void vpmulld(int dst, int lhs, int rhs) { vex(1, 2, 0x40, dst, lhs, rhs); }
+  void vminps(int dst, int lhs, int rhs) { vex(0, 1, 0x5D, dst, lhs, rhs); }
+  void vmaxps(int dst, int lhs, int rhs) { vex(0, 1, 0x5F, dst, lhs, rhs); }
+  void vpminsd(int dst, int lhs, int rhs) { vex(1, 2, 0x39, dst, lhs, rhs); }
+  void vpmaxsd(int dst, int lhs, int rhs) { vex(1, 2, 0x3D, dst, lhs, rhs); }
+
+  void vpand(int dst, int lhs, int rhs) { vex(1, 1, 0xDB, dst, lhs, rhs); }
+  void vpand(int dst, int lhs, label& rhs) { vex(1, 1, 0xDB, dst, lhs, rhs); }
+  void vpandn(int dst, int lhs, int rhs) { vex(1, 1, 0xDF, dst, lhs, rhs); }
+  void vpcmpeqd(int dst, int lhs, int rhs) { vex(1, 1, 0x76, dst, lhs, rhs); }
+  void vpcmpeqd(int dst, int lhs, label& rhs) {
+    vex(1, 1, 0x76, dst, lhs, rhs);
+  }
+  void vpcmpgtd(int dst, int lhs, int rhs) { vex(1, 1, 0x66, dst, lhs, rhs); }
+
+  void vcmpps(int dst, int lhs, int rhs, std::uint8_t predicate) {
+    vex(0, 1, 0xC2, dst, lhs, rhs);
+    byte(predicate);
+  }
+
+  // dst = lanes of `mask` with the sign bit set ? rhs : lhs
+  void vblendvps(int dst, int lhs, int rhs, int mask) {
+    vex(1, 3, 0x4A, dst, lhs, rhs);
+    byte(static_cast<std::uint8_t>(mask << 4));
+  }
+
+  void vzeroupper() {
+    byte(0xC5);
+    byte(0xF8);
+    byte(0x77);
+  }
+
+private:
+  void byte(std::uint8_t value) { code.push_back(value); }
+
+  void dword(std::uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+      byte(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+  }
+
+  void patch_rel32(std::size_t at, std::size_t target) {
+    const auto rel = static_cast<std::uint32_t>(static_cast<std::int64_t>(
+        target - (at + 4)));
+    for (int i = 0; i < 4; ++i) {
+      code[at + i] = static_cast<std::uint8_t>(rel >> (8 * i));
+    }
+  }
+
+  // rel32 field relative to the end of the instruction, which it must end
+  void rel32(label& target) {
+    const std::size_t at = code.size();
+    dword(0);
+    if (target.bound) {
+      patch_rel32(at, target.position);
+    } else {
+      target.uses.push_back(at);
+    }
+  }
+
+  void jcc(std::uint8_t condition, label& target) {
+    byte(0x0F);
+    byte(condition);
+    rel32(target);
+  }
+
+  static bool index_extended(const mem& m) { return m.index >= 8; }
+
+  // REX for a register-register form (reg, rm)
+  void rex(bool wide, int reg, int rm) {
+    const std::uint8_t bits = (wide ? 8 : 0) | (reg >= 8 ? 4 : 0) |
+                              (rm >= 8 ? 1 : 0);
+    if (bits != 0) {
+      byte(0x40 | bits);
+    }
+  }
+
+  void rex(bool wide, int reg, const mem& m) {
+    const std::uint8_t bits = (wide ? 8 : 0) | (reg >= 8 ? 4 : 0) |
+                              (index_extended(m) ? 2 : 0) |
+                              (m.base >= 8 ? 1 : 0);
+    if (bits != 0) {
+      byte(0x40 | bits);
+    }
+  }
+
+  void modrm(int reg, int rm) {
+    byte(static_cast<std::uint8_t>(0xC0 | (reg & 7) << 3 | (rm & 7)));
+  }
+
+  void modrm(int reg, const mem& m) {
+    // rsp/r12 as base need a SIB byte; rbp/r13 need a displacement
+    const bool sib = m.index >= 0 || (m.base & 7) == 4;
+    const int mod = m.disp == 0 && (m.base & 7) != 5 ? 0
+                    : m.disp >= -128 && m.disp <= 127 ? 1
+                                                      : 2;
+    byte(static_cast<std::uint8_t>(mod << 6 | (reg & 7) << 3 |
+                                   (sib ? 4 : m.base & 7)));
+    if (sib) {
+      const int scale_bits = m.scale == 8 ? 3 : m.scale == 4 ? 2
+                                              : m.scale == 2 ? 1
+                                                             : 0;
+      const int index = m.index >= 0 ? m.index & 7 : 4; // 4: no index
+      byte(static_cast<std::uint8_t>(scale_bits << 6 | index << 3 |
+                                     (m.base & 7)));
+    }
+    if (mod == 1) {
+      byte(static_cast<std::uint8_t>(m.disp));
+    } else if (mod == 2) {
+      dword(static_cast<std::uint32_t>(m.disp));
+    }
+  }
+
+  // Three-byte VEX prefix, W0. pp: 0 none, 1 66; map: 1 0F, 2 0F38,
+  // 3 0F3A. The R, X and B bits and vvvv are stored inverted.
+  void vex_prefix(int pp, int map, bool ymm, int reg, int vvvv, bool x,
+                  bool b) {
+    byte(0xC4);
+    byte(static_cast<std::uint8_t>((reg >= 8 ? 0 : 0x80) | (x ? 0 : 0x40) |
+                                   (b ? 0 : 0x20) | map));
+    byte(static_cast<std::uint8_t>((~vvvv & 15) << 3 | (ymm ? 4 : 0) | pp));
+  }
+
+  // op reg, vvvv, rm (register forms, 256-bit)
+  void vex(int pp, int map, std::uint8_t opcode, int reg, int vvvv, int rm) {
+    vex_prefix(pp, map, true, reg, vvvv, false, rm >= 8);
+    byte(opcode);
+    modrm(reg, rm);
+  }
+
+  // op reg, vvvv, [mem] (256-bit)
+  void vex(int pp, int map, std::uint8_t opcode, int reg, int vvvv,
+           const mem& m) {
+    vex_prefix(pp, map, true, reg, vvvv, index_extended(m), m.base >= 8);
+    byte(opcode);
+    modrm(reg, m);
+  }
+
+  // op reg, vvvv, [rip + data] (256-bit)
+  void vex(int pp, int map, std::uint8_t opcode, int reg, int vvvv,
+           label& data) {
+    vex_prefix(pp, map, true, reg, vvvv, false, false);
+    byte(opcode);
+    byte(static_cast<std::uint8_t>((reg & 7) << 3 | 5)); // mod 00, rm 101
+    rel32(data);
+  }
+};
+
+// ============================================================================
+// Kernels
+// ============================================================================
+
+constexpr std::size_t kMaxStackDepth = 16;
+
+// Registers holding the column base pointers. The first four are caller-saved;
+// the rest are callee-saved and pushed/popped around the kernel.
+constexpr std::size_t kMaxColumns = 9;
+constexpr std::array<gp, kMaxColumns> kColumnRegs = {r8,  r9,  r10, r11, rbx,
+                                                     r12, r13, r14, r15};
+constexpr std::size_t kCallerSavedColumnRegs = 4;
+
+// Reduction kernels take n in r8, so their columns start at r9
+constexpr std::size_t kMaxReductionColumns = kMaxColumns - 1;
+
+// ymm13-15 hold the identity, the selection and the accumulator of a
+// reduction
+constexpr std::size_t kMaxReductionStackDepth = 13;
+
+bool is_jit_type(DataTypeEnum::Enum type) {
+  return type == DataTypeEnum::Int32Default ||
+         type == DataTypeEnum::Float32Default;
+}
+
+bool supported(const Program& program) {
+  return is_jit_type(program.type) && !program.reduction &&
+         !program.columns.empty() && program.columns.size() <= kMaxColumns &&
+         program.max_stack_depth <= kMaxStackDepth;
+}
+
+bool supported_reduction(const Program& program) {
+  return is_jit_type(program.type) && program.reduction &&
+         (!program.filtered() || is_jit_type(program.predicate_type)) &&
+         !program.columns.empty() &&
+         program.columns.size() <= kMaxReductionColumns &&
+         program.max_stack_depth <= kMaxReductionStackDepth;
+}
+
+// Emits the arithmetic of code[begin, end) for one vector of 8 elements,
+// with operand stack slot d in ymm<d>. `columns[slot]` holds the base
+// pointer of each column and rax the element index.
+void emit_expression(assembler& a, const Program& program, std::size_t begin,
+                     std::size_t end, DataTypeEnum::Enum type,
+                     const gp* columns, gp literals, int depth) {
+  const bool is_float = type == DataTypeEnum::Float32Default;
+  for (std::size_t pc = begin; pc < end; ++pc) {
+    const Instruction& instr = program.code[pc];
+    switch (instr.kind) {
+    case Instruction::Kind::LoadColumn:
+      a.vmovups(depth++, ptr(columns[instr.slot], rax, 4));
+      break;
+    case Instruction::Kind::LoadLiteral: {
+      const mem literal =
+          ptr(literals, static_cast<std::int32_t>(instr.slot * 4));
+      if (is_float) {
+        a.vbroadcastss(depth++, literal);
+      } else {
+        a.vpbroadcastd(depth++, literal);
+      }
+      break;
+    }
+    case Instruction::Kind::Add:
+    case Instruction::Kind::Sub:
+    case Instruction::Kind::Mul: {
+      const int rhs = --depth;
+      const int lhs = depth - 1;
+      if (instr.kind == Instruction::Kind::Add && is_float) {
+        a.vaddps(lhs, lhs, rhs);
+      } else if (instr.kind == Instruction::Kind::Add) {
+        a.vpaddd(lhs, lhs, rhs);
+      } else if (instr.kind == Instruction::Kind::Sub && is_float) {
+        a.vsubps(lhs, lhs, rhs);
+      } else if (instr.kind == Instruction::Kind::Sub) {
+        a.vpsubd(lhs, lhs, rhs);
+      } else if (is_float) {
+        a.vmulps(lhs, lhs, rhs);
+      } else {
+        a.vpmulld(lhs, lhs, rhs);
+      }
+      break;
+    }
+    default:
+      // Comparisons are emitted by emit_reduction_kernel()
+      FRANKLIN_ASSERT_MSG(false, "comparison inside an expression");
+    }
+  }
+}
+
+// Emit: void kernel(const void* const* inputs, const uint32_t* literals,
+//                   void* out, size_t n)
+// System V AMD64 ABI: rdi=inputs, rsi=literals, rdx=out, rcx=n
+//
+// n is a padded column length (a multiple of 16 for 32-bit types), so the loop
+// needs no scalar tail; n & ~7 only guards against misuse.
+void emit_kernel(assembler& a, const Program& program) {
+  const std::size_t num_columns = program.columns.size();
+
+  for (std::size_t i = kCallerSavedColumnRegs; i < num_columns; ++i) {
+    a.push(kColumnRegs[i]);
+  }
+  for (std::size_t i = 0; i < num_columns; ++i) {
+    a.mov(kColumnRegs[i], ptr(rdi, static_cast<std::int32_t>(i * 8)));
+  }
+
+  label loop;
+  label done;
+  a.and_(rcx, ~7);
+  a.jz(done);
+  a.xor32(rax, rax);
+
+  a.bind(loop);
+  emit_expression(a, program, 0, program.code.size(), program.type,
+                  kColumnRegs.data(), rsi, 0);
+  a.vmovups(ptr(rdx, rax, 4), 0);
+  a.add(rax, 8);
+  a.cmp(rax, rcx);
+  a.jb(loop);
+
+  a.bind(done);
+  a.vzeroupper();
+  for (std::size_t i = num_columns; i-- > kCallerSavedColumnRegs;) {
+    a.pop(kColumnRegs[i]);
+  }
+  a.ret();
+}
+
+// vcmpps predicates (ordered, non-signalling; != is unordered so that it
+// holds for NaN, as in C++)
+std::uint8_t float_predicate(Instruction::Kind kind) {
+  switch (kind) {
+  case Instruction::Kind::CmpLt:
+    return 0x11; // LT_OQ
+  case Instruction::Kind::CmpLe:
+    return 0x12; // LE_OQ
+  case Instruction::Kind::CmpGt:
+    return 0x1E; // GT_OQ
+  case Instruction::Kind::CmpGe:
+    return 0x1D; // GE_OQ
+  case Instruction::Kind::CmpEq:
+    return 0x00; // EQ_OQ
+  default:
+    return 0x04; // NEQ_UQ
+  }
+}
+
+// ymm14 &= ymm1 op ymm2 on int32 lanes. AVX2 only compares for == and >;
+// the other predicates swap the operands or clear the lanes that compare
+// true instead (vpandn).
+void emit_int_predicate(assembler& a, Instruction::Kind kind) {
+  switch (kind) {
+  case Instruction::Kind::CmpLt:
+    a.vpcmpgtd(1, 2, 1);
+    a.vpand(14, 14, 1);
+    break;
+  case Instruction::Kind::CmpLe:
+    a.vpcmpgtd(1, 1, 2);
+    a.vpandn(14, 1, 14);
+    break;
+  case Instruction::Kind::CmpGt:
+    a.vpcmpgtd(1, 1, 2);
+    a.vpand(14, 14, 1);
+    break;
+  case Instruction::Kind::CmpGe:
+    a.vpcmpgtd(1, 2, 1);
+    a.vpandn(14, 1, 14);
+    break;
+  case Instruction::Kind::CmpEq:
+    a.vpcmpeqd(1, 1, 2);
+    a.vpand(14, 14, 1);
+    break;
+  default:
+    a.vpcmpeqd(1, 1, 2);
+    a.vpandn(14, 1, 14);
+    break;
+  }
+}
+
+// Bit pattern of the reduction's identity element
+std::uint32_t identity_bits(ReductionOp op, bool is_float) {
+  switch (op) {
+  case ReductionOp::Sum:
+    return 0;
+  case ReductionOp::Product:
+    return is_float ? std::bit_cast<std::uint32_t>(1.0f) : 1;
+  case ReductionOp::Min:
+    return is_float ? std::bit_cast<std::uint32_t>(
+                          std::numeric_limits<float>::max())
+                    : std::bit_cast<std::uint32_t>(
+                          std::numeric_limits<std::int32_t>::max());
+  case ReductionOp::Max:
+    return is_float ? std::bit_cast<std::uint32_t>(
+                          std::numeric_limits<float>::lowest())
+                    : std::bit_cast<std::uint32_t>(
+                          std::numeric_limits<std::int32_t>::lowest());
+  }
+  return 0;
+}
+
+// Emit: void kernel(const void* const* inputs, const uint64_t* const* masks,
+//                   const uint32_t* literals, void* lanes, size_t n)
+// System V AMD64 ABI: rdi=inputs, rsi=masks, rdx=literals, rcx=lanes, r8=n
+//
+// The generated code is the register-resident version of reduce_float32's
+// masked pattern, with the predicate folded into the selection:
+//
+//   ymm14  = AND of the columns' present bits for these 8 rows, as lanes
+//   ymm0   = value expression
+//   ymm14 &= predicate
+//   ymm15  = op(ymm15, blend(identity, ymm0, ymm14))
+//
+// so neither the selection nor the value is ever written to memory. Rows
+// outside the selection contribute the identity, as with the blend in
+// reduce_float32.
+void emit_reduction_kernel(assembler& a, const Program& program) {
+  const std::size_t num_columns = program.columns.size();
+  const gp* columns = kColumnRegs.data() + 1;
+  const bool is_float = program.type == DataTypeEnum::Float32Default;
+  constexpr int identity = 13;
+  constexpr int selected = 14;
+  constexpr int acc = 15;
+
+  // rbp: validity byte, rdi: mask pointer, rcx: byte index into the masks.
+  // The lanes pointer is parked on the stack to free rcx.
+  a.push(rbp);
+  for (std::size_t i = kCallerSavedColumnRegs - 1; i < num_columns; ++i) {
+    a.push(columns[i]);
+  }
+  a.push(rcx);
+  for (std::size_t i = 0; i < num_columns; ++i) {
+    a.mov(columns[i], ptr(rdi, static_cast<std::int32_t>(i * 8)));
+  }
+
+  a.mov32(rax, identity_bits(*program.reduction, is_float));
+  a.vmovd(identity, rax);
+  a.vpbroadcastd(identity, identity);
+  a.vmovaps(acc, identity);
+
+  label loop;
+  label done;
+  label lane_bits; // 1 << lane, to spread a validity byte over the lanes
+  a.and_(r8, ~7);
+  a.jz(done);
+  a.xor32(rax, rax);
+
+  a.bind(loop);
+  a.mov(rcx, rax);
+  a.shr(rcx, 3);
+  a.mov(rdi, ptr(rsi));
+  a.movzx8(rbp, ptr(rdi, rcx, 1));
+  for (std::size_t i = 1; i < num_columns; ++i) {
+    a.mov(rdi, ptr(rsi, static_cast<std::int32_t>(i * 8)));
+    a.and8(rbp, ptr(rdi, rcx, 1));
+  }
+  a.vmovd(selected, rbp);
+  a.vpbroadcastd(selected, selected);
+  a.vpand(selected, selected, lane_bits);
+  a.vpcmpeqd(selected, selected, lane_bits);
+
+  emit_expression(a, program, 0, program.value_length, program.type, columns,
+                  rdx, 0);
+
+  if (program.filtered()) {
+    const std::size_t last = program.code.size() - 1;
+    emit_expression(a, program, program.value_length, last,
+                    program.predicate_type, columns, rdx, 1);
+    const Instruction::Kind kind = program.code[last].kind;
+    if (program.predicate_type == DataTypeEnum::Float32Default) {
+      a.vcmpps(1, 1, 2, float_predicate(kind));
+      a.vpand(selected, selected, 1);
+    } else {
+      emit_int_predicate(a, kind);
+    }
+  }
+  a.vblendvps(0, identity, 0, selected);
+
+  const ReductionOp op = *program.reduction;
+  if (op == ReductionOp::Sum && is_float) {
+    a.vaddps(acc, acc, 0);
+  } else if (op == ReductionOp::Sum) {
+    a.vpaddd(acc, acc, 0);
+  } else if (op == ReductionOp::Product && is_float) {
+    a.vmulps(acc, acc, 0);
+  } else if (op == ReductionOp::Product) {
+    a.vpmulld(acc, acc, 0);
+  } else if (op == ReductionOp::Min && is_float) {
+    a.vminps(acc, acc, 0);
+  } else if (op == ReductionOp::Min) {
+    a.vpminsd(acc, acc, 0);
+  } else if (is_float) {
+    a.vmaxps(acc, acc, 0);
+  } else {
+    a.vpmaxsd(acc, acc, 0);
+  }
+
+  a.add(rax, 8);
+  a.cmp(rax, r8);
+  a.jb(loop);
+
+  a.bind(done);
+  a.pop(rcx);
+  a.vmovups(ptr(rcx), acc);
+  a.vzeroupper();
+  for (std::size_t i = num_columns; i-- > kCallerSavedColumnRegs - 1;) {
+    a.pop(columns[i]);
+  }
+  a.pop(rbp);
+  a.ret();
+
+  a.align(32);
+  a.bind(lane_bits);
+  for (int lane = 0; lane < 8; ++lane) {
+    a.dd(1u << lane);
+  }
+}
+
+} // namespace
+
+// Every kernel gets its own pages, written and then made read+execute, so no
+// page is ever writable and executable at once
+struct x86_kernel_compiler::impl {
+  struct mapping {
+    void* address;
+    std::size_t length;
+  };
+
+  std::mutex mutex; // guards mappings
+  std::vector<mapping> mappings;
+  std::optional<kernel_cache> cache;
+
+  ~impl() {
+    for (const mapping& map : mappings) {
+      ::munmap(map.address, map.length);
+    }
+  }
+
+  // Copy `code` into executable memory and persist it for `program`;
+  // nullptr on failure, which leaves the shape in tier 0
+  const void* install(const std::vector<std::uint8_t>& code,
+                      const Program& program) {
+    const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const std::size_t length = (code.size() + page - 1) / page * page;
+    void* address = ::mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (address == MAP_FAILED) {
+      return nullptr;
+    }
+    std::memcpy(address, code.data(), code.size());
+    if (::mprotect(address, length, PROT_READ | PROT_EXEC) != 0) {
+      ::munmap(address, length);
+      return nullptr;
+    }
+    {
+      std::lock_guard lock(mutex);
+      mappings.push_back({address, length});
+    }
+    // The kernels only address their arguments and their own trailing data,
+    // so the bytes can be stored as they are. A failed store only costs the
+    // next run a compilation.
+    if (cache) {
+      cache->store(program.shape(), code.data(), code.size());
+    }
+    return address;
+  }
+};
+
+x86_kernel_compiler::x86_kernel_compiler(std::string cache_directory)
+    : impl_(std::make_unique<impl>()) {
+  if (!cache_directory.empty()) {
+    impl_->cache.emplace(std::move(cache_directory),
+                         std::string(kCodegenVersion) + ";" +
+                             host_cpu_features_digest());
+  }
+}
+
+x86_kernel_compiler::~x86_kernel_compiler() = default;
+
+fused_kernel x86_kernel_compiler::compile(const Program& program) {
+  if (!supported(program) || !__builtin_cpu_supports("avx2")) {
+    return nullptr;
+  }
+  assembler a;
+  emit_kernel(a, program);
+  return reinterpret_cast<fused_kernel>(impl_->install(a.code, program));
+}
+
+fused_reduction x86_kernel_compiler::compile_reduction(const Program& program) {
+  if (!supported_reduction(program) || !__builtin_cpu_supports("avx2")) {
+    return nullptr;
+  }
+  assembler a;
+  emit_reduction_kernel(a, program);
+  return reinterpret_cast<fused_reduction>(impl_->install(a.code, program));
+}
+
+const void* x86_kernel_compiler::cached(const Program& program) {
+  const bool compilable = program.reduction ? supported_reduction(program)
+                                            : supported(program);
+  if (!compilable || !impl_->cache || !__builtin_cpu_supports("avx2")) {
+    return nullptr;
+  }
+  return impl_->cache->load(program.shape());
+}
+
+} // namespace franklin::expression
@@ -0,0 +1,47 @@
+#ifndef FRANKLIN_CORE_EXPRESSION_X86_COMPILER_HPP
+#define FRANKLIN_CORE_EXPRESSION_X86_COMPILER_HPP
+
+#include "core/expression/tiered_engine.hpp"
+#include <memory>
+#include <string>
+
+namespace franklin::expression {
+
+// x86-64 AVX2 backend for the tiered_engine.
+//
+// Emits the machine code itself (see x86_compiler.cpp for the handful of
+// instructions it encodes), so tier 1 needs no assembler library. Each
+// program becomes one loop that keeps the whole operand stack in ymm
+// registers (stack slot d lives in ymm<d>), so an expression such as
+// `a * b + c` reads each input once and writes the output once instead of
+// materializing an intermediate column per operator.
+//
+// Reductions compile the same way: the value, the predicate and the rows'
+// validity stay in registers and only the accumulator lanes are stored.
+//
+// Supported: Int32Default and Float32Default programs with at most 9 distinct
+// columns and a stack depth of at most 16 (8 columns and a depth of 13 for
+// reductions). Anything else (including BF16) is rejected and keeps running
+// in tier 0. Needs AVX2 on the host.
+//
+// With a cache directory, every kernel is also written to a kernel_cache
+// keyed by its shape, the code generator version and the host's CPU
+// features, and cached() hands those kernels back to the engine of a later
+// run, so that a warm restart starts such shapes in tier 1.
+class x86_kernel_compiler final : public kernel_compiler {
+public:
+  explicit x86_kernel_compiler(std::string cache_directory = {});
+  ~x86_kernel_compiler() override;
+
+  fused_kernel compile(const Program& program) override;
+  fused_reduction compile_reduction(const Program& program) override;
+  const void* cached(const Program& program) override;
+
+private:
+  struct impl;
+  std::unique_ptr<impl> impl_;
+};
+
+} // namespace franklin::expression
+
+#endif // FRANKLIN_CORE_EXPRESSION_X86_COMPILER_HPP
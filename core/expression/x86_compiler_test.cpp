@@ -0,0 +1,279 @@
+#include "core/expression/x86_compiler.hpp"
+#include <bit>
+#include <cmath>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace franklin::expression {
+namespace {
+
+using Float32Column = column_vector<Float32DefaultPolicy>;
+using Int32Column = column_vector<Int32DefaultPolicy>;
+
+// Promotes every shape on its first execution
+tiering_thresholds eager() { return {.min_executions = 1, .min_rows = 1}; }
+
+// Float32 columns a, b, c and Int32 columns i, j, k, with some absent rows
+class X86CompilerTest : public ::testing::Test {
+protected:
+  static constexpr std::size_t n = 1003;
+
+  void SetUp() override {
+    if (!__builtin_cpu_supports("avx2")) {
+      GTEST_SKIP() << "the x86 kernels need AVX2";
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      fa.data()[i] = static_cast<float>(i) * 0.25f - 40.0f;
+      fb.data()[i] = 1.5f + static_cast<float>(i % 17);
+      fc.data()[i] = static_cast<float>(i % 5) - 2.0f;
+      ia.data()[i] = static_cast<std::int32_t>(i * 7919) - 4'000'000;
+      ib.data()[i] = static_cast<std::int32_t>(i % 13) - 6;
+      ic.data()[i] = static_cast<std::int32_t>(i);
+    }
+    fa.present_mask().set(3, false);
+    fb.present_mask().set(64, false);
+    ia.present_mask().set(5, false);
+    ic.present_mask().set(700, false);
+  }
+
+  void bind(tiered_engine& engine) {
+    engine.bind("a", fa);
+    engine.bind("b", fb);
+    engine.bind("c", fc);
+    engine.bind("i", ia);
+    engine.bind("j", ib);
+    engine.bind("k", ic);
+  }
+
+  // Evaluates `expression` in tier 0 and with the x86 kernel, and checks
+  // that both produce the same bits and the same validity
+  template <concepts::ColumnPolicy Policy>
+  void expect_matches_tier0(const std::string& expression) {
+    SCOPED_TRACE(expression);
+    tiered_engine interpreted;
+    bind(interpreted);
+    const column_vector<Policy> expected =
+        interpreted.eval_as<Policy>(expression);
+
+    tiered_engine fused(std::make_unique<x86_kernel_compiler>(), eager());
+    bind(fused);
+    fused.eval_as<Policy>(expression);
+    fused.wait_for_promotions();
+    ASSERT_EQ(fused.tier(expression), 1);
+    const column_vector<Policy> actual = fused.eval_as<Policy>(expression);
+
+    ASSERT_EQ(actual.data().size(), expected.data().size());
+    for (std::size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(std::bit_cast<std::uint32_t>(actual.data()[i]),
+                std::bit_cast<std::uint32_t>(expected.data()[i]))
+          << "row " << i;
+      ASSERT_EQ(actual.present(i), expected.present(i)) << "row " << i;
+    }
+  }
+
+  // As expect_matches_tier0(), for reduce_as(). Float32 sums are compared
+  // with a tolerance: the fused kernel adds in a different order.
+  template <concepts::ColumnPolicy Policy>
+  void expect_reduction_matches_tier0(const std::string& expression) {
+    SCOPED_TRACE(expression);
+    tiered_engine interpreted;
+    bind(interpreted);
+    const auto expected = interpreted.reduce_as<Policy>(expression);
+
+    tiered_engine fused(std::make_unique<x86_kernel_compiler>(), eager());
+    bind(fused);
+    fused.reduce_as<Policy>(expression);
+    fused.wait_for_promotions();
+    ASSERT_EQ(fused.tier(expression), 1);
+    const auto actual = fused.reduce_as<Policy>(expression);
+
+    if constexpr (std::is_same_v<Policy, Float32DefaultPolicy>) {
+      if (expression.starts_with("sum")) {
+        EXPECT_NEAR(actual, expected, 1e-5f * std::abs(expected));
+        return;
+      }
+    }
+    EXPECT_EQ(actual, expected);
+  }
+
+  Float32Column fa{n};
+  Float32Column fb{n};
+  Float32Column fc{n};
+  Int32Column ia{n};
+  Int32Column ib{n};
+  Int32Column ic{n};
+};
+
+TEST_F(X86CompilerTest, Float32MatchesTier0) {
+  expect_matches_tier0<Float32DefaultPolicy>("a + b");
+  expect_matches_tier0<Float32DefaultPolicy>("a * b + c");
+  expect_matches_tier0<Float32DefaultPolicy>("a - b * 0.5_f32");
+  expect_matches_tier0<Float32DefaultPolicy>("2_f32 - a * a");
+  expect_matches_tier0<Float32DefaultPolicy>("(a + b) * (b - c) - (c * a)");
+}
+
+TEST_F(X86CompilerTest, Int32MatchesTier0) {
+  // Products wrap around in both tiers
+  expect_matches_tier0<Int32DefaultPolicy>("i * j");
+  expect_matches_tier0<Int32DefaultPolicy>("i - j * 3_i32 + k");
+  expect_matches_tier0<Int32DefaultPolicy>("k * k * k * k");
+}
+
+TEST_F(X86CompilerTest, UsesEveryColumnRegister) {
+  // Nine columns: four caller-saved and five callee-saved base registers
+  Float32Column d(fa), e(fb), f(fc), g(fa), p(fb), q(fc);
+  auto bind_all = [&](tiered_engine& engine) {
+    bind(engine);
+    engine.bind("d", d);
+    engine.bind("e", e);
+    engine.bind("f", f);
+    engine.bind("g", g);
+    engine.bind("p", p);
+    engine.bind("q", q);
+  };
+  const std::string expression = "a + b * c - d + e * f - g + p * q";
+  tiered_engine interpreted;
+  bind_all(interpreted);
+  const Float32Column expected =
+      interpreted.eval_as<Float32DefaultPolicy>(expression);
+
+  tiered_engine fused(std::make_unique<x86_kernel_compiler>(), eager());
+  bind_all(fused);
+  fused.eval_as<Float32DefaultPolicy>(expression);
+  fused.wait_for_promotions();
+  ASSERT_EQ(fused.tier(expression), 1);
+  const Float32Column actual = fused.eval_as<Float32DefaultPolicy>(expression);
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(std::bit_cast<std::uint32_t>(actual.data()[i]),
+              std::bit_cast<std::uint32_t>(expected.data()[i]))
+        << "row " << i;
+  }
+}
+
+TEST_F(X86CompilerTest, EvaluatesIntoAnInput) {
+  tiered_engine engine(std::make_unique<x86_kernel_compiler>(), eager());
+  bind(engine);
+  Float32Column dest;
+  engine.eval_into(dest, "b * 2_f32 + a");
+  engine.wait_for_promotions();
+  ASSERT_EQ(engine.tier("b * 2_f32 + a"), 1);
+
+  engine.eval_into(fb, "b * 2_f32 + a");
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(fb.data()[i], dest.data()[i]) << "row " << i;
+  }
+  EXPECT_FALSE(fb.present(3));
+  EXPECT_FALSE(fb.present(64));
+}
+
+TEST_F(X86CompilerTest, ReductionsMatchTier0) {
+  expect_reduction_matches_tier0<Int32DefaultPolicy>("sum(i)");
+  expect_reduction_matches_tier0<Int32DefaultPolicy>("max(i * j)");
+  expect_reduction_matches_tier0<Int32DefaultPolicy>("min(k - i)");
+  expect_reduction_matches_tier0<Float32DefaultPolicy>("sum(a * b + c)");
+  expect_reduction_matches_tier0<Float32DefaultPolicy>("min(a - c)");
+  expect_reduction_matches_tier0<Float32DefaultPolicy>("max(c * b)");
+}
+
+TEST_F(X86CompilerTest, FilteredReductionsMatchTier0) {
+  // Predicates of the value's type and of the other type, on columns absent
+  // in some rows and on columns only the predicate reads
+  expect_reduction_matches_tier0<Float32DefaultPolicy>(
+      "sum(a * b where k > 500_i32)");
+  expect_reduction_matches_tier0<Float32DefaultPolicy>(
+      "max(a where b * 2_f32 >= c + 20_f32)");
+  expect_reduction_matches_tier0<Float32DefaultPolicy>("min(b where a != c)");
+  expect_reduction_matches_tier0<Float32DefaultPolicy>("max(b where a < c)");
+  expect_reduction_matches_tier0<Int32DefaultPolicy>("sum(j where i < k)");
+  expect_reduction_matches_tier0<Int32DefaultPolicy>(
+      "min(i + k where c <= 0_f32)");
+  expect_reduction_matches_tier0<Int32DefaultPolicy>("max(k where j == 2_i32)");
+  // The int32 predicates AVX2 has no instruction for
+  expect_reduction_matches_tier0<Int32DefaultPolicy>("sum(k where j <= 1_i32)");
+  expect_reduction_matches_tier0<Int32DefaultPolicy>("max(i where j >= k)");
+  expect_reduction_matches_tier0<Int32DefaultPolicy>("sum(k where j != 0_i32)");
+  // No row selected: every lane keeps the identity
+  expect_reduction_matches_tier0<Int32DefaultPolicy>(
+      "sum(i where k > 5000_i32)");
+  expect_reduction_matches_tier0<Float32DefaultPolicy>(
+      "min(a where b < 0_f32)");
+}
+
+TEST_F(X86CompilerTest, CachedKernelsSurviveRestarts) {
+  const std::string directory = ::testing::TempDir() + "x86_kernel_cache";
+  std::filesystem::remove_all(directory);
+  const std::string expression = "a * b + c";
+  const std::string reduction = "sum(i * j where c > 0_f32)";
+  Float32Column expected;
+  std::int32_t expected_sum = 0;
+  {
+    tiered_engine interpreted;
+    bind(interpreted);
+    expected = interpreted.eval_as<Float32DefaultPolicy>(expression);
+    expected_sum = interpreted.reduce_as<Int32DefaultPolicy>(reduction);
+  }
+
+  {
+    tiered_engine engine(std::make_unique<x86_kernel_compiler>(directory),
+                         eager());
+    bind(engine);
+    EXPECT_EQ(engine.tier(expression), 0);
+    engine.eval_as<Float32DefaultPolicy>(expression);
+    engine.reduce_as<Int32DefaultPolicy>(reduction);
+    engine.wait_for_promotions();
+    ASSERT_EQ(engine.tier(expression), 1);
+    ASSERT_EQ(engine.tier(reduction), 1);
+  }
+  EXPECT_FALSE(std::filesystem::is_empty(directory));
+
+  // A fresh compiler, as after a restart: both shapes start in tier 1 even
+  // though they could never be promoted again
+  tiered_engine engine(std::make_unique<x86_kernel_compiler>(directory),
+                       tiering_thresholds{.min_executions = 1000});
+  bind(engine);
+  ASSERT_EQ(engine.tier(expression), 1);
+  ASSERT_EQ(engine.tier(reduction), 1);
+  const Float32Column actual = engine.eval_as<Float32DefaultPolicy>(expression);
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(std::bit_cast<std::uint32_t>(actual.data()[i]),
+              std::bit_cast<std::uint32_t>(expected.data()[i]))
+        << "row " << i;
+    ASSERT_EQ(actual.present(i), expected.present(i)) << "row " << i;
+  }
+  EXPECT_EQ(engine.reduce_as<Int32DefaultPolicy>(reduction), expected_sum);
+
+  // Without the directory nothing is loaded
+  tiered_engine cold(std::make_unique<x86_kernel_compiler>(), eager());
+  bind(cold);
+  EXPECT_EQ(cold.tier(expression), 0);
+  std::filesystem::remove_all(directory);
+}
+
+TEST_F(X86CompilerTest, UnsupportedShapesStayInTier0) {
+  column_vector<BF16DefaultPolicy> h(n, bf16::from_float_trunc(1.0f));
+  tiered_engine engine(std::make_unique<x86_kernel_compiler>(), eager());
+  bind(engine);
+  engine.bind("h", h);
+
+  // BF16, and more columns than there are registers for them
+  engine.eval_as<BF16DefaultPolicy>("h + h");
+  engine.bind("d", fa);
+  engine.bind("e", fb);
+  engine.bind("f", fc);
+  engine.bind("g", fa);
+  engine.bind("p", fb);
+  engine.bind("q", fc);
+  engine.bind("r", fa);
+  const std::string columns = "a + b + c + d + e + f + g + p + q + r";
+  Float32Column result = engine.eval_as<Float32DefaultPolicy>(columns);
+  engine.wait_for_promotions();
+
+  EXPECT_EQ(engine.tier("h + h"), 0);
+  EXPECT_EQ(engine.tier(columns), 0);
+  EXPECT_FLOAT_EQ(engine.eval_as<Float32DefaultPolicy>(columns).data()[10],
+                  result.data()[10]);
+}
+
+} // namespace
+} // namespace franklin::expression
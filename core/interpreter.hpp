@@ -11,6 +11,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 
 namespace franklin {
 
@@ -22,8 +23,11 @@ struct ErasedColumn {
 
   ErasedColumn() : packed_ptr_and_policy(0) {}
 
-  // Pack pointer and policy into a single uintptr_t
+  // Pack pointer and policy into a single uintptr_t. Decimal64 columns are
+  // not accepted: their policy id leaves out the scale, so get_as() could not
+  // tell a column at scale 2 from one at scale 4.
   template <concepts::ColumnPolicy Policy>
+    requires(!concepts::DecimalColumnPolicy<Policy>)
   explicit ErasedColumn(column_vector<Policy>* ptr) {
     static_assert(sizeof(void*) == 8, "Only 64-bit pointers supported");
     std::uintptr_t ptr_val = std::bit_cast<std::uintptr_t>(ptr);
@@ -77,9 +81,24 @@ private:
     Token next();
   };
 
+  // A variable, or two variables joined by an operator (op is empty for a
+  // lone variable)
+  struct ParsedExpression {
+    ErasedColumn lhs;
+    std::string op;
+    ErasedColumn rhs;
+  };
+
+  ParsedExpression parse(Tokenizer& tokenizer) const;
+
   // Parse expression - returns type-erased column
   ErasedColumn parse_expression(Tokenizer& tokenizer);
 
+  // eval_into() once the destination's type is known
+  template <concepts::ColumnPolicy Policy>
+  static void eval_into_typed(column_vector<Policy>& dest,
+                              const ParsedExpression& parsed);
+
   // Type-erased arithmetic operations
   static ErasedColumn add(const ErasedColumn& a, const ErasedColumn& b);
   static ErasedColumn subtract(const ErasedColumn& a, const ErasedColumn& b);
@@ -101,8 +120,10 @@ public:
   // Delete a type-erased column
   static void delete_erased_column(ErasedColumn erased);
 
-  // Register a column vector with a name (template takes ownership)
+  // Register a column vector with a name (template takes ownership). Not
+  // for Decimal64 columns, which ErasedColumn cannot hold.
   template <concepts::ColumnPolicy Policy>
+    requires(!concepts::DecimalColumnPolicy<Policy>)
   void register_column(const std::string& name, column_vector<Policy>&& col) {
     // Check if name exists and delete old column
     auto it = columns_.find(name);
@@ -118,6 +139,19 @@ public:
   // Evaluate an expression - returns ErasedColumn that caller must delete
   ErasedColumn eval(const std::string& expression);
 
+  // Evaluate an expression into `dest`, whose buffer is reused whenever its
+  // capacity allows (see franklin::eval_into), so a query evaluated every
+  // step allocates nothing after the first. dest must have the expression's
+  // type and may be one of its operands. Int32, Float32 and BF16 columns
+  // with +, - and *.
+  void eval_into(ErasedColumn dest, const std::string& expression);
+
+  template <concepts::ColumnPolicy Policy>
+    requires(!concepts::DecimalColumnPolicy<Policy>)
+  void eval_into(column_vector<Policy>& dest, const std::string& expression) {
+    eval_into(ErasedColumn(&dest), expression);
+  }
+
   // Get a type-erased column by name
   ErasedColumn get_column(const std::string& name) const;
 
@@ -188,7 +222,8 @@ inline interpreter::Token interpreter::Tokenizer::next() {
 }
 
 // Parser implementation
-inline ErasedColumn interpreter::parse_expression(Tokenizer& tokenizer) {
+inline interpreter::ParsedExpression
+interpreter::parse(Tokenizer& tokenizer) const {
   Token first_token = tokenizer.next();
 
   if (first_token.type != Token::Type::Variable) {
@@ -200,12 +235,12 @@ inline ErasedColumn interpreter::parse_expression(Tokenizer& tokenizer) {
     throw std::runtime_error("Unknown variable: " + first_token.value);
   }
 
-  ErasedColumn result = it->second;
+  ParsedExpression parsed{it->second, "", ErasedColumn()};
 
   // Check for binary operator
   Token op_token = tokenizer.next();
   if (op_token.type == Token::Type::EndOfInput) {
-    return result;
+    return parsed;
   }
 
   if (op_token.type != Token::Type::Operator) {
@@ -222,23 +257,36 @@ inline ErasedColumn interpreter::parse_expression(Tokenizer& tokenizer) {
     throw std::runtime_error("Unknown variable: " + second_token.value);
   }
 
-  const ErasedColumn& operand2 = it2->second;
+  parsed.op = std::move(op_token.value);
+  parsed.rhs = it2->second;
+  return parsed;
+}
+
+inline ErasedColumn interpreter::parse_expression(Tokenizer& tokenizer) {
+  const ParsedExpression parsed = parse(tokenizer);
+  if (parsed.op.empty()) {
+    return parsed.lhs;
+  }
+
+  const ErasedColumn& result = parsed.lhs;
+  const ErasedColumn& operand2 = parsed.rhs;
+  const std::string& op = parsed.op;
 
   // Perform operation
-  if (op_token.value == "+") {
+  if (op == "+") {
     return add(result, operand2);
-  } else if (op_token.value == "-") {
+  } else if (op == "-") {
     return subtract(result, operand2);
-  } else if (op_token.value == "*") {
+  } else if (op == "*") {
     return multiply(result, operand2);
-  } else if (op_token.value == "&") {
+  } else if (op == "&") {
     return bitwise_and(result, operand2);
-  } else if (op_token.value == "|") {
+  } else if (op == "|") {
     return bitwise_or(result, operand2);
-  } else if (op_token.value == "^") {
+  } else if (op == "^") {
     return bitwise_xor(result, operand2);
   } else {
-    throw std::runtime_error("Unsupported operator: " + op_token.value);
+    throw std::runtime_error("Unsupported operator: " + op);
   }
 }
 
@@ -257,6 +305,12 @@ inline void interpreter::delete_erased_column(ErasedColumn erased) {
   case DataTypeEnum::BF16Default:
     delete std::bit_cast<column_vector<BF16DefaultPolicy>*>(ptr);
     break;
+  case DataTypeEnum::Date32:
+    delete std::bit_cast<column_vector<Date32Policy>*>(ptr);
+    break;
+  case DataTypeEnum::TimestampMicros:
+    delete std::bit_cast<column_vector<TimestampMicrosPolicy>*>(ptr);
+    break;
   default:
     throw std::runtime_error("Unknown policy type in delete_erased_column");
   }
@@ -331,6 +385,52 @@ inline ErasedColumn interpreter::eval(const std::string& expression) {
   return parse_expression(tokenizer);
 }
 
+inline void interpreter::eval_into(ErasedColumn dest,
+                                   const std::string& expression) {
+  Tokenizer tokenizer(expression);
+  const ParsedExpression parsed = parse(tokenizer);
+  if (parsed.lhs.get_policy() != dest.get_policy() ||
+      (!parsed.op.empty() && parsed.rhs.get_policy() != dest.get_policy())) {
+    throw std::runtime_error("Type mismatch in eval_into");
+  }
+
+  switch (dest.get_policy()) {
+  case DataTypeEnum::Int32Default:
+    eval_into_typed(*dest.get_as<Int32DefaultPolicy>(), parsed);
+    break;
+  case DataTypeEnum::Float32Default:
+    eval_into_typed(*dest.get_as<Float32DefaultPolicy>(), parsed);
+    break;
+  case DataTypeEnum::BF16Default:
+    eval_into_typed(*dest.get_as<BF16DefaultPolicy>(), parsed);
+    break;
+  default:
+    throw std::runtime_error("Unsupported policy type in eval_into");
+  }
+}
+
+template <concepts::ColumnPolicy Policy>
+void interpreter::eval_into_typed(column_vector<Policy>& dest,
+                                  const ParsedExpression& parsed) {
+  const column_vector<Policy>& lhs = *parsed.lhs.get_as<Policy>();
+  if (parsed.op.empty()) {
+    dest = lhs; // self-assignment is a no-op
+    return;
+  }
+
+  const column_vector<Policy>& rhs = *parsed.rhs.get_as<Policy>();
+  if (parsed.op == "+") {
+    franklin::eval_into<OpType::Add>(dest, lhs, rhs);
+  } else if (parsed.op == "-") {
+    franklin::eval_into<OpType::Sub>(dest, lhs, rhs);
+  } else if (parsed.op == "*") {
+    franklin::eval_into<OpType::Mul>(dest, lhs, rhs);
+  } else {
+    throw std::runtime_error("Unsupported operator in eval_into: " +
+                             parsed.op);
+  }
+}
+
 inline ErasedColumn interpreter::get_column(const std::string& name) const {
   auto it = columns_.find(name);
   if (it == columns_.end()) {
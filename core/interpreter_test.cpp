@@ -0,0 +1,70 @@
+#include "core/interpreter.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+
+namespace franklin {
+namespace {
+
+template <typename Policy>
+constexpr bool can_register = requires(interpreter& interp,
+                                       column_vector<Policy>&& column) {
+  interp.register_column("x", std::move(column));
+};
+
+// ErasedColumn keeps the policy id, which has no room for a decimal scale
+static_assert(can_register<Int32DefaultPolicy>);
+static_assert(can_register<Date32Policy>);
+static_assert(!can_register<Decimal64Policy<2>>);
+static_assert(
+    !std::is_constructible_v<ErasedColumn, column_vector<Decimal64Policy<2>>*>);
+
+TEST(InterpreterTest, OwnsRegisteredColumns) {
+  interpreter interp;
+  interp.register_column("a", column_vector<Int32DefaultPolicy>(5, 10));
+  interp.register_column("d", column_vector<Date32Policy>(3));
+  interp.register_column("a", column_vector<Int32DefaultPolicy>(5, 20));
+  EXPECT_EQ(interp.size(), 2u);
+  EXPECT_EQ(interp.get_column_typed<Int32DefaultPolicy>("a").data()[0], 20);
+  EXPECT_EQ(interp.get_column("d").get_policy(), DataTypeEnum::Date32);
+  interp.unregister_column("d");
+  EXPECT_FALSE(interp.has_column("d"));
+}
+
+TEST(InterpreterTest, EvaluatesIntoADestination) {
+  interpreter interp;
+  column_vector<Float32DefaultPolicy> a(100, 1.5f);
+  a.present_mask().set(7, false);
+  interp.register_column("a", std::move(a));
+  interp.register_column("b", column_vector<Float32DefaultPolicy>(100, 2.0f));
+  interp.register_column("i", column_vector<Int32DefaultPolicy>(100, 3));
+
+  column_vector<Float32DefaultPolicy> dest;
+  interp.eval_into(dest, "a * b");
+  ASSERT_GE(dest.data().size(), 100u);
+  EXPECT_EQ(dest.data()[0], 3.0f);
+  EXPECT_FALSE(dest.present(7));
+  EXPECT_TRUE(dest.present(8));
+
+  // Later evaluations reuse the buffer
+  const float* buffer = dest.data().data();
+  interp.eval_into(dest, "a - b");
+  EXPECT_EQ(dest.data()[0], -0.5f);
+  interp.eval_into(ErasedColumn(&dest), "b + a");
+  EXPECT_EQ(dest.data()[99], 3.5f);
+  interp.eval_into(dest, "b");
+  EXPECT_EQ(dest.data()[0], 2.0f);
+  EXPECT_TRUE(dest.present(7));
+  EXPECT_EQ(dest.data().data(), buffer);
+
+  // Into one of the operands
+  interp.eval_into(interp.get_column("i"), "i * i");
+  EXPECT_EQ(interp.get_column_typed<Int32DefaultPolicy>("i").data()[5], 9);
+
+  EXPECT_THROW(interp.eval_into(dest, "i + i"), std::runtime_error);
+  EXPECT_THROW(interp.eval_into(dest, "a + i"), std::runtime_error);
+  EXPECT_THROW(interp.eval_into(dest, "a & b"), std::runtime_error);
+}
+
+} // namespace
+} // namespace franklin
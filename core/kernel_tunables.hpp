@@ -0,0 +1,212 @@
+#ifndef FRANKLIN_CORE_KERNEL_TUNABLES_HPP
+#define FRANKLIN_CORE_KERNEL_TUNABLES_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+namespace franklin {
+
+// Runtime knobs for the column kernels in container/column.hpp.
+// Adjust them at startup, before any kernel runs: they are read without
+// synchronization on the hot path.
+//
+// The optima differ between CPU generations, so the defaults below are only a
+// starting point. benchmarks/autotune measures the candidates on the host and
+// writes the winners to a tunables file, which tunables() loads on first use
+// (see default_tunables_path()).
+struct kernel_tunables {
+  // Outputs larger than this fraction of the last-level cache are written with
+  // non-temporal (streaming) stores. Such outputs are evicted before they can
+  // be reused, so bypassing the cache saves the read-for-ownership traffic and
+  // keeps the inputs resident. Set to 0 to always stream, or to a large value
+  // to never stream.
+  double streaming_store_llc_fraction = 0.5;
+
+  // Software prefetch distance for the input streams of the element-wise
+  // kernels, in bytes ahead of the current position. 0 leaves everything to
+  // the hardware prefetcher. Column policies may override it with a
+  // `prefetch_distance` member. Pick the value for a host with the
+  // Cache_Prefetch_Distance_DRAM sweep in benchmarks/cache_throughput_benchmark
+  // (--benchmark_filter=Prefetch_Distance), which prints the recommended
+  // setting.
+  std::size_t prefetch_distance_bytes = 512;
+
+  // Independent vectors processed per iteration of the element-wise loops.
+  // One of 1, 2, 4 or 8; anything else runs the 4x loop.
+  std::size_t unroll_factor = 4;
+};
+
+// Identifier of the host CPU model, recorded in tunables files so that a file
+// tuned on one CPU generation is not applied on another (e.g. through a
+// shared home directory).
+inline std::string host_cpu_id() {
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    if (line.rfind("model name", 0) == 0) {
+      auto colon = line.find(':');
+      if (colon != std::string::npos) {
+        auto begin = line.find_first_not_of(" \t", colon + 1);
+        return begin == std::string::npos ? "" : line.substr(begin);
+      }
+    }
+  }
+  return "unknown";
+}
+
+// Location of the tunables file: $FRANKLIN_TUNABLES_FILE if set, otherwise
+// $XDG_CONFIG_HOME/franklin/tunables.conf, otherwise
+// $HOME/.config/franklin/tunables.conf. Empty when none can be determined.
+inline std::string default_tunables_path() {
+  if (const char* path = std::getenv("FRANKLIN_TUNABLES_FILE")) {
+    return path;
+  }
+  if (const char* xdg = std::getenv("XDG_CONFIG_HOME"); xdg && *xdg) {
+    return std::string(xdg) + "/franklin/tunables.conf";
+  }
+  if (const char* home = std::getenv("HOME"); home && *home) {
+    return std::string(home) + "/.config/franklin/tunables.conf";
+  }
+  return {};
+}
+
+// Tunables file format: one `key = value` per line, `#` starts a comment.
+// Unknown keys and malformed values are skipped so that files written by
+// newer versions still load.
+//
+// Returns false, leaving `out` untouched, if the file cannot be read or was
+// tuned on a different CPU model.
+inline bool load_tunables(const std::string& path, kernel_tunables& out) {
+  std::ifstream in(path);
+  if (!in) {
+    return false;
+  }
+
+  auto trim = [](const std::string& str) {
+    auto begin = str.find_first_not_of(" \t");
+    auto end = str.find_last_not_of(" \t\r");
+    return begin == std::string::npos ? std::string()
+                                      : str.substr(begin, end - begin + 1);
+  };
+
+  kernel_tunables loaded = out;
+  std::string line;
+  while (std::getline(in, line)) {
+    line = line.substr(0, line.find('#'));
+    auto eq = line.find('=');
+    if (eq == std::string::npos) {
+      continue;
+    }
+    const std::string key = trim(line.substr(0, eq));
+    const std::string value = trim(line.substr(eq + 1));
+    char* end = nullptr;
+
+    if (key == "cpu") {
+      if (value != host_cpu_id()) {
+        return false;
+      }
+    } else if (key == "streaming_store_llc_fraction") {
+      double parsed = std::strtod(value.c_str(), &end);
+      if (end != value.c_str() && parsed >= 0.0) {
+        loaded.streaming_store_llc_fraction = parsed;
+      }
+    } else if (key == "prefetch_distance_bytes") {
+      auto parsed = std::strtoull(value.c_str(), &end, 10);
+      if (end != value.c_str()) {
+        loaded.prefetch_distance_bytes = parsed;
+      }
+    } else if (key == "unroll_factor") {
+      auto parsed = std::strtoull(value.c_str(), &end, 10);
+      if (end != value.c_str()) {
+        loaded.unroll_factor = parsed;
+      }
+    }
+  }
+
+  out = loaded;
+  return true;
+}
+
+// Write `t` to `path` in the format read by load_tunables(), stamped with
+// host_cpu_id(). The parent directory must exist.
+inline bool save_tunables(const std::string& path, const kernel_tunables& t) {
+  std::ofstream file(path, std::ios::trunc);
+  if (!file) {
+    return false;
+  }
+  file << "# franklin kernel tunables, generated by benchmarks/autotune\n"
+       << "cpu = " << host_cpu_id() << "\n"
+       << "streaming_store_llc_fraction = " << t.streaming_store_llc_fraction
+       << "\n"
+       << "prefetch_distance_bytes = " << t.prefetch_distance_bytes << "\n"
+       << "unroll_factor = " << t.unroll_factor << "\n";
+  return static_cast<bool>(file);
+}
+
+// The defaults, overridden by the tunables file at `path` (if not empty),
+// overridden in turn by FRANKLIN_PREFETCH_DISTANCE. Tunables only affect
+// speed, so any failure to read them yields the defaults rather than an
+// error.
+inline kernel_tunables load_process_tunables(const std::string& path) noexcept {
+  try {
+    kernel_tunables t;
+    if (!path.empty()) {
+      load_tunables(path, t);
+    }
+    if (const char* env = std::getenv("FRANKLIN_PREFETCH_DISTANCE")) {
+      t.prefetch_distance_bytes = std::strtoull(env, nullptr, 10);
+    }
+    return t;
+  } catch (...) {
+    return kernel_tunables{};
+  }
+}
+
+// Process-wide tunables: load_process_tunables() of default_tunables_path(),
+// on first use. Tests can point FRANKLIN_TUNABLES_FILE elsewhere (e.g. at
+// /dev/null) before that to run independently of the user's file.
+inline kernel_tunables& tunables() noexcept {
+  static kernel_tunables instance = [] {
+    std::string path;
+    try {
+      path = default_tunables_path();
+    } catch (...) {
+    }
+    return load_process_tunables(path);
+  }();
+  return instance;
+}
+
+// Size of the last-level cache in bytes, queried from the OS once.
+// Falls back to 32 MB when the OS does not report cache geometry.
+inline std::size_t llc_size_bytes() noexcept {
+  static const std::size_t size = [] {
+    constexpr std::size_t fallback = 32UL * 1024 * 1024;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+    long const l3 = ::sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (l3 > 0) {
+      return static_cast<std::size_t>(l3);
+    }
+    long const l2 = ::sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (l2 > 0) {
+      return static_cast<std::size_t>(l2);
+    }
+#endif
+    return fallback;
+  }();
+  return size;
+}
+
+// Whether a kernel writing output_bytes should use streaming stores.
+inline bool use_streaming_stores(std::size_t output_bytes) noexcept {
+  return static_cast<double>(output_bytes) >
+         tunables().streaming_store_llc_fraction *
+             static_cast<double>(llc_size_bytes());
+}
+
+} // namespace franklin
+
+#endif // FRANKLIN_CORE_KERNEL_TUNABLES_HPP
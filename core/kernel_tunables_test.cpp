@@ -0,0 +1,139 @@
+#include "core/kernel_tunables.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+
+namespace franklin {
+namespace {
+
+// Scratch file in the test's temporary directory, removed on destruction
+class TempFile {
+public:
+  explicit TempFile(const std::string& name)
+      : path_(::testing::TempDir() + name) {}
+  ~TempFile() { std::remove(path_.c_str()); }
+
+  const std::string& path() const { return path_; }
+
+  void write(const std::string& contents) const {
+    std::ofstream(path_, std::ios::trunc) << contents;
+  }
+
+private:
+  std::string path_;
+};
+
+// Sets (or with nullopt, unsets) an environment variable for the scope of a
+// test and restores the previous value afterwards
+class ScopedEnv {
+public:
+  ScopedEnv(const char* name, std::optional<std::string> value) : name_(name) {
+    if (const char* old = std::getenv(name)) {
+      saved_ = old;
+    }
+    set(value);
+  }
+  ~ScopedEnv() { set(saved_); }
+
+private:
+  void set(const std::optional<std::string>& value) {
+    if (value) {
+      ::setenv(name_, value->c_str(), 1);
+    } else {
+      ::unsetenv(name_);
+    }
+  }
+
+  const char* name_;
+  std::optional<std::string> saved_;
+};
+
+TEST(KernelTunablesTest, SaveLoadRoundTrip) {
+  TempFile file("tunables_roundtrip.conf");
+  kernel_tunables saved;
+  saved.streaming_store_llc_fraction = 0.75;
+  saved.prefetch_distance_bytes = 1024;
+  saved.unroll_factor = 8;
+  ASSERT_TRUE(save_tunables(file.path(), saved));
+
+  kernel_tunables loaded;
+  ASSERT_TRUE(load_tunables(file.path(), loaded));
+  EXPECT_DOUBLE_EQ(loaded.streaming_store_llc_fraction, 0.75);
+  EXPECT_EQ(loaded.prefetch_distance_bytes, 1024u);
+  EXPECT_EQ(loaded.unroll_factor, 8u);
+}
+
+TEST(KernelTunablesTest, MissingFileLeavesDefaults) {
+  kernel_tunables t;
+  EXPECT_FALSE(load_tunables(::testing::TempDir() + "does_not_exist", t));
+  EXPECT_EQ(t.unroll_factor, kernel_tunables{}.unroll_factor);
+}
+
+TEST(KernelTunablesTest, RejectsFileFromDifferentCpu) {
+  TempFile file("tunables_other_cpu.conf");
+  file.write("cpu = Some Other CPU @ 1.00GHz\nunroll_factor = 2\n");
+
+  kernel_tunables t;
+  EXPECT_FALSE(load_tunables(file.path(), t));
+  EXPECT_EQ(t.unroll_factor, kernel_tunables{}.unroll_factor);
+}
+
+TEST(KernelTunablesTest, SkipsCommentsUnknownKeysAndBadValues) {
+  TempFile file("tunables_lenient.conf");
+  file.write("# comment\n"
+             "future_knob = 17\n"
+             "prefetch_distance_bytes = lots\n"
+             "  unroll_factor=2   # trailing comment\n"
+             "not a key value line\n");
+
+  kernel_tunables t;
+  ASSERT_TRUE(load_tunables(file.path(), t));
+  EXPECT_EQ(t.unroll_factor, 2u);
+  EXPECT_EQ(t.prefetch_distance_bytes,
+            kernel_tunables{}.prefetch_distance_bytes);
+}
+
+TEST(KernelTunablesTest, DefaultPathFollowsTheEnvironment) {
+  ScopedEnv file("FRANKLIN_TUNABLES_FILE", std::nullopt);
+  ScopedEnv xdg("XDG_CONFIG_HOME", std::nullopt);
+  ScopedEnv home("HOME", "/home/tester");
+  EXPECT_EQ(default_tunables_path(),
+            "/home/tester/.config/franklin/tunables.conf");
+  {
+    ScopedEnv config("XDG_CONFIG_HOME", "/xdg");
+    EXPECT_EQ(default_tunables_path(), "/xdg/franklin/tunables.conf");
+    ScopedEnv explicit_file("FRANKLIN_TUNABLES_FILE", "/etc/tunables.conf");
+    EXPECT_EQ(default_tunables_path(), "/etc/tunables.conf");
+  }
+  ScopedEnv no_home("HOME", std::nullopt);
+  EXPECT_EQ(default_tunables_path(), "");
+}
+
+TEST(KernelTunablesTest, ProcessTunablesFallBackToDefaults) {
+  ScopedEnv prefetch("FRANKLIN_PREFETCH_DISTANCE", std::nullopt);
+  TempFile file("tunables_process.conf");
+  kernel_tunables tuned;
+  tuned.unroll_factor = 2;
+  ASSERT_TRUE(save_tunables(file.path(), tuned));
+  EXPECT_EQ(load_process_tunables(file.path()).unroll_factor, 2u);
+
+  // No file, a missing file and a directory all give the defaults
+  for (const std::string& path :
+       {std::string(), ::testing::TempDir() + "does_not_exist",
+        ::testing::TempDir()}) {
+    const kernel_tunables t = load_process_tunables(path);
+    EXPECT_EQ(t.unroll_factor, kernel_tunables{}.unroll_factor) << path;
+    EXPECT_EQ(t.prefetch_distance_bytes,
+              kernel_tunables{}.prefetch_distance_bytes)
+        << path;
+  }
+
+  ScopedEnv distance("FRANKLIN_PREFETCH_DISTANCE", "256");
+  EXPECT_EQ(load_process_tunables("").prefetch_distance_bytes, 256u);
+}
+
+} // namespace
+} // namespace franklin
@@ -0,0 +1,36 @@
+#ifndef FRANKLIN_IO_BLOCK_CODEC_HPP
+#define FRANKLIN_IO_BLOCK_CODEC_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace franklin::io {
+
+// Codec interface shared by compressed frames (see compression.hpp) and
+// spilled blocks (see spill_file.hpp)
+
+enum class codec_id : std::uint8_t { none = 0, lz = 1, user_first = 128 };
+
+class block_codec {
+public:
+  virtual ~block_codec() = default;
+
+  virtual codec_id id() const noexcept = 0;
+
+  // Upper bound on the compressed size of `size` bytes
+  virtual std::size_t max_compressed_size(std::size_t size) const noexcept = 0;
+
+  // Compress `size` bytes from `src` into `dst`, which has room for
+  // max_compressed_size(size) bytes; returns the compressed size
+  virtual std::size_t compress(const std::byte* src, std::size_t size,
+                               std::byte* dst) const = 0;
+
+  // Decompress `compressed` bytes from `src` into exactly `size` bytes at
+  // `dst`; throws on corrupt input instead of reading or writing out of bounds
+  virtual void decompress(const std::byte* src, std::size_t compressed,
+                          std::byte* dst, std::size_t size) const = 0;
+};
+
+} // namespace franklin::io
+
+#endif // FRANKLIN_IO_BLOCK_CODEC_HPP
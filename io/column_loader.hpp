@@ -0,0 +1,358 @@
+#ifndef FRANKLIN_IO_COLUMN_LOADER_HPP
+#define FRANKLIN_IO_COLUMN_LOADER_HPP
+
+#include "io/io_uring.hpp"
+#include "io/spill_file.hpp"
+#include "memory/memory_budget.hpp"
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
+#include <future>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace franklin::io {
+
+// Byte range of one row group in a column file
+struct extent {
+  std::uint64_t offset;
+  std::size_t length;
+};
+
+// Extents of a file holding `rows` fixed-width values from `offset` on,
+// split into row groups of `rows_per_group` rows
+inline std::vector<extent> row_group_extents(std::uint64_t offset,
+                                             std::size_t rows,
+                                             std::size_t rows_per_group,
+                                             std::size_t value_size) {
+  std::vector<extent> extents;
+  for (std::size_t row = 0; row < rows; row += rows_per_group) {
+    const std::size_t count = std::min(rows_per_group, rows - row);
+    extents.push_back({offset + row * value_size, count * value_size});
+  }
+  return extents;
+}
+
+struct loader_options {
+  // Row groups in flight: 2 for double buffering, 3 for triple, ...
+  std::size_t depth = 3;
+  // Bypass the page cache with O_DIRECT when the filesystem supports it
+  bool direct_io = true;
+  // Use io_uring when the kernel provides it (else a pread thread pool)
+  bool use_io_uring = true;
+};
+
+struct loader_stats {
+  std::uint64_t bytes_read = 0; // including alignment padding
+  std::size_t row_groups = 0;
+  // Row groups whose data was not ready when the stage asked for it
+  std::size_t stalls = 0;
+  std::chrono::nanoseconds wait_time{0};
+};
+
+// Streams row groups of a column file into a pipeline stage, reading ahead.
+//
+// scan() keeps `depth` row groups in flight: while the stage processes row
+// group i, the reads of groups i+1 .. i+depth-1 are queued with the kernel,
+// and the buffer of group i is reused for group i+depth as soon as the stage
+// returns. With O_DIRECT, reads are widened to the device's logical block
+// size, so any extent can be requested; the stage sees exactly its bytes.
+//
+// Read buffers are allocated from the memory budget (buddy blocks, page
+// aligned at page size and up), and the stage's span is only valid during the
+// call. Each read is a single large request, so row groups of a few MiB keep
+// an NVMe queue busy with few system calls.
+class column_loader {
+public:
+  using stage_type =
+      std::function<void(std::size_t row_group, std::span<const std::byte>)>;
+
+  column_loader(const std::string& path, memory_budget& budget,
+                loader_options options = {});
+  ~column_loader();
+
+  column_loader(const column_loader&) = delete;
+  column_loader& operator=(const column_loader&) = delete;
+
+  // Pass every extent, in order, to `stage`
+  void scan(const std::vector<extent>& extents, const stage_type& stage);
+
+  bool uses_io_uring() const noexcept { return ring_ != nullptr; }
+  bool uses_direct_io() const noexcept { return direct_; }
+  std::uint64_t file_size() const noexcept { return file_size_; }
+  const loader_stats& stats() const noexcept { return stats_; }
+
+private:
+  // Read issued for one row group
+  struct slot {
+    budget_buffer<std::byte> buffer;
+    std::uint64_t aligned_offset = 0; // where the read starts
+    std::size_t skip = 0;             // bytes before the extent
+    std::size_t needed = 0;           // bytes through the end of the extent
+    std::size_t done = 0;             // bytes read so far
+    std::size_t length = 0;           // of the widened read
+    std::future<void> pending;        // thread-pool fallback only
+  };
+
+  void prepare(slot& s, const extent& e);
+  void issue(slot& s, std::size_t index);
+  void await(slot& s, std::size_t index, std::vector<slot>& slots);
+
+  // Where a read that started at slot byte `begin` and ended short at `end`
+  // continues. O_DIRECT reads must start on a block boundary, so the tail
+  // of a partial block is read again; `begin` means no progress is possible.
+  std::size_t resume_offset(std::size_t begin, std::size_t end) const noexcept;
+
+  int fd_ = -1;
+  bool direct_ = false;
+  std::size_t alignment_ = 1;
+  std::uint64_t file_size_ = 0;
+  memory_budget& budget_;
+  loader_options options_;
+  std::unique_ptr<io_uring_queue> ring_;
+  std::unique_ptr<io_thread_pool> pool_;
+  // Completions reaped while waiting for another slot
+  std::vector<std::int64_t> completed_;
+  std::size_t ring_in_flight_ = 0; // submitted, completion not yet reaped
+  loader_stats stats_;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+inline column_loader::column_loader(const std::string& path,
+                                    memory_budget& budget,
+                                    loader_options options)
+    : budget_(budget), options_(options) {
+  options_.depth = std::max<std::size_t>(options_.depth, 1);
+  if (options_.direct_io) {
+    // Not every filesystem supports O_DIRECT (tmpfs does not)
+    fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+    direct_ = fd_ >= 0;
+  }
+  if (fd_ < 0) {
+    fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  }
+  if (fd_ < 0) {
+    throw std::runtime_error("Cannot open " + path + ": " +
+                             std::strerror(errno));
+  }
+  struct stat st {};
+  if (::fstat(fd_, &st) != 0) {
+    ::close(fd_);
+    throw std::runtime_error("Cannot stat " + path);
+  }
+  file_size_ = static_cast<std::uint64_t>(st.st_size);
+  if (direct_) {
+    // st_blksize is the preferred I/O size, a multiple of the logical block
+    // size; 4096 is safe for every current device
+    alignment_ = 4096;
+  } else {
+    ::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+  }
+
+  if (options_.use_io_uring) {
+    ring_ = io_uring_queue::try_create(
+        static_cast<unsigned>(std::bit_ceil(options_.depth)));
+  }
+  if (!ring_) {
+    pool_ = std::make_unique<io_thread_pool>(options_.depth);
+  }
+}
+
+inline column_loader::~column_loader() {
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+}
+
+inline void column_loader::prepare(slot& s, const extent& e) {
+  if (e.offset + e.length > file_size_) {
+    throw std::runtime_error("Row group extends past the end of the file");
+  }
+  const std::uint64_t mask = alignment_ - 1;
+  s.aligned_offset = e.offset & ~mask;
+  s.skip = static_cast<std::size_t>(e.offset - s.aligned_offset);
+  s.needed = s.skip + e.length;
+  s.length = (s.needed + mask) & ~mask;
+  s.done = 0;
+  if (s.buffer.capacity() < s.length) {
+    s.buffer.reset();
+    s.buffer = budget_buffer<std::byte>::try_allocate(budget_, s.length);
+    if (!s.buffer) {
+      throw std::runtime_error("Memory budget too small for column loader");
+    }
+  }
+}
+
+inline void column_loader::issue(slot& s, std::size_t index) {
+  std::byte* dst = s.buffer.data() + s.done;
+  const std::size_t size = s.length - s.done;
+  const std::uint64_t offset = s.aligned_offset + s.done;
+  if (ring_) {
+    // Longer reads complete short and are continued by await()
+    const auto length = static_cast<std::uint32_t>(
+        std::min<std::size_t>(size, std::size_t{1} << 30));
+    if (!ring_->prepare_read(fd_, dst, length, offset, index)) {
+      throw std::runtime_error("io_uring submission queue full");
+    }
+    ring_->submit();
+    ++ring_in_flight_;
+  } else {
+    const int fd = fd_;
+    std::size_t* done = &s.done;
+    const std::size_t wanted = s.needed - s.done;
+    s.pending = pool_->submit([this, fd, dst, size, offset, done, wanted] {
+      std::size_t got = 0;
+      while (got < wanted) {
+        const ssize_t n = ::pread(fd, dst + got, size - got,
+                                  static_cast<off_t>(offset + got));
+        if (n < 0 && errno == EINTR) {
+          continue;
+        }
+        if (n < 0) {
+          throw std::runtime_error(std::string("Column read failed: ") +
+                                   std::strerror(errno));
+        }
+        const std::size_t end = got + static_cast<std::size_t>(n);
+        if (end >= wanted) {
+          got = end;
+          break;
+        }
+        const std::size_t next = resume_offset(got, end);
+        if (next == got) {
+          break; // end of file
+        }
+        got = next;
+      }
+      *done += got;
+      if (got < wanted) {
+        throw std::runtime_error("Column file truncated");
+      }
+    });
+  }
+}
+
+inline std::size_t
+column_loader::resume_offset(std::size_t begin,
+                             std::size_t end) const noexcept {
+  const std::size_t aligned = end & ~(alignment_ - 1);
+  return aligned > begin ? aligned : begin;
+}
+
+inline void column_loader::await(slot& s, std::size_t index,
+                                 std::vector<slot>& slots) {
+  const auto start = std::chrono::steady_clock::now();
+  bool stalled = false;
+
+  if (!ring_) {
+    if (s.pending.wait_for(std::chrono::seconds(0)) !=
+        std::future_status::ready) {
+      stalled = true;
+    }
+    s.pending.get(); // the worker reads the whole slot
+    stats_.bytes_read += s.done;
+  } else {
+    const std::size_t depth = slots.size();
+    while (true) {
+      // A completion for this slot may have been reaped already
+      std::int64_t& result = completed_[index % depth];
+      if (result == -1) {
+        io_uring_queue::completion c;
+        if (!ring_->pop(c)) {
+          stalled = true;
+          c = ring_->wait();
+        }
+        --ring_in_flight_;
+        completed_[c.user_data % depth] = c.result;
+        continue;
+      }
+      const std::int64_t got = result;
+      result = -1;
+      if (got < 0) {
+        throw std::runtime_error(std::string("Column read failed: ") +
+                                 std::strerror(static_cast<int>(-got)));
+      }
+      const std::size_t begin = s.done;
+      s.done += static_cast<std::size_t>(got);
+      stats_.bytes_read += static_cast<std::uint64_t>(got);
+      if (s.done >= s.needed) {
+        break;
+      }
+      s.done = resume_offset(begin, s.done);
+      if (s.done == begin) {
+        throw std::runtime_error("Column file truncated");
+      }
+      // Short read: ask for the rest
+      issue(s, index);
+    }
+  }
+
+  if (stalled) {
+    ++stats_.stalls;
+    stats_.wait_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+  }
+}
+
+inline void column_loader::scan(const std::vector<extent>& extents,
+                                const stage_type& stage) {
+  const std::size_t depth = std::min(options_.depth, extents.size());
+  if (depth == 0) {
+    return;
+  }
+  std::vector<slot> slots(depth);
+  completed_.assign(depth, -1);
+
+  // On an exception, in-flight reads must finish before their buffers go
+  struct drain_guard {
+    column_loader& loader;
+    std::vector<slot>& slots;
+    ~drain_guard() {
+      try {
+        for (; loader.ring_in_flight_ > 0; --loader.ring_in_flight_) {
+          loader.ring_->wait();
+        }
+      } catch (...) {
+        loader.ring_in_flight_ = 0;
+      }
+      for (slot& s : slots) {
+        if (s.pending.valid()) {
+          s.pending.wait();
+        }
+      }
+    }
+  } guard{*this, slots};
+
+  for (std::size_t i = 0; i < depth; ++i) {
+    prepare(slots[i], extents[i]);
+    issue(slots[i], i);
+  }
+  for (std::size_t i = 0; i < extents.size(); ++i) {
+    slot& s = slots[i % depth];
+    await(s, i, slots);
+    stage(i, std::span<const std::byte>(s.buffer.data() + s.skip,
+                                         extents[i].length));
+    ++stats_.row_groups;
+    if (i + depth < extents.size()) {
+      prepare(s, extents[i + depth]);
+      issue(s, i + depth);
+    }
+  }
+}
+
+} // namespace franklin::io
+
+#endif // FRANKLIN_IO_COLUMN_LOADER_HPP
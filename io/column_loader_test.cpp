@@ -0,0 +1,132 @@
+#include "io/column_loader.hpp"
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace franklin::io {
+namespace {
+
+// Column file of `rows` int32 values 0, 1, 2, ... after a `header` byte
+// prefix, removed on destruction
+class ColumnFile {
+public:
+  ColumnFile(const std::string& name, std::size_t rows, std::size_t header)
+      : path_(::testing::TempDir() + name) {
+    std::vector<std::int32_t> values(rows);
+    std::iota(values.begin(), values.end(), 0);
+    std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+    const std::string prefix(header, 'h');
+    out.write(prefix.data(), static_cast<std::streamsize>(prefix.size()));
+    out.write(reinterpret_cast<const char*>(values.data()),
+              static_cast<std::streamsize>(rows * sizeof(std::int32_t)));
+  }
+  ~ColumnFile() { std::remove(path_.c_str()); }
+
+  const std::string& path() const { return path_; }
+
+private:
+  std::string path_;
+};
+
+struct Config {
+  std::size_t depth;
+  bool direct_io;
+  bool use_io_uring;
+};
+
+class ColumnLoaderTest : public ::testing::TestWithParam<Config> {};
+
+TEST_P(ColumnLoaderTest, StreamsRowGroupsInOrder) {
+  constexpr std::size_t rows = 1'000'003;
+  constexpr std::size_t header = 100; // unaligned extents
+  ColumnFile file("column_loader_test.bin", rows, header);
+  memory_budget budget(16 << 20);
+
+  const Config config = GetParam();
+  loader_options options;
+  options.depth = config.depth;
+  options.direct_io = config.direct_io;
+  options.use_io_uring = config.use_io_uring;
+  column_loader loader(file.path(), budget, options);
+  if (!config.use_io_uring) {
+    EXPECT_FALSE(loader.uses_io_uring());
+  }
+  if (!config.direct_io) {
+    EXPECT_FALSE(loader.uses_direct_io());
+  }
+
+  const auto extents =
+      row_group_extents(header, rows, 65536, sizeof(std::int32_t));
+  std::size_t next_group = 0;
+  std::int64_t next_value = 0;
+  loader.scan(extents, [&](std::size_t group, std::span<const std::byte> d) {
+    ASSERT_EQ(group, next_group++);
+    ASSERT_EQ(d.size(), extents[group].length);
+    const std::size_t count = d.size() / sizeof(std::int32_t);
+    for (std::size_t i = 0; i < count; ++i) {
+      std::int32_t value;
+      std::memcpy(&value, d.data() + i * sizeof(value), sizeof(value));
+      ASSERT_EQ(value, next_value++);
+    }
+  });
+  EXPECT_EQ(next_group, extents.size());
+  EXPECT_EQ(next_value, static_cast<std::int64_t>(rows));
+  EXPECT_EQ(loader.stats().row_groups, extents.size());
+  EXPECT_GE(loader.stats().bytes_read, rows * sizeof(std::int32_t));
+
+  // Buffers go back to the budget with the scan
+  EXPECT_EQ(budget.used(), 0u);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Configurations, ColumnLoaderTest,
+    ::testing::Values(Config{3, true, true}, Config{2, false, true},
+                      Config{1, true, true}, Config{3, true, false},
+                      Config{4, false, false}));
+
+TEST(ColumnLoaderErrorsTest, RejectsExtentsPastEndOfFile) {
+  ColumnFile file("column_loader_short.bin", 1000, 0);
+  memory_budget budget(1 << 20);
+  column_loader loader(file.path(), budget);
+  const std::vector<extent> extents = {{0, 2000}, {2000, 4000}};
+  std::size_t groups = 0;
+  EXPECT_THROW(loader.scan(extents,
+                           [&](std::size_t, std::span<const std::byte>) {
+                             ++groups;
+                           }),
+               std::runtime_error);
+  EXPECT_EQ(groups, 0u);
+  EXPECT_EQ(budget.used(), 0u);
+}
+
+TEST(ColumnLoaderErrorsTest, StageExceptionsLeaveNoReadsBehind) {
+  ColumnFile file("column_loader_throw.bin", 100000, 0);
+  memory_budget budget(1 << 20);
+  column_loader loader(file.path(), budget);
+  const auto extents = row_group_extents(0, 100000, 4096, 4);
+  EXPECT_THROW(loader.scan(extents,
+                           [](std::size_t group, std::span<const std::byte>) {
+                             if (group == 3) {
+                               throw std::runtime_error("stage failed");
+                             }
+                           }),
+               std::runtime_error);
+
+  // The loader stays usable
+  std::size_t groups = 0;
+  loader.scan(extents,
+              [&](std::size_t, std::span<const std::byte>) { ++groups; });
+  EXPECT_EQ(groups, extents.size());
+}
+
+TEST(ColumnLoaderErrorsTest, ReportsMissingFiles) {
+  memory_budget budget(1 << 20);
+  EXPECT_THROW(column_loader("/nonexistent/column.bin", budget),
+               std::runtime_error);
+}
+
+} // namespace
+} // namespace franklin::io
@@ -0,0 +1,66 @@
+#ifndef FRANKLIN_IO_COLUMN_VIEW_HPP
+#define FRANKLIN_IO_COLUMN_VIEW_HPP
+
+#include "container/column.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace franklin::io {
+
+// Read-only view of column data owned by someone else: a shared-memory
+// segment, a receive buffer, ... Valid as long as that owner keeps the bytes.
+//
+// The validity bitmap uses dynamic_bitset's block layout (bit i of word
+// i / 64); bits at positions >= rows() are ignored.
+template <concepts::ColumnPolicy Policy> class column_view {
+public:
+  using value_type = typename Policy::value_type;
+
+  column_view(const value_type* data, const std::uint64_t* validity,
+              std::size_t rows) noexcept
+      : data_(data), validity_(validity), rows_(rows) {}
+
+  std::size_t rows() const noexcept { return rows_; }
+  std::span<const value_type> data() const noexcept { return {data_, rows_}; }
+  const std::uint64_t* validity() const noexcept { return validity_; }
+
+  bool present(std::size_t i) const noexcept {
+    return i < rows_ && ((validity_[i >> 6] >> (i & 63)) & 1) != 0;
+  }
+
+  value_type operator[](std::size_t i) const noexcept { return data_[i]; }
+
+  // Private, mutable copy for use with the column operators
+  column_vector<Policy> to_column() const;
+
+private:
+  const value_type* data_;
+  const std::uint64_t* validity_;
+  std::size_t rows_;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy> column_view<Policy>::to_column() const {
+  column_vector<Policy> column(rows_);
+  if (rows_ == 0) {
+    return column;
+  }
+  std::memcpy(column.data().data(), data_, rows_ * sizeof(value_type));
+  auto& blocks = column.present_mask().blocks();
+  const std::size_t words = (rows_ + 63) >> 6;
+  std::memcpy(blocks.data(), validity_, words * sizeof(std::uint64_t));
+  if (rows_ % 64 != 0) {
+    blocks[words - 1] &= (std::uint64_t{1} << (rows_ % 64)) - 1;
+  }
+  return column;
+}
+
+} // namespace franklin::io
+
+#endif // FRANKLIN_IO_COLUMN_VIEW_HPP
@@ -0,0 +1,795 @@
+#ifndef FRANKLIN_IO_COMPRESSION_HPP
+#define FRANKLIN_IO_COMPRESSION_HPP
+
+#include "container/column.hpp"
+#include "io/block_codec.hpp"
+#include "io/spill_file.hpp"
+#include "memory/aligned_allocator.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <future>
+#include <immintrin.h>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace franklin::io {
+
+// Block compression for persisted and spilled columns.
+//
+// A buffer is compressed as a frame of independent blocks, so blocks can be
+// compressed and decompressed in parallel:
+//
+//   [frame header, 32 B][block table: u32 per block][blocks ...]
+//
+// Each table entry is the compressed size of its block; the high bit marks a
+// block stored raw because it did not compress. Before compression, a block
+// can be preconditioned with a shuffle that groups bytes (or bits) of equal
+// significance: the exponent and high mantissa bytes of Float32/BF16 values
+// and the high bytes of small integers then form long runs that the codec
+// compresses well.
+//
+// Codecs are pluggable: implement block_codec, give it an unused codec id
+// from codec_id::user_first on, and register_codec() it at startup so frames
+// naming it can be decompressed. Spilling operators use a codec on whole
+// spilled blocks instead of frames (see spill_options::codec).
+
+enum class shuffle_mode : std::uint8_t {
+  none = 0,
+  byte = 1, // byte j of every element is stored together
+  bit = 2,  // bit b of byte j of every element is stored together
+};
+
+// Byte-oriented LZ77 codec in the LZ4 block format: literal runs and matches
+// of 4+ bytes within a 64 KiB window, found through a hash table of 4-byte
+// prefixes. Favours speed over ratio; decompression is a tight copy loop.
+class lz_codec final : public block_codec {
+public:
+  codec_id id() const noexcept override { return codec_id::lz; }
+  std::size_t max_compressed_size(std::size_t size) const noexcept override {
+    return size + size / 255 + 16;
+  }
+  std::size_t compress(const std::byte* src, std::size_t size,
+                       std::byte* dst) const override;
+  void decompress(const std::byte* src, std::size_t compressed, std::byte* dst,
+                  std::size_t size) const override;
+};
+
+// The codec registered for `id`, or nullptr
+const block_codec* find_codec(codec_id id) noexcept;
+
+// Make `codec` available to decompression under codec.id(). Not thread-safe;
+// call before any frame using the codec is decompressed.
+void register_codec(const block_codec& codec);
+
+struct compression_options {
+  codec_id codec = codec_id::lz;
+  shuffle_mode shuffle = shuffle_mode::byte;
+  // Raw bytes per block, rounded down to whole groups of 8 elements
+  std::size_t block_bytes = std::size_t{1} << 16;
+};
+
+// Compress `data`, made of `element_size`-byte values, into a frame. With a
+// pool, blocks are compressed in parallel.
+std::vector<std::byte> compress_frame(std::span<const std::byte> data,
+                                      std::size_t element_size,
+                                      const compression_options& options = {},
+                                      io_thread_pool* pool = nullptr);
+
+// Bytes the frame at the start of `frame` decompresses to, and occupies
+std::size_t frame_raw_bytes(std::span<const std::byte> frame);
+std::size_t frame_bytes(std::span<const std::byte> frame);
+
+// Decompress the frame at the start of `frame` into `out`, which holds
+// exactly frame_raw_bytes(frame) bytes. With a pool, blocks are decompressed
+// in parallel, each straight into its place in `out`.
+void decompress_frame(std::span<const std::byte> frame,
+                      std::span<std::byte> out,
+                      io_thread_pool* pool = nullptr);
+
+// Values and validity of the first `rows` rows of a column, as two frames
+template <concepts::ColumnPolicy Policy>
+std::vector<std::byte> compress_column(const column_vector<Policy>& column,
+                                       std::size_t rows,
+                                       const compression_options& options = {},
+                                       io_thread_pool* pool = nullptr);
+
+// Column from compress_column() output; its buffers come from the policy's
+// (aligned) allocator and are filled in place
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy> decompress_column(std::span<const std::byte> frames,
+                                        std::size_t& rows,
+                                        io_thread_pool* pool = nullptr);
+
+// Shuffle preconditioning of `count` elements of `element_size` bytes;
+// `src` and `dst` hold count * element_size bytes and do not overlap
+void shuffle(shuffle_mode mode, const std::byte* src, std::byte* dst,
+             std::size_t count, std::size_t element_size) noexcept;
+void unshuffle(shuffle_mode mode, const std::byte* src, std::byte* dst,
+               std::size_t count, std::size_t element_size) noexcept;
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+namespace detail {
+
+inline constexpr std::uint32_t frame_magic = 0x5a4c4246; // "FBLZ"
+inline constexpr std::uint8_t frame_version = 1;
+inline constexpr std::uint32_t stored_block = 0x80000000u;
+
+struct frame_header {
+  std::uint32_t magic;
+  std::uint8_t version;
+  std::uint8_t codec;   // codec_id
+  std::uint8_t shuffle; // shuffle_mode
+  std::uint8_t element_size;
+  std::uint32_t block_bytes;
+  std::uint32_t blocks;
+  std::uint64_t raw_bytes;
+  std::uint64_t reserved;
+};
+
+static_assert(sizeof(frame_header) == 32);
+
+inline std::uint32_t load_u32(const std::byte* p) noexcept {
+  std::uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline std::uint64_t load_u64(const std::byte* p) noexcept {
+  std::uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+// --- LZ ----------------------------------------------------------------------
+
+inline constexpr std::size_t lz_min_match = 4;
+inline constexpr std::size_t lz_last_literals = 5; // format requirement
+inline constexpr std::size_t lz_match_limit = 12;  // no match starts later
+inline constexpr std::size_t lz_max_offset = 65535;
+inline constexpr unsigned lz_hash_bits = 13;
+
+inline std::uint32_t lz_hash(std::uint32_t sequence) noexcept {
+  return (sequence * 2654435761u) >> (32 - lz_hash_bits);
+}
+
+// Write a length continuation: 255, 255, ..., rest
+inline std::byte* lz_put_length(std::byte* op, std::size_t length) noexcept {
+  for (; length >= 255; length -= 255) {
+    *op++ = std::byte{255};
+  }
+  *op++ = static_cast<std::byte>(length);
+  return op;
+}
+
+inline std::byte* lz_put_sequence(std::byte* op, const std::byte* literals,
+                                  std::size_t literal_length,
+                                  std::size_t offset,
+                                  std::size_t match_length) noexcept {
+  std::byte* token = op++;
+  const std::size_t lit = std::min<std::size_t>(literal_length, 15);
+  std::uint8_t t = static_cast<std::uint8_t>(lit << 4);
+  if (literal_length >= 15) {
+    op = lz_put_length(op, literal_length - 15);
+  }
+  std::memcpy(op, literals, literal_length);
+  op += literal_length;
+  if (match_length > 0) {
+    *op++ = static_cast<std::byte>(offset & 0xff);
+    *op++ = static_cast<std::byte>(offset >> 8);
+    const std::size_t ml = match_length - lz_min_match;
+    t |= static_cast<std::uint8_t>(std::min<std::size_t>(ml, 15));
+    if (ml >= 15) {
+      op = lz_put_length(op, ml - 15);
+    }
+  }
+  *token = static_cast<std::byte>(t);
+  return op;
+}
+
+// Read a length continuation; false if it runs past `end`
+inline bool lz_get_length(const std::byte*& ip, const std::byte* end,
+                          std::size_t& length) noexcept {
+  std::uint8_t b;
+  do {
+    if (ip == end) {
+      return false;
+    }
+    b = static_cast<std::uint8_t>(*ip++);
+    length += b;
+  } while (b == 255);
+  return true;
+}
+
+// --- Shuffles ----------------------------------------------------------------
+
+// Transpose the 8x8 bit matrix whose row i is byte i of x
+inline std::uint64_t transpose_8x8(std::uint64_t x) noexcept {
+  std::uint64_t t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAull;
+  x ^= t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull;
+  x ^= t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull;
+  x ^= t ^ (t << 28);
+  return x;
+}
+
+inline void byte_shuffle(const std::byte* src, std::byte* dst,
+                         std::size_t count, std::size_t size) noexcept {
+  std::size_t i = 0;
+  if (size == 4) {
+    // 8 elements per step: transpose 4x4 bytes in each lane, then gather
+    // each plane's two 4-byte pieces
+    const __m256i bytes = _mm256_setr_epi8(
+        0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15, //
+        0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    const __m256i words = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    for (; i + 8 <= count; i += 8) {
+      __m256i v = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(src + i * 4));
+      v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, bytes), words);
+      alignas(32) std::uint64_t planes[4];
+      _mm256_store_si256(reinterpret_cast<__m256i*>(planes), v);
+      for (std::size_t j = 0; j < 4; ++j) {
+        std::memcpy(dst + j * count + i, &planes[j], 8);
+      }
+    }
+  } else if (size == 2) {
+    const __m256i bytes = _mm256_setr_epi8(
+        0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15, //
+        0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+    for (; i + 16 <= count; i += 16) {
+      __m256i v = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(src + i * 2));
+      v = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, bytes),
+                                   _MM_SHUFFLE(3, 1, 2, 0));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                       _mm256_castsi256_si128(v));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + count + i),
+                       _mm256_extracti128_si256(v, 1));
+    }
+  }
+  for (; i < count; ++i) {
+    for (std::size_t j = 0; j < size; ++j) {
+      dst[j * count + i] = src[i * size + j];
+    }
+  }
+}
+
+inline void byte_unshuffle(const std::byte* src, std::byte* dst,
+                           std::size_t count, std::size_t size) noexcept {
+  std::size_t i = 0;
+  if (size == 4) {
+    // Inverse of byte_shuffle's permutation; the in-lane transpose is its own
+    // inverse
+    const __m256i bytes = _mm256_setr_epi8(
+        0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15, //
+        0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    const __m256i words = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    for (; i + 8 <= count; i += 8) {
+      alignas(32) std::uint64_t planes[4];
+      for (std::size_t j = 0; j < 4; ++j) {
+        std::memcpy(&planes[j], src + j * count + i, 8);
+      }
+      __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(planes));
+      v = _mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(v, words), bytes);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), v);
+    }
+  } else if (size == 2) {
+    const __m256i bytes = _mm256_setr_epi8(
+        0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15, //
+        0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15);
+    for (; i + 16 <= count; i += 16) {
+      const __m128i lo =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+      const __m128i hi =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count + i));
+      __m256i v = _mm256_set_m128i(hi, lo);
+      v = _mm256_shuffle_epi8(
+          _mm256_permute4x64_epi64(v, _MM_SHUFFLE(3, 1, 2, 0)), bytes);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 2), v);
+    }
+  }
+  for (; i < count; ++i) {
+    for (std::size_t j = 0; j < size; ++j) {
+      dst[i * size + j] = src[j * count + i];
+    }
+  }
+}
+
+// Bit shuffle: byte shuffle, then split each byte plane into 8 bit planes.
+// Whole groups of 8 elements are shuffled; the remaining elements follow
+// the bit planes unchanged.
+inline void bit_shuffle(const std::byte* src, std::byte* dst,
+                        std::size_t count, std::size_t size) noexcept {
+  const std::size_t groups = count / 8;
+  const std::size_t shuffled = groups * 8;
+  std::vector<std::byte> planes(shuffled * size);
+  byte_shuffle(src, planes.data(), shuffled, size);
+  for (std::size_t p = 0; p < size; ++p) {
+    const std::byte* plane = planes.data() + p * shuffled;
+    std::byte* out = dst + p * shuffled; // 8 bit planes of `groups` bytes
+    for (std::size_t g = 0; g < groups; ++g) {
+      const std::uint64_t bits = transpose_8x8(load_u64(plane + g * 8));
+      for (std::size_t b = 0; b < 8; ++b) {
+        out[b * groups + g] = static_cast<std::byte>(bits >> (8 * b));
+      }
+    }
+  }
+  std::memcpy(dst + shuffled * size, src + shuffled * size,
+              (count - shuffled) * size);
+}
+
+inline void bit_unshuffle(const std::byte* src, std::byte* dst,
+                          std::size_t count, std::size_t size) noexcept {
+  const std::size_t groups = count / 8;
+  const std::size_t shuffled = groups * 8;
+  std::vector<std::byte> planes(shuffled * size);
+  for (std::size_t p = 0; p < size; ++p) {
+    const std::byte* in = src + p * shuffled;
+    std::byte* plane = planes.data() + p * shuffled;
+    for (std::size_t g = 0; g < groups; ++g) {
+      std::uint64_t bits = 0;
+      for (std::size_t b = 0; b < 8; ++b) {
+        bits |= static_cast<std::uint64_t>(in[b * groups + g]) << (8 * b);
+      }
+      bits = transpose_8x8(bits);
+      std::memcpy(plane + g * 8, &bits, 8);
+    }
+  }
+  byte_unshuffle(planes.data(), dst, shuffled, size);
+  std::memcpy(dst + shuffled * size, src + shuffled * size,
+              (count - shuffled) * size);
+}
+
+inline const block_codec*& codec_slot(codec_id id) noexcept {
+  static lz_codec lz;
+  static std::array<const block_codec*, 256> codecs = [] {
+    std::array<const block_codec*, 256> table{};
+    table[static_cast<std::size_t>(codec_id::lz)] = &lz;
+    return table;
+  }();
+  return codecs[static_cast<std::size_t>(id)];
+}
+
+inline frame_header read_frame_header(std::span<const std::byte> frame) {
+  if (frame.size() < sizeof(frame_header)) {
+    throw std::runtime_error("Compressed frame truncated");
+  }
+  frame_header header;
+  std::memcpy(&header, frame.data(), sizeof(header));
+  if (header.magic != frame_magic || header.version != frame_version ||
+      header.element_size == 0 || header.block_bytes == 0 ||
+      header.block_bytes % header.element_size != 0 ||
+      header.shuffle > static_cast<std::uint8_t>(shuffle_mode::bit) ||
+      header.blocks != (header.raw_bytes + header.block_bytes - 1) /
+                           header.block_bytes) {
+    throw std::runtime_error("Not a compressed frame");
+  }
+  if (header.blocks > (frame.size() - sizeof(header)) / 4) {
+    throw std::runtime_error("Compressed frame truncated");
+  }
+  return header;
+}
+
+// Run body(first, last) over [0, count) in up to one chunk per pool thread
+template <typename Body>
+void for_blocks(std::size_t count, io_thread_pool* pool, const Body& body) {
+  if (pool == nullptr || pool->size() < 2 || count < 2) {
+    body(std::size_t{0}, count);
+    return;
+  }
+  const std::size_t chunks = std::min(pool->size(), count);
+  std::vector<std::future<void>> done;
+  done.reserve(chunks);
+  for (std::size_t c = 0; c < chunks; ++c) {
+    const std::size_t first = count * c / chunks;
+    const std::size_t last = count * (c + 1) / chunks;
+    done.push_back(pool->submit([&body, first, last] { body(first, last); }));
+  }
+  // Wait for every chunk before rethrowing, as they use the caller's buffers
+  std::exception_ptr error;
+  for (auto& d : done) {
+    try {
+      d.get();
+    } catch (...) {
+      error = std::current_exception();
+    }
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace detail
+
+inline std::size_t lz_codec::compress(const std::byte* src, std::size_t size,
+                                      std::byte* dst) const {
+  using namespace detail;
+  std::byte* op = dst;
+  std::size_t anchor = 0;
+  if (size > lz_match_limit) {
+    std::vector<std::uint32_t> table(std::size_t{1} << lz_hash_bits, 0);
+    const std::size_t limit = size - lz_match_limit;
+    const std::size_t match_end = size - lz_last_literals;
+    std::size_t ip = 1;
+    while (ip < limit) {
+      const std::uint32_t sequence = load_u32(src + ip);
+      std::uint32_t& slot = table[lz_hash(sequence)];
+      const std::size_t ref = slot;
+      slot = static_cast<std::uint32_t>(ip);
+      if (ip - ref > lz_max_offset || load_u32(src + ref) != sequence) {
+        // Skip faster through data that does not compress
+        ip += 1 + ((ip - anchor) >> 6);
+        continue;
+      }
+      std::size_t start = ip;
+      std::size_t from = ref;
+      while (start > anchor && from > 0 && src[start - 1] == src[from - 1]) {
+        --start;
+        --from;
+      }
+      std::size_t length = ip + lz_min_match - start;
+      while (start + length < match_end &&
+             src[start + length] == src[from + length]) {
+        ++length;
+      }
+      op = lz_put_sequence(op, src + anchor, start - anchor, start - from,
+                           length);
+      ip = start + length;
+      anchor = ip;
+      if (ip < limit) {
+        // Index a position inside the match, for the next one
+        table[lz_hash(load_u32(src + ip - 2))] =
+            static_cast<std::uint32_t>(ip - 2);
+      }
+    }
+  }
+  op = detail::lz_put_sequence(op, src + anchor, size - anchor, 0, 0);
+  return static_cast<std::size_t>(op - dst);
+}
+
+inline void lz_codec::decompress(const std::byte* src, std::size_t compressed,
+                                 std::byte* dst, std::size_t size) const {
+  const std::byte* ip = src;
+  const std::byte* const end = src + compressed;
+  std::byte* op = dst;
+  std::byte* const out_end = dst + size;
+  const auto corrupt = [] {
+    throw std::runtime_error("Corrupt compressed block");
+  };
+  while (true) {
+    if (ip == end) {
+      corrupt();
+    }
+    const auto token = static_cast<std::uint8_t>(*ip++);
+    std::size_t literals = token >> 4;
+    if (literals == 15 && !detail::lz_get_length(ip, end, literals)) {
+      corrupt();
+    }
+    if (literals > static_cast<std::size_t>(end - ip) ||
+        literals > static_cast<std::size_t>(out_end - op)) {
+      corrupt();
+    }
+    if (literals <= 16 && end - ip >= 16 && out_end - op >= 16) {
+      // Fixed-size copies compile to a single load/store pair
+      std::memcpy(op, ip, 16);
+    } else {
+      std::memcpy(op, ip, literals);
+    }
+    ip += literals;
+    op += literals;
+    if (ip == end) {
+      break; // the last sequence has no match
+    }
+
+    if (end - ip < 2) {
+      corrupt();
+    }
+    const std::size_t offset = static_cast<std::size_t>(ip[0]) |
+                               static_cast<std::size_t>(ip[1]) << 8;
+    ip += 2;
+    std::size_t length = token & 15;
+    if (length == 15 && !detail::lz_get_length(ip, end, length)) {
+      corrupt();
+    }
+    length += detail::lz_min_match;
+    if (offset == 0 || offset > static_cast<std::size_t>(op - dst) ||
+        length > static_cast<std::size_t>(out_end - op)) {
+      corrupt();
+    }
+    const std::byte* from = op - offset;
+    if (offset >= 16 &&
+        static_cast<std::size_t>(out_end - op) >= ((length + 15) & ~15u)) {
+      // Copy whole 16-byte pieces; each reads only finished output
+      for (std::size_t i = 0; i < length; i += 16) {
+        std::memcpy(op + i, from + i, 16);
+      }
+      op += length;
+      continue;
+    }
+    // An overlapping match repeats the last `offset` bytes: copy the
+    // pattern in non-overlapping pieces that double in size
+    for (std::size_t left = length; left > 0;) {
+      const std::size_t n =
+          std::min(static_cast<std::size_t>(op - from), left);
+      std::memcpy(op, from, n);
+      op += n;
+      left -= n;
+    }
+  }
+  if (op != out_end) {
+    corrupt();
+  }
+}
+
+inline const block_codec* find_codec(codec_id id) noexcept {
+  return detail::codec_slot(id);
+}
+
+inline void register_codec(const block_codec& codec) {
+  if (codec.id() == codec_id::none) {
+    throw std::runtime_error("Codec id 0 is reserved");
+  }
+  detail::codec_slot(codec.id()) = &codec;
+}
+
+inline void shuffle(shuffle_mode mode, const std::byte* src, std::byte* dst,
+                    std::size_t count, std::size_t element_size) noexcept {
+  switch (mode) {
+  case shuffle_mode::byte:
+    detail::byte_shuffle(src, dst, count, element_size);
+    break;
+  case shuffle_mode::bit:
+    detail::bit_shuffle(src, dst, count, element_size);
+    break;
+  case shuffle_mode::none:
+    std::memcpy(dst, src, count * element_size);
+    break;
+  }
+}
+
+inline void unshuffle(shuffle_mode mode, const std::byte* src, std::byte* dst,
+                      std::size_t count, std::size_t element_size) noexcept {
+  switch (mode) {
+  case shuffle_mode::byte:
+    detail::byte_unshuffle(src, dst, count, element_size);
+    break;
+  case shuffle_mode::bit:
+    detail::bit_unshuffle(src, dst, count, element_size);
+    break;
+  case shuffle_mode::none:
+    std::memcpy(dst, src, count * element_size);
+    break;
+  }
+}
+
+inline std::vector<std::byte> compress_frame(std::span<const std::byte> data,
+                                             std::size_t element_size,
+                                             const compression_options& options,
+                                             io_thread_pool* pool) {
+  if (element_size == 0 || element_size > 255 ||
+      data.size() % element_size != 0) {
+    throw std::runtime_error("Data is not made of " +
+                             std::to_string(element_size) + "-byte elements");
+  }
+  const block_codec* codec = nullptr;
+  if (options.codec != codec_id::none) {
+    codec = find_codec(options.codec);
+    if (codec == nullptr) {
+      throw std::runtime_error("Unknown codec " +
+                               std::to_string(static_cast<int>(options.codec)));
+    }
+  }
+  const std::size_t group = 8 * element_size;
+  const std::size_t block_bytes =
+      std::clamp<std::size_t>(options.block_bytes / group * group, group,
+                              (detail::stored_block - 1) / group * group);
+  const std::size_t blocks = (data.size() + block_bytes - 1) / block_bytes;
+
+  // Compress every block into its own worst-case slot, then pack
+  const std::size_t slot = codec != nullptr
+                               ? codec->max_compressed_size(block_bytes)
+                               : block_bytes;
+  std::vector<std::byte> scratch(blocks * slot);
+  std::vector<std::uint32_t> sizes(blocks);
+  detail::for_blocks(
+      blocks, pool, [&](std::size_t first, std::size_t last) {
+        std::vector<std::byte> shuffled(
+            options.shuffle != shuffle_mode::none ? block_bytes : 0);
+        for (std::size_t b = first; b < last; ++b) {
+          const std::size_t offset = b * block_bytes;
+          const std::size_t raw = std::min(block_bytes, data.size() - offset);
+          const std::byte* input = data.data() + offset;
+          if (options.shuffle != shuffle_mode::none) {
+            shuffle(options.shuffle, input, shuffled.data(),
+                    raw / element_size, element_size);
+            input = shuffled.data();
+          }
+          std::byte* out = scratch.data() + b * slot;
+          std::size_t size = raw;
+          if (codec != nullptr) {
+            size = codec->compress(input, raw, out);
+          }
+          if (size >= raw) {
+            std::memcpy(out, input, raw);
+            sizes[b] = static_cast<std::uint32_t>(raw) | detail::stored_block;
+          } else {
+            sizes[b] = static_cast<std::uint32_t>(size);
+          }
+        }
+      });
+
+  std::size_t total = sizeof(detail::frame_header) + 4 * blocks;
+  for (std::uint32_t size : sizes) {
+    total += size & ~detail::stored_block;
+  }
+  std::vector<std::byte> frame(total);
+  detail::frame_header header{};
+  header.magic = detail::frame_magic;
+  header.version = detail::frame_version;
+  header.codec = static_cast<std::uint8_t>(options.codec);
+  header.shuffle = static_cast<std::uint8_t>(options.shuffle);
+  header.element_size = static_cast<std::uint8_t>(element_size);
+  header.block_bytes = static_cast<std::uint32_t>(block_bytes);
+  header.blocks = static_cast<std::uint32_t>(blocks);
+  header.raw_bytes = data.size();
+  std::memcpy(frame.data(), &header, sizeof(header));
+  if (blocks > 0) {
+    std::memcpy(frame.data() + sizeof(header), sizes.data(), 4 * blocks);
+  }
+  std::byte* out = frame.data() + sizeof(header) + 4 * blocks;
+  for (std::size_t b = 0; b < blocks; ++b) {
+    const std::size_t size = sizes[b] & ~detail::stored_block;
+    std::memcpy(out, scratch.data() + b * slot, size);
+    out += size;
+  }
+  return frame;
+}
+
+inline std::size_t frame_raw_bytes(std::span<const std::byte> frame) {
+  return static_cast<std::size_t>(detail::read_frame_header(frame).raw_bytes);
+}
+
+inline std::size_t frame_bytes(std::span<const std::byte> frame) {
+  const detail::frame_header header = detail::read_frame_header(frame);
+  std::size_t total = sizeof(header) + 4 * std::size_t{header.blocks};
+  for (std::size_t b = 0; b < header.blocks; ++b) {
+    total += detail::load_u32(frame.data() + sizeof(header) + 4 * b) &
+             ~detail::stored_block;
+  }
+  return total;
+}
+
+inline void decompress_frame(std::span<const std::byte> frame,
+                             std::span<std::byte> out, io_thread_pool* pool) {
+  const detail::frame_header header = detail::read_frame_header(frame);
+  if (out.size() != header.raw_bytes) {
+    throw std::runtime_error("Output does not match the frame's size");
+  }
+  const auto mode = static_cast<shuffle_mode>(header.shuffle);
+  const auto id = static_cast<codec_id>(header.codec);
+  const block_codec* codec = nullptr;
+  if (id != codec_id::none) {
+    codec = find_codec(id);
+    if (codec == nullptr) {
+      throw std::runtime_error("Unknown codec " +
+                               std::to_string(static_cast<int>(id)));
+    }
+  }
+
+  // Block offsets from the table, checked against the frame
+  const std::size_t blocks = header.blocks;
+  const std::byte* table = frame.data() + sizeof(header);
+  std::vector<std::size_t> offsets(blocks + 1);
+  offsets[0] = sizeof(header) + 4 * blocks;
+  for (std::size_t b = 0; b < blocks; ++b) {
+    offsets[b + 1] =
+        offsets[b] + (detail::load_u32(table + 4 * b) & ~detail::stored_block);
+  }
+  if (offsets[blocks] > frame.size()) {
+    throw std::runtime_error("Compressed frame truncated");
+  }
+
+  detail::for_blocks(
+      blocks, pool, [&](std::size_t first, std::size_t last) {
+        std::vector<std::byte> shuffled(
+            mode != shuffle_mode::none ? header.block_bytes : 0);
+        for (std::size_t b = first; b < last; ++b) {
+          const std::size_t offset = b * header.block_bytes;
+          const std::size_t raw = std::min<std::size_t>(
+              header.block_bytes, header.raw_bytes - offset);
+          const bool stored =
+              (detail::load_u32(table + 4 * b) & detail::stored_block) != 0;
+          const std::byte* input = frame.data() + offsets[b];
+          const std::size_t size = offsets[b + 1] - offsets[b];
+          std::byte* target = mode != shuffle_mode::none
+                                  ? shuffled.data()
+                                  : out.data() + offset;
+          if (stored || codec == nullptr) {
+            if (size != raw) {
+              throw std::runtime_error("Corrupt compressed block");
+            }
+            std::memcpy(target, input, raw);
+          } else {
+            codec->decompress(input, size, target, raw);
+          }
+          if (mode != shuffle_mode::none) {
+            unshuffle(mode, shuffled.data(), out.data() + offset,
+                      raw / header.element_size, header.element_size);
+          }
+        }
+      });
+}
+
+template <concepts::ColumnPolicy Policy>
+std::vector<std::byte> compress_column(const column_vector<Policy>& column,
+                                       std::size_t rows,
+                                       const compression_options& options,
+                                       io_thread_pool* pool) {
+  using value_type = typename Policy::value_type;
+  if (rows > column.data().size()) {
+    throw std::runtime_error("Column has fewer than " + std::to_string(rows) +
+                             " rows");
+  }
+  std::vector<std::byte> frames = compress_frame(
+      std::as_bytes(std::span(column.data().data(), rows)), sizeof(value_type),
+      options, pool);
+
+  // Validity bitmaps are mostly runs of ones: no shuffle
+  std::vector<std::uint64_t> words(
+      column.present_mask().blocks().begin(),
+      column.present_mask().blocks().begin() + (rows + 63) / 64);
+  if (rows % 64 != 0) {
+    words.back() &= (std::uint64_t{1} << (rows % 64)) - 1;
+  }
+  compression_options validity = options;
+  validity.shuffle = shuffle_mode::none;
+  const std::vector<std::byte> mask =
+      compress_frame(std::as_bytes(std::span(words)), sizeof(std::uint64_t),
+                     validity, pool);
+  frames.insert(frames.end(), mask.begin(), mask.end());
+  return frames;
+}
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy> decompress_column(std::span<const std::byte> frames,
+                                        std::size_t& rows,
+                                        io_thread_pool* pool) {
+  using value_type = typename Policy::value_type;
+  const detail::frame_header header = detail::read_frame_header(frames);
+  if (header.element_size != sizeof(value_type)) {
+    throw std::runtime_error("Frame does not hold " +
+                             std::string(DataTypeEnum::to_string(
+                                 Policy::policy_id)) +
+                             " values");
+  }
+  rows = static_cast<std::size_t>(header.raw_bytes / sizeof(value_type));
+  column_vector<Policy> column(rows);
+  decompress_frame(
+      frames, std::as_writable_bytes(std::span(column.data().data(), rows)),
+      pool);
+
+  const auto mask = frames.subspan(frame_bytes(frames));
+  const std::size_t words = (rows + 63) / 64;
+  if (frame_raw_bytes(mask) != words * sizeof(std::uint64_t)) {
+    throw std::runtime_error("Validity frame does not match the column");
+  }
+  decompress_frame(mask,
+                   std::as_writable_bytes(
+                       std::span(column.present_mask().blocks().data(), words)),
+                   pool);
+  return column;
+}
+
+} // namespace franklin::io
+
+#endif // FRANKLIN_IO_COMPRESSION_HPP
@@ -0,0 +1,310 @@
+#include "io/compression.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace franklin::io {
+namespace {
+
+std::vector<std::byte> random_bytes(std::size_t size, std::uint32_t seed,
+                                    int alphabet = 256) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(0, alphabet - 1);
+  std::vector<std::byte> bytes(size);
+  for (auto& b : bytes) {
+    b = static_cast<std::byte>(dist(rng));
+  }
+  return bytes;
+}
+
+// Slowly moving prices in cents
+std::vector<float> smooth_floats(std::size_t count) {
+  std::vector<float> values(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const float price =
+        100.0f + 10.0f * std::sin(static_cast<float>(i) * 0.001f);
+    values[i] = std::round(price * 100.0f) / 100.0f;
+  }
+  return values;
+}
+
+std::vector<std::byte> lz_round_trip(const std::vector<std::byte>& input) {
+  lz_codec codec;
+  std::vector<std::byte> compressed(codec.max_compressed_size(input.size()));
+  compressed.resize(
+      codec.compress(input.data(), input.size(), compressed.data()));
+  std::vector<std::byte> output(input.size());
+  codec.decompress(compressed.data(), compressed.size(), output.data(),
+                   output.size());
+  return output;
+}
+
+TEST(CompressionTest, LzRoundTrips) {
+  for (std::size_t size : {0, 1, 5, 12, 13, 16, 17, 300, 70000, 300000}) {
+    // Incompressible, low-entropy, and long runs
+    for (int alphabet : {256, 4, 1}) {
+      const auto input = random_bytes(size, static_cast<std::uint32_t>(size),
+                                      alphabet);
+      EXPECT_EQ(lz_round_trip(input), input)
+          << "size " << size << ", alphabet " << alphabet;
+    }
+  }
+  // Repeats at a distance, with literal runs of 15 and 255+ bytes between
+  auto input = random_bytes(1000, 1);
+  const auto tail = input;
+  input.insert(input.end(), tail.begin(), tail.begin() + 270);
+  input.insert(input.end(), 15, std::byte{7});
+  input.insert(input.end(), tail.begin() + 500, tail.end());
+  EXPECT_EQ(lz_round_trip(input), input);
+}
+
+TEST(CompressionTest, LzRejectsCorruptInput) {
+  lz_codec codec;
+  const auto input = random_bytes(20000, 3, 8);
+  std::vector<std::byte> compressed(codec.max_compressed_size(input.size()));
+  compressed.resize(
+      codec.compress(input.data(), input.size(), compressed.data()));
+  std::vector<std::byte> output(input.size());
+
+  // Truncated input and wrong sizes are detected
+  EXPECT_THROW(codec.decompress(compressed.data(), compressed.size() / 2,
+                                output.data(), output.size()),
+               std::runtime_error);
+  EXPECT_THROW(codec.decompress(compressed.data(), compressed.size(),
+                                output.data(), output.size() - 1),
+               std::runtime_error);
+  // Random damage never reads or writes out of bounds (checked under ASan)
+  std::mt19937 rng(5);
+  for (int trial = 0; trial < 200; ++trial) {
+    auto damaged = compressed;
+    damaged[rng() % damaged.size()] = static_cast<std::byte>(rng());
+    try {
+      codec.decompress(damaged.data(), damaged.size(), output.data(),
+                       output.size());
+    } catch (const std::runtime_error&) {
+    }
+  }
+}
+
+TEST(CompressionTest, ShufflesRoundTrip) {
+  for (std::size_t size : {1, 2, 3, 4, 8}) {
+    for (std::size_t count : {0, 1, 7, 8, 15, 16, 17, 100, 1001}) {
+      const auto input = random_bytes(count * size, 11);
+      for (auto mode : {shuffle_mode::byte, shuffle_mode::bit}) {
+        std::vector<std::byte> shuffled(input.size());
+        std::vector<std::byte> output(input.size());
+        shuffle(mode, input.data(), shuffled.data(), count, size);
+        unshuffle(mode, shuffled.data(), output.data(), count, size);
+        EXPECT_EQ(output, input) << "size " << size << ", count " << count;
+      }
+    }
+  }
+  // Byte shuffle of 4-byte values: least significant bytes first
+  const std::uint32_t values[8] = {0x11223344, 0x55667788, 0, 0,
+                                   0,          0,          0, 0xaabbccdd};
+  std::byte planes[32];
+  shuffle(shuffle_mode::byte, reinterpret_cast<const std::byte*>(values),
+          planes, 8, 4);
+  EXPECT_EQ(planes[0], std::byte{0x44});
+  EXPECT_EQ(planes[1], std::byte{0x88});
+  EXPECT_EQ(planes[8], std::byte{0x33});
+  EXPECT_EQ(planes[31], std::byte{0xaa});
+}
+
+TEST(CompressionTest, FramesRoundTripInParallel) {
+  io_thread_pool pool(4);
+  const auto values = smooth_floats(300001);
+  const auto bytes = std::as_bytes(std::span(values));
+  for (auto mode :
+       {shuffle_mode::none, shuffle_mode::byte, shuffle_mode::bit}) {
+    for (io_thread_pool* p : {static_cast<io_thread_pool*>(nullptr), &pool}) {
+      compression_options options;
+      options.shuffle = mode;
+      options.block_bytes = 40000; // not a multiple of 32
+      const auto frame = compress_frame(bytes, sizeof(float), options, p);
+      EXPECT_EQ(frame_raw_bytes(frame), bytes.size());
+      EXPECT_EQ(frame_bytes(frame), frame.size());
+      std::vector<float, memory::aligned_allocator<float, 64>> out(
+          values.size());
+      decompress_frame(frame, std::as_writable_bytes(std::span(out)), p);
+      EXPECT_TRUE(std::equal(values.begin(), values.end(), out.begin()));
+    }
+  }
+
+  // Preconditioning pays off on floating-point data
+  compression_options plain;
+  plain.shuffle = shuffle_mode::none;
+  const std::size_t unshuffled =
+      compress_frame(bytes, sizeof(float), plain, &pool).size();
+  const std::size_t shuffled =
+      compress_frame(bytes, sizeof(float), {}, &pool).size();
+  EXPECT_LT(shuffled * 2, unshuffled);
+  EXPECT_LT(shuffled * 3, bytes.size());
+
+  // Incompressible data is stored, not expanded beyond the block table
+  const auto noise = random_bytes(100000, 9);
+  const auto frame = compress_frame(noise, 1, plain);
+  EXPECT_LE(frame.size(), noise.size() + 32 + 4 * 2);
+  std::vector<std::byte> out(noise.size());
+  decompress_frame(frame, out);
+  EXPECT_EQ(out, noise);
+}
+
+TEST(CompressionTest, ColumnsRoundTrip) {
+  io_thread_pool pool(3);
+  const std::size_t rows = 200003;
+  const auto values = smooth_floats(rows);
+  column_vector<Float32DefaultPolicy> column(rows);
+  for (std::size_t i = 0; i < rows; ++i) {
+    column.data()[i] = values[i];
+    column.present_mask().set(i, i % 1000 != 0);
+  }
+  const auto frames = compress_column(column, rows, {}, &pool);
+  EXPECT_LT(frames.size(), rows * sizeof(float) / 2);
+
+  std::size_t decoded_rows = 0;
+  const auto decoded =
+      decompress_column<Float32DefaultPolicy>(frames, decoded_rows, &pool);
+  ASSERT_EQ(decoded_rows, rows);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(decoded.data().data()) % 64, 0u);
+  for (std::size_t i = 0; i < rows; ++i) {
+    ASSERT_EQ(decoded.data()[i], values[i]);
+    ASSERT_EQ(decoded.present(i), i % 1000 != 0);
+  }
+  EXPECT_EQ(decoded.present_mask().count(), column.present_mask().count());
+
+  column_vector<BF16DefaultPolicy> halves(1000, bf16(1.5f));
+  compression_options bits;
+  bits.shuffle = shuffle_mode::bit;
+  const auto half_frames = compress_column(halves, 999, bits);
+  const auto decoded_halves =
+      decompress_column<BF16DefaultPolicy>(half_frames, decoded_rows);
+  EXPECT_EQ(decoded_rows, 999u);
+  EXPECT_EQ(decoded_halves.data()[998].to_float(), 1.5f);
+  EXPECT_FALSE(decoded_halves.present(999));
+
+  EXPECT_THROW(decompress_column<Int32DefaultPolicy>(half_frames,
+                                                     decoded_rows),
+               std::runtime_error);
+  EXPECT_THROW(compress_column(halves, 1025), std::runtime_error);
+}
+
+// Codec storing every byte inverted, to exercise registration
+class invert_codec final : public block_codec {
+public:
+  codec_id id() const noexcept override {
+    return static_cast<codec_id>(static_cast<int>(codec_id::user_first) + 1);
+  }
+  std::size_t max_compressed_size(std::size_t size) const noexcept override {
+    return size;
+  }
+  std::size_t compress(const std::byte* src, std::size_t size,
+                       std::byte* dst) const override {
+    // Claim one byte of savings so that blocks are not stored raw
+    for (std::size_t i = 0; i + 1 < size; ++i) {
+      dst[i] = ~src[i];
+    }
+    return size == 0 ? 0 : size - 1;
+  }
+  void decompress(const std::byte* src, std::size_t compressed,
+                  std::byte* dst, std::size_t size) const override {
+    if (compressed + 1 != size) {
+      throw std::runtime_error("Corrupt compressed block");
+    }
+    for (std::size_t i = 0; i < compressed; ++i) {
+      dst[i] = ~src[i];
+    }
+    dst[compressed] = std::byte{0};
+  }
+};
+
+TEST(CompressionTest, PluggableCodecs) {
+  static const invert_codec codec;
+  compression_options options;
+  options.codec = codec.id();
+  options.shuffle = shuffle_mode::none;
+  auto input = random_bytes(1000, 4);
+  input.back() = std::byte{0}; // the last byte of each block is implied
+  EXPECT_THROW(compress_frame(input, 1, options), std::runtime_error);
+
+  register_codec(codec);
+  EXPECT_EQ(find_codec(codec.id()), &codec);
+  options.block_bytes = 1000;
+  const auto frame = compress_frame(input, 1, options);
+  std::vector<std::byte> out(input.size());
+  decompress_frame(frame, out);
+  EXPECT_EQ(out, input);
+
+  // Damaged frames are rejected
+  auto damaged = frame;
+  damaged[0] = std::byte{0};
+  EXPECT_THROW(decompress_frame(damaged, out), std::runtime_error);
+  EXPECT_THROW(decompress_frame(std::span(frame).first(40), out),
+               std::runtime_error);
+  EXPECT_THROW(decompress_frame(frame, std::span(out).first(999)),
+               std::runtime_error);
+}
+
+TEST(CompressionTest, SpilledBlocksRoundTrip) {
+  io_thread_pool pool(2);
+  spill_file file(::testing::TempDir(), pool);
+  spill_layout layout({{sizeof(std::uint32_t), true}}, 1024);
+  std::vector<std::uint64_t> buffers[4];
+  for (auto& buffer : buffers) {
+    buffer.resize(layout.bytes() / 8);
+  }
+
+  // Even blocks repeat a few values; odd blocks are random and stay raw
+  const lz_codec codec;
+  std::mt19937 rng(7);
+  std::vector<std::uint32_t> values(5000);
+  std::vector<bool> present(values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    const bool random = (i / 1024) % 2 == 1;
+    values[i] = random ? static_cast<std::uint32_t>(rng())
+                       : static_cast<std::uint32_t>(i % 3);
+    present[i] = random ? (rng() & 1) != 0 : i % 5 != 0;
+  }
+  std::vector<spill_block> blocks;
+  {
+    block_writer writer(layout, buffers[0].data(), buffers[1].data(),
+                        &codec);
+    writer.open(file, blocks);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      const std::size_t row = writer.row();
+      layout.payload<std::uint32_t>(writer.block(), 0)[row] = values[i];
+      if (present[i]) {
+        layout.validity(writer.block(), 0)[row / 64] |= std::uint64_t{1}
+                                                        << (row % 64);
+      }
+      writer.commit_row();
+    }
+    writer.close();
+    EXPECT_LT(writer.bytes_written(), values.size() * sizeof(std::uint32_t));
+  }
+  ASSERT_EQ(blocks.size(), 5u);
+  EXPECT_TRUE(blocks[0].compressed);
+  EXPECT_FALSE(blocks[1].compressed);
+  EXPECT_TRUE(blocks[4].compressed); // the short last block
+
+  block_reader reader(layout, buffers[2].data(), buffers[3].data(), &codec);
+  std::size_t i = 0;
+  for (bool more = reader.open(file, blocks); more; more = reader.next()) {
+    for (std::size_t row = 0; row < reader.rows(); ++row, ++i) {
+      ASSERT_EQ(layout.payload<std::uint32_t>(reader.block(), 0)[row],
+                values[i]);
+      const bool valid =
+          (layout.validity(reader.block(), 0)[row / 64] >> (row % 64)) & 1;
+      ASSERT_EQ(valid, present[i]);
+    }
+  }
+  EXPECT_EQ(i, values.size());
+
+  // Compressed blocks need the codec they were written with
+  block_reader raw_reader(layout, buffers[2].data(), buffers[3].data());
+  EXPECT_THROW(raw_reader.open(file, blocks), std::runtime_error);
+}
+
+} // namespace
+} // namespace franklin::io
@@ -0,0 +1,676 @@
+#ifndef FRANKLIN_IO_CSV_READER_HPP
+#define FRANKLIN_IO_CSV_READER_HPP
+
+#include "container/column.hpp"
+#include "core/bf16.hpp"
+#include "core/compiler_macros.hpp"
+#include "core/data_type_enum.hpp"
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fcntl.h>
+#include <immintrin.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <variant>
+#include <vector>
+
+namespace franklin::io {
+
+struct csv_options {
+  char delimiter = ',';
+  // First line holds column names; otherwise columns are named c0, c1, ...
+  bool has_header = true;
+  // 0: std::thread::hardware_concurrency()
+  std::size_t num_threads = 0;
+  // Lower bound on the bytes handled per thread, so small inputs are not
+  // split into chunks whose setup costs more than the parse
+  std::size_t min_chunk_bytes = 1 << 20;
+};
+
+using any_column = std::variant<column_vector<Int32DefaultPolicy>,
+                                column_vector<Float32DefaultPolicy>,
+                                column_vector<BF16DefaultPolicy>>;
+
+struct csv_table {
+  std::vector<std::string> names;
+  std::vector<any_column> columns;
+  std::size_t num_rows = 0;
+
+  // Column by name; throws std::runtime_error if it is missing or has a
+  // different type
+  template <concepts::ColumnPolicy Policy>
+  column_vector<Policy>& get(std::string_view name);
+};
+
+// Parse delimited text into one column per field. `types` gives the type of
+// each column (Int32Default, Float32Default or BF16Default) and must match the
+// number of fields per line.
+//
+// Empty fields are stored as absent (cleared in the column's present_mask).
+// Fields may be enclosed in double quotes; delimiters and newlines inside
+// quotes do not split. A trailing newline and CRLF line endings are accepted.
+// Throws std::runtime_error, naming the 1-based data row, on malformed
+// numbers, out-of-range values and rows with the wrong number of fields.
+csv_table read_csv_buffer(std::string_view text,
+                          const std::vector<DataTypeEnum::Enum>& types,
+                          const csv_options& options = {});
+
+// As read_csv_buffer, on a memory-mapped file
+csv_table read_csv(const std::string& path,
+                   const std::vector<DataTypeEnum::Enum>& types,
+                   const csv_options& options = {});
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+namespace detail {
+
+// ----------------------------------------------------------------------------
+// Structural scanning
+//
+// 64 input bytes at a time, the positions of delimiters, newlines and quotes
+// are computed as bitmasks with AVX2 compares. Quoted regions are found with
+// a carry-less multiply by all-ones, which computes the prefix XOR of the
+// quote bits (the same trick simdjson uses for strings); delimiters and
+// newlines inside quotes are masked out. The parser then walks the remaining
+// structural bits with tzcnt instead of looking at every byte.
+// ----------------------------------------------------------------------------
+
+struct block_bits {
+  std::uint64_t delimiter;
+  std::uint64_t newline;
+  std::uint64_t quote;
+};
+
+FRANKLIN_FORCE_INLINE std::uint64_t match_mask(__m256i lo, __m256i hi,
+                                               char ch) noexcept {
+  const __m256i needle = _mm256_set1_epi8(ch);
+  const auto lo_bits = static_cast<std::uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, needle)));
+  const auto hi_bits = static_cast<std::uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, needle)));
+  return lo_bits | (std::uint64_t{hi_bits} << 32);
+}
+
+// Classify the 64 bytes at `data + pos`. Bytes at or past `end` are treated
+// as padding (no matches); they are never read.
+FRANKLIN_FORCE_INLINE block_bits scan_block(const char* data, std::size_t pos,
+                                            std::size_t end,
+                                            char delimiter) noexcept {
+  const char* src = data + pos;
+  alignas(32) char tail[64];
+  if (end - pos < 64) {
+    std::memset(tail, 0, sizeof(tail));
+    std::memcpy(tail, src, end - pos);
+    src = tail;
+  }
+  const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+  const __m256i hi =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32));
+  return {match_mask(lo, hi, delimiter), match_mask(lo, hi, '\n'),
+          match_mask(lo, hi, '"')};
+}
+
+// Mask of bytes inside quotes (opening quote included, closing excluded)
+FRANKLIN_FORCE_INLINE std::uint64_t quoted_mask(std::uint64_t quotes,
+                                                std::uint64_t& in_quote) {
+  const __m128i prefix = _mm_clmulepi64_si128(
+      _mm_set_epi64x(0, static_cast<std::int64_t>(quotes)),
+      _mm_set1_epi8(static_cast<char>(0xFF)), 0);
+  const std::uint64_t mask =
+      static_cast<std::uint64_t>(_mm_cvtsi128_si64(prefix)) ^ in_quote;
+  // Carry the state into the next block: all ones if still inside quotes
+  in_quote = static_cast<std::uint64_t>(static_cast<std::int64_t>(mask) >> 63);
+  return mask;
+}
+
+// Yields the positions of unquoted delimiters and newlines in [begin, end)
+class structural_iterator {
+public:
+  structural_iterator(const char* data, std::size_t begin, std::size_t end,
+                      char delimiter, bool in_quote) noexcept
+      : data_(data), end_(end), delimiter_(delimiter), block_(begin),
+        in_quote_(in_quote ? ~std::uint64_t{0} : 0) {
+    load();
+  }
+
+  // Next structural position, or end() when exhausted
+  FRANKLIN_FORCE_INLINE std::size_t next() noexcept {
+    while (bits_ == 0) {
+      block_ += 64;
+      if (block_ >= end_) {
+        return end_;
+      }
+      load();
+    }
+    const std::size_t pos = block_ + std::countr_zero(bits_);
+    bits_ &= bits_ - 1;
+    return pos;
+  }
+
+  std::size_t end() const noexcept { return end_; }
+
+private:
+  void load() noexcept {
+    if (block_ >= end_) {
+      bits_ = 0;
+      return;
+    }
+    const block_bits bits = scan_block(data_, block_, end_, delimiter_);
+    const std::uint64_t quoted = quoted_mask(bits.quote, in_quote_);
+    bits_ = (bits.delimiter | bits.newline) & ~quoted;
+  }
+
+  const char* data_;
+  std::size_t end_;
+  char delimiter_;
+  std::size_t block_;
+  std::uint64_t in_quote_;
+  std::uint64_t bits_ = 0;
+};
+
+// Number of quote characters in [begin, end)
+inline std::size_t count_quotes(const char* data, std::size_t begin,
+                                std::size_t end, char delimiter) {
+  std::size_t count = 0;
+  for (std::size_t pos = begin; pos < end; pos += 64) {
+    count += std::popcount(scan_block(data, pos, end, delimiter).quote);
+  }
+  return count;
+}
+
+// Number of unquoted newlines in [begin, end), given the quote state at begin
+inline std::size_t count_rows(const char* data, std::size_t begin,
+                              std::size_t end, char delimiter, bool in_quote) {
+  std::uint64_t state = in_quote ? ~std::uint64_t{0} : 0;
+  std::size_t count = 0;
+  for (std::size_t pos = begin; pos < end; pos += 64) {
+    const block_bits bits = scan_block(data, pos, end, delimiter);
+    count += std::popcount(bits.newline & ~quoted_mask(bits.quote, state));
+  }
+  return count;
+}
+
+// ----------------------------------------------------------------------------
+// Number parsing
+// ----------------------------------------------------------------------------
+
+// Value of the decimal digits in [begin, end), at most 16 of them. Returns
+// false if any byte is not a digit. The 16-byte window ending at `end` is
+// converted in parallel: bytes before `begin` are forced to '0', then pairs,
+// quads and octets of digits are combined with multiply-adds.
+// `buffer_begin` bounds how far back the window may read.
+FRANKLIN_FORCE_INLINE bool parse_digits(const char* begin, const char* end,
+                                        const char* buffer_begin,
+                                        std::uint64_t& out) noexcept {
+  const auto n = static_cast<int>(end - begin);
+  __m128i window;
+  if (end - buffer_begin >= 16) {
+    window = _mm_loadu_si128(reinterpret_cast<const __m128i*>(end - 16));
+  } else {
+    alignas(16) char copy[16];
+    std::memset(copy, '0', sizeof(copy));
+    std::memcpy(copy + 16 - n, begin, static_cast<std::size_t>(n));
+    window = _mm_load_si128(reinterpret_cast<const __m128i*>(copy));
+  }
+
+  const __m128i index =
+      _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m128i keep = _mm_cmpgt_epi8(index, _mm_set1_epi8(15 - n));
+  window = _mm_blendv_epi8(_mm_set1_epi8('0'), window, keep);
+
+  // Bytes below '0' wrap around, so one unsigned compare checks both bounds
+  const __m128i digits = _mm_sub_epi8(window, _mm_set1_epi8('0'));
+  const __m128i nine = _mm_set1_epi8(9);
+  if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(digits, nine), nine)) !=
+      0xFFFF) {
+    return false;
+  }
+
+  const __m128i pairs =
+      _mm_maddubs_epi16(digits, _mm_set1_epi16(0x010A)); // d0 * 10 + d1
+  const __m128i quads =
+      _mm_madd_epi16(pairs, _mm_set1_epi32(0x00010064)); // p0 * 100 + p1
+  const __m128i packed = _mm_packus_epi32(quads, quads);
+  const __m128i octets =
+      _mm_madd_epi16(packed, _mm_set1_epi32(0x00012710)); // q0 * 10000 + q1
+  const auto high = static_cast<std::uint32_t>(_mm_cvtsi128_si32(octets));
+  const auto low =
+      static_cast<std::uint32_t>(_mm_extract_epi32(octets, 1));
+  out = std::uint64_t{high} * 100000000 + low;
+  return true;
+}
+
+inline bool parse_int32(const char* begin, const char* end,
+                        const char* buffer_begin, std::int32_t& out) {
+  bool negative = false;
+  if (begin != end && (*begin == '-' || *begin == '+')) {
+    negative = *begin == '-';
+    ++begin;
+  }
+  const std::ptrdiff_t n = end - begin;
+  if (n == 0) {
+    return false;
+  }
+  if (n > 16) {
+    // Leading zeros; rare enough for the scalar parser
+    auto [ptr, ec] = std::from_chars(begin - negative, end, out);
+    return ec == std::errc() && ptr == end;
+  }
+
+  std::uint64_t magnitude = 0;
+  if (!parse_digits(begin, end, buffer_begin, magnitude) ||
+      magnitude > std::uint64_t{2147483647} + negative) {
+    return false;
+  }
+  out = static_cast<std::int32_t>(negative ? 0 - magnitude : magnitude);
+  return true;
+}
+
+// Exactly representable powers of ten in binary32
+inline constexpr float kPow10f[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                    1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+// [sign] digits [. digits] [(e|E) [sign] digits]
+//
+// Fast path (Clinger): with a mantissa below 2^24 and a power of ten up to
+// 10^10 both operands are exact in binary32, so a single multiplication or
+// division is correctly rounded. That covers typical data ("1234.56",
+// "-0.125", "3e5"); everything else goes through std::from_chars.
+inline bool parse_float(const char* begin, const char* end,
+                        const char* buffer_begin, float& out) {
+  const char* const field = begin;
+  bool negative = false;
+  if (begin != end && (*begin == '-' || *begin == '+')) {
+    negative = *begin == '-';
+    ++begin;
+  }
+
+  const char* int_end = begin;
+  while (int_end != end && static_cast<unsigned>(*int_end - '0') < 10) {
+    ++int_end;
+  }
+  const char* frac_begin = int_end;
+  const char* frac_end = int_end;
+  if (frac_begin != end && *frac_begin == '.') {
+    ++frac_begin;
+    frac_end = frac_begin;
+    while (frac_end != end && static_cast<unsigned>(*frac_end - '0') < 10) {
+      ++frac_end;
+    }
+  }
+
+  int exponent = 0;
+  bool fast = int_end - begin + (frac_end - frac_begin) > 0 &&
+              int_end - begin <= 16 && frac_end - frac_begin <= 16;
+  if (frac_end != end) {
+    // Exponent (or garbage, which from_chars rejects)
+    fast = fast && (*frac_end == 'e' || *frac_end == 'E');
+    if (fast) {
+      auto [ptr, ec] = std::from_chars(
+          frac_end + 1 + (frac_end + 1 != end && frac_end[1] == '+'), end,
+          exponent);
+      fast = ec == std::errc() && ptr == end;
+    }
+  }
+
+  std::uint64_t whole = 0;
+  std::uint64_t fraction = 0;
+  if (fast && begin != int_end) {
+    fast = parse_digits(begin, int_end, buffer_begin, whole);
+  }
+  if (fast && frac_begin != frac_end) {
+    fast = parse_digits(frac_begin, frac_end, buffer_begin, fraction);
+  }
+
+  const auto frac_digits = static_cast<int>(frac_end - frac_begin);
+  exponent -= frac_digits;
+  std::uint64_t mantissa = whole;
+  if (fast) {
+    for (int i = 0; i < frac_digits && mantissa < (1u << 24); ++i) {
+      mantissa *= 10;
+    }
+    mantissa += fraction;
+  }
+
+  if (fast && mantissa < (1u << 24) && exponent >= -10 && exponent <= 10) {
+    float value = static_cast<float>(mantissa);
+    value = exponent < 0 ? value / kPow10f[-exponent]
+                         : value * kPow10f[exponent];
+    out = negative ? -value : value;
+    return true;
+  }
+
+  auto [ptr, ec] = std::from_chars(field + (*field == '+'), end, out);
+  return ec == std::errc() && ptr == end;
+}
+
+// ----------------------------------------------------------------------------
+// Chunked parsing
+// ----------------------------------------------------------------------------
+
+struct column_sink {
+  DataTypeEnum::Enum type;
+  void* data;
+};
+
+struct chunk_result {
+  std::vector<std::pair<std::size_t, std::size_t>> absent; // (column, row)
+  std::exception_ptr error;
+};
+
+[[noreturn]] inline void throw_row_error(std::size_t row, std::size_t column,
+                                         std::string_view what,
+                                         std::string_view field) {
+  throw std::runtime_error("CSV row " + std::to_string(row + 1) + ", column " +
+                           std::to_string(column + 1) + ": " +
+                           std::string(what) + " '" + std::string(field) + "'");
+}
+
+// Parse `num_rows` rows, the first of which starts at `pos` (outside quotes),
+// into the sinks from index `first_row` on
+inline void parse_rows(std::string_view text, std::size_t pos,
+                       std::size_t end, std::size_t first_row,
+                       std::size_t num_rows,
+                       const std::vector<column_sink>& sinks, char delimiter,
+                       chunk_result& result) {
+  const char* data = text.data();
+  structural_iterator it(data, pos, end, delimiter, false);
+  const std::size_t num_columns = sinks.size();
+
+  for (std::size_t row = first_row; row < first_row + num_rows; ++row) {
+    for (std::size_t col = 0; col < num_columns; ++col) {
+      const std::size_t sep = it.next();
+      const bool last = col + 1 == num_columns;
+      if (sep == end ? !last : (data[sep] == '\n') != last) {
+        throw_row_error(row, col, "wrong number of fields in row",
+                        std::string_view(data + pos, sep - pos));
+      }
+
+      const char* field_begin = data + pos;
+      const char* field_end = data + sep;
+      pos = sep + 1;
+      if (field_end != field_begin && field_end[-1] == '\r') {
+        --field_end;
+      }
+      if (field_end - field_begin >= 2 && *field_begin == '"' &&
+          field_end[-1] == '"') {
+        ++field_begin;
+        --field_end;
+      }
+      if (field_begin == field_end) {
+        result.absent.emplace_back(col, row);
+        continue;
+      }
+
+      const column_sink& sink = sinks[col];
+      bool ok = false;
+      switch (sink.type) {
+      case DataTypeEnum::Int32Default:
+        ok = parse_int32(field_begin, field_end, data,
+                         static_cast<std::int32_t*>(sink.data)[row]);
+        break;
+      case DataTypeEnum::Float32Default:
+        ok = parse_float(field_begin, field_end, data,
+                         static_cast<float*>(sink.data)[row]);
+        break;
+      default: {
+        float value = 0.0f;
+        ok = parse_float(field_begin, field_end, data, value);
+        static_cast<bf16*>(sink.data)[row] = bf16(value);
+        break;
+      }
+      }
+      if (!ok) {
+        throw_row_error(row, col, "invalid value",
+                        std::string_view(field_begin, field_end - field_begin));
+      }
+    }
+  }
+}
+
+// Column names of the header row starting at data[0]; `header_end` receives
+// the position of the newline ending it (quoted newlines do not count)
+inline std::vector<std::string> split_header(const char* data,
+                                             std::size_t size, char delimiter,
+                                             std::size_t& header_end) {
+  std::vector<std::string> names;
+  structural_iterator it(data, 0, size, delimiter, false);
+  std::size_t start = 0;
+  while (true) {
+    const std::size_t stop = it.next();
+    std::string_view name(data + start, stop - start);
+    if (!name.empty() && name.back() == '\r') {
+      name.remove_suffix(1);
+    }
+    if (name.size() >= 2 && name.front() == '"' && name.back() == '"') {
+      name = name.substr(1, name.size() - 2);
+    }
+    names.emplace_back(name);
+    if (stop == size || data[stop] == '\n') {
+      header_end = stop;
+      return names;
+    }
+    start = stop + 1;
+  }
+}
+
+} // namespace detail
+
+template <concepts::ColumnPolicy Policy>
+column_vector<Policy>& csv_table::get(std::string_view name) {
+  auto it = std::find(names.begin(), names.end(), name);
+  if (it == names.end()) {
+    throw std::runtime_error("No such column: " + std::string(name));
+  }
+  auto* column = std::get_if<column_vector<Policy>>(
+      &columns[static_cast<std::size_t>(it - names.begin())]);
+  if (column == nullptr) {
+    throw std::runtime_error("Type mismatch for column: " + std::string(name));
+  }
+  return *column;
+}
+
+inline csv_table read_csv_buffer(std::string_view text,
+                                 const std::vector<DataTypeEnum::Enum>& types,
+                                 const csv_options& options) {
+  const char* data = text.data();
+  const std::size_t num_columns = types.size();
+  if (num_columns == 0) {
+    throw std::runtime_error("CSV schema has no columns");
+  }
+
+  csv_table table;
+  std::size_t begin = 0;
+  if (options.has_header) {
+    table.names =
+        detail::split_header(data, text.size(), options.delimiter, begin);
+    if (table.names.size() != num_columns) {
+      throw std::runtime_error("CSV header has " +
+                               std::to_string(table.names.size()) +
+                               " columns, schema has " +
+                               std::to_string(num_columns));
+    }
+    begin = std::min(begin + 1, text.size());
+  } else {
+    for (std::size_t i = 0; i < num_columns; ++i) {
+      table.names.push_back("c" + std::to_string(i));
+    }
+  }
+
+  // The final newline terminates the last row rather than starting a new one
+  std::size_t end = text.size();
+  if (end > begin && data[end - 1] == '\n') {
+    --end;
+  }
+
+  // Split into chunks; chunk i owns the rows that start after an unquoted
+  // newline in [bounds[i], bounds[i + 1]) (chunk 0 also owns the first row)
+  std::size_t num_threads = options.num_threads;
+  if (num_threads == 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  num_threads = std::clamp<std::size_t>(
+      (end - begin) / std::max<std::size_t>(options.min_chunk_bytes, 1), 1,
+      num_threads);
+  std::vector<std::size_t> bounds(num_threads + 1);
+  for (std::size_t i = 0; i <= num_threads; ++i) {
+    bounds[i] = begin + (end - begin) * i / num_threads;
+  }
+
+  auto parallel_for = [num_threads](auto&& body) {
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads - 1);
+    for (std::size_t i = 1; i < num_threads; ++i) {
+      workers.emplace_back(body, i);
+    }
+    body(0);
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  };
+
+  // Pass 1: quote parity at each chunk start
+  std::vector<std::size_t> quotes(num_threads);
+  parallel_for([&](std::size_t i) {
+    quotes[i] = detail::count_quotes(data, bounds[i], bounds[i + 1],
+                                     options.delimiter);
+  });
+  std::vector<char> in_quote(num_threads, false);
+  for (std::size_t i = 1; i < num_threads; ++i) {
+    in_quote[i] = in_quote[i - 1] ^ (quotes[i - 1] & 1);
+  }
+
+  // Pass 2: rows per chunk, then each chunk's first row index
+  std::vector<std::size_t> rows(num_threads);
+  parallel_for([&](std::size_t i) {
+    rows[i] = detail::count_rows(data, bounds[i], bounds[i + 1],
+                                 options.delimiter, in_quote[i]);
+  });
+  if (end > begin) {
+    rows[0] += 1;
+  }
+  std::vector<std::size_t> first_row(num_threads, 0);
+  for (std::size_t i = 1; i < num_threads; ++i) {
+    first_row[i] = first_row[i - 1] + rows[i - 1];
+  }
+  table.num_rows = first_row.back() + rows.back();
+
+  std::vector<detail::column_sink> sinks;
+  table.columns.reserve(num_columns);
+  for (DataTypeEnum::Enum type : types) {
+    switch (type) {
+    case DataTypeEnum::Int32Default:
+      table.columns.emplace_back(
+          column_vector<Int32DefaultPolicy>(table.num_rows));
+      break;
+    case DataTypeEnum::Float32Default:
+      table.columns.emplace_back(
+          column_vector<Float32DefaultPolicy>(table.num_rows));
+      break;
+    case DataTypeEnum::BF16Default:
+      table.columns.emplace_back(
+          column_vector<BF16DefaultPolicy>(table.num_rows));
+      break;
+    default:
+      throw std::runtime_error("Unsupported CSV column type");
+    }
+    std::visit(
+        [&](auto& column) {
+          sinks.push_back({type, column.data().data()});
+        },
+        table.columns.back());
+  }
+
+  // Pass 3: parse. Rows never share a value slot, but they do share
+  // present_mask words, so absent fields are collected per chunk and applied
+  // afterwards.
+  std::vector<detail::chunk_result> results(num_threads);
+  parallel_for([&](std::size_t i) {
+    try {
+      std::size_t start = bounds[i];
+      if (i > 0) {
+        // Skip to the first row owned by this chunk
+        detail::structural_iterator it(data, bounds[i], end, options.delimiter,
+                                       in_quote[i]);
+        for (std::size_t pos = it.next(); pos < bounds[i + 1];
+             pos = it.next()) {
+          if (data[pos] == '\n') {
+            start = pos + 1;
+            break;
+          }
+        }
+      }
+      if (rows[i] != 0) {
+        detail::parse_rows(text, start, end, first_row[i], rows[i], sinks,
+                           options.delimiter, results[i]);
+      }
+    } catch (...) {
+      results[i].error = std::current_exception();
+    }
+  });
+
+  for (const detail::chunk_result& result : results) {
+    if (result.error) {
+      std::rethrow_exception(result.error);
+    }
+  }
+  for (const detail::chunk_result& result : results) {
+    for (auto [col, row] : result.absent) {
+      std::visit([row](auto& column) { column.present_mask().set(row, false); },
+                 table.columns[col]);
+    }
+  }
+  return table;
+}
+
+inline csv_table read_csv(const std::string& path,
+                          const std::vector<DataTypeEnum::Enum>& types,
+                          const csv_options& options) {
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot open " + path);
+  }
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Cannot stat " + path);
+  }
+  const auto size = static_cast<std::size_t>(st.st_size);
+  if (size == 0) {
+    ::close(fd);
+    return read_csv_buffer({}, types, options);
+  }
+
+  void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    throw std::runtime_error("Cannot map " + path);
+  }
+  ::madvise(mapped, size, MADV_SEQUENTIAL);
+
+  try {
+    csv_table table = read_csv_buffer(
+        std::string_view(static_cast<const char*>(mapped), size), types,
+        options);
+    ::munmap(mapped, size);
+    return table;
+  } catch (...) {
+    ::munmap(mapped, size);
+    throw;
+  }
+}
+
+} // namespace franklin::io
+
+#endif // FRANKLIN_IO_CSV_READER_HPP
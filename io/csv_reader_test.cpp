@@ -0,0 +1,250 @@
+#include "io/csv_reader.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace franklin::io {
+namespace {
+
+constexpr auto kInt = DataTypeEnum::Int32Default;
+constexpr auto kFloat = DataTypeEnum::Float32Default;
+constexpr auto kBF16 = DataTypeEnum::BF16Default;
+
+TEST(CsvReaderTest, ParsesTypedColumns) {
+  const std::string text = "id,price,weight\n"
+                           "1,2.5,0.5\n"
+                           "-42,-0.125,3\n"
+                           "2147483647,1e3,-2.0\n";
+  csv_table table = read_csv_buffer(text, {kInt, kFloat, kBF16});
+
+  ASSERT_EQ(table.num_rows, 3);
+  EXPECT_EQ(table.names, (std::vector<std::string>{"id", "price", "weight"}));
+
+  auto& id = table.get<Int32DefaultPolicy>("id");
+  EXPECT_EQ(id.data()[0], 1);
+  EXPECT_EQ(id.data()[1], -42);
+  EXPECT_EQ(id.data()[2], 2147483647);
+
+  auto& price = table.get<Float32DefaultPolicy>("price");
+  EXPECT_FLOAT_EQ(price.data()[0], 2.5f);
+  EXPECT_FLOAT_EQ(price.data()[1], -0.125f);
+  EXPECT_FLOAT_EQ(price.data()[2], 1000.0f);
+
+  auto& weight = table.get<BF16DefaultPolicy>("weight");
+  EXPECT_FLOAT_EQ(weight.data()[1].to_float(), 3.0f);
+  EXPECT_FLOAT_EQ(weight.data()[2].to_float(), -2.0f);
+
+  for (std::size_t row = 0; row < 3; ++row) {
+    EXPECT_TRUE(id.present_mask()[row]);
+  }
+  EXPECT_FALSE(id.present_mask()[3]); // padding
+
+  EXPECT_THROW(table.get<Int32DefaultPolicy>("price"), std::runtime_error);
+  EXPECT_THROW(table.get<Int32DefaultPolicy>("missing"), std::runtime_error);
+}
+
+TEST(CsvReaderTest, EmptyFieldsAreAbsent) {
+  const std::string text = "a,b\n"
+                           "1,\n"
+                           ",2.5\n"
+                           "\"\",\"\"\n"
+                           "4,5";
+  csv_table table = read_csv_buffer(text, {kInt, kFloat});
+  ASSERT_EQ(table.num_rows, 4);
+
+  auto& a = table.get<Int32DefaultPolicy>("a");
+  auto& b = table.get<Float32DefaultPolicy>("b");
+  EXPECT_TRUE(a.present_mask()[0]);
+  EXPECT_FALSE(b.present_mask()[0]);
+  EXPECT_FALSE(a.present_mask()[1]);
+  EXPECT_TRUE(b.present_mask()[1]);
+  EXPECT_FALSE(a.present_mask()[2]);
+  EXPECT_FALSE(b.present_mask()[2]);
+  EXPECT_EQ(a.data()[3], 4);
+  EXPECT_FLOAT_EQ(b.data()[3], 5.0f);
+
+  // Absent values do not contribute to reductions
+  EXPECT_EQ(a.sum(), 5);
+}
+
+TEST(CsvReaderTest, QuotesCrLfAndDelimiters) {
+  const std::string text = "\"x;y\";z\r\n"
+                           "\"7\";\"1.5\"\r\n"
+                           "8;2\r\n";
+  csv_options options;
+  options.delimiter = ';';
+  csv_table table = read_csv_buffer(text, {kInt, kFloat}, options);
+
+  ASSERT_EQ(table.num_rows, 2);
+  EXPECT_EQ(table.names[0], "x;y");
+  EXPECT_EQ(table.get<Int32DefaultPolicy>("x;y").data()[0], 7);
+  EXPECT_FLOAT_EQ(table.get<Float32DefaultPolicy>("z").data()[0], 1.5f);
+  EXPECT_FLOAT_EQ(table.get<Float32DefaultPolicy>("z").data()[1], 2.0f);
+}
+
+TEST(CsvReaderTest, NoHeader) {
+  csv_options options;
+  options.has_header = false;
+  csv_table table = read_csv_buffer("1,2\n3,4\n", {kInt, kInt}, options);
+  ASSERT_EQ(table.num_rows, 2);
+  EXPECT_EQ(table.get<Int32DefaultPolicy>("c1").data()[1], 4);
+
+  csv_table empty = read_csv_buffer("a,b\n", {kInt, kInt});
+  EXPECT_EQ(empty.num_rows, 0);
+}
+
+TEST(CsvReaderTest, NumberParsingEdgeCases) {
+  const std::string text = "i,f\n"
+                           "-2147483648,0.1\n"
+                           "+17,1.17549435e-38\n"
+                           "00000000000000000000123,3.4028235e38\n"
+                           "0,-1234567.0\n"
+                           "9999999999999999,16777217\n"
+                           "5,123456789.123\n"
+                           "5,nan\n";
+  // The int column overflows in row 5; parse it as float to reach the rest
+  csv_table table = read_csv_buffer(text, {kFloat, kFloat});
+  auto& f = table.get<Float32DefaultPolicy>("f");
+  auto& i = table.get<Float32DefaultPolicy>("i");
+  EXPECT_EQ(f.data()[0], 0.1f);
+  EXPECT_EQ(f.data()[1], 1.17549435e-38f);
+  EXPECT_EQ(f.data()[2], 3.4028235e38f);
+  EXPECT_EQ(f.data()[3], -1234567.0f);
+  EXPECT_EQ(f.data()[4], 16777216.0f); // round to nearest even
+  EXPECT_EQ(f.data()[5], 123456789.123f);
+  EXPECT_TRUE(std::isnan(f.data()[6]));
+  EXPECT_EQ(i.data()[0], -2147483648.0f);
+  EXPECT_EQ(i.data()[2], 123.0f);
+
+  csv_table ints = read_csv_buffer(
+      "i\n-2147483648\n+17\n000000000000000000123\n", {kInt});
+  auto& column = ints.get<Int32DefaultPolicy>("i");
+  EXPECT_EQ(column.data()[0], std::numeric_limits<std::int32_t>::min());
+  EXPECT_EQ(column.data()[1], 17);
+  EXPECT_EQ(column.data()[2], 123);
+}
+
+TEST(CsvReaderTest, FloatFastPathMatchesFromChars) {
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> mantissa(-9999999, 9999999);
+  std::uniform_int_distribution<int> scale(0, 9);
+
+  std::ostringstream text;
+  std::vector<std::string> fields;
+  text << "f\n";
+  for (int row = 0; row < 5000; ++row) {
+    std::string field = std::to_string(mantissa(rng));
+    const int digits = scale(rng);
+    const std::size_t sign = field[0] == '-';
+    if (digits > 0) {
+      while (field.size() - sign <= static_cast<std::size_t>(digits)) {
+        field.insert(sign, "0");
+      }
+      field.insert(field.size() - digits, ".");
+    }
+    fields.push_back(field);
+    text << field << "\n";
+  }
+
+  csv_table table = read_csv_buffer(text.str(), {kFloat});
+  auto& column = table.get<Float32DefaultPolicy>("f");
+  for (std::size_t row = 0; row < fields.size(); ++row) {
+    float expected = 0.0f;
+    std::from_chars(fields[row].data(), fields[row].data() + fields[row].size(),
+                    expected);
+    ASSERT_EQ(column.data()[row], expected) << fields[row];
+  }
+}
+
+TEST(CsvReaderTest, ReportsMalformedInput) {
+  EXPECT_THROW(read_csv_buffer("a,b\n1,2,3\n", {kInt, kInt}),
+               std::runtime_error);
+  EXPECT_THROW(read_csv_buffer("a,b\n1\n", {kInt, kInt}), std::runtime_error);
+  EXPECT_THROW(read_csv_buffer("a\n12x\n", {kInt}), std::runtime_error);
+  EXPECT_THROW(read_csv_buffer("a\n2147483648\n", {kInt}), std::runtime_error);
+  EXPECT_THROW(read_csv_buffer("a\n1.5.2\n", {kFloat}), std::runtime_error);
+  EXPECT_THROW(read_csv_buffer("a,b\n1,2\n", {kInt}), std::runtime_error);
+
+  try {
+    read_csv_buffer("a\n1\n2\nthree\n", {kInt});
+    FAIL() << "expected an exception";
+  } catch (const std::runtime_error& e) {
+    EXPECT_NE(std::string(e.what()).find("row 3"), std::string::npos)
+        << e.what();
+  }
+}
+
+// Many small chunks, with quoted newlines and delimiters straddling chunk
+// boundaries, must give the same table as a single-threaded parse
+TEST(CsvReaderTest, MultiThreadedMatchesSingleThreaded) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> value(-100000, 100000);
+  std::uniform_int_distribution<int> shape(0, 9);
+
+  std::ostringstream text;
+  text << "\"first\nname\",second,third\n";
+  for (int row = 0; row < 20000; ++row) {
+    const int kind = shape(rng);
+    if (kind == 0) {
+      text << ",";
+    } else if (kind == 1) {
+      text << "\"" << value(rng) << "\",";
+    } else {
+      text << value(rng) << ",";
+    }
+    text << value(rng) / 8.0 << ",";
+    text << (kind == 2 ? "" : std::to_string(value(rng) % 100)) << "\n";
+  }
+
+  csv_options single;
+  single.num_threads = 1;
+  csv_options parallel;
+  parallel.num_threads = 7;
+  parallel.min_chunk_bytes = 1000;
+
+  const std::vector<DataTypeEnum::Enum> types = {kInt, kFloat, kBF16};
+  csv_table expected = read_csv_buffer(text.str(), types, single);
+  csv_table actual = read_csv_buffer(text.str(), types, parallel);
+
+  ASSERT_EQ(expected.num_rows, 20000);
+  ASSERT_EQ(actual.num_rows, expected.num_rows);
+  EXPECT_EQ(actual.names[0], "first\nname");
+
+  auto& e0 = expected.get<Int32DefaultPolicy>("first\nname");
+  auto& a0 = actual.get<Int32DefaultPolicy>("first\nname");
+  auto& e1 = expected.get<Float32DefaultPolicy>("second");
+  auto& a1 = actual.get<Float32DefaultPolicy>("second");
+  auto& e2 = expected.get<BF16DefaultPolicy>("third");
+  auto& a2 = actual.get<BF16DefaultPolicy>("third");
+  for (std::size_t row = 0; row < expected.num_rows; ++row) {
+    ASSERT_EQ(a0.present_mask()[row], e0.present_mask()[row]) << row;
+    ASSERT_EQ(a2.present_mask()[row], e2.present_mask()[row]) << row;
+    if (e0.present_mask()[row]) {
+      ASSERT_EQ(a0.data()[row], e0.data()[row]) << row;
+    }
+    ASSERT_EQ(a1.data()[row], e1.data()[row]) << row;
+    ASSERT_EQ(a2.data()[row].to_bits(), e2.data()[row].to_bits()) << row;
+  }
+}
+
+TEST(CsvReaderTest, ReadsFiles) {
+  const std::string path = ::testing::TempDir() + "csv_reader_test.csv";
+  std::ofstream(path, std::ios::trunc) << "x,y\n1,2\n3,\n";
+
+  csv_table table = read_csv(path, {kInt, kInt});
+  std::remove(path.c_str());
+
+  ASSERT_EQ(table.num_rows, 2);
+  EXPECT_EQ(table.get<Int32DefaultPolicy>("x").data()[1], 3);
+  EXPECT_FALSE(table.get<Int32DefaultPolicy>("y").present_mask()[1]);
+
+  EXPECT_THROW(read_csv(path, {kInt, kInt}), std::runtime_error);
+}
+
+} // namespace
+} // namespace franklin::io
@@ -0,0 +1,262 @@
+#ifndef FRANKLIN_IO_IO_URING_HPP
+#define FRANKLIN_IO_IO_URING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace franklin::io {
+
+// Minimal io_uring submission/completion queue pair for file reads.
+//
+// Talks to the kernel through the raw io_uring_setup/io_uring_enter system
+// calls and the shared ring mappings, so there is no liburing dependency.
+// Only what the loaders need is exposed: queue reads, submit, reap
+// completions. Not thread-safe; one owner drives the ring.
+class io_uring_queue {
+public:
+  struct completion {
+    std::uint64_t user_data;
+    std::int32_t result; // bytes transferred, or -errno
+  };
+
+  // A ring with room for `entries` reads in flight, or nullptr when the
+  // kernel does not provide io_uring (or forbids it, e.g. under seccomp) or
+  // predates IORING_OP_READ (Linux 5.6)
+  static std::unique_ptr<io_uring_queue> try_create(unsigned entries);
+
+  ~io_uring_queue();
+
+  io_uring_queue(const io_uring_queue&) = delete;
+  io_uring_queue& operator=(const io_uring_queue&) = delete;
+
+  // Queue a read of `length` bytes at `offset` into `buffer`; false if the
+  // submission ring is full. Nothing reaches the kernel before submit().
+  bool prepare_read(int fd, void* buffer, std::uint32_t length,
+                    std::uint64_t offset, std::uint64_t user_data) noexcept;
+
+  // Hand queued reads to the kernel; with `wait`, also block until at least
+  // one completion is available
+  void submit(bool wait = false);
+
+  // Pop a completion if one is available
+  bool pop(completion& out) noexcept;
+
+  // Pop a completion, blocking until one is available
+  completion wait();
+
+private:
+  io_uring_queue() = default;
+
+  // Whether the kernel implements `opcode`
+  bool supports(unsigned opcode) const noexcept;
+
+  int fd_ = -1;
+  unsigned pending_ = 0; // prepared, not yet submitted
+
+  void* sq_ring_ = MAP_FAILED;
+  std::size_t sq_ring_size_ = 0;
+  void* cq_ring_ = MAP_FAILED;
+  std::size_t cq_ring_size_ = 0;
+  io_uring_sqe* sqes_ = static_cast<io_uring_sqe*>(MAP_FAILED);
+  std::size_t sqes_size_ = 0;
+
+  unsigned* sq_head_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned sq_entries_ = 0;
+  unsigned* sq_array_ = nullptr;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  io_uring_cqe* cqes_ = nullptr;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+namespace detail {
+
+inline unsigned load_acquire(unsigned* p) noexcept {
+  return std::atomic_ref<unsigned>(*p).load(std::memory_order_acquire);
+}
+
+inline void store_release(unsigned* p, unsigned value) noexcept {
+  std::atomic_ref<unsigned>(*p).store(value, std::memory_order_release);
+}
+
+template <typename T> T* ring_field(void* ring, std::uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+
+} // namespace detail
+
+inline std::unique_ptr<io_uring_queue>
+io_uring_queue::try_create(unsigned entries) {
+  io_uring_params params{};
+  const long fd = ::syscall(__NR_io_uring_setup, entries, &params);
+  if (fd < 0) {
+    return nullptr;
+  }
+  std::unique_ptr<io_uring_queue> queue(new io_uring_queue());
+  queue->fd_ = static_cast<int>(fd);
+  // Kernels before 5.6 set up rings but fail every IORING_OP_READ with
+  // -EINVAL in its completion
+  if (!queue->supports(IORING_OP_READ)) {
+    return nullptr;
+  }
+
+  queue->sq_ring_size_ =
+      params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  queue->cq_ring_size_ =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap) {
+    queue->sq_ring_size_ =
+        std::max(queue->sq_ring_size_, queue->cq_ring_size_);
+  }
+  queue->sq_ring_ =
+      ::mmap(nullptr, queue->sq_ring_size_, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, queue->fd_, IORING_OFF_SQ_RING);
+  if (queue->sq_ring_ == MAP_FAILED) {
+    return nullptr;
+  }
+  if (single_mmap) {
+    queue->cq_ring_ = queue->sq_ring_;
+  } else {
+    queue->cq_ring_ =
+        ::mmap(nullptr, queue->cq_ring_size_, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE, queue->fd_, IORING_OFF_CQ_RING);
+    if (queue->cq_ring_ == MAP_FAILED) {
+      return nullptr;
+    }
+  }
+  queue->sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+  queue->sqes_ = static_cast<io_uring_sqe*>(
+      ::mmap(nullptr, queue->sqes_size_, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, queue->fd_, IORING_OFF_SQES));
+  if (queue->sqes_ == MAP_FAILED) {
+    return nullptr;
+  }
+
+  void* sq = queue->sq_ring_;
+  void* cq = queue->cq_ring_;
+  queue->sq_head_ = detail::ring_field<unsigned>(sq, params.sq_off.head);
+  queue->sq_tail_ = detail::ring_field<unsigned>(sq, params.sq_off.tail);
+  queue->sq_mask_ =
+      *detail::ring_field<unsigned>(sq, params.sq_off.ring_mask);
+  queue->sq_entries_ = params.sq_entries;
+  queue->sq_array_ = detail::ring_field<unsigned>(sq, params.sq_off.array);
+  queue->cq_head_ = detail::ring_field<unsigned>(cq, params.cq_off.head);
+  queue->cq_tail_ = detail::ring_field<unsigned>(cq, params.cq_off.tail);
+  queue->cq_mask_ =
+      *detail::ring_field<unsigned>(cq, params.cq_off.ring_mask);
+  queue->cqes_ = detail::ring_field<io_uring_cqe>(cq, params.cq_off.cqes);
+  return queue;
+}
+
+inline bool io_uring_queue::supports(unsigned opcode) const noexcept {
+  // IORING_REGISTER_PROBE arrived with IORING_OP_READ, so an older kernel
+  // rejects the probe itself
+  constexpr unsigned max_ops = 256;
+  alignas(io_uring_probe) std::byte
+      storage[sizeof(io_uring_probe) + max_ops * sizeof(io_uring_probe_op)]{};
+  auto* probe = reinterpret_cast<io_uring_probe*>(storage);
+  if (::syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PROBE, probe,
+                max_ops) < 0) {
+    return false;
+  }
+  return opcode <= probe->last_op && opcode < probe->ops_len &&
+         (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED) != 0;
+}
+
+inline io_uring_queue::~io_uring_queue() {
+  if (sqes_ != MAP_FAILED) {
+    ::munmap(sqes_, sqes_size_);
+  }
+  if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_) {
+    ::munmap(cq_ring_, cq_ring_size_);
+  }
+  if (sq_ring_ != MAP_FAILED) {
+    ::munmap(sq_ring_, sq_ring_size_);
+  }
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+}
+
+inline bool io_uring_queue::prepare_read(int fd, void* buffer,
+                                         std::uint32_t length,
+                                         std::uint64_t offset,
+                                         std::uint64_t user_data) noexcept {
+  const unsigned tail = *sq_tail_; // only this thread writes the tail
+  if (tail - detail::load_acquire(sq_head_) >= sq_entries_) {
+    return false;
+  }
+  const unsigned index = tail & sq_mask_;
+  io_uring_sqe& sqe = sqes_[index];
+  std::memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = IORING_OP_READ;
+  sqe.fd = fd;
+  sqe.addr = reinterpret_cast<std::uint64_t>(buffer);
+  sqe.len = length;
+  sqe.off = offset;
+  sqe.user_data = user_data;
+  sq_array_[index] = index;
+  detail::store_release(sq_tail_, tail + 1);
+  ++pending_;
+  return true;
+}
+
+inline void io_uring_queue::submit(bool wait) {
+  while (true) {
+    const unsigned flags = wait ? IORING_ENTER_GETEVENTS : 0;
+    const long submitted = ::syscall(__NR_io_uring_enter, fd_, pending_,
+                                     wait ? 1u : 0u, flags, nullptr, 0);
+    if (submitted < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::runtime_error(std::string("io_uring_enter failed: ") +
+                               std::strerror(errno));
+    }
+    pending_ -= static_cast<unsigned>(submitted);
+    if (pending_ == 0 || submitted == 0) {
+      return;
+    }
+  }
+}
+
+inline bool io_uring_queue::pop(completion& out) noexcept {
+  const unsigned head = *cq_head_; // only this thread writes the head
+  if (head == detail::load_acquire(cq_tail_)) {
+    return false;
+  }
+  const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+  out = {cqe.user_data, cqe.res};
+  detail::store_release(cq_head_, head + 1);
+  return true;
+}
+
+inline io_uring_queue::completion io_uring_queue::wait() {
+  completion out;
+  while (!pop(out)) {
+    submit(true);
+  }
+  return out;
+}
+
+} // namespace franklin::io
+
+#endif // FRANKLIN_IO_IO_URING_HPP
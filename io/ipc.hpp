@@ -0,0 +1,485 @@
+#ifndef FRANKLIN_IO_IPC_HPP
+#define FRANKLIN_IO_IPC_HPP
+
+#include "container/column.hpp"
+#include "io/column_view.hpp"
+#include "memory/aligned_allocator.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <vector>
+
+namespace franklin::io {
+
+// Binary IPC format for streaming record batches between processes.
+//
+// A stream is a sequence of messages, each of which is
+//
+//   [message header, 64 B][column header, 64 B each][body]
+//
+// The message header holds a magic number, the format version, the message
+// kind (record batch or end of stream), the column count, the row count and
+// the body size. A column header holds the column's name, its DataTypeEnum
+// type, value size, scale (Decimal64 only) and length, and the body offsets
+// of its validity bitmap (64-bit words, dynamic_bitset layout) and its
+// values. Every body section starts on a 64-byte boundary, so a message
+// received into a 64-byte aligned buffer can be used in place, without
+// copies. Integers are in host byte order; the format is meant for local
+// services, not for storage.
+//
+// record_batch_writer gathers the headers and the columns' own buffers into
+// one writev() per batch; record_batch_reader receives a batch into a
+// reusable aligned buffer and hands out column_views over it.
+
+namespace detail {
+
+inline constexpr std::uint32_t ipc_magic = 0x43504946; // "FIPC"
+inline constexpr std::uint16_t ipc_version = 2;
+inline constexpr std::size_t ipc_name_size = 32;
+inline constexpr std::size_t ipc_alignment = 64;
+
+enum class ipc_kind : std::uint16_t { batch = 1, end = 2 };
+
+struct ipc_message_header {
+  std::uint32_t magic;
+  std::uint16_t version;
+  std::uint16_t kind; // ipc_kind
+  std::uint32_t columns;
+  std::uint32_t reserved;
+  std::uint64_t rows;
+  std::uint64_t body_bytes;
+  std::uint8_t padding[32];
+};
+
+struct ipc_column_header {
+  char name[ipc_name_size]; // NUL-terminated
+  std::uint16_t type;       // DataTypeEnum::Enum
+  std::uint16_t value_size;
+  std::uint32_t scale; // Decimal64 fractional digits, 0 for other types
+  std::uint64_t length;
+  std::uint64_t validity_offset; // in the body
+  std::uint64_t data_offset;     // in the body
+};
+
+static_assert(sizeof(ipc_message_header) == ipc_alignment);
+static_assert(sizeof(ipc_column_header) == ipc_alignment);
+
+inline constexpr std::size_t ipc_align(std::size_t bytes) noexcept {
+  return (bytes + ipc_alignment - 1) & ~(ipc_alignment - 1);
+}
+
+inline std::size_t ipc_validity_bytes(std::size_t rows) noexcept {
+  return ((rows + 63) >> 6) * sizeof(std::uint64_t);
+}
+
+} // namespace detail
+
+// Record batch parsed from a message buffer; column views point into the
+// buffer, which must outlive them
+class record_batch_view {
+public:
+  record_batch_view() noexcept = default;
+
+  // Parse the message at the start of `message`, which must be 64-byte
+  // aligned. Throws on a malformed or truncated message.
+  static record_batch_view parse(std::span<const std::byte> message);
+
+  // Bytes of the message, header included
+  std::size_t bytes() const noexcept { return bytes_; }
+  bool end_of_stream() const noexcept { return end_; }
+
+  std::size_t rows() const noexcept { return rows_; }
+  std::size_t columns() const noexcept { return columns_; }
+  std::string_view name(std::size_t column) const noexcept {
+    return column_header(column).name;
+  }
+  DataTypeEnum::Enum type(std::size_t column) const noexcept {
+    return static_cast<DataTypeEnum::Enum>(column_header(column).type);
+  }
+
+  // Throw if the column is not of Policy's type
+  template <concepts::ColumnPolicy Policy>
+  column_view<Policy> column(std::size_t column) const;
+  template <concepts::ColumnPolicy Policy>
+  column_view<Policy> column(std::string_view name) const;
+
+private:
+  const detail::ipc_column_header&
+  column_header(std::size_t column) const noexcept {
+    return reinterpret_cast<const detail::ipc_column_header*>(
+        base_ + sizeof(detail::ipc_message_header))[column];
+  }
+
+  const std::byte* base_ = nullptr;
+  const std::byte* body_ = nullptr;
+  std::size_t bytes_ = 0;
+  std::size_t rows_ = 0;
+  std::size_t columns_ = 0;
+  bool end_ = false;
+};
+
+// Writes record batches to a file descriptor (pipe, socket, file).
+//
+// Columns are referenced, not copied: add() records where a column's buffers
+// are, and write() sends them with the headers in a single gathered write.
+// The columns must stay alive and unchanged until write() returns.
+class record_batch_writer {
+public:
+  explicit record_batch_writer(int fd) noexcept : fd_(fd) {}
+
+  // Add a column to the batch being built
+  template <concepts::ColumnPolicy Policy>
+  void add(std::string_view name, const column_vector<Policy>& column);
+
+  // Send the first `rows` rows of every added column as one record batch
+  void write(std::size_t rows);
+
+  // Send the end-of-stream message
+  void finish();
+
+  std::uint64_t bytes_written() const noexcept { return bytes_written_; }
+
+private:
+  struct pending_column {
+    detail::ipc_column_header header;
+    const void* validity;
+    std::size_t validity_capacity; // bytes
+    const void* data;
+    std::size_t data_capacity; // bytes
+  };
+
+  void send(std::vector<iovec>& iov);
+
+  int fd_;
+  std::vector<pending_column> columns_;
+  std::vector<detail::ipc_column_header> headers_;
+  std::uint64_t bytes_written_ = 0;
+};
+
+// Reads record batches from a file descriptor into a reusable 64-byte
+// aligned receive buffer. Messages larger than `max_message_bytes` are
+// rejected before anything is allocated for them, since their sizes come
+// from the peer.
+class record_batch_reader {
+public:
+  static constexpr std::size_t default_max_message_bytes =
+      std::size_t{1} << 30;
+
+  explicit record_batch_reader(
+      int fd,
+      std::size_t max_message_bytes = default_max_message_bytes) noexcept
+      : fd_(fd), max_message_bytes_(max_message_bytes) {}
+
+  // Receive the next batch; false at the end-of-stream message. Views of the
+  // previous batch are invalidated. Throws if the stream ends without an
+  // end-of-stream message, or on a message over the size limit.
+  bool next();
+
+  const record_batch_view& batch() const noexcept { return batch_; }
+  std::uint64_t bytes_read() const noexcept { return bytes_read_; }
+
+private:
+  // Read exactly `size` bytes; false on end of file before the first byte
+  bool read_exact(std::byte* dst, std::size_t size);
+
+  int fd_;
+  std::size_t max_message_bytes_;
+  std::vector<std::byte, memory::aligned_allocator<std::byte, 64>> buffer_;
+  record_batch_view batch_;
+  std::uint64_t bytes_read_ = 0;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+inline record_batch_view
+record_batch_view::parse(std::span<const std::byte> message) {
+  using detail::ipc_column_header;
+  using detail::ipc_message_header;
+  if (reinterpret_cast<std::uintptr_t>(message.data()) %
+          detail::ipc_alignment !=
+      0) {
+    throw std::runtime_error("IPC message buffer is not 64-byte aligned");
+  }
+  if (message.size() < sizeof(ipc_message_header)) {
+    throw std::runtime_error("IPC message truncated");
+  }
+  ipc_message_header header;
+  std::memcpy(&header, message.data(), sizeof(header));
+  if (header.magic != detail::ipc_magic) {
+    throw std::runtime_error("Not an IPC message");
+  }
+  if (header.version != detail::ipc_version) {
+    throw std::runtime_error("Unsupported IPC version " +
+                             std::to_string(header.version));
+  }
+
+  record_batch_view view;
+  view.base_ = message.data();
+  if (header.kind == static_cast<std::uint16_t>(detail::ipc_kind::end)) {
+    view.end_ = true;
+    view.bytes_ = sizeof(header);
+    return view;
+  }
+  if (header.kind != static_cast<std::uint16_t>(detail::ipc_kind::batch)) {
+    throw std::runtime_error("Unknown IPC message kind");
+  }
+
+  const std::size_t available = message.size() - sizeof(header);
+  if (header.columns > available / sizeof(ipc_column_header) ||
+      header.body_bytes >
+          available - header.columns * sizeof(ipc_column_header)) {
+    throw std::runtime_error("IPC message truncated");
+  }
+  view.columns_ = header.columns;
+  view.rows_ = static_cast<std::size_t>(header.rows);
+  view.body_ = message.data() + sizeof(header) +
+               header.columns * sizeof(ipc_column_header);
+  view.bytes_ = sizeof(header) + header.columns * sizeof(ipc_column_header) +
+                static_cast<std::size_t>(header.body_bytes);
+
+  // Every section must lie inside the body, so views never read past it
+  const std::uint64_t body = header.body_bytes;
+  auto fits = [body](std::uint64_t offset, std::uint64_t count,
+                     std::uint64_t size) {
+    return offset % detail::ipc_alignment == 0 && offset <= body &&
+           (size == 0 || count <= (body - offset) / size);
+  };
+  for (std::size_t c = 0; c < view.columns_; ++c) {
+    const ipc_column_header& column = view.column_header(c);
+    if (std::memchr(column.name, 0, detail::ipc_name_size) == nullptr ||
+        column.length != header.rows ||
+        !fits(column.validity_offset, (column.length + 63) / 64,
+              sizeof(std::uint64_t)) ||
+        !fits(column.data_offset, column.length, column.value_size)) {
+      throw std::runtime_error("Malformed IPC column header");
+    }
+  }
+  return view;
+}
+
+template <concepts::ColumnPolicy Policy>
+column_view<Policy> record_batch_view::column(std::size_t column) const {
+  using value_type = typename Policy::value_type;
+  const detail::ipc_column_header& header = column_header(column);
+  if (header.type != Policy::policy_id ||
+      header.value_size != sizeof(value_type)) {
+    throw std::runtime_error(
+        "IPC column " + std::string(header.name) + " holds " +
+        std::string(DataTypeEnum::to_string(type(column))) + ", not " +
+        std::string(DataTypeEnum::to_string(Policy::policy_id)));
+  }
+  if (header.scale != column_scale<Policy>()) {
+    throw std::runtime_error("IPC column " + std::string(header.name) +
+                             " has scale " + std::to_string(header.scale) +
+                             ", not " + std::to_string(column_scale<Policy>()));
+  }
+  return column_view<Policy>(
+      reinterpret_cast<const value_type*>(body_ + header.data_offset),
+      reinterpret_cast<const std::uint64_t*>(body_ + header.validity_offset),
+      rows_);
+}
+
+template <concepts::ColumnPolicy Policy>
+column_view<Policy> record_batch_view::column(std::string_view name) const {
+  for (std::size_t c = 0; c < columns_; ++c) {
+    if (this->name(c) == name) {
+      return column<Policy>(c);
+    }
+  }
+  throw std::runtime_error("No IPC column named " + std::string(name));
+}
+
+template <concepts::ColumnPolicy Policy>
+void record_batch_writer::add(std::string_view name,
+                              const column_vector<Policy>& column) {
+  using value_type = typename Policy::value_type;
+  if (name.empty() || name.size() >= detail::ipc_name_size) {
+    throw std::runtime_error("IPC column name must have 1 to " +
+                             std::to_string(detail::ipc_name_size - 1) +
+                             " characters");
+  }
+  pending_column pending{};
+  std::memcpy(pending.header.name, name.data(), name.size());
+  pending.header.type = Policy::policy_id;
+  pending.header.value_size = sizeof(value_type);
+  pending.header.scale = column_scale<Policy>();
+  const auto& blocks = column.present_mask().blocks();
+  pending.validity = blocks.data();
+  pending.validity_capacity = blocks.size() * sizeof(std::uint64_t);
+  pending.data = column.data().data();
+  pending.data_capacity = column.data().size() * sizeof(value_type);
+  columns_.push_back(pending);
+}
+
+inline void record_batch_writer::write(std::size_t rows) {
+  // Zeros for padding sections out to 64-byte boundaries
+  alignas(64) static constexpr std::byte zeros[detail::ipc_alignment] = {};
+
+  std::vector<iovec> iov;
+  iov.reserve(1 + 4 * columns_.size());
+  iov.push_back({}); // headers, filled in below
+
+  headers_.clear();
+  std::uint64_t body = 0;
+  auto section = [&](const void* data, std::size_t bytes) {
+    if (bytes > 0) {
+      iov.push_back({const_cast<void*>(data), bytes});
+    }
+    const std::size_t pad = detail::ipc_align(bytes) - bytes;
+    if (pad > 0) {
+      iov.push_back({const_cast<std::byte*>(zeros), pad});
+    }
+    body += bytes + pad;
+  };
+  for (pending_column& column : columns_) {
+    const std::size_t validity = detail::ipc_validity_bytes(rows);
+    const std::size_t data = rows * column.header.value_size;
+    if (validity > column.validity_capacity || data > column.data_capacity) {
+      columns_.clear();
+      throw std::runtime_error("IPC column " +
+                               std::string(column.header.name) +
+                               " has fewer than " + std::to_string(rows) +
+                               " rows");
+    }
+    column.header.length = rows;
+    column.header.validity_offset = body;
+    section(column.validity, validity);
+    column.header.data_offset = body;
+    section(column.data, data);
+    headers_.push_back(column.header);
+  }
+
+  // Message and column headers are contiguous: one staging buffer
+  std::vector<std::byte> staging(sizeof(detail::ipc_message_header) +
+                                 headers_.size() *
+                                     sizeof(detail::ipc_column_header));
+  detail::ipc_message_header header{};
+  header.magic = detail::ipc_magic;
+  header.version = detail::ipc_version;
+  header.kind = static_cast<std::uint16_t>(detail::ipc_kind::batch);
+  header.columns = static_cast<std::uint32_t>(headers_.size());
+  header.rows = rows;
+  header.body_bytes = body;
+  std::memcpy(staging.data(), &header, sizeof(header));
+  if (!headers_.empty()) {
+    std::memcpy(staging.data() + sizeof(header), headers_.data(),
+                headers_.size() * sizeof(detail::ipc_column_header));
+  }
+  iov[0] = {staging.data(), staging.size()};
+
+  columns_.clear();
+  send(iov);
+}
+
+inline void record_batch_writer::finish() {
+  detail::ipc_message_header header{};
+  header.magic = detail::ipc_magic;
+  header.version = detail::ipc_version;
+  header.kind = static_cast<std::uint16_t>(detail::ipc_kind::end);
+  std::vector<iovec> iov{{&header, sizeof(header)}};
+  send(iov);
+}
+
+inline void record_batch_writer::send(std::vector<iovec>& iov) {
+  std::size_t first = 0;
+  while (first < iov.size()) {
+    const int count =
+        static_cast<int>(std::min<std::size_t>(iov.size() - first, IOV_MAX));
+    const ssize_t n = ::writev(fd_, iov.data() + first, count);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::runtime_error(std::string("IPC write failed: ") +
+                               std::strerror(errno));
+    }
+    bytes_written_ += static_cast<std::uint64_t>(n);
+    // Skip what was written; a partial write resumes mid-section
+    auto left = static_cast<std::size_t>(n);
+    while (first < iov.size() && left >= iov[first].iov_len) {
+      left -= iov[first].iov_len;
+      ++first;
+    }
+    if (left > 0) {
+      iov[first].iov_base = static_cast<std::byte*>(iov[first].iov_base) + left;
+      iov[first].iov_len -= left;
+    }
+  }
+}
+
+inline bool record_batch_reader::read_exact(std::byte* dst, std::size_t size) {
+  std::size_t got = 0;
+  while (got < size) {
+    const ssize_t n = ::read(fd_, dst + got, size - got);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::runtime_error(std::string("IPC read failed: ") +
+                               std::strerror(errno));
+    }
+    if (n == 0) {
+      if (got == 0) {
+        return false;
+      }
+      throw std::runtime_error("IPC stream truncated");
+    }
+    got += static_cast<std::size_t>(n);
+  }
+  bytes_read_ += size;
+  return true;
+}
+
+inline bool record_batch_reader::next() {
+  using detail::ipc_column_header;
+  using detail::ipc_message_header;
+  if (batch_.end_of_stream()) {
+    return false;
+  }
+  batch_ = record_batch_view();
+  buffer_.resize(sizeof(ipc_message_header));
+  if (!read_exact(buffer_.data(), sizeof(ipc_message_header))) {
+    throw std::runtime_error("IPC stream ended without end-of-stream message");
+  }
+  ipc_message_header header;
+  std::memcpy(&header, buffer_.data(), sizeof(header));
+  if (header.magic != detail::ipc_magic) {
+    throw std::runtime_error("Not an IPC message");
+  }
+  if (header.kind == static_cast<std::uint16_t>(detail::ipc_kind::batch)) {
+    // Each step is bounded by the limit, so none of the sums can wrap
+    std::size_t room = max_message_bytes_ - std::min(max_message_bytes_,
+                                                     sizeof(header));
+    if (header.columns > room / sizeof(ipc_column_header)) {
+      throw std::runtime_error("IPC message exceeds the size limit");
+    }
+    room -= header.columns * sizeof(ipc_column_header);
+    if (header.body_bytes > room) {
+      throw std::runtime_error("IPC message exceeds the size limit");
+    }
+    const std::size_t bytes = sizeof(header) +
+                              header.columns * sizeof(ipc_column_header) +
+                              static_cast<std::size_t>(header.body_bytes);
+    buffer_.resize(bytes);
+    if (!read_exact(buffer_.data() + sizeof(header), bytes - sizeof(header))) {
+      throw std::runtime_error("IPC stream truncated");
+    }
+  }
+  batch_ = record_batch_view::parse(buffer_);
+  return !batch_.end_of_stream();
+}
+
+} // namespace franklin::io
+
+#endif // FRANKLIN_IO_IPC_HPP
@@ -0,0 +1,255 @@
+#include "io/ipc.hpp"
+#include <cstdio>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <utility>
+#include <unistd.h>
+#include <vector>
+
+namespace franklin::io {
+namespace {
+
+// Int32 column offset + i with every fifth row missing
+column_vector<Int32DefaultPolicy> int_column(std::size_t rows, int offset) {
+  column_vector<Int32DefaultPolicy> column(rows);
+  for (std::size_t i = 0; i < rows; ++i) {
+    column.data()[i] = offset + static_cast<std::int32_t>(i);
+    column.present_mask().set(i, i % 5 != 0);
+  }
+  return column;
+}
+
+column_vector<Float32DefaultPolicy> float_column(std::size_t rows) {
+  column_vector<Float32DefaultPolicy> column(rows);
+  for (std::size_t i = 0; i < rows; ++i) {
+    column.data()[i] = 0.5f * static_cast<float>(i);
+  }
+  return column;
+}
+
+// Write `batches` batches of `rows` rows (plus end of stream) to `fd`
+void write_stream(int fd, std::size_t batches, std::size_t rows) {
+  record_batch_writer writer(fd);
+  for (std::size_t b = 0; b < batches; ++b) {
+    const auto ids = int_column(rows, static_cast<int>(b * rows));
+    const auto values = float_column(rows);
+    const column_vector<BF16DefaultPolicy> weights(rows, bf16(2.0f));
+    writer.add("id", ids);
+    writer.add("value", values);
+    writer.add("weight", weights);
+    writer.write(rows);
+  }
+  writer.finish();
+}
+
+// Check batch `b` as written by write_stream
+void check_batch(const record_batch_view& batch, std::size_t b,
+                 std::size_t rows) {
+  ASSERT_EQ(batch.rows(), rows);
+  ASSERT_EQ(batch.columns(), 3u);
+  EXPECT_EQ(batch.name(1), "value");
+  EXPECT_EQ(batch.type(2), DataTypeEnum::BF16Default);
+  const auto ids = batch.column<Int32DefaultPolicy>("id");
+  const auto values = batch.column<Float32DefaultPolicy>(1);
+  const auto weights = batch.column<BF16DefaultPolicy>("weight");
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ids.data().data()) % 64, 0u);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(values.data().data()) % 64, 0u);
+  for (std::size_t i = 0; i < rows; ++i) {
+    ASSERT_EQ(ids[i], static_cast<std::int32_t>(b * rows + i));
+    ASSERT_EQ(ids.present(i), i % 5 != 0);
+    ASSERT_EQ(values[i], 0.5f * static_cast<float>(i));
+    ASSERT_TRUE(values.present(i));
+    ASSERT_EQ(weights[i].to_float(), 2.0f);
+  }
+}
+
+TEST(IpcTest, StreamsBatchesThroughAPipe) {
+  int fds[2];
+  ASSERT_EQ(::pipe(fds), 0);
+  // Larger than the pipe buffer, so writes complete partially
+  const std::size_t batches = 4;
+  const std::size_t rows = 100003;
+  std::thread producer([&] {
+    write_stream(fds[1], batches, rows);
+    ::close(fds[1]);
+  });
+
+  record_batch_reader reader(fds[0]);
+  std::size_t b = 0;
+  while (reader.next()) {
+    check_batch(reader.batch(), b++, rows);
+  }
+  producer.join();
+  ::close(fds[0]);
+  EXPECT_EQ(b, batches);
+  EXPECT_FALSE(reader.next()); // stays at the end
+}
+
+TEST(IpcTest, StreamsBatchesThroughASocket) {
+  int fds[2];
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  std::thread producer([&] {
+    write_stream(fds[0], 3, 777);
+    ::close(fds[0]);
+  });
+  record_batch_reader reader(fds[1]);
+  std::size_t b = 0;
+  while (reader.next()) {
+    check_batch(reader.batch(), b++, 777);
+  }
+  producer.join();
+  ::close(fds[1]);
+  EXPECT_EQ(b, 3u);
+}
+
+TEST(IpcTest, ParsesMessagesInPlace) {
+  const std::string path = ::testing::TempDir() + "ipc_test_stream";
+  const int out = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  ASSERT_GE(out, 0);
+  write_stream(out, 2, 130);
+  ::close(out);
+
+  // The whole stream in one aligned receive buffer
+  const int in = ::open(path.c_str(), O_RDONLY);
+  ASSERT_GE(in, 0);
+  std::vector<std::byte, memory::aligned_allocator<std::byte, 64>> buffer(
+      1 << 16);
+  const ssize_t size = ::read(in, buffer.data(), buffer.size());
+  ::close(in);
+  std::remove(path.c_str());
+  ASSERT_GT(size, 0);
+  buffer.resize(static_cast<std::size_t>(size));
+
+  std::span<const std::byte> rest(buffer);
+  for (std::size_t b = 0; b < 2; ++b) {
+    const auto batch = record_batch_view::parse(rest);
+    check_batch(batch, b, 130);
+    // Views point into the buffer: no copies
+    const auto* data = reinterpret_cast<const std::byte*>(
+        batch.column<Int32DefaultPolicy>(0).data().data());
+    EXPECT_GE(data, rest.data());
+    EXPECT_LT(data, rest.data() + batch.bytes());
+    EXPECT_EQ(batch.bytes() % 64, 0u);
+    rest = rest.subspan(batch.bytes());
+  }
+  EXPECT_TRUE(record_batch_view::parse(rest).end_of_stream());
+  EXPECT_EQ(rest.size(), 64u);
+
+  // A private copy works with the column operators
+  const auto batch = record_batch_view::parse(buffer);
+  const auto ids = batch.column<Int32DefaultPolicy>("id").to_column();
+  EXPECT_EQ((ids + ids).data()[3], 6);
+  EXPECT_FALSE(ids.present(5));
+}
+
+TEST(IpcTest, RejectsMalformedInput) {
+  int fds[2];
+  ASSERT_EQ(::pipe(fds), 0);
+  {
+    record_batch_writer writer(fds[1]);
+    const auto ids = int_column(64, 0);
+    EXPECT_THROW(writer.add("", ids), std::runtime_error);
+    EXPECT_THROW(writer.add(std::string(32, 'x'), ids), std::runtime_error);
+    writer.add("id", ids);
+    EXPECT_THROW(writer.write(65), std::runtime_error);
+    writer.add("id", ids);
+    writer.write(64);
+    // No end-of-stream message
+  }
+  ::close(fds[1]);
+  record_batch_reader reader(fds[0]);
+  ASSERT_TRUE(reader.next());
+  EXPECT_THROW(reader.batch().column<Float32DefaultPolicy>("id"),
+               std::runtime_error);
+  EXPECT_THROW(reader.batch().column<Int32DefaultPolicy>("missing"),
+               std::runtime_error);
+  EXPECT_THROW(reader.next(), std::runtime_error);
+  ::close(fds[0]);
+
+  // Corrupted headers
+  std::vector<std::byte, memory::aligned_allocator<std::byte, 64>> message(
+      256);
+  EXPECT_THROW(record_batch_view::parse(message), std::runtime_error);
+  detail::ipc_message_header header{};
+  header.magic = detail::ipc_magic;
+  header.version = detail::ipc_version;
+  header.kind = static_cast<std::uint16_t>(detail::ipc_kind::batch);
+  header.columns = 1;
+  header.rows = 1000; // payload would not fit in the body
+  header.body_bytes = 128;
+  std::memcpy(message.data(), &header, sizeof(header));
+  detail::ipc_column_header column{};
+  column.name[0] = 'a';
+  column.type = DataTypeEnum::Int32Default;
+  column.value_size = 4;
+  column.length = 1000;
+  column.data_offset = 64;
+  std::memcpy(message.data() + 64, &column, sizeof(column));
+  EXPECT_THROW(record_batch_view::parse(message), std::runtime_error);
+  EXPECT_THROW(record_batch_view::parse(std::span(message).first(100)),
+               std::runtime_error);
+  EXPECT_THROW(record_batch_view::parse(std::span(message).subspan(1)),
+               std::runtime_error);
+}
+
+TEST(IpcTest, DecimalColumnsKeepTheirScale) {
+  int fds[2];
+  ASSERT_EQ(::pipe(fds), 0);
+  {
+    record_batch_writer writer(fds[1]);
+    column_vector<Decimal64Policy<2>> prices(10);
+    for (std::size_t i = 0; i < 10; ++i) {
+      prices.data()[i] = static_cast<std::int64_t>(i) * 125; // i * 1.25
+    }
+    writer.add("price", prices);
+    writer.write(10);
+    writer.finish();
+  }
+  ::close(fds[1]);
+  record_batch_reader reader(fds[0]);
+  ASSERT_TRUE(reader.next());
+  EXPECT_EQ(reader.batch().type(0), DataTypeEnum::Decimal64);
+  EXPECT_EQ(reader.batch().column<Decimal64Policy<2>>("price")[3], 375);
+  EXPECT_THROW(reader.batch().column<Decimal64Policy<4>>("price"),
+               std::runtime_error);
+  EXPECT_FALSE(reader.next());
+  ::close(fds[0]);
+}
+
+TEST(IpcTest, RejectsOversizedMessageHeaders) {
+  detail::ipc_message_header header{};
+  header.magic = detail::ipc_magic;
+  header.version = detail::ipc_version;
+  header.kind = static_cast<std::uint16_t>(detail::ipc_kind::batch);
+  // Sizes that would wrap, or exceed the limit, must not reach resize()
+  const std::pair<std::uint32_t, std::uint64_t> sizes[] = {
+      {1, ~std::uint64_t{0} - 100},
+      {0xffffffffu, 0},
+      {1, std::uint64_t{1} << 40},
+      {1, 4096}};
+  for (const auto& [columns, body_bytes] : sizes) {
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    header.columns = columns;
+    header.body_bytes = body_bytes;
+    ASSERT_EQ(::write(fds[1], &header, sizeof(header)),
+              static_cast<ssize_t>(sizeof(header)));
+    ::close(fds[1]);
+    record_batch_reader reader(fds[0], 4096);
+    try {
+      reader.next();
+      ADD_FAILURE() << "accepted " << columns << " columns, " << body_bytes
+                    << " body bytes";
+    } catch (const std::runtime_error& e) {
+      EXPECT_NE(std::string(e.what()).find("size limit"), std::string::npos)
+          << e.what();
+    }
+    ::close(fds[0]);
+  }
+}
+
+} // namespace
+} // namespace franklin::io
@@ -0,0 +1,513 @@
+#ifndef FRANKLIN_IO_SHARED_COLUMN_STORE_HPP
+#define FRANKLIN_IO_SHARED_COLUMN_STORE_HPP
+
+#include "container/column.hpp"
+#include "io/column_view.hpp"
+#include "memory/buddy_allocator.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace franklin::io {
+
+// Shared-memory column store: one process publishes columns into a named
+// POSIX shared-memory segment, any number of processes attach to it
+// read-only and use the columns in place, so N workers need one copy of the
+// reference data instead of N.
+//
+// Segment layout (every offset is relative to the segment start, so the
+// segment may be mapped at a different address in each process):
+//
+//   [header][directory: max_columns entries][pad to 4 KiB][buddy pool]
+//
+// The publisher manages the pool with a buddy_allocator over the mapping.
+// Each column occupies a pool block holding its values, padded with zeros to
+// whole cache lines, and a block holding its validity bitmap in 64-bit words
+// (bit i of word i / 64), padded to whole cache lines like dynamic_bitset.
+// Empty columns occupy no blocks.
+// Directory entries are filled in before the entry count is advanced with a
+// release store, so readers never see a partially published column.
+// Segments are append-only: a published column stays valid until the
+// segment is unlinked and the last mapping goes away.
+
+namespace detail {
+
+inline constexpr std::uint64_t shm_magic = 0x4c4f434e4b415246; // "FRANKCOL"
+inline constexpr std::uint32_t shm_version = 2;
+inline constexpr std::size_t shm_name_size = 48;
+
+struct shm_header {
+  std::uint64_t magic;
+  std::uint32_t version;
+  std::uint32_t max_columns;
+  std::uint64_t pool_offset;
+  std::uint64_t pool_size;
+  std::uint32_t count; // published entries
+  std::uint32_t reserved;
+};
+
+struct shm_entry {
+  char name[shm_name_size]; // NUL-terminated
+  std::uint64_t rows;
+  std::uint64_t data_offset;
+  std::uint64_t validity_offset;
+  std::uint16_t type; // DataTypeEnum::Enum
+  std::uint16_t value_size;
+  std::uint32_t scale; // Decimal64 fractional digits, 0 for other types
+};
+
+static_assert(sizeof(shm_header) == 40);
+static_assert(sizeof(shm_entry) == 80);
+
+// POSIX shared-memory object names have a single leading slash
+inline std::string shm_object_name(std::string_view name) {
+  if (name.empty() || name.find('/', 1) != std::string_view::npos) {
+    throw std::runtime_error("Invalid shared memory name: " +
+                             std::string(name));
+  }
+  return name.front() == '/' ? std::string(name) : "/" + std::string(name);
+}
+
+// Owning mapping of a shared-memory object
+class shm_mapping {
+public:
+  shm_mapping() noexcept = default;
+  shm_mapping(void* base, std::size_t size) noexcept
+      : base_(base), size_(size) {}
+  shm_mapping(shm_mapping&& other) noexcept
+      : base_(std::exchange(other.base_, nullptr)),
+        size_(std::exchange(other.size_, 0)) {}
+  shm_mapping& operator=(shm_mapping&& other) noexcept {
+    if (this != &other) {
+      unmap();
+      base_ = std::exchange(other.base_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+  ~shm_mapping() { unmap(); }
+
+  std::byte* base() const noexcept { return static_cast<std::byte*>(base_); }
+  std::size_t size() const noexcept { return size_; }
+
+private:
+  void unmap() noexcept {
+    if (base_ != nullptr) {
+      ::munmap(base_, size_);
+    }
+  }
+
+  void* base_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+inline std::uint32_t load_count(const shm_header& header) noexcept {
+  return std::atomic_ref<std::uint32_t>(
+             const_cast<std::uint32_t&>(header.count))
+      .load(std::memory_order_acquire);
+}
+
+} // namespace detail
+
+// Publishing side of a shared column store. Creates the segment, and unlinks
+// its name on destruction; processes that are attached keep their mappings.
+// Not thread-safe.
+class shared_column_writer {
+public:
+  // Create segment `name` with a pool of at least `pool_bytes` (rounded up to
+  // a power of two) and room for `max_columns` columns. Throws if the name is
+  // already in use.
+  shared_column_writer(std::string_view name, std::size_t pool_bytes,
+                       std::size_t max_columns = 64);
+  ~shared_column_writer();
+
+  shared_column_writer(const shared_column_writer&) = delete;
+  shared_column_writer& operator=(const shared_column_writer&) = delete;
+
+  // Copy the first `rows` rows of `column` into the segment under `name`
+  template <concepts::ColumnPolicy Policy>
+  void publish(std::string_view name, const column_vector<Policy>& column,
+               std::size_t rows);
+
+  // View of a column published by this writer
+  template <concepts::ColumnPolicy Policy>
+  column_view<Policy> column(std::string_view name) const;
+
+  const std::string& name() const noexcept { return name_; }
+  std::size_t size() const noexcept;
+  std::size_t segment_bytes() const noexcept { return mapping_.size(); }
+
+private:
+  detail::shm_header& header() const noexcept {
+    return *reinterpret_cast<detail::shm_header*>(mapping_.base());
+  }
+  detail::shm_entry* entries() const noexcept {
+    return reinterpret_cast<detail::shm_entry*>(mapping_.base() +
+                                                sizeof(detail::shm_header));
+  }
+  std::uint64_t allocate(std::size_t bytes);
+  // Fill in the next directory entry and publish it to readers
+  void publish_entry(std::string_view name, DataTypeEnum::Enum type,
+                     std::size_t value_size, unsigned scale, std::size_t rows,
+                     std::uint64_t data_offset, std::uint64_t validity_offset);
+
+  std::string name_;
+  detail::shm_mapping mapping_;
+  std::unique_ptr<buddy_allocator> pool_;
+};
+
+// Attaching side of a shared column store. Maps the segment read-only, so
+// the columns cannot be modified through it. Columns published after
+// attaching become visible as they are published.
+class shared_column_reader {
+public:
+  explicit shared_column_reader(std::string_view name);
+
+  template <concepts::ColumnPolicy Policy>
+  column_view<Policy> column(std::string_view name) const;
+
+  bool contains(std::string_view name) const noexcept;
+  std::vector<std::string> names() const;
+  std::size_t size() const noexcept;
+
+private:
+  const detail::shm_header& header() const noexcept {
+    return *reinterpret_cast<const detail::shm_header*>(mapping_.base());
+  }
+  const detail::shm_entry* entries() const noexcept {
+    return reinterpret_cast<const detail::shm_entry*>(
+        mapping_.base() + sizeof(detail::shm_header));
+  }
+  // Published entries, never more than the directory validated on attach
+  // holds, whatever another process writes into the header
+  std::uint32_t count() const noexcept {
+    return std::min(detail::load_count(header()), max_columns_);
+  }
+
+  detail::shm_mapping mapping_;
+  std::uint32_t max_columns_ = 0;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+namespace detail {
+
+inline std::size_t shm_pool_offset(std::size_t max_columns) noexcept {
+  const std::size_t directory =
+      sizeof(shm_header) + max_columns * sizeof(shm_entry);
+  return (directory + 4095) & ~std::size_t{4095};
+}
+
+inline std::size_t shm_validity_words(std::size_t rows) noexcept {
+  return (((rows + 63) >> 6) + 7) & ~std::size_t{7};
+}
+
+// Name of `entry`; empty if it is not NUL-terminated, which only a corrupt
+// entry can be (published names are never empty)
+inline std::string_view shm_entry_name(const shm_entry& entry) noexcept {
+  const void* end = std::memchr(entry.name, 0, shm_name_size);
+  return end == nullptr
+             ? std::string_view()
+             : std::string_view(entry.name,
+                                static_cast<const char*>(end) - entry.name);
+}
+
+// Published entry called `name` among the first `count`, or nullptr
+inline const shm_entry* shm_find(const shm_entry* entries, std::uint32_t count,
+                                 std::string_view name) noexcept {
+  for (std::uint32_t i = 0; i < count; ++i) {
+    if (!name.empty() && name == shm_entry_name(entries[i])) {
+      return &entries[i];
+    }
+  }
+  return nullptr;
+}
+
+// Whether `count` elements of `size` bytes at `offset` lie in the pool of `h`
+inline bool shm_in_pool(const shm_header& h, std::uint64_t offset,
+                        std::uint64_t count, std::uint64_t size) noexcept {
+  const std::uint64_t end = h.pool_offset + h.pool_size;
+  return offset >= h.pool_offset && offset <= end && offset % size == 0 &&
+         count <= (end - offset) / size;
+}
+
+// Typed view of `entry` in a segment mapped at `base`, whose header `h` the
+// reader has validated against the mapping
+template <concepts::ColumnPolicy Policy>
+column_view<Policy> shm_view(const std::byte* base, const shm_header& h,
+                             const shm_entry* entry, std::string_view name) {
+  using value_type = typename Policy::value_type;
+  if (entry == nullptr) {
+    throw std::runtime_error("No shared column named " + std::string(name));
+  }
+  if (entry->type != Policy::policy_id ||
+      entry->value_size != sizeof(value_type)) {
+    throw std::runtime_error(
+        "Shared column " + std::string(name) + " holds " +
+        std::string(DataTypeEnum::to_string(
+            static_cast<DataTypeEnum::Enum>(entry->type))) +
+        ", not " + std::string(DataTypeEnum::to_string(Policy::policy_id)));
+  }
+  if (entry->scale != column_scale<Policy>()) {
+    throw std::runtime_error("Shared column " + std::string(name) +
+                             " has scale " + std::to_string(entry->scale) +
+                             ", not " + std::to_string(column_scale<Policy>()));
+  }
+  // The segment may be written by another process; never trust its offsets.
+  // The data check bounds `rows`, so the validity size cannot overflow.
+  if (!shm_in_pool(h, entry->data_offset, entry->rows, sizeof(value_type)) ||
+      !shm_in_pool(h, entry->validity_offset,
+                   shm_validity_words(static_cast<std::size_t>(entry->rows)),
+                   sizeof(std::uint64_t))) {
+    throw std::runtime_error("Shared column " + std::string(name) +
+                             " lies outside the column store");
+  }
+  return column_view<Policy>(
+      reinterpret_cast<const value_type*>(base + entry->data_offset),
+      reinterpret_cast<const std::uint64_t*>(base + entry->validity_offset),
+      static_cast<std::size_t>(entry->rows));
+}
+
+} // namespace detail
+
+inline shared_column_writer::shared_column_writer(std::string_view name,
+                                                  std::size_t pool_bytes,
+                                                  std::size_t max_columns)
+    : name_(detail::shm_object_name(name)) {
+  const std::size_t pool_size =
+      std::bit_ceil(std::max(pool_bytes, buddy_allocator::MIN_BLOCK_SIZE));
+  const std::size_t pool_offset = detail::shm_pool_offset(max_columns);
+  const std::size_t bytes = pool_offset + pool_size;
+
+  const int fd =
+      ::shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot create shared memory " + name_ + ": " +
+                             std::strerror(errno));
+  }
+  // Pages are only backed once written, so an oversized pool is cheap
+  if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+    const int error = errno;
+    ::close(fd);
+    ::shm_unlink(name_.c_str());
+    throw std::runtime_error("Cannot size shared memory " + name_ + ": " +
+                             std::strerror(error));
+  }
+  void* base =
+      ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  const int error = errno;
+  ::close(fd);
+  if (base == MAP_FAILED) {
+    ::shm_unlink(name_.c_str());
+    throw std::runtime_error("Cannot map shared memory " + name_ + ": " +
+                             std::strerror(error));
+  }
+  mapping_ = detail::shm_mapping(base, bytes);
+  pool_ = std::make_unique<buddy_allocator>(pool_size,
+                                            mapping_.base() + pool_offset);
+
+  detail::shm_header& h = header();
+  h.version = detail::shm_version;
+  h.max_columns = static_cast<std::uint32_t>(max_columns);
+  h.pool_offset = pool_offset;
+  h.pool_size = pool_size;
+  h.count = 0;
+  // Readers check the magic number last
+  std::atomic_ref<std::uint64_t>(h.magic).store(detail::shm_magic,
+                                                std::memory_order_release);
+}
+
+inline shared_column_writer::~shared_column_writer() {
+  ::shm_unlink(name_.c_str());
+}
+
+inline std::size_t shared_column_writer::size() const noexcept {
+  return header().count;
+}
+
+inline std::uint64_t shared_column_writer::allocate(std::size_t bytes) {
+  void* block = pool_->allocate(bytes);
+  if (block == nullptr) {
+    throw std::runtime_error("Shared memory " + name_ + " is full");
+  }
+  return static_cast<std::uint64_t>(static_cast<std::byte*>(block) -
+                                    mapping_.base());
+}
+
+template <concepts::ColumnPolicy Policy>
+void shared_column_writer::publish(std::string_view name,
+                                   const column_vector<Policy>& column,
+                                   std::size_t rows) {
+  using value_type = typename Policy::value_type;
+  detail::shm_header& h = header();
+  if (name.empty() || name.size() >= detail::shm_name_size) {
+    throw std::runtime_error("Shared column name must have 1 to " +
+                             std::to_string(detail::shm_name_size - 1) +
+                             " characters");
+  }
+  if (detail::shm_find(entries(), h.count, name) != nullptr) {
+    throw std::runtime_error("Shared column " + std::string(name) +
+                             " already exists");
+  }
+  if (h.count == h.max_columns) {
+    throw std::runtime_error("Shared column directory of " + name_ +
+                             " is full");
+  }
+  if (rows > column.data().size()) {
+    throw std::runtime_error("Column has fewer than " + std::to_string(rows) +
+                             " rows");
+  }
+
+  const std::size_t data_bytes = padded_size<Policy>(rows) * sizeof(value_type);
+  const std::size_t words = detail::shm_validity_words(rows);
+  if (rows == 0) {
+    // Nothing to allocate; the entry points at the (aligned) pool start
+    publish_entry(name, Policy::policy_id, sizeof(value_type),
+                  column_scale<Policy>(), 0, h.pool_offset, h.pool_offset);
+    return;
+  }
+  const std::uint64_t data_offset = allocate(data_bytes);
+  std::uint64_t validity_offset;
+  try {
+    validity_offset = allocate(words * sizeof(std::uint64_t));
+  } catch (...) {
+    pool_->deallocate(mapping_.base() + data_offset);
+    throw;
+  }
+
+  std::byte* data = mapping_.base() + data_offset;
+  std::memcpy(data, column.data().data(), rows * sizeof(value_type));
+  std::memset(data + rows * sizeof(value_type), 0,
+              data_bytes - rows * sizeof(value_type));
+
+  auto* validity =
+      reinterpret_cast<std::uint64_t*>(mapping_.base() + validity_offset);
+  const auto& blocks = column.present_mask().blocks();
+  const std::size_t used = (rows + 63) >> 6;
+  std::memcpy(validity, blocks.data(),
+              std::min(used, blocks.size()) * sizeof(std::uint64_t));
+  std::fill(validity + std::min(used, blocks.size()), validity + words, 0);
+  if (rows % 64 != 0) {
+    // Rows past `rows` are not part of the shared column
+    validity[used - 1] &= (std::uint64_t{1} << (rows % 64)) - 1;
+  }
+
+  publish_entry(name, Policy::policy_id, sizeof(value_type),
+                column_scale<Policy>(), rows, data_offset, validity_offset);
+}
+
+inline void shared_column_writer::publish_entry(std::string_view name,
+                                                DataTypeEnum::Enum type,
+                                                std::size_t value_size,
+                                                unsigned scale,
+                                                std::size_t rows,
+                                                std::uint64_t data_offset,
+                                                std::uint64_t validity_offset) {
+  detail::shm_header& h = header();
+  detail::shm_entry& entry = entries()[h.count];
+  std::memset(&entry, 0, sizeof(entry));
+  std::memcpy(entry.name, name.data(), name.size());
+  entry.rows = rows;
+  entry.data_offset = data_offset;
+  entry.validity_offset = validity_offset;
+  entry.type = type;
+  entry.value_size = static_cast<std::uint16_t>(value_size);
+  entry.scale = scale;
+  std::atomic_ref<std::uint32_t>(h.count).store(h.count + 1,
+                                                std::memory_order_release);
+}
+
+template <concepts::ColumnPolicy Policy>
+column_view<Policy> shared_column_writer::column(std::string_view name) const {
+  return detail::shm_view<Policy>(
+      mapping_.base(), header(),
+      detail::shm_find(entries(), header().count, name), name);
+}
+
+inline shared_column_reader::shared_column_reader(std::string_view name) {
+  const std::string object = detail::shm_object_name(name);
+  const int fd = ::shm_open(object.c_str(), O_RDONLY | O_CLOEXEC, 0);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot open shared memory " + object + ": " +
+                             std::strerror(errno));
+  }
+  struct stat st {};
+  if (::fstat(fd, &st) != 0 ||
+      static_cast<std::size_t>(st.st_size) < sizeof(detail::shm_header)) {
+    ::close(fd);
+    throw std::runtime_error("Shared memory " + object +
+                             " is not a column store");
+  }
+  const auto bytes = static_cast<std::size_t>(st.st_size);
+  void* base = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+  const int error = errno;
+  ::close(fd);
+  if (base == MAP_FAILED) {
+    throw std::runtime_error("Cannot map shared memory " + object + ": " +
+                             std::strerror(error));
+  }
+  mapping_ = detail::shm_mapping(base, bytes);
+
+  const detail::shm_header& h = header();
+  const std::uint64_t magic =
+      std::atomic_ref<std::uint64_t>(const_cast<std::uint64_t&>(h.magic))
+          .load(std::memory_order_acquire);
+  if (magic != detail::shm_magic || h.version != detail::shm_version ||
+      h.pool_offset < detail::shm_pool_offset(h.max_columns) ||
+      h.pool_offset > bytes || h.pool_size > bytes - h.pool_offset) {
+    throw std::runtime_error("Shared memory " + object +
+                             " is not a column store");
+  }
+  max_columns_ = h.max_columns;
+}
+
+inline std::size_t shared_column_reader::size() const noexcept {
+  return count();
+}
+
+inline bool
+shared_column_reader::contains(std::string_view name) const noexcept {
+  return detail::shm_find(entries(), count(), name) != nullptr;
+}
+
+inline std::vector<std::string> shared_column_reader::names() const {
+  const std::uint32_t n = count();
+  std::vector<std::string> names;
+  names.reserve(n);
+  for (std::uint32_t i = 0; i < n; ++i) {
+    const std::string_view name = detail::shm_entry_name(entries()[i]);
+    if (name.empty()) {
+      throw std::runtime_error("Malformed shared column directory entry");
+    }
+    names.emplace_back(name);
+  }
+  return names;
+}
+
+template <concepts::ColumnPolicy Policy>
+column_view<Policy> shared_column_reader::column(std::string_view name) const {
+  return detail::shm_view<Policy>(mapping_.base(), header(),
+                                  detail::shm_find(entries(), count(), name),
+                                  name);
+}
+
+} // namespace franklin::io
+
+#endif // FRANKLIN_IO_SHARED_COLUMN_STORE_HPP
@@ -0,0 +1,231 @@
+#include "io/shared_column_store.hpp"
+#include <fcntl.h>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace franklin::io {
+namespace {
+
+// Segment name unique to this process and test
+std::string segment_name(const std::string& test) {
+  return "/franklin_" + std::to_string(::getpid()) + "_" + test;
+}
+
+// Int32 column i * 3 with every seventh row missing
+column_vector<Int32DefaultPolicy> sample_column(std::size_t rows) {
+  column_vector<Int32DefaultPolicy> column(rows);
+  for (std::size_t i = 0; i < rows; ++i) {
+    column.data()[i] = static_cast<std::int32_t>(i * 3);
+    column.present_mask().set(i, i % 7 != 0);
+  }
+  return column;
+}
+
+TEST(SharedColumnStoreTest, PublishAndAttach) {
+  const std::string name = segment_name("publish");
+  shared_column_writer writer(name, 1 << 20);
+
+  const std::size_t rows = 1000;
+  auto ints = sample_column(rows + 50);
+  column_vector<Float32DefaultPolicy> floats(3);
+  floats.data()[0] = 1.5f;
+  floats.data()[1] = -2.0f;
+  floats.data()[2] = 4.25f;
+  column_vector<BF16DefaultPolicy> halves(2, bf16(0.5f));
+  writer.publish("ints", ints, rows); // only the first `rows` rows
+  writer.publish("floats", floats, 3);
+  writer.publish("halves", halves, 2);
+  EXPECT_EQ(writer.size(), 3u);
+
+  shared_column_reader reader(name);
+  EXPECT_EQ(reader.names(),
+            (std::vector<std::string>{"ints", "floats", "halves"}));
+  const auto view = reader.column<Int32DefaultPolicy>("ints");
+  ASSERT_EQ(view.rows(), rows);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(view.data().data()) % 64, 0u);
+  for (std::size_t i = 0; i < rows; ++i) {
+    EXPECT_EQ(view[i], static_cast<std::int32_t>(i * 3));
+    EXPECT_EQ(view.present(i), i % 7 != 0);
+  }
+  EXPECT_FALSE(view.present(rows));
+  EXPECT_EQ(view.data().data()[rows], 0); // zero padding
+
+  // A private copy works with the column operators
+  const auto copy = view.to_column();
+  const auto doubled = copy + copy;
+  EXPECT_EQ(doubled.data()[5], 30);
+  EXPECT_FALSE(doubled.present(7));
+  EXPECT_EQ(copy.present_mask().count(), rows - (rows + 6) / 7);
+
+  const auto f = reader.column<Float32DefaultPolicy>("floats");
+  EXPECT_EQ(f[1], -2.0f);
+  EXPECT_TRUE(f.present(2));
+  EXPECT_EQ(reader.column<BF16DefaultPolicy>("halves")[1].to_float(), 0.5f);
+
+  // The writer sees the same bytes
+  EXPECT_EQ(writer.column<Float32DefaultPolicy>("floats")[2], 4.25f);
+
+  // Columns published after attaching become visible
+  EXPECT_FALSE(reader.contains("late"));
+  writer.publish("late", floats, 1);
+  EXPECT_TRUE(reader.contains("late"));
+  EXPECT_EQ(reader.column<Float32DefaultPolicy>("late").rows(), 1u);
+
+  // Empty columns take no pool space
+  writer.publish("empty", floats, 0);
+  EXPECT_EQ(reader.column<Float32DefaultPolicy>("empty").rows(), 0u);
+}
+
+TEST(SharedColumnStoreTest, WorkersShareOneCopy) {
+  const std::string name = segment_name("workers");
+  shared_column_writer writer(name, 1 << 22);
+  const std::size_t rows = 100000;
+  writer.publish("ref", sample_column(rows), rows);
+
+  std::int64_t expected = 0;
+  for (std::size_t i = 0; i < rows; ++i) {
+    expected += i % 7 != 0 ? static_cast<std::int64_t>(i * 3) : 0;
+  }
+
+  constexpr int workers = 3;
+  pid_t children[workers];
+  for (int w = 0; w < workers; ++w) {
+    children[w] = ::fork();
+    ASSERT_GE(children[w], 0);
+    if (children[w] == 0) {
+      // Worker: attach and aggregate in place; report through the exit code
+      int status = 1;
+      try {
+        shared_column_reader reader(name);
+        const auto view = reader.column<Int32DefaultPolicy>("ref");
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < view.rows(); ++i) {
+          sum += view.present(i) ? view[i] : 0;
+        }
+        status = sum == expected ? 0 : 2;
+      } catch (...) {
+        status = 3;
+      }
+      ::_exit(status);
+    }
+  }
+  for (pid_t child : children) {
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+  }
+}
+
+TEST(SharedColumnStoreTest, Errors) {
+  const std::string name = segment_name("errors");
+  EXPECT_THROW(shared_column_reader{name}, std::runtime_error);
+  EXPECT_THROW(shared_column_writer("a/b", 1024), std::runtime_error);
+
+  shared_column_writer writer(name, 4096, 2);
+  EXPECT_THROW(shared_column_writer(name, 4096), std::runtime_error);
+
+  auto column = sample_column(64);
+  writer.publish("a", column, 64);
+  EXPECT_THROW(writer.publish("a", column, 64), std::runtime_error);
+  EXPECT_THROW(writer.publish("", column, 64), std::runtime_error);
+  EXPECT_THROW(writer.publish(std::string(48, 'x'), column, 64),
+               std::runtime_error);
+  EXPECT_THROW(writer.publish("b", column, 65), std::runtime_error);
+
+  // The pool holds 4 KiB: 64 int32 rows fit, 2048 do not
+  auto large = sample_column(2048);
+  EXPECT_THROW(writer.publish("b", large, 2048), std::runtime_error);
+  writer.publish("b", column, 64);
+  EXPECT_THROW(writer.publish("c", column, 64), std::runtime_error); // full
+
+  shared_column_reader reader(name);
+  EXPECT_THROW(reader.column<Float32DefaultPolicy>("a"), std::runtime_error);
+  EXPECT_THROW(reader.column<Int32DefaultPolicy>("c"), std::runtime_error);
+}
+
+TEST(SharedColumnStoreTest, DecimalColumnsKeepTheirScale) {
+  const std::string name = segment_name("decimal");
+  shared_column_writer writer(name, 4096);
+  column_vector<Decimal64Policy<2>> prices(10);
+  for (std::size_t i = 0; i < 10; ++i) {
+    prices.data()[i] = static_cast<std::int64_t>(i) * 125; // i * 1.25
+  }
+  writer.publish("price", prices, 10);
+
+  shared_column_reader reader(name);
+  const auto view = reader.column<Decimal64Policy<2>>("price");
+  EXPECT_EQ(view[3], 375);
+  // The same raw values at another scale would be off by powers of ten
+  EXPECT_THROW(reader.column<Decimal64Policy<4>>("price"), std::runtime_error);
+  EXPECT_THROW(reader.column<Decimal64Policy<0>>("price"), std::runtime_error);
+}
+
+TEST(SharedColumnStoreTest, RejectsEntriesOutsideThePool) {
+  const std::string name = segment_name("corrupt");
+  shared_column_writer writer(name, 4096, 1);
+  auto column = sample_column(64);
+  writer.publish("a", column, 64);
+
+  // Another process scribbles over the directory entry
+  const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+  ASSERT_GE(fd, 0);
+  const std::size_t bytes = detail::shm_pool_offset(1);
+  void* base =
+      ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  ASSERT_NE(base, MAP_FAILED);
+  auto* entry = reinterpret_cast<detail::shm_entry*>(
+      static_cast<std::byte*>(base) + sizeof(detail::shm_header));
+  const detail::shm_entry original = *entry;
+
+  shared_column_reader reader(name);
+  EXPECT_EQ(reader.column<Int32DefaultPolicy>("a")[1], 3);
+  entry->rows = std::uint64_t{1} << 62;
+  EXPECT_THROW(reader.column<Int32DefaultPolicy>("a"), std::runtime_error);
+  *entry = original;
+  entry->data_offset = ~std::uint64_t{0} - 3;
+  EXPECT_THROW(reader.column<Int32DefaultPolicy>("a"), std::runtime_error);
+  *entry = original;
+  entry->validity_offset = 0;
+  EXPECT_THROW(reader.column<Int32DefaultPolicy>("a"), std::runtime_error);
+  *entry = original;
+  entry->data_offset += 2; // misaligned
+  EXPECT_THROW(reader.column<Int32DefaultPolicy>("a"), std::runtime_error);
+  *entry = original;
+  std::memset(entry->name, 'a', sizeof(entry->name)); // no terminator
+  EXPECT_FALSE(reader.contains("a"));
+  EXPECT_THROW(reader.names(), std::runtime_error);
+  *entry = original;
+  EXPECT_EQ(reader.column<Int32DefaultPolicy>("a")[1], 3);
+
+  // An entry count past the directory is clamped to it
+  auto* header = static_cast<detail::shm_header*>(base);
+  header->count = 1000;
+  EXPECT_EQ(reader.size(), 1u);
+  EXPECT_EQ(reader.names(), std::vector<std::string>{"a"});
+  EXPECT_FALSE(reader.contains("b"));
+  header->count = 1;
+  ::munmap(base, bytes);
+}
+
+TEST(SharedColumnStoreTest, NameIsUnlinkedWithTheWriter) {
+  const std::string name = segment_name("unlink");
+  auto writer = std::make_unique<shared_column_writer>(name, 4096);
+  auto column = sample_column(10);
+  writer->publish("a", column, 10);
+  shared_column_reader reader(name);
+  writer.reset();
+
+  // Attached readers keep their mapping; new ones cannot attach
+  EXPECT_EQ(reader.column<Int32DefaultPolicy>("a")[9], 27);
+  EXPECT_THROW(shared_column_reader{name}, std::runtime_error);
+}
+
+} // namespace
+} // namespace franklin::io
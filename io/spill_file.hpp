@@ -0,0 +1,568 @@
+#ifndef FRANKLIN_IO_SPILL_FILE_HPP
+#define FRANKLIN_IO_SPILL_FILE_HPP
+
+#include "io/block_codec.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace franklin::io {
+
+// Worker threads running blocking pread/pwrite calls, so that spill I/O
+// overlaps with the computation that produces or consumes it
+class io_thread_pool {
+public:
+  explicit io_thread_pool(std::size_t num_threads = 2);
+  ~io_thread_pool();
+
+  io_thread_pool(const io_thread_pool&) = delete;
+  io_thread_pool& operator=(const io_thread_pool&) = delete;
+
+  // Run `task` on a worker; exceptions are delivered through the future
+  std::future<void> submit(std::function<void()> task);
+
+  std::size_t size() const noexcept { return workers_.size(); }
+
+private:
+  void work();
+
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<std::packaged_task<void()>> queue_;
+  bool stopping_ = false;
+  std::vector<std::thread> workers_;
+};
+
+// Anonymous scratch file for spilled data.
+//
+// The file is unlinked as soon as it is created, so its space is returned
+// when the spill_file is destroyed, including on crashes. Writes append: each
+// one reserves the next range of the file and runs on the I/O pool, so several
+// can be in flight. The caller keeps the source buffer alive until the
+// returned future is ready.
+class spill_file {
+public:
+  spill_file(const std::string& directory, io_thread_pool& pool);
+  ~spill_file();
+
+  spill_file(const spill_file&) = delete;
+  spill_file& operator=(const spill_file&) = delete;
+
+  // Append `size` bytes; `offset` receives where they will land
+  std::future<void> write_async(const void* data, std::size_t size,
+                                std::uint64_t& offset);
+
+  std::future<void> read_async(void* data, std::size_t size,
+                               std::uint64_t offset) const;
+
+  void read(void* data, std::size_t size, std::uint64_t offset) const;
+
+  // Bytes reserved by writes so far
+  std::uint64_t size() const noexcept { return size_; }
+
+private:
+  static void write_all(int fd, const char* data, std::size_t size,
+                        std::uint64_t offset);
+  static void read_all(int fd, char* data, std::size_t size,
+                       std::uint64_t offset);
+
+  io_thread_pool& pool_;
+  int fd_ = -1;
+  std::uint64_t size_ = 0;
+};
+
+// Columnar layout of one spilled block of `rows` rows:
+//
+//   [validity bitmap of each nullable column, 64-bit words]
+//   [payload of each column, rows * width bytes, padded to 64 bytes]
+//
+// Payloads start on cache lines, so a block read into a 64-byte aligned
+// buffer can be consumed in place. A partially filled block is compacted to
+// the layout for its row count before it is written, and expanded back after
+// it is read, so short blocks cost no more disk than their rows.
+class spill_layout {
+public:
+  struct column {
+    std::size_t width;
+    bool nullable;
+  };
+
+  spill_layout(std::vector<column> columns, std::size_t rows)
+      : columns_(std::move(columns)), rows_(rows) {
+    bytes_ = place(rows_, validity_, offsets_);
+  }
+
+  std::size_t rows() const noexcept { return rows_; }
+  std::size_t bytes() const noexcept { return bytes_; }
+  // Leading bytes holding the validity bitmaps
+  std::size_t validity_bytes() const noexcept {
+    return columns_.empty() ? 0 : offsets_[0];
+  }
+
+  template <typename T> T* payload(void* block, std::size_t c) const noexcept {
+    return reinterpret_cast<T*>(static_cast<char*>(block) + offsets_[c]);
+  }
+  std::uint64_t* validity(void* block, std::size_t c) const noexcept {
+    return reinterpret_cast<std::uint64_t*>(static_cast<char*>(block) +
+                                            validity_[c]);
+  }
+
+  // Size of a block compacted to `rows` rows
+  std::size_t bytes(std::size_t rows) const {
+    std::vector<std::size_t> validity, offsets;
+    return place(rows, validity, offsets);
+  }
+
+  // Move the first `rows` rows of a full block into the compact layout
+  void compact(void* block, std::size_t rows) const {
+    std::vector<std::size_t> validity, offsets;
+    place(rows, validity, offsets);
+    char* base = static_cast<char*>(block);
+    // Every region moves down, so ascending order never clobbers a source
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+      if (columns_[c].nullable) {
+        std::memmove(base + validity[c], base + validity_[c],
+                     words(rows) * sizeof(std::uint64_t));
+      }
+    }
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+      std::memmove(base + offsets[c], base + offsets_[c],
+                   rows * columns_[c].width);
+    }
+  }
+
+  // Inverse of compact()
+  void expand(void* block, std::size_t rows) const {
+    std::vector<std::size_t> validity, offsets;
+    place(rows, validity, offsets);
+    char* base = static_cast<char*>(block);
+    for (std::size_t c = columns_.size(); c-- > 0;) {
+      std::memmove(base + offsets_[c], base + offsets[c],
+                   rows * columns_[c].width);
+    }
+    for (std::size_t c = columns_.size(); c-- > 0;) {
+      if (columns_[c].nullable) {
+        std::memmove(base + validity_[c], base + validity[c],
+                     words(rows) * sizeof(std::uint64_t));
+      }
+    }
+  }
+
+private:
+  static std::size_t words(std::size_t rows) noexcept {
+    return (rows + 63) / 64;
+  }
+
+  // Offsets of every region for a block of `rows` rows; returns its size
+  std::size_t place(std::size_t rows, std::vector<std::size_t>& validity,
+                    std::vector<std::size_t>& offsets) const {
+    validity.assign(columns_.size(), 0);
+    offsets.assign(columns_.size(), 0);
+    std::size_t offset = 0;
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+      if (columns_[c].nullable) {
+        validity[c] = offset;
+        offset += words(rows) * sizeof(std::uint64_t);
+      }
+    }
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+      offset = (offset + 63) & ~std::size_t{63};
+      offsets[c] = offset;
+      offset += rows * columns_[c].width;
+    }
+    return (offset + 63) & ~std::size_t{63};
+  }
+
+  std::vector<column> columns_;
+  std::vector<std::size_t> validity_;
+  std::vector<std::size_t> offsets_;
+  std::size_t rows_;
+  std::size_t bytes_ = 0;
+};
+
+// Location of a spilled block
+struct spill_block {
+  std::uint64_t offset;
+  std::size_t bytes; // on disk
+  std::size_t rows;
+  bool compressed = false;
+};
+
+// Writes rows into fixed-layout blocks, alternating between two staging
+// buffers so one block is encoded while the previous one is being written.
+// Callers fill row() of block() through the layout, then commit_row().
+//
+// With a codec, each block is compressed into a scratch buffer of the writer
+// before it is written, and stored raw if that does not make it smaller.
+class block_writer {
+public:
+  block_writer(const spill_layout& layout, void* staging0, void* staging1,
+               const block_codec* codec = nullptr)
+      : layout_(layout), staging_{staging0, staging1}, codec_(codec) {
+    if (codec_ != nullptr) {
+      for (auto& scratch : scratch_) {
+        scratch.resize(codec_->max_compressed_size(layout_.bytes()));
+      }
+    }
+  }
+
+  ~block_writer() { drain(); }
+
+  // Start appending blocks to `file`, recording them in `blocks`
+  void open(spill_file& file, std::vector<spill_block>& blocks) {
+    file_ = &file;
+    blocks_ = &blocks;
+    row_ = 0;
+    clear_validity();
+  }
+
+  void* block() const noexcept { return staging_[current_]; }
+  std::size_t row() const noexcept { return row_; }
+
+  void commit_row() {
+    if (++row_ == layout_.rows()) {
+      flush();
+    }
+  }
+
+  // Write any partial block and wait until everything is on disk
+  void close() {
+    if (row_ > 0) {
+      flush();
+    }
+    drain();
+    for (auto& pending : pending_) {
+      if (pending.valid()) {
+        pending.get();
+      }
+    }
+    file_ = nullptr;
+  }
+
+  std::uint64_t bytes_written() const noexcept { return bytes_written_; }
+
+private:
+  void flush() {
+    spill_block block{0, layout_.bytes(), row_};
+    if (row_ < layout_.rows()) {
+      layout_.compact(staging_[current_], row_);
+      block.bytes = layout_.bytes(row_);
+    }
+    const void* data = staging_[current_];
+    if (codec_ != nullptr) {
+      std::byte* scratch = scratch_[current_].data();
+      const std::size_t bytes = codec_->compress(
+          static_cast<const std::byte*>(data), block.bytes, scratch);
+      if (bytes < block.bytes) {
+        data = scratch;
+        block.bytes = bytes;
+        block.compressed = true;
+      }
+    }
+    pending_[current_] = file_->write_async(data, block.bytes, block.offset);
+    blocks_->push_back(block);
+    bytes_written_ += block.bytes;
+    current_ ^= 1;
+    // The other buffer may still be in flight
+    if (pending_[current_].valid()) {
+      pending_[current_].get();
+    }
+    row_ = 0;
+    clear_validity();
+  }
+
+  void clear_validity() noexcept {
+    std::memset(staging_[current_], 0, layout_.validity_bytes());
+  }
+
+  // Never leave a write pointing into a buffer the caller may free
+  void drain() noexcept {
+    for (auto& pending : pending_) {
+      if (pending.valid()) {
+        pending.wait();
+      }
+    }
+  }
+
+  const spill_layout& layout_;
+  void* staging_[2];
+  const block_codec* codec_;
+  std::vector<std::byte> scratch_[2];
+  std::future<void> pending_[2];
+  unsigned current_ = 0;
+  spill_file* file_ = nullptr;
+  std::vector<spill_block>* blocks_ = nullptr;
+  std::size_t row_ = 0;
+  std::uint64_t bytes_written_ = 0;
+};
+
+// Reads the blocks of a spilled sequence in order, prefetching the next block
+// into the second buffer while the current one is consumed. Compressed
+// blocks are prefetched into a scratch buffer and decompressed by next();
+// `codec` must be the one they were written with.
+class block_reader {
+public:
+  block_reader(const spill_layout& layout, void* buffer0, void* buffer1,
+               const block_codec* codec = nullptr)
+      : layout_(layout), buffers_{buffer0, buffer1}, codec_(codec) {
+    if (codec_ != nullptr) {
+      scratch_.resize(codec_->max_compressed_size(layout_.bytes()));
+    }
+  }
+
+  ~block_reader() {
+    if (prefetch_.valid()) {
+      prefetch_.wait();
+    }
+  }
+
+  // Position on the first block; false if there is none
+  bool open(const spill_file& file, const std::vector<spill_block>& blocks) {
+    if (prefetch_.valid()) {
+      prefetch_.wait();
+      prefetch_ = {};
+    }
+    file_ = &file;
+    blocks_ = &blocks;
+    next_ = 0;
+    if (blocks.empty()) {
+      return false;
+    }
+    current_ = 0;
+    next_ = 1;
+    file.read(target(blocks[0], buffers_[0]), blocks[0].bytes,
+              blocks[0].offset);
+    expand();
+    start_prefetch();
+    return true;
+  }
+
+  void* block() const noexcept { return buffers_[current_]; }
+  std::size_t rows() const noexcept { return (*blocks_)[next_ - 1].rows; }
+
+  // Advance to the next block; false at the end
+  bool next() {
+    if (!prefetch_.valid()) {
+      return false;
+    }
+    prefetch_.get();
+    current_ ^= 1;
+    ++next_;
+    expand();
+    start_prefetch();
+    return true;
+  }
+
+private:
+  // Where `block` is read to: `buffer`, or the scratch buffer if compressed
+  void* target(const spill_block& block, void* buffer) {
+    if (!block.compressed) {
+      return buffer;
+    }
+    if (codec_ == nullptr || block.bytes > scratch_.size()) {
+      throw std::runtime_error("Spilled block cannot be decompressed");
+    }
+    return scratch_.data();
+  }
+
+  void start_prefetch() {
+    if (next_ < blocks_->size()) {
+      const spill_block& next = (*blocks_)[next_];
+      prefetch_ = file_->read_async(target(next, buffers_[current_ ^ 1]),
+                                    next.bytes, next.offset);
+    }
+  }
+
+  // Decompress and expand the block just made current
+  void expand() {
+    const spill_block& block = (*blocks_)[next_ - 1];
+    if (block.compressed) {
+      codec_->decompress(scratch_.data(), block.bytes,
+                         static_cast<std::byte*>(buffers_[current_]),
+                         layout_.bytes(block.rows));
+    }
+    if (rows() < layout_.rows()) {
+      layout_.expand(buffers_[current_], rows());
+    }
+  }
+
+  const spill_layout& layout_;
+  void* buffers_[2];
+  const block_codec* codec_;
+  std::vector<std::byte> scratch_;
+  std::future<void> prefetch_;
+  unsigned current_ = 0;
+  const spill_file* file_ = nullptr;
+  const std::vector<spill_block>* blocks_ = nullptr;
+  std::size_t next_ = 0;
+};
+
+// Configuration shared by the spilling operators
+struct spill_options {
+  // Where spill files are created (they are unlinked immediately)
+  std::string directory = "/tmp";
+  std::size_t io_threads = 2;
+  // Rows per spilled block; lowered automatically for small budgets
+  std::size_t block_rows = 1 << 14;
+  // Rows per batch handed to the output sink
+  std::size_t batch_rows = 1 << 16;
+  // Fan-out of each hash partitioning level (power of two)
+  std::size_t partitions = 16;
+  // Codec for spilled blocks, or nullptr to store them raw. Its scratch
+  // buffers (two blocks for the writer, one for every open reader) are not
+  // charged to the memory budget.
+  const block_codec* codec = nullptr;
+};
+
+struct spill_stats {
+  std::size_t runs = 0;       // sorted runs written
+  std::size_t partitions = 0; // hash partitions written
+  std::size_t merge_passes = 0;
+  std::uint64_t bytes_written = 0;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+inline io_thread_pool::io_thread_pool(std::size_t num_threads) {
+  num_threads = std::max<std::size_t>(num_threads, 1);
+  workers_.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; ++i) {
+    workers_.emplace_back([this] { work(); });
+  }
+}
+
+inline io_thread_pool::~io_thread_pool() {
+  {
+    std::lock_guard lock(mutex_);
+    stopping_ = true;
+  }
+  ready_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+inline std::future<void> io_thread_pool::submit(std::function<void()> task) {
+  std::packaged_task<void()> packaged(std::move(task));
+  std::future<void> result = packaged.get_future();
+  {
+    std::lock_guard lock(mutex_);
+    queue_.push_back(std::move(packaged));
+  }
+  ready_.notify_one();
+  return result;
+}
+
+inline void io_thread_pool::work() {
+  while (true) {
+    std::packaged_task<void()> task;
+    {
+      std::unique_lock lock(mutex_);
+      ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;
+      }
+      task = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    task();
+  }
+}
+
+inline spill_file::spill_file(const std::string& directory,
+                              io_thread_pool& pool)
+    : pool_(pool) {
+  std::string path = directory + "/franklin-spill-XXXXXX";
+  fd_ = ::mkstemp(path.data());
+  if (fd_ < 0) {
+    throw std::runtime_error("Cannot create spill file in " + directory +
+                             ": " + std::strerror(errno));
+  }
+  ::unlink(path.c_str());
+}
+
+inline spill_file::~spill_file() {
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+}
+
+inline void spill_file::write_all(int fd, const char* data, std::size_t size,
+                                  std::uint64_t offset) {
+  while (size > 0) {
+    const ssize_t written =
+        ::pwrite(fd, data, size, static_cast<off_t>(offset));
+    if (written < 0 && errno == EINTR) {
+      continue;
+    }
+    if (written <= 0) {
+      throw std::runtime_error(std::string("Spill write failed: ") +
+                               std::strerror(errno));
+    }
+    data += written;
+    size -= static_cast<std::size_t>(written);
+    offset += static_cast<std::uint64_t>(written);
+  }
+}
+
+inline void spill_file::read_all(int fd, char* data, std::size_t size,
+                                 std::uint64_t offset) {
+  while (size > 0) {
+    const ssize_t got = ::pread(fd, data, size, static_cast<off_t>(offset));
+    if (got < 0 && errno == EINTR) {
+      continue;
+    }
+    if (got <= 0) {
+      throw std::runtime_error(got == 0 ? std::string("Spill file truncated")
+                                        : std::string("Spill read failed: ") +
+                                              std::strerror(errno));
+    }
+    data += got;
+    size -= static_cast<std::size_t>(got);
+    offset += static_cast<std::uint64_t>(got);
+  }
+}
+
+inline std::future<void> spill_file::write_async(const void* data,
+                                                 std::size_t size,
+                                                 std::uint64_t& offset) {
+  offset = size_;
+  size_ += size;
+  const int fd = fd_;
+  const auto* bytes = static_cast<const char*>(data);
+  const std::uint64_t at = offset;
+  return pool_.submit(
+      [fd, bytes, size, at] { write_all(fd, bytes, size, at); });
+}
+
+inline std::future<void> spill_file::read_async(void* data, std::size_t size,
+                                                std::uint64_t offset) const {
+  const int fd = fd_;
+  auto* bytes = static_cast<char*>(data);
+  return pool_.submit(
+      [fd, bytes, size, offset] { read_all(fd, bytes, size, offset); });
+}
+
+inline void spill_file::read(void* data, std::size_t size,
+                             std::uint64_t offset) const {
+  read_all(fd_, static_cast<char*>(data), size, offset);
+}
+
+} // namespace franklin::io
+
+#endif // FRANKLIN_IO_SPILL_FILE_HPP
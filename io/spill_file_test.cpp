@@ -0,0 +1,93 @@
+#include "io/spill_file.hpp"
+#include <gtest/gtest.h>
+#include <numeric>
+#include <vector>
+
+namespace franklin::io {
+namespace {
+
+std::vector<spill_layout::column> test_columns() {
+  return {{sizeof(std::int32_t), true}, {sizeof(double), false},
+          {sizeof(std::uint16_t), true}};
+}
+
+TEST(SpillFileTest, LayoutCompactsAndExpandsPartialBlocks) {
+  spill_layout layout(test_columns(), 256);
+  EXPECT_EQ(layout.bytes() % 64, 0u);
+  EXPECT_LT(layout.bytes(100), layout.bytes());
+
+  std::vector<std::uint64_t> storage(layout.bytes() / 8 + 8);
+  void* block = storage.data();
+  for (std::size_t row = 0; row < 100; ++row) {
+    layout.payload<std::int32_t>(block, 0)[row] = static_cast<int>(row);
+    layout.payload<double>(block, 1)[row] = row * 0.5;
+    layout.payload<std::uint16_t>(block, 2)[row] =
+        static_cast<std::uint16_t>(row * 3);
+  }
+  layout.validity(block, 0)[1] = 0x0123456789abcdefULL;
+  layout.validity(block, 2)[0] = 0xfedcba9876543210ULL;
+
+  layout.compact(block, 100);
+  layout.expand(block, 100);
+  for (std::size_t row = 0; row < 100; ++row) {
+    ASSERT_EQ(layout.payload<std::int32_t>(block, 0)[row],
+              static_cast<int>(row));
+    ASSERT_EQ(layout.payload<double>(block, 1)[row], row * 0.5);
+    ASSERT_EQ(layout.payload<std::uint16_t>(block, 2)[row], row * 3);
+  }
+  EXPECT_EQ(layout.validity(block, 0)[1], 0x0123456789abcdefULL);
+  EXPECT_EQ(layout.validity(block, 2)[0], 0xfedcba9876543210ULL);
+}
+
+TEST(SpillFileTest, WriterAndReaderRoundTrip) {
+  io_thread_pool pool(2);
+  spill_file file(::testing::TempDir(), pool);
+  spill_layout layout(test_columns(), 64);
+
+  std::vector<std::uint64_t> buffers[4];
+  for (auto& buffer : buffers) {
+    buffer.resize(layout.bytes() / 8);
+  }
+  std::vector<spill_block> blocks;
+  {
+    block_writer writer(layout, buffers[0].data(), buffers[1].data());
+    writer.open(file, blocks);
+    for (int i = 0; i < 1000; ++i) {
+      void* block = writer.block();
+      const std::size_t row = writer.row();
+      layout.payload<std::int32_t>(block, 0)[row] = i;
+      layout.payload<double>(block, 1)[row] = -i;
+      if (i % 3 == 0) {
+        layout.validity(block, 0)[row / 64] |= std::uint64_t{1} << (row % 64);
+      }
+      writer.commit_row();
+    }
+    writer.close();
+    EXPECT_EQ(writer.bytes_written(), file.size());
+  }
+  ASSERT_EQ(blocks.size(), 16u); // 15 full blocks and one of 40 rows
+  EXPECT_EQ(blocks.back().rows, 40u);
+  EXPECT_LT(blocks.back().bytes, layout.bytes());
+
+  block_reader reader(layout, buffers[2].data(), buffers[3].data());
+  int expected = 0;
+  for (bool more = reader.open(file, blocks); more; more = reader.next()) {
+    for (std::size_t row = 0; row < reader.rows(); ++row, ++expected) {
+      void* block = reader.block();
+      ASSERT_EQ(layout.payload<std::int32_t>(block, 0)[row], expected);
+      ASSERT_EQ(layout.payload<double>(block, 1)[row], -expected);
+      const bool valid =
+          (layout.validity(block, 0)[row / 64] >> (row % 64)) & 1;
+      ASSERT_EQ(valid, expected % 3 == 0);
+    }
+  }
+  EXPECT_EQ(expected, 1000);
+}
+
+TEST(SpillFileTest, ReportsMissingDirectory) {
+  io_thread_pool pool(1);
+  EXPECT_THROW(spill_file("/nonexistent/franklin", pool), std::runtime_error);
+}
+
+} // namespace
+} // namespace franklin::io
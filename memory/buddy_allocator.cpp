@@ -33,9 +33,11 @@ buddy_allocator::buddy_allocator(std::size_t pool_size, void* pool_ptr)
 
   // Allocate memory if needed
   if (owns_memory_) {
-    // Use aligned_alloc for cache line alignment
+    // Align the pool to a page (or to its own size, if smaller), so every
+    // block of a page or more is page aligned, as direct I/O requires
+    const std::size_t alignment = std::min<std::size_t>(pool_size_, 4096);
     pool_ptr_ =
-        static_cast<std::byte*>(std::aligned_alloc(MIN_BLOCK_SIZE, pool_size_));
+        static_cast<std::byte*>(std::aligned_alloc(alignment, pool_size_));
     FRANKLIN_ASSERT(pool_ptr_ != nullptr && "Failed to allocate pool memory");
   }
 
@@ -0,0 +1,124 @@
+#ifndef FRANKLIN_MEMORY_MEMORY_BUDGET_HPP
+#define FRANKLIN_MEMORY_MEMORY_BUDGET_HPP
+
+#include "memory/buddy_allocator.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <utility>
+
+namespace franklin {
+
+// Hard memory budget for operators that can spill to disk.
+//
+// All tracked memory comes out of one buddy_allocator pool whose size is the
+// budget, so the budget is enforced by construction: an allocation that does
+// not fit fails (try_allocate returns nullptr) instead of growing the process.
+// Operators react to that by spilling to disk and retrying.
+//
+// The budget is rounded down to a power of two, and every allocation is
+// charged its power-of-two block size. The pool is only reserved address
+// space until pages are touched.
+//
+// Not thread-safe: an operator owns its budget, or callers serialize access.
+class memory_budget {
+public:
+  explicit memory_budget(std::size_t bytes)
+      : pool_(std::bit_floor(
+            std::max(bytes, buddy_allocator::MIN_BLOCK_SIZE))) {}
+
+  memory_budget(const memory_budget&) = delete;
+  memory_budget& operator=(const memory_budget&) = delete;
+
+  // At least `bytes` bytes, 64-byte aligned, or nullptr when over budget
+  void* try_allocate(std::size_t bytes) noexcept {
+    void* ptr = pool_.allocate(bytes);
+    if (ptr != nullptr) {
+      used_ += charged_size(bytes);
+      peak_ = std::max(peak_, used_);
+    }
+    return ptr;
+  }
+
+  // Return memory from try_allocate(bytes)
+  void release(void* ptr, std::size_t bytes) noexcept {
+    if (ptr != nullptr) {
+      pool_.deallocate(ptr);
+      used_ -= charged_size(bytes);
+    }
+  }
+
+  // Bytes actually reserved for an allocation of `bytes`
+  static std::size_t charged_size(std::size_t bytes) noexcept {
+    return std::bit_ceil(std::max(bytes, buddy_allocator::MIN_BLOCK_SIZE));
+  }
+
+  std::size_t capacity() const noexcept { return pool_.pool_size(); }
+  std::size_t used() const noexcept { return used_; }
+  std::size_t peak() const noexcept { return peak_; }
+
+private:
+  buddy_allocator pool_;
+  std::size_t used_ = 0;
+  std::size_t peak_ = 0;
+};
+
+// Owning array of trivially copyable T charged against a memory_budget.
+// The capacity covers the whole power-of-two block, so it may exceed the
+// requested count.
+template <typename T> class budget_buffer {
+public:
+  budget_buffer() noexcept = default;
+
+  // Empty (false) buffer when the budget cannot cover `count` elements
+  static budget_buffer try_allocate(memory_budget& budget, std::size_t count) {
+    budget_buffer buffer;
+    const std::size_t bytes = std::max<std::size_t>(count, 1) * sizeof(T);
+    void* ptr = budget.try_allocate(bytes);
+    if (ptr != nullptr) {
+      buffer.budget_ = &budget;
+      buffer.data_ = static_cast<T*>(ptr);
+      buffer.capacity_ = memory_budget::charged_size(bytes) / sizeof(T);
+    }
+    return buffer;
+  }
+
+  budget_buffer(budget_buffer&& other) noexcept
+      : budget_(std::exchange(other.budget_, nullptr)),
+        data_(std::exchange(other.data_, nullptr)),
+        capacity_(std::exchange(other.capacity_, 0)) {}
+
+  budget_buffer& operator=(budget_buffer&& other) noexcept {
+    if (this != &other) {
+      reset();
+      budget_ = std::exchange(other.budget_, nullptr);
+      data_ = std::exchange(other.data_, nullptr);
+      capacity_ = std::exchange(other.capacity_, 0);
+    }
+    return *this;
+  }
+
+  ~budget_buffer() { reset(); }
+
+  void reset() noexcept {
+    if (data_ != nullptr) {
+      budget_->release(data_, capacity_ * sizeof(T));
+      data_ = nullptr;
+      capacity_ = 0;
+    }
+  }
+
+  explicit operator bool() const noexcept { return data_ != nullptr; }
+  T* data() const noexcept { return data_; }
+  std::size_t capacity() const noexcept { return capacity_; }
+  T& operator[](std::size_t i) const noexcept { return data_[i]; }
+
+private:
+  memory_budget* budget_ = nullptr;
+  T* data_ = nullptr;
+  std::size_t capacity_ = 0;
+};
+
+} // namespace franklin
+
+#endif // FRANKLIN_MEMORY_MEMORY_BUDGET_HPP
@@ -0,0 +1,57 @@
+#include "memory/memory_budget.hpp"
+#include <gtest/gtest.h>
+
+namespace franklin {
+namespace {
+
+TEST(MemoryBudgetTest, RoundsToPowerOfTwo) {
+  memory_budget budget(3000);
+  EXPECT_EQ(budget.capacity(), 2048u);
+  EXPECT_EQ(memory_budget::charged_size(1), 64u);
+  EXPECT_EQ(memory_budget::charged_size(65), 128u);
+  EXPECT_EQ(memory_budget::charged_size(1024), 1024u);
+}
+
+TEST(MemoryBudgetTest, FailsInsteadOfExceedingBudget) {
+  memory_budget budget(4096);
+  void* a = budget.try_allocate(2048);
+  void* b = budget.try_allocate(1500);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+  EXPECT_EQ(budget.used(), 4096u);
+  EXPECT_EQ(budget.try_allocate(64), nullptr);
+
+  budget.release(b, 1500);
+  EXPECT_EQ(budget.used(), 2048u);
+  void* c = budget.try_allocate(2048);
+  EXPECT_NE(c, nullptr);
+  EXPECT_EQ(budget.peak(), 4096u);
+
+  budget.release(a, 2048);
+  budget.release(c, 2048);
+  EXPECT_EQ(budget.used(), 0u);
+  EXPECT_NE(budget.try_allocate(4096), nullptr);
+}
+
+TEST(MemoryBudgetTest, BufferUsesWholeBlockAndReleases) {
+  memory_budget budget(1 << 16);
+  {
+    auto buffer = budget_buffer<std::uint32_t>::try_allocate(budget, 100);
+    ASSERT_TRUE(buffer);
+    EXPECT_EQ(buffer.capacity(), 128u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data()) % 64, 0u);
+    buffer[127] = 7;
+
+    auto moved = std::move(buffer);
+    EXPECT_FALSE(buffer);
+    EXPECT_EQ(moved[127], 7u);
+    EXPECT_EQ(budget.used(), 512u);
+
+    auto too_big = budget_buffer<std::uint32_t>::try_allocate(budget, 1 << 16);
+    EXPECT_FALSE(too_big);
+  }
+  EXPECT_EQ(budget.used(), 0u);
+}
+
+} // namespace
+} // namespace franklin
@@ -0,0 +1,563 @@
+#ifndef FRANKLIN_OPERATORS_COROUTINE_HPP
+#define FRANKLIN_OPERATORS_COROUTINE_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace franklin::operators {
+
+// C++20 coroutine building blocks for pipelined operators:
+//
+//   generator<T>  lazily computed sequence, pulled by the consumer
+//   task<T>       lazily started asynchronous computation, co_await-able
+//   executor      worker threads that resume coroutines
+//   channel<T>    bounded queue between tasks; a full or empty channel
+//                 suspends the coroutine, not the worker thread
+//
+// Coroutine parameters are copied into the coroutine frame, but references
+// and views stay references: whatever they point at must outlive the
+// coroutine.
+
+// ============================================================================
+// generator
+// ============================================================================
+
+template <typename T> class generator {
+public:
+  struct promise_type {
+    std::optional<T> value;
+    std::exception_ptr error;
+
+    generator get_return_object() noexcept {
+      return generator(handle::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    std::suspend_always yield_value(T v) {
+      value = std::move(v);
+      return {};
+    }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+  };
+
+  using handle = std::coroutine_handle<promise_type>;
+
+  generator(generator&& other) noexcept
+      : coroutine_(std::exchange(other.coroutine_, nullptr)) {}
+  generator& operator=(generator&& other) noexcept {
+    if (this != &other) {
+      reset();
+      coroutine_ = std::exchange(other.coroutine_, nullptr);
+    }
+    return *this;
+  }
+  ~generator() { reset(); }
+
+  // Compute the next element; false at the end. Rethrows what the
+  // coroutine threw.
+  bool next() {
+    if (!coroutine_ || coroutine_.done()) {
+      return false;
+    }
+    coroutine_.promise().value.reset();
+    coroutine_.resume();
+    if (coroutine_.promise().error) {
+      std::rethrow_exception(std::exchange(coroutine_.promise().error, {}));
+    }
+    return !coroutine_.done();
+  }
+
+  // The element computed by the last successful next()
+  T& value() noexcept { return *coroutine_.promise().value; }
+
+  // Single-pass range over the remaining elements
+  class iterator {
+  public:
+    explicit iterator(generator* g) noexcept : generator_(g) {}
+    T& operator*() const noexcept { return generator_->value(); }
+    iterator& operator++() {
+      if (!generator_->next()) {
+        generator_ = nullptr;
+      }
+      return *this;
+    }
+    bool operator==(std::default_sentinel_t) const noexcept {
+      return generator_ == nullptr;
+    }
+
+  private:
+    generator* generator_;
+  };
+
+  iterator begin() {
+    iterator it(this);
+    return ++it;
+  }
+  std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+  explicit generator(handle h) noexcept : coroutine_(h) {}
+
+  void reset() noexcept {
+    if (coroutine_) {
+      coroutine_.destroy();
+      coroutine_ = nullptr;
+    }
+  }
+
+  handle coroutine_;
+};
+
+// ============================================================================
+// task
+// ============================================================================
+
+template <typename T = void> class task;
+
+namespace detail {
+
+template <typename T> struct task_result {
+  std::optional<T> value;
+  template <typename U> void return_value(U&& v) {
+    value.emplace(std::forward<U>(v));
+  }
+  T take() { return std::move(*value); }
+};
+
+template <> struct task_result<void> {
+  void return_void() noexcept {}
+  void take() noexcept {}
+};
+
+} // namespace detail
+
+template <typename T> class task {
+public:
+  struct promise_type : detail::task_result<T> {
+    std::coroutine_handle<> continuation;
+    std::exception_ptr error;
+
+    task get_return_object() noexcept {
+      return task(handle::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    // Resume whoever awaited the task, on this thread
+    struct final_awaiter {
+      bool await_ready() const noexcept { return false; }
+      std::coroutine_handle<>
+      await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+        if (h.promise().continuation) {
+          return h.promise().continuation;
+        }
+        return std::noop_coroutine();
+      }
+      void await_resume() const noexcept {}
+    };
+    final_awaiter final_suspend() noexcept { return {}; }
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+  };
+
+  using handle = std::coroutine_handle<promise_type>;
+
+  task(task&& other) noexcept
+      : coroutine_(std::exchange(other.coroutine_, nullptr)) {}
+  task& operator=(task&& other) noexcept {
+    if (this != &other) {
+      reset();
+      coroutine_ = std::exchange(other.coroutine_, nullptr);
+    }
+    return *this;
+  }
+  ~task() { reset(); }
+
+  // co_await starts the task and resumes the awaiter when it finishes
+  auto operator co_await() && noexcept {
+    struct awaiter {
+      handle coroutine;
+      bool await_ready() const noexcept { return false; }
+      std::coroutine_handle<>
+      await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        coroutine.promise().continuation = awaiting;
+        return coroutine;
+      }
+      T await_resume() {
+        if (coroutine.promise().error) {
+          std::rethrow_exception(coroutine.promise().error);
+        }
+        return coroutine.promise().take();
+      }
+    };
+    return awaiter{coroutine_};
+  }
+
+private:
+  explicit task(handle h) noexcept : coroutine_(h) {}
+
+  void reset() noexcept {
+    if (coroutine_) {
+      coroutine_.destroy();
+      coroutine_ = nullptr;
+    }
+  }
+
+  handle coroutine_;
+};
+
+// ============================================================================
+// executor
+// ============================================================================
+
+// Fixed set of worker threads resuming coroutines in FIFO order. A coroutine
+// that waits on a channel gives its worker to another coroutine, so stages of
+// a pipeline interleave on however many threads there are.
+class executor {
+public:
+  explicit executor(std::size_t threads = std::thread::hardware_concurrency());
+  ~executor();
+
+  executor(const executor&) = delete;
+  executor& operator=(const executor&) = delete;
+
+  // co_await schedule() continues the coroutine on a worker
+  auto schedule() noexcept {
+    struct awaiter {
+      executor* ex;
+      bool await_ready() const noexcept { return false; }
+      void await_suspend(std::coroutine_handle<> h) { ex->post(h); }
+      void await_resume() const noexcept {}
+    };
+    return awaiter{this};
+  }
+
+  // Queue a suspended coroutine for resumption on a worker
+  void post(std::coroutine_handle<> h);
+
+  // Run `t` on the workers in the background; wait() collects it
+  void spawn(task<> t);
+
+  // Wait for every spawned task; rethrows the first exception one threw
+  void wait();
+
+  // Run `t` on the workers and block the calling thread for its result
+  template <typename T> T sync_wait(task<T> t);
+
+  std::size_t size() const noexcept { return workers_.size(); }
+
+private:
+  // Coroutine that owns itself: runs to completion, then frees its frame
+  struct detached {
+    struct promise_type {
+      detached get_return_object() noexcept { return {}; }
+      std::suspend_never initial_suspend() noexcept { return {}; }
+      std::suspend_never final_suspend() noexcept { return {}; }
+      void return_void() noexcept {}
+      void unhandled_exception() noexcept { std::terminate(); }
+    };
+  };
+
+  static detached run_spawned(executor& ex, task<> t);
+  template <typename T>
+  static detached run_waited(executor& ex, task<T> t, std::promise<T> done);
+
+  void work();
+
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<std::coroutine_handle<>> queue_;
+  bool stopping_ = false;
+  std::condition_variable idle_;
+  std::size_t spawned_ = 0; // not yet finished
+  std::exception_ptr error_;
+  std::vector<std::thread> workers_;
+};
+
+// ============================================================================
+// channel
+// ============================================================================
+
+// Bounded multi-producer, multi-consumer queue between tasks. Each producer
+// calls close() when done; once all have and the queue is drained, pop()
+// yields std::nullopt.
+//
+// A consumer that stops early (including by throwing) calls cancel(): queued
+// values are dropped, producers suspended in push() resume, and every push()
+// from then on is rejected, so producers can wind down instead of waiting
+// for room that will never come.
+template <typename T> class channel {
+public:
+  channel(executor& ex, std::size_t capacity, std::size_t producers = 1);
+
+  channel(const channel&) = delete;
+  channel& operator=(const channel&) = delete;
+
+  // co_await push(v): suspends while the channel is full. False if the
+  // value was rejected because the channel is cancelled.
+  auto push(T value);
+
+  // co_await pop(): the next value, or std::nullopt when closed and empty
+  // or cancelled
+  auto pop();
+
+  // One producer is done
+  void close();
+
+  // The consumers are done: reject all values, queued or to come
+  void cancel();
+
+private:
+  struct waiting_producer {
+    std::coroutine_handle<> coroutine;
+    T* value;
+    bool* accepted;
+  };
+  struct waiting_consumer {
+    std::coroutine_handle<> coroutine;
+    std::optional<T>* slot;
+  };
+
+  executor& executor_;
+  std::size_t capacity_;
+  std::size_t producers_;
+  bool cancelled_ = false;
+  std::mutex mutex_;
+  std::deque<T> queue_;
+  std::deque<waiting_producer> producers_waiting_;
+  std::deque<waiting_consumer> consumers_waiting_;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+inline executor::executor(std::size_t threads) {
+  threads = std::max<std::size_t>(threads, 1);
+  workers_.reserve(threads);
+  for (std::size_t i = 0; i < threads; ++i) {
+    workers_.emplace_back([this] { work(); });
+  }
+}
+
+inline executor::~executor() {
+  {
+    std::unique_lock lock(mutex_);
+    idle_.wait(lock, [this] { return spawned_ == 0; });
+    stopping_ = true;
+  }
+  ready_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+inline void executor::post(std::coroutine_handle<> h) {
+  {
+    std::lock_guard lock(mutex_);
+    queue_.push_back(h);
+  }
+  ready_.notify_one();
+}
+
+inline void executor::work() {
+  while (true) {
+    std::coroutine_handle<> h;
+    {
+      std::unique_lock lock(mutex_);
+      ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;
+      }
+      h = queue_.front();
+      queue_.pop_front();
+    }
+    h.resume();
+  }
+}
+
+inline executor::detached executor::run_spawned(executor& ex, task<> t) {
+  co_await ex.schedule();
+  std::exception_ptr error;
+  try {
+    co_await std::move(t);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  std::lock_guard lock(ex.mutex_);
+  if (error && !ex.error_) {
+    ex.error_ = error;
+  }
+  if (--ex.spawned_ == 0) {
+    ex.idle_.notify_all();
+  }
+}
+
+inline void executor::spawn(task<> t) {
+  {
+    std::lock_guard lock(mutex_);
+    ++spawned_;
+  }
+  run_spawned(*this, std::move(t));
+}
+
+inline void executor::wait() {
+  std::unique_lock lock(mutex_);
+  idle_.wait(lock, [this] { return spawned_ == 0; });
+  if (error_) {
+    std::rethrow_exception(std::exchange(error_, {}));
+  }
+}
+
+template <typename T>
+executor::detached executor::run_waited(executor& ex, task<T> t,
+                                        std::promise<T> done) {
+  co_await ex.schedule();
+  try {
+    if constexpr (std::is_void_v<T>) {
+      co_await std::move(t);
+      done.set_value();
+    } else {
+      done.set_value(co_await std::move(t));
+    }
+  } catch (...) {
+    done.set_exception(std::current_exception());
+  }
+}
+
+template <typename T> T executor::sync_wait(task<T> t) {
+  std::promise<T> done;
+  std::future<T> result = done.get_future();
+  run_waited(*this, std::move(t), std::move(done));
+  return result.get();
+}
+
+template <typename T>
+channel<T>::channel(executor& ex, std::size_t capacity, std::size_t producers)
+    : executor_(ex), capacity_(capacity), producers_(producers) {
+  if (capacity == 0) {
+    throw std::runtime_error("Channel capacity must be positive");
+  }
+}
+
+template <typename T> auto channel<T>::push(T value) {
+  struct awaiter {
+    channel* ch;
+    T value;
+    bool accepted = true;
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> h) {
+      std::unique_lock lock(ch->mutex_);
+      if (ch->cancelled_) {
+        accepted = false;
+        return false;
+      }
+      if (!ch->consumers_waiting_.empty()) {
+        // Hand the value straight to a waiting consumer
+        waiting_consumer consumer = ch->consumers_waiting_.front();
+        ch->consumers_waiting_.pop_front();
+        consumer.slot->emplace(std::move(value));
+        lock.unlock();
+        ch->executor_.post(consumer.coroutine);
+        return false;
+      }
+      if (ch->queue_.size() < ch->capacity_) {
+        ch->queue_.push_back(std::move(value));
+        return false;
+      }
+      ch->producers_waiting_.push_back({h, &value, &accepted});
+      return true;
+    }
+    bool await_resume() const noexcept { return accepted; }
+  };
+  return awaiter{this, std::move(value)};
+}
+
+template <typename T> auto channel<T>::pop() {
+  struct awaiter {
+    channel* ch;
+    std::optional<T> slot;
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> h) {
+      std::unique_lock lock(ch->mutex_);
+      if (!ch->queue_.empty()) {
+        slot.emplace(std::move(ch->queue_.front()));
+        ch->queue_.pop_front();
+        if (!ch->producers_waiting_.empty()) {
+          // Room for one blocked producer's value
+          waiting_producer producer = ch->producers_waiting_.front();
+          ch->producers_waiting_.pop_front();
+          ch->queue_.push_back(std::move(*producer.value));
+          lock.unlock();
+          ch->executor_.post(producer.coroutine);
+        }
+        return false;
+      }
+      if (ch->producers_ == 0 || ch->cancelled_) {
+        return false; // closed and drained, or cancelled
+      }
+      ch->consumers_waiting_.push_back({h, &slot});
+      return true;
+    }
+    std::optional<T> await_resume() noexcept { return std::move(slot); }
+  };
+  return awaiter{this, std::nullopt};
+}
+
+template <typename T> void channel<T>::close() {
+  std::deque<waiting_consumer> woken;
+  {
+    std::lock_guard lock(mutex_);
+    if (producers_ == 0) {
+      return;
+    }
+    if (--producers_ == 0) {
+      // Nothing more will arrive; waiting consumers get std::nullopt
+      woken.swap(consumers_waiting_);
+    }
+  }
+  for (const waiting_consumer& consumer : woken) {
+    executor_.post(consumer.coroutine);
+  }
+}
+
+template <typename T> void channel<T>::cancel() {
+  std::deque<waiting_producer> producers;
+  std::deque<waiting_consumer> consumers;
+  std::deque<T> dropped;
+  {
+    std::lock_guard lock(mutex_);
+    if (cancelled_) {
+      return;
+    }
+    cancelled_ = true;
+    for (const waiting_producer& producer : producers_waiting_) {
+      *producer.accepted = false;
+    }
+    producers.swap(producers_waiting_);
+    consumers.swap(consumers_waiting_);
+    dropped.swap(queue_);
+  }
+  // Resumed producers see push() return false, consumers std::nullopt
+  for (const waiting_producer& producer : producers) {
+    executor_.post(producer.coroutine);
+  }
+  for (const waiting_consumer& consumer : consumers) {
+    executor_.post(consumer.coroutine);
+  }
+}
+
+} // namespace franklin::operators
+
+#endif // FRANKLIN_OPERATORS_COROUTINE_HPP
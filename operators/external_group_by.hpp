@@ -0,0 +1,483 @@
+#ifndef FRANKLIN_OPERATORS_EXTERNAL_GROUP_BY_HPP
+#define FRANKLIN_OPERATORS_EXTERNAL_GROUP_BY_HPP
+
+#include "container/column.hpp"
+#include "io/spill_file.hpp"
+#include "memory/memory_budget.hpp"
+#include "operators/operator_traits.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace franklin::operators {
+
+// Hash aggregation of COUNT, SUM, MIN and MAX per key within a fixed memory
+// budget.
+//
+// Partial aggregates live in an open-addressing table charged to the budget.
+// When the table cannot grow, its groups are hash-partitioned into scratch
+// files and the table starts over empty. finish() then aggregates each
+// partition on its own, which repartitions it one level deeper (on further
+// hash bits) if it still does not fit.
+//
+// Absent values do not contribute; a group whose values are all absent has a
+// count of 0 and absent SUM/MIN/MAX. Rows with an absent key form one group
+// whose key is absent. Groups are emitted in no particular order. Counts, and
+// the sums of integer values, are emitted as int64 (scale-0 decimals).
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+class external_group_by {
+public:
+  using key_type = typename KeyPolicy::value_type;
+  using value_type = typename ValuePolicy::value_type;
+  using accumulator_type = detail::accumulator_t<value_type>;
+  using count_policy = Decimal64Policy<0>;
+  using sum_policy =
+      std::conditional_t<std::is_integral_v<value_type>, Decimal64Policy<0>,
+                         ValuePolicy>;
+
+  // Output columns of one batch of groups
+  struct batch {
+    column_vector<KeyPolicy> keys;
+    column_vector<count_policy> counts;
+    column_vector<sum_policy> sums;
+    column_vector<ValuePolicy> mins;
+    column_vector<ValuePolicy> maxs;
+    std::size_t rows = 0;
+  };
+  using sink_type = std::function<void(const batch&)>;
+
+  explicit external_group_by(memory_budget& budget,
+                             io::spill_options options = {});
+
+  // Aggregate the first `rows` rows of the columns
+  void add(const column_vector<KeyPolicy>& keys,
+           const column_vector<ValuePolicy>& values, std::size_t rows);
+
+  // Emit every group; the operator is empty afterwards
+  void finish(const sink_type& sink);
+
+  const io::spill_stats& stats() const noexcept { return stats_; }
+
+private:
+  struct state {
+    key_type key;
+    std::uint64_t count;
+    accumulator_type sum;
+    value_type min;
+    value_type max;
+    bool used;
+  };
+
+  // Columns of a spilled block
+  enum : std::size_t {
+    key_column,
+    count_column,
+    sum_column,
+    min_column,
+    max_column
+  };
+
+  struct partition {
+    std::unique_ptr<io::spill_file> file;
+    std::vector<io::spill_block> blocks;
+  };
+
+  static std::uint64_t hash(key_type key) noexcept {
+    return detail::mix64(detail::key_bits(key));
+  }
+  std::size_t partition_of(std::uint64_t h, unsigned depth) const noexcept {
+    return (h >> (64 - partition_bits_ * (depth + 1))) &
+           (options_.partitions - 1);
+  }
+
+  static void accumulate(state& s, value_type value) noexcept;
+  static void combine(state& into, const state& from) noexcept;
+
+  // Slot for `key`, inserted if new; nullptr if the table is full
+  state* find_or_insert(key_type key, std::uint64_t h);
+  bool grow();
+  void clear_table() noexcept;
+
+  void spill_table(std::vector<partition>& parts, unsigned depth);
+  void drain(std::vector<partition>& parts, unsigned depth,
+             const std::function<void(const state&)>& emit);
+  template <typename Emit> void emit_table(Emit&& emit);
+
+  memory_budget& budget_;
+  io::spill_options options_;
+  unsigned partition_bits_;
+  io::io_thread_pool io_;
+  std::unique_ptr<io::spill_layout> layout_;
+  budget_buffer<std::byte> staging_[2];
+  budget_buffer<std::byte> read_buffers_[2];
+  std::unique_ptr<io::block_writer> writer_;
+
+  budget_buffer<state> table_;
+  std::size_t capacity_ = 0; // power of two, <= table_.capacity()
+  std::size_t size_ = 0;
+  state null_group_{};
+  std::vector<partition> partitions_;
+  io::spill_stats stats_;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+external_group_by<KeyPolicy, ValuePolicy>::external_group_by(
+    memory_budget& budget, io::spill_options options)
+    : budget_(budget), options_(std::move(options)),
+      io_(options_.io_threads) {
+  if (!std::has_single_bit(options_.partitions) || options_.partitions < 2) {
+    throw std::runtime_error("Partition count must be a power of two >= 2");
+  }
+  partition_bits_ =
+      static_cast<unsigned>(std::countr_zero(options_.partitions));
+
+  // Staging and read buffers are reserved up front so spilling and reading
+  // partitions back can never fail for lack of memory
+  for (std::size_t rows = options_.block_rows; rows >= 64; rows /= 2) {
+    auto layout = std::make_unique<io::spill_layout>(
+        std::vector<io::spill_layout::column>{{sizeof(key_type), false},
+                                              {sizeof(std::uint64_t), false},
+                                              {sizeof(accumulator_type), false},
+                                              {sizeof(value_type), false},
+                                              {sizeof(value_type), false}},
+        rows);
+    // The four buffers take at most half of the budget
+    if (8 * memory_budget::charged_size(layout->bytes()) > budget.capacity()) {
+      continue;
+    }
+    bool ok = true;
+    for (auto* buffers : {staging_, read_buffers_}) {
+      for (int i = 0; i < 2; ++i) {
+        buffers[i] =
+            budget_buffer<std::byte>::try_allocate(budget, layout->bytes());
+        ok = ok && buffers[i];
+      }
+    }
+    if (ok) {
+      layout_ = std::move(layout);
+      break;
+    }
+    for (auto* buffers : {staging_, read_buffers_}) {
+      buffers[0].reset();
+      buffers[1].reset();
+    }
+  }
+  if (!layout_) {
+    throw std::runtime_error("Memory budget too small for external group-by");
+  }
+  writer_ = std::make_unique<io::block_writer>(
+      *layout_, staging_[0].data(), staging_[1].data(), options_.codec);
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_group_by<KeyPolicy, ValuePolicy>::accumulate(
+    state& s, value_type value) noexcept {
+  if (s.count == 0) {
+    s.sum = static_cast<accumulator_type>(value);
+    s.min = value;
+    s.max = value;
+  } else {
+    s.sum += static_cast<accumulator_type>(value);
+    if (detail::value_less(value, s.min)) {
+      s.min = value;
+    }
+    if (detail::value_less(s.max, value)) {
+      s.max = value;
+    }
+  }
+  ++s.count;
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_group_by<KeyPolicy, ValuePolicy>::combine(
+    state& into, const state& from) noexcept {
+  if (from.count == 0) {
+    return;
+  }
+  if (into.count == 0) {
+    into.sum = from.sum;
+    into.min = from.min;
+    into.max = from.max;
+  } else {
+    into.sum += from.sum;
+    if (detail::value_less(from.min, into.min)) {
+      into.min = from.min;
+    }
+    if (detail::value_less(into.max, from.max)) {
+      into.max = from.max;
+    }
+  }
+  into.count += from.count;
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+typename external_group_by<KeyPolicy, ValuePolicy>::state*
+external_group_by<KeyPolicy, ValuePolicy>::find_or_insert(key_type key,
+                                                          std::uint64_t h) {
+  const std::uint64_t bits = detail::key_bits(key);
+  while (true) {
+    if (capacity_ > 0) {
+      const std::size_t mask = capacity_ - 1;
+      for (std::size_t i = h & mask;; i = (i + 1) & mask) {
+        state& s = table_[i];
+        if (!s.used) {
+          // Keep the load factor at or below 1/2
+          if (2 * (size_ + 1) > capacity_) {
+            break;
+          }
+          s = state{};
+          s.key = key;
+          s.used = true;
+          ++size_;
+          return &s;
+        }
+        if (detail::key_bits(s.key) == bits) {
+          return &s;
+        }
+      }
+    }
+    if (!grow()) {
+      return nullptr;
+    }
+  }
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+bool external_group_by<KeyPolicy, ValuePolicy>::grow() {
+  const std::size_t wanted = capacity_ > 0 ? 2 * capacity_ : 1024;
+  auto bigger = budget_buffer<state>::try_allocate(budget_, wanted);
+  if (!bigger) {
+    return false;
+  }
+  const std::size_t capacity = std::bit_floor(bigger.capacity());
+  std::memset(static_cast<void*>(bigger.data()), 0, capacity * sizeof(state));
+  const std::size_t mask = capacity - 1;
+  for (std::size_t i = 0; i < capacity_; ++i) {
+    if (table_[i].used) {
+      std::size_t slot = hash(table_[i].key) & mask;
+      while (bigger[slot].used) {
+        slot = (slot + 1) & mask;
+      }
+      bigger[slot] = table_[i];
+    }
+  }
+  table_ = std::move(bigger);
+  capacity_ = capacity;
+  return true;
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_group_by<KeyPolicy, ValuePolicy>::clear_table() noexcept {
+  std::memset(static_cast<void*>(table_.data()), 0, capacity_ * sizeof(state));
+  size_ = 0;
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_group_by<KeyPolicy, ValuePolicy>::spill_table(
+    std::vector<partition>& parts, unsigned depth) {
+  if (partition_bits_ * (depth + 1) > 64) {
+    throw std::runtime_error("Group-by does not fit the memory budget");
+  }
+  parts.resize(options_.partitions);
+
+  // Pack the groups at the front, ordered by partition
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < capacity_; ++i) {
+    if (table_[i].used) {
+      table_[count++] = table_[i];
+    }
+  }
+  std::sort(table_.data(), table_.data() + count,
+            [this, depth](const state& a, const state& b) {
+              return partition_of(hash(a.key), depth) <
+                     partition_of(hash(b.key), depth);
+            });
+
+  for (std::size_t i = 0; i < count;) {
+    const std::size_t p = partition_of(hash(table_[i].key), depth);
+    if (!parts[p].file) {
+      parts[p].file =
+          std::make_unique<io::spill_file>(options_.directory, io_);
+      ++stats_.partitions;
+    }
+    writer_->open(*parts[p].file, parts[p].blocks);
+    for (; i < count && partition_of(hash(table_[i].key), depth) == p; ++i) {
+      const state& s = table_[i];
+      void* block = writer_->block();
+      const std::size_t row = writer_->row();
+      layout_->template payload<key_type>(block, key_column)[row] = s.key;
+      layout_->template payload<std::uint64_t>(block, count_column)[row] =
+          s.count;
+      layout_->template payload<accumulator_type>(block, sum_column)[row] =
+          s.sum;
+      layout_->template payload<value_type>(block, min_column)[row] = s.min;
+      layout_->template payload<value_type>(block, max_column)[row] = s.max;
+      writer_->commit_row();
+    }
+    writer_->close();
+  }
+  stats_.bytes_written = writer_->bytes_written();
+  clear_table();
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_group_by<KeyPolicy, ValuePolicy>::add(
+    const column_vector<KeyPolicy>& keys,
+    const column_vector<ValuePolicy>& values, std::size_t rows) {
+  if (rows > keys.data().size() || rows > values.data().size()) {
+    throw std::runtime_error("Row count exceeds column size");
+  }
+  const key_type* key_data = keys.data().data();
+  const value_type* value_data = values.data().data();
+  const auto& key_mask = keys.present_mask();
+  const auto& value_mask = values.present_mask();
+
+  for (std::size_t row = 0; row < rows; ++row) {
+    state* s = &null_group_;
+    if (key_mask[row]) {
+      const std::uint64_t h = hash(key_data[row]);
+      s = find_or_insert(key_data[row], h);
+      if (s == nullptr) {
+        if (size_ == 0) {
+          throw std::runtime_error(
+              "Memory budget too small for external group-by");
+        }
+        spill_table(partitions_, 0);
+        s = find_or_insert(key_data[row], h);
+      }
+    } else {
+      null_group_.used = true;
+    }
+    if (value_mask[row]) {
+      accumulate(*s, value_data[row]);
+    }
+  }
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+template <typename Emit>
+void external_group_by<KeyPolicy, ValuePolicy>::emit_table(Emit&& emit) {
+  for (std::size_t i = 0; i < capacity_; ++i) {
+    if (table_[i].used) {
+      emit(table_[i]);
+    }
+  }
+  clear_table();
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_group_by<KeyPolicy, ValuePolicy>::drain(
+    std::vector<partition>& parts, unsigned depth,
+    const std::function<void(const state&)>& emit) {
+  io::block_reader reader(*layout_, read_buffers_[0].data(),
+                          read_buffers_[1].data(), options_.codec);
+  for (partition& part : parts) {
+    if (!part.file) {
+      continue;
+    }
+    // Groups of one partition are disjoint from all others, so each
+    // partition is aggregated and emitted on its own
+    std::vector<partition> children;
+    for (bool more = reader.open(*part.file, part.blocks); more;
+         more = reader.next()) {
+      void* block = reader.block();
+      for (std::size_t row = 0; row < reader.rows(); ++row) {
+        const io::spill_layout& l = *layout_;
+        state from{};
+        from.key = l.payload<key_type>(block, key_column)[row];
+        from.count = l.payload<std::uint64_t>(block, count_column)[row];
+        from.sum = l.payload<accumulator_type>(block, sum_column)[row];
+        from.min = l.payload<value_type>(block, min_column)[row];
+        from.max = l.payload<value_type>(block, max_column)[row];
+        const std::uint64_t h = hash(from.key);
+        state* s = find_or_insert(from.key, h);
+        if (s == nullptr) {
+          spill_table(children, depth + 1);
+          s = find_or_insert(from.key, h);
+        }
+        combine(*s, from);
+      }
+    }
+    part = {};
+
+    if (children.empty()) {
+      emit_table(emit);
+    } else {
+      spill_table(children, depth + 1);
+      drain(children, depth + 1, emit);
+    }
+  }
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_group_by<KeyPolicy, ValuePolicy>::finish(const sink_type& sink) {
+  const std::size_t batch_rows = std::max<std::size_t>(options_.batch_rows, 1);
+  batch out{column_vector<KeyPolicy>(batch_rows),
+            column_vector<count_policy>(batch_rows),
+            column_vector<sum_policy>(batch_rows),
+            column_vector<ValuePolicy>(batch_rows),
+            column_vector<ValuePolicy>(batch_rows), 0};
+
+  auto flush = [&] {
+    for (std::size_t i = out.rows; i < batch_rows; ++i) {
+      out.keys.present_mask().set(i, false);
+      out.counts.present_mask().set(i, false);
+      out.sums.present_mask().set(i, false);
+      out.mins.present_mask().set(i, false);
+      out.maxs.present_mask().set(i, false);
+    }
+    sink(out);
+    out.rows = 0;
+  };
+  auto emit = [&](const state& s, bool key_present) {
+    const std::size_t r = out.rows;
+    const bool any = s.count > 0;
+    out.keys.data()[r] = s.key;
+    out.counts.data()[r] = static_cast<std::int64_t>(s.count);
+    out.sums.data()[r] =
+        static_cast<typename sum_policy::value_type>(s.sum);
+    out.mins.data()[r] = s.min;
+    out.maxs.data()[r] = s.max;
+    out.keys.present_mask().set(r, key_present);
+    out.counts.present_mask().set(r, true);
+    out.sums.present_mask().set(r, any);
+    out.mins.present_mask().set(r, any);
+    out.maxs.present_mask().set(r, any);
+    if (++out.rows == batch_rows) {
+      flush();
+    }
+  };
+  const std::function<void(const state&)> emit_group =
+      [&emit](const state& s) { emit(s, true); };
+
+  if (partitions_.empty()) {
+    emit_table(emit_group);
+  } else {
+    if (size_ > 0) {
+      spill_table(partitions_, 0);
+    }
+    drain(partitions_, 0, emit_group);
+    partitions_.clear();
+  }
+  if (null_group_.used) {
+    emit(null_group_, false);
+    null_group_ = state{};
+  }
+  if (out.rows > 0) {
+    flush();
+  }
+}
+
+} // namespace franklin::operators
+
+#endif // FRANKLIN_OPERATORS_EXTERNAL_GROUP_BY_HPP
@@ -0,0 +1,231 @@
+#include "operators/external_group_by.hpp"
+#include <gtest/gtest.h>
+#include <limits>
+#include <map>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace franklin::operators {
+namespace {
+
+using IntGroupBy = external_group_by<Int32DefaultPolicy, Int32DefaultPolicy>;
+
+struct group {
+  std::int64_t count = 0;
+  std::int64_t sum = 0;
+  std::int32_t min = 0;
+  std::int32_t max = 0;
+
+  bool operator==(const group&) const = default;
+};
+
+// Reference result: std::nullopt is the group of absent keys
+using result_map = std::map<std::optional<std::int32_t>, group>;
+
+io::spill_options test_options() {
+  io::spill_options options;
+  options.directory = ::testing::TempDir();
+  options.batch_rows = 1000;
+  return options;
+}
+
+struct input {
+  column_vector<Int32DefaultPolicy> keys;
+  column_vector<Int32DefaultPolicy> values;
+  std::size_t rows;
+};
+
+input random_input(std::size_t rows, std::int32_t distinct,
+                   std::uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<std::int32_t> key(0, distinct - 1);
+  std::uniform_int_distribution<std::int32_t> value(-1000, 1000);
+  std::uniform_int_distribution<int> shape(0, 49);
+  input in{column_vector<Int32DefaultPolicy>(rows),
+           column_vector<Int32DefaultPolicy>(rows), rows};
+  for (std::size_t i = 0; i < rows; ++i) {
+    in.keys.data()[i] = key(rng) * 7919; // spread over the key space
+    in.values.data()[i] = value(rng);
+    in.keys.present_mask().set(i, shape(rng) != 0);
+    in.values.present_mask().set(i, shape(rng) != 1);
+  }
+  return in;
+}
+
+result_map reference(const input& in) {
+  result_map expected;
+  for (std::size_t i = 0; i < in.rows; ++i) {
+    std::optional<std::int32_t> key;
+    if (in.keys.present_mask()[i]) {
+      key = in.keys.data()[i];
+    }
+    group& g = expected[key];
+    if (in.values.present_mask()[i]) {
+      const std::int32_t v = in.values.data()[i];
+      g.min = g.count == 0 ? v : std::min(g.min, v);
+      g.max = g.count == 0 ? v : std::max(g.max, v);
+      g.sum += v;
+      ++g.count;
+    }
+  }
+  return expected;
+}
+
+result_map run_group_by(IntGroupBy& group_by, const input& in,
+                        std::size_t batch = 10000) {
+  for (std::size_t begin = 0; begin < in.rows; begin += batch) {
+    const std::size_t rows = std::min(batch, in.rows - begin);
+    column_vector<Int32DefaultPolicy> keys(rows);
+    column_vector<Int32DefaultPolicy> values(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+      keys.data()[i] = in.keys.data()[begin + i];
+      values.data()[i] = in.values.data()[begin + i];
+      keys.present_mask().set(i, in.keys.present_mask()[begin + i]);
+      values.present_mask().set(i, in.values.present_mask()[begin + i]);
+    }
+    group_by.add(keys, values, rows);
+  }
+
+  result_map actual;
+  group_by.finish([&](const IntGroupBy::batch& out) {
+    EXPECT_LE(out.rows, 1000u);
+    for (std::size_t i = 0; i < out.rows; ++i) {
+      std::optional<std::int32_t> key;
+      if (out.keys.present_mask()[i]) {
+        key = out.keys.data()[i];
+      }
+      EXPECT_FALSE(actual.contains(key)) << "group emitted twice";
+      group& g = actual[key];
+      g.count = out.counts.data()[i];
+      const bool any = g.count > 0;
+      EXPECT_EQ(out.sums.present_mask()[i], any);
+      EXPECT_EQ(out.mins.present_mask()[i], any);
+      EXPECT_EQ(out.maxs.present_mask()[i], any);
+      if (any) {
+        g.sum = out.sums.data()[i];
+        g.min = out.mins.data()[i];
+        g.max = out.maxs.data()[i];
+      }
+    }
+  });
+  return actual;
+}
+
+TEST(ExternalGroupByTest, AggregatesInMemory) {
+  memory_budget budget(16 << 20);
+  IntGroupBy group_by(budget, test_options());
+  const input in = random_input(100000, 500, 1);
+  EXPECT_EQ(run_group_by(group_by, in), reference(in));
+  EXPECT_EQ(group_by.stats().partitions, 0u);
+}
+
+TEST(ExternalGroupByTest, HandlesAbsentKeysAndValues) {
+  memory_budget budget(1 << 20);
+  IntGroupBy group_by(budget, test_options());
+  input in{column_vector<Int32DefaultPolicy>(6),
+           column_vector<Int32DefaultPolicy>(6), 6};
+  const std::int32_t keys[] = {1, 1, 2, 0, 0, 3};
+  const bool key_present[] = {true, true, true, false, false, true};
+  const std::int32_t values[] = {5, 7, 9, 4, 6, 1};
+  const bool value_present[] = {true, true, false, true, true, false};
+  for (std::size_t i = 0; i < 6; ++i) {
+    in.keys.data()[i] = keys[i];
+    in.values.data()[i] = values[i];
+    in.keys.present_mask().set(i, key_present[i]);
+    in.values.present_mask().set(i, value_present[i]);
+  }
+
+  const result_map actual = run_group_by(group_by, in);
+  ASSERT_EQ(actual.size(), 4u);
+  EXPECT_EQ(actual.at(1), (group{2, 12, 5, 7}));
+  EXPECT_EQ(actual.at(2), (group{}));
+  EXPECT_EQ(actual.at(3), (group{}));
+  EXPECT_EQ(actual.at(std::nullopt), (group{2, 10, 4, 6}));
+}
+
+TEST(ExternalGroupByTest, SpillsPartitionsWhenTableDoesNotFit) {
+  memory_budget budget(1 << 20);
+  IntGroupBy group_by(budget, test_options());
+  const input in = random_input(400000, 120000, 2);
+  EXPECT_EQ(run_group_by(group_by, in), reference(in));
+  EXPECT_GT(group_by.stats().partitions, 0u);
+  EXPECT_GT(group_by.stats().bytes_written, 0u);
+}
+
+TEST(ExternalGroupByTest, RepartitionsOversizedPartitions) {
+  memory_budget budget(256 << 10);
+  auto options = test_options();
+  options.partitions = 2;
+  options.block_rows = 512;
+  IntGroupBy group_by(budget, options);
+  const input in = random_input(300000, 100000, 3);
+  EXPECT_EQ(run_group_by(group_by, in, 4096), reference(in));
+  // Two first-level partitions cannot hold 100k groups in 256 KiB
+  EXPECT_GT(group_by.stats().partitions, 2u);
+}
+
+TEST(ExternalGroupByTest, AggregatesFloatValues) {
+  memory_budget budget(256 << 10);
+  external_group_by<Int32DefaultPolicy, Float32DefaultPolicy> group_by(
+      budget, test_options());
+  constexpr std::size_t n = 50000;
+  column_vector<Int32DefaultPolicy> keys(n);
+  column_vector<Float32DefaultPolicy> values(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys.data()[i] = static_cast<std::int32_t>(i % 20000);
+    values.data()[i] = 0.25f * static_cast<float>(i);
+  }
+  group_by.add(keys, values, n);
+
+  std::size_t groups = 0;
+  group_by.finish([&](const auto& out) {
+    for (std::size_t i = 0; i < out.rows; ++i, ++groups) {
+      const std::int32_t k = out.keys.data()[i];
+      const float first = 0.25f * static_cast<float>(k);
+      const std::int64_t count = k < 10000 ? 3 : 2;
+      ASSERT_EQ(out.counts.data()[i], count);
+      ASSERT_EQ(out.mins.data()[i], first);
+      ASSERT_EQ(out.maxs.data()[i], first + 5000.0f * (count - 1));
+      ASSERT_FLOAT_EQ(out.sums.data()[i],
+                      count * first + 5000.0f * (count * (count - 1) / 2));
+    }
+  });
+  EXPECT_EQ(groups, 20000u);
+  EXPECT_GT(group_by.stats().partitions, 0u);
+}
+
+TEST(ExternalGroupByTest, SumsIntegersWithoutWrapping) {
+  memory_budget budget(1 << 20);
+  IntGroupBy group_by(budget, test_options());
+  // 3000 rows of INT32_MAX per group overflow an int32 sum 1500 times over
+  input in{column_vector<Int32DefaultPolicy>(6000),
+           column_vector<Int32DefaultPolicy>(6000), 6000};
+  for (std::size_t i = 0; i < in.rows; ++i) {
+    const bool high = i % 2 == 0;
+    in.keys.data()[i] = high ? 1 : 2;
+    in.values.data()[i] = high ? std::numeric_limits<std::int32_t>::max()
+                               : std::numeric_limits<std::int32_t>::min();
+  }
+
+  const result_map actual = run_group_by(group_by, in);
+  ASSERT_EQ(actual.size(), 2u);
+  EXPECT_EQ(actual.at(1).count, 3000);
+  EXPECT_EQ(actual.at(1).sum,
+            3000 * std::int64_t{std::numeric_limits<std::int32_t>::max()});
+  EXPECT_EQ(actual.at(2).sum,
+            3000 * std::int64_t{std::numeric_limits<std::int32_t>::min()});
+}
+
+TEST(ExternalGroupByTest, RejectsInvalidConfiguration) {
+  memory_budget small(1024);
+  EXPECT_THROW(IntGroupBy(small, test_options()), std::runtime_error);
+
+  memory_budget budget(1 << 20);
+  auto options = test_options();
+  options.partitions = 12;
+  EXPECT_THROW(IntGroupBy(budget, options), std::runtime_error);
+}
+
+} // namespace
+} // namespace franklin::operators
@@ -0,0 +1,376 @@
+#ifndef FRANKLIN_OPERATORS_EXTERNAL_SORT_HPP
+#define FRANKLIN_OPERATORS_EXTERNAL_SORT_HPP
+
+#include "container/column.hpp"
+#include "io/spill_file.hpp"
+#include "memory/memory_budget.hpp"
+#include "operators/operator_traits.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
+namespace franklin::operators {
+
+// Sort of (key, value) rows by key that works within a fixed memory budget.
+//
+// Rows are buffered in memory charged to the budget. When the buffer cannot
+// grow any further it is sorted and spilled as a run of columnar blocks to a
+// scratch file, with writes running behind on the I/O pool. finish() merges
+// the runs (in several passes if the budget cannot hold a read buffer pair
+// for every run) and hands the result to the sink in batches.
+//
+// Rows with an absent key sort last; the order of equal keys is unspecified.
+// Output batches are ordinary columns and are not charged to the budget.
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+class external_sort {
+public:
+  using key_type = typename KeyPolicy::value_type;
+  using value_type = typename ValuePolicy::value_type;
+  using sink_type = std::function<void(const column_vector<KeyPolicy>& keys,
+                                       const column_vector<ValuePolicy>& values,
+                                       std::size_t rows)>;
+
+  explicit external_sort(memory_budget& budget, io::spill_options options = {});
+
+  // Buffer the first `rows` rows of the columns
+  void add(const column_vector<KeyPolicy>& keys,
+           const column_vector<ValuePolicy>& values, std::size_t rows);
+
+  // Emit all rows in key order; the sorter is empty afterwards
+  void finish(const sink_type& sink);
+
+  const io::spill_stats& stats() const noexcept { return stats_; }
+
+private:
+  enum : std::uint8_t { key_present = 1, value_present = 2 };
+
+  struct entry {
+    key_type key;
+    value_type value;
+    std::uint8_t flags;
+  };
+
+  // Columns of a spilled block
+  enum : std::size_t { key_column, value_column };
+
+  struct run {
+    std::unique_ptr<io::spill_file> file;
+    std::vector<io::spill_block> blocks;
+  };
+
+  // Cursor over one run during a merge. The buffers are declared first so
+  // that they outlive the reader, which waits for its prefetch into them
+  // when destroyed.
+  struct cursor {
+    budget_buffer<std::byte> buffers[2];
+    std::unique_ptr<io::block_reader> reader;
+    std::size_t row = 0;
+  };
+
+  static bool less(const entry& a, const entry& b) noexcept {
+    if ((a.flags ^ b.flags) & key_present) {
+      return a.flags & key_present; // absent keys last
+    }
+    return (a.flags & key_present) && detail::value_less(a.key, b.key);
+  }
+
+  entry read_entry(const cursor& c) const noexcept;
+  void write_entry(const entry& e);
+
+  bool grow();
+  void spill_buffer();
+  void new_run();
+
+  // Merge the runs open in `cursors`, passing entries to `emit` in order
+  template <typename Emit>
+  void merge(std::vector<cursor>& cursors, Emit&& emit);
+
+  memory_budget& budget_;
+  io::spill_options options_;
+  io::io_thread_pool io_;
+  std::unique_ptr<io::spill_layout> layout_;
+  budget_buffer<std::byte> staging_[2];
+  // Before writer_, which may still be writing to the last run's file
+  std::vector<run> runs_;
+  std::unique_ptr<io::block_writer> writer_;
+  budget_buffer<entry> buffer_;
+  std::size_t count_ = 0;
+  io::spill_stats stats_;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+external_sort<KeyPolicy, ValuePolicy>::external_sort(memory_budget& budget,
+                                                     io::spill_options options)
+    : budget_(budget), options_(std::move(options)), io_(options_.io_threads) {
+  // Staging for spilled blocks is reserved up front so spilling can never
+  // fail for lack of memory; smaller budgets get smaller blocks
+  for (std::size_t rows = options_.block_rows; rows >= 64; rows /= 2) {
+    auto layout = std::make_unique<io::spill_layout>(
+        std::vector<io::spill_layout::column>{{sizeof(key_type), true},
+                                              {sizeof(value_type), true}},
+        rows);
+    // Staging plus the read buffers of a two-way merge take at most 3/4
+    if (8 * memory_budget::charged_size(layout->bytes()) > budget.capacity()) {
+      continue;
+    }
+    for (auto& staging : staging_) {
+      staging = budget_buffer<std::byte>::try_allocate(budget, layout->bytes());
+    }
+    if (staging_[0] && staging_[1]) {
+      layout_ = std::move(layout);
+      break;
+    }
+    staging_[0].reset();
+    staging_[1].reset();
+  }
+  if (!layout_) {
+    throw std::runtime_error("Memory budget too small for external sort");
+  }
+  writer_ = std::make_unique<io::block_writer>(
+      *layout_, staging_[0].data(), staging_[1].data(), options_.codec);
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+bool external_sort<KeyPolicy, ValuePolicy>::grow() {
+  const std::size_t wanted =
+      buffer_ ? 2 * buffer_.capacity() : layout_->rows();
+  auto bigger = budget_buffer<entry>::try_allocate(budget_, wanted);
+  if (!bigger) {
+    return false;
+  }
+  if (count_ > 0) {
+    std::memcpy(bigger.data(), buffer_.data(), count_ * sizeof(entry));
+  }
+  buffer_ = std::move(bigger);
+  return true;
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_sort<KeyPolicy, ValuePolicy>::new_run() {
+  runs_.push_back({std::make_unique<io::spill_file>(options_.directory, io_),
+                   {}});
+  writer_->open(*runs_.back().file, runs_.back().blocks);
+  ++stats_.runs;
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_sort<KeyPolicy, ValuePolicy>::write_entry(const entry& e) {
+  void* block = writer_->block();
+  const std::size_t row = writer_->row();
+  layout_->template payload<key_type>(block, key_column)[row] = e.key;
+  layout_->template payload<value_type>(block, value_column)[row] = e.value;
+  const std::uint64_t bit = std::uint64_t{1} << (row % 64);
+  if (e.flags & key_present) {
+    layout_->validity(block, key_column)[row / 64] |= bit;
+  }
+  if (e.flags & value_present) {
+    layout_->validity(block, value_column)[row / 64] |= bit;
+  }
+  writer_->commit_row();
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+typename external_sort<KeyPolicy, ValuePolicy>::entry
+external_sort<KeyPolicy, ValuePolicy>::read_entry(
+    const cursor& c) const noexcept {
+  void* block = c.reader->block();
+  const std::size_t row = c.row;
+  const std::uint64_t bit = std::uint64_t{1} << (row % 64);
+  entry e;
+  e.key = layout_->template payload<key_type>(block, key_column)[row];
+  e.value = layout_->template payload<value_type>(block, value_column)[row];
+  e.flags = 0;
+  if (layout_->validity(block, key_column)[row / 64] & bit) {
+    e.flags |= key_present;
+  }
+  if (layout_->validity(block, value_column)[row / 64] & bit) {
+    e.flags |= value_present;
+  }
+  return e;
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_sort<KeyPolicy, ValuePolicy>::spill_buffer() {
+  std::sort(buffer_.data(), buffer_.data() + count_, less);
+  new_run();
+  for (std::size_t i = 0; i < count_; ++i) {
+    write_entry(buffer_[i]);
+  }
+  writer_->close();
+  stats_.bytes_written = writer_->bytes_written();
+  count_ = 0;
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_sort<KeyPolicy, ValuePolicy>::add(
+    const column_vector<KeyPolicy>& keys,
+    const column_vector<ValuePolicy>& values, std::size_t rows) {
+  if (rows > keys.data().size() || rows > values.data().size()) {
+    throw std::runtime_error("Row count exceeds column size");
+  }
+  const key_type* key_data = keys.data().data();
+  const value_type* value_data = values.data().data();
+  const auto& key_mask = keys.present_mask();
+  const auto& value_mask = values.present_mask();
+
+  std::size_t row = 0;
+  while (row < rows) {
+    if (count_ == buffer_.capacity() && !grow()) {
+      if (count_ == 0) {
+        throw std::runtime_error("Memory budget too small for external sort");
+      }
+      spill_buffer();
+      continue;
+    }
+    const std::size_t stop = std::min(rows, row + buffer_.capacity() - count_);
+    entry* out = buffer_.data() + count_;
+    for (; row < stop; ++row, ++out) {
+      out->key = key_data[row];
+      out->value = value_data[row];
+      out->flags = static_cast<std::uint8_t>(
+          (key_mask[row] ? key_present : 0) |
+          (value_mask[row] ? value_present : 0));
+    }
+    count_ = static_cast<std::size_t>(out - buffer_.data());
+  }
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+template <typename Emit>
+void external_sort<KeyPolicy, ValuePolicy>::merge(std::vector<cursor>& cursors,
+                                                  Emit&& emit) {
+  // Min-heap of cursor indices by current entry
+  std::vector<entry> heads(cursors.size());
+  auto greater = [&heads](std::size_t a, std::size_t b) {
+    return less(heads[b], heads[a]);
+  };
+  std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(greater)>
+      heap(greater);
+  for (std::size_t i = 0; i < cursors.size(); ++i) {
+    heads[i] = read_entry(cursors[i]);
+    heap.push(i);
+  }
+
+  while (!heap.empty()) {
+    const std::size_t i = heap.top();
+    heap.pop();
+    emit(heads[i]);
+    cursor& c = cursors[i];
+    if (++c.row == c.reader->rows()) {
+      c.row = 0;
+      if (!c.reader->next()) {
+        continue;
+      }
+    }
+    heads[i] = read_entry(c);
+    heap.push(i);
+  }
+}
+
+template <concepts::ColumnPolicy KeyPolicy, concepts::ColumnPolicy ValuePolicy>
+void external_sort<KeyPolicy, ValuePolicy>::finish(const sink_type& sink) {
+  const std::size_t batch_rows = std::max<std::size_t>(options_.batch_rows, 1);
+  column_vector<KeyPolicy> out_keys(batch_rows);
+  column_vector<ValuePolicy> out_values(batch_rows);
+  std::size_t out_rows = 0;
+
+  auto flush_batch = [&] {
+    for (std::size_t i = out_rows; i < batch_rows; ++i) {
+      out_keys.present_mask().set(i, false);
+      out_values.present_mask().set(i, false);
+    }
+    sink(out_keys, out_values, out_rows);
+    out_rows = 0;
+  };
+  auto emit = [&](const entry& e) {
+    out_keys.data()[out_rows] = e.key;
+    out_values.data()[out_rows] = e.value;
+    out_keys.present_mask().set(out_rows, (e.flags & key_present) != 0);
+    out_values.present_mask().set(out_rows, (e.flags & value_present) != 0);
+    if (++out_rows == batch_rows) {
+      flush_batch();
+    }
+  };
+
+  // Everything fit: sort in place
+  if (runs_.empty()) {
+    std::sort(buffer_.data(), buffer_.data() + count_, less);
+    for (std::size_t i = 0; i < count_; ++i) {
+      emit(buffer_[i]);
+    }
+    if (out_rows > 0) {
+      flush_batch();
+    }
+    count_ = 0;
+    buffer_.reset();
+    return;
+  }
+
+  if (count_ > 0) {
+    spill_buffer();
+  }
+  buffer_.reset();
+
+  while (!runs_.empty()) {
+    // The runs being merged outlive the cursors, whose readers may still be
+    // prefetching from their files if the merge throws
+    std::vector<run> inputs;
+
+    // Open as many runs as the budget has read buffers for
+    std::vector<cursor> cursors;
+    for (std::size_t i = 0; i < runs_.size(); ++i) {
+      cursor c;
+      c.buffers[0] =
+          budget_buffer<std::byte>::try_allocate(budget_, layout_->bytes());
+      c.buffers[1] =
+          budget_buffer<std::byte>::try_allocate(budget_, layout_->bytes());
+      if (!c.buffers[0] || !c.buffers[1]) {
+        break;
+      }
+      c.reader = std::make_unique<io::block_reader>(
+          *layout_, c.buffers[0].data(), c.buffers[1].data(), options_.codec);
+      cursors.push_back(std::move(c));
+    }
+    if (cursors.size() < std::min<std::size_t>(2, runs_.size())) {
+      throw std::runtime_error("Memory budget too small to merge sort runs");
+    }
+    ++stats_.merge_passes;
+
+    // The merged runs leave runs_ before a new run may be appended to it
+    const bool last_pass = cursors.size() == runs_.size();
+    inputs.assign(std::make_move_iterator(runs_.begin()),
+                  std::make_move_iterator(runs_.begin() + cursors.size()));
+    runs_.erase(runs_.begin(), runs_.begin() + cursors.size());
+    for (std::size_t i = 0; i < cursors.size(); ++i) {
+      cursors[i].reader->open(*inputs[i].file, inputs[i].blocks);
+    }
+
+    if (last_pass) {
+      merge(cursors, emit);
+    } else {
+      // Intermediate pass: the merged prefix becomes one new run
+      new_run();
+      merge(cursors, [this](const entry& e) { write_entry(e); });
+      writer_->close();
+      stats_.bytes_written = writer_->bytes_written();
+    }
+    cursors.clear();
+  }
+
+  if (out_rows > 0) {
+    flush_batch();
+  }
+}
+
+} // namespace franklin::operators
+
+#endif // FRANKLIN_OPERATORS_EXTERNAL_SORT_HPP
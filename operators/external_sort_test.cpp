@@ -0,0 +1,213 @@
+#include "operators/external_sort.hpp"
+#include "io/compression.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace franklin::operators {
+namespace {
+
+using IntSort = external_sort<Int32DefaultPolicy, Int32DefaultPolicy>;
+
+struct row {
+  bool key_present;
+  std::int32_t key;
+  bool value_present;
+  std::int32_t value;
+
+  auto tie() const {
+    return std::tuple(!key_present, key_present ? key : 0, value_present,
+                      value_present ? value : 0);
+  }
+  bool operator<(const row& other) const { return tie() < other.tie(); }
+  bool operator==(const row& other) const { return tie() == other.tie(); }
+};
+
+io::spill_options test_options() {
+  io::spill_options options;
+  options.directory = ::testing::TempDir();
+  options.batch_rows = 1000;
+  return options;
+}
+
+// Feeds `input` in batches of `batch` rows
+template <typename Sort>
+void add_rows(Sort& sort, const std::vector<row>& input,
+              std::size_t batch = 4096) {
+  for (std::size_t begin = 0; begin < input.size(); begin += batch) {
+    const std::size_t rows = std::min(batch, input.size() - begin);
+    column_vector<Int32DefaultPolicy> keys(rows);
+    column_vector<Int32DefaultPolicy> values(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+      const row& r = input[begin + i];
+      keys.data()[i] = r.key;
+      values.data()[i] = r.value;
+      keys.present_mask().set(i, r.key_present);
+      values.present_mask().set(i, r.value_present);
+    }
+    sort.add(keys, values, rows);
+  }
+}
+
+// Feeds `input` in batches of `batch` rows and returns the sorted output
+template <typename Sort>
+std::vector<row> run_sort(Sort& sort, const std::vector<row>& input,
+                          std::size_t batch = 4096) {
+  add_rows(sort, input, batch);
+  std::vector<row> output;
+  sort.finish([&](const column_vector<Int32DefaultPolicy>& keys,
+                  const column_vector<Int32DefaultPolicy>& values,
+                  std::size_t rows) {
+    EXPECT_LE(rows, 1000u);
+    for (std::size_t i = 0; i < rows; ++i) {
+      output.push_back({keys.present_mask()[i], keys.data()[i],
+                        values.present_mask()[i], values.data()[i]});
+    }
+  });
+  return output;
+}
+
+std::vector<row> random_rows(std::size_t n, std::uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<std::int32_t> key(-50000, 50000);
+  std::uniform_int_distribution<int> shape(0, 19);
+  std::vector<row> rows(n);
+  for (auto& r : rows) {
+    r = {shape(rng) != 0, key(rng), shape(rng) != 1,
+         static_cast<std::int32_t>(rng())};
+  }
+  return rows;
+}
+
+void expect_sorted_permutation(std::vector<row> input,
+                               std::vector<row> output) {
+  ASSERT_EQ(output.size(), input.size());
+  for (std::size_t i = 1; i < output.size(); ++i) {
+    const row& a = output[i - 1];
+    const row& b = output[i];
+    ASSERT_TRUE(a.key_present || !b.key_present) << "absent keys sort last";
+    if (a.key_present && b.key_present) {
+      ASSERT_LE(a.key, b.key) << i;
+    }
+  }
+  std::sort(input.begin(), input.end());
+  std::sort(output.begin(), output.end());
+  EXPECT_TRUE(input == output);
+}
+
+TEST(ExternalSortTest, SortsInMemoryWithoutSpilling) {
+  memory_budget budget(64 << 20);
+  IntSort sort(budget, test_options());
+  const auto input = random_rows(50000, 1);
+  expect_sorted_permutation(input, run_sort(sort, input));
+  EXPECT_EQ(sort.stats().runs, 0u);
+  EXPECT_EQ(sort.stats().bytes_written, 0u);
+}
+
+TEST(ExternalSortTest, SpillsRunsAndMerges) {
+  memory_budget budget(4 << 20);
+  IntSort sort(budget, test_options());
+  const auto input = random_rows(300000, 2);
+  expect_sorted_permutation(input, run_sort(sort, input));
+  EXPECT_GT(sort.stats().runs, 2u);
+  EXPECT_EQ(sort.stats().merge_passes, 1u);
+  EXPECT_GT(sort.stats().bytes_written, 300000u * 8);
+  EXPECT_LE(budget.peak(), budget.capacity());
+}
+
+TEST(ExternalSortTest, MergesInSeveralPassesWhenFanInIsLimited) {
+  memory_budget budget(64 << 10);
+  auto options = test_options();
+  options.block_rows = 256;
+  IntSort sort(budget, options);
+  const auto input = random_rows(100000, 3);
+  expect_sorted_permutation(input, run_sort(sort, input, 777));
+  EXPECT_GT(sort.stats().merge_passes, 1u);
+}
+
+TEST(ExternalSortTest, CompressesSpilledRuns) {
+  std::vector<row> input = random_rows(200000, 4);
+  for (auto& r : input) {
+    r.key %= 1000; // sorted runs repeat keys and values
+    r.value &= 0xff;
+  }
+  memory_budget plain_budget(4 << 20);
+  IntSort plain(plain_budget, test_options());
+  expect_sorted_permutation(input, run_sort(plain, input));
+
+  static const io::lz_codec codec;
+  auto options = test_options();
+  options.codec = &codec;
+  memory_budget budget(4 << 20);
+  IntSort sort(budget, options);
+  expect_sorted_permutation(input, run_sort(sort, input));
+  EXPECT_EQ(sort.stats().runs, plain.stats().runs);
+  EXPECT_GT(sort.stats().merge_passes, 0u);
+  EXPECT_LT(sort.stats().bytes_written, plain.stats().bytes_written / 2);
+}
+
+TEST(ExternalSortTest, SortsFloatKeysWithBF16Payload) {
+  memory_budget budget(256 << 10);
+  external_sort<Float32DefaultPolicy, BF16DefaultPolicy> sort(budget,
+                                                             test_options());
+  constexpr std::size_t n = 40000;
+  column_vector<Float32DefaultPolicy> keys(n);
+  column_vector<BF16DefaultPolicy> values(n);
+  std::mt19937 rng(4);
+  std::normal_distribution<float> dist(0.0f, 100.0f);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys.data()[i] = dist(rng);
+    values.data()[i] = bf16(keys.data()[i]);
+  }
+  sort.add(keys, values, n);
+
+  std::size_t seen = 0;
+  float last = -std::numeric_limits<float>::infinity();
+  sort.finish([&](const column_vector<Float32DefaultPolicy>& k,
+                  const column_vector<BF16DefaultPolicy>& v,
+                  std::size_t rows) {
+    for (std::size_t i = 0; i < rows; ++i, ++seen) {
+      ASSERT_LE(last, k.data()[i]);
+      last = k.data()[i];
+      ASSERT_EQ(v.data()[i].to_bits(), bf16(last).to_bits());
+    }
+  });
+  EXPECT_EQ(seen, n);
+  EXPECT_GT(sort.stats().runs, 0u);
+}
+
+TEST(ExternalSortTest, SinkErrorsDuringAMergeReleaseEverything) {
+  // One merge pass, and several passes with intermediate runs
+  for (std::size_t capacity : {std::size_t{4} << 20, std::size_t{64} << 10}) {
+    memory_budget budget(capacity);
+    {
+      auto options = test_options();
+      options.block_rows = 256;
+      IntSort sort(budget, options);
+      add_rows(sort, random_rows(100000, 6));
+      std::size_t batches = 0;
+      // Thrown while the readers of the merged runs are still prefetching
+      EXPECT_THROW(sort.finish([&](const column_vector<Int32DefaultPolicy>&,
+                                   const column_vector<Int32DefaultPolicy>&,
+                                   std::size_t) {
+        if (++batches == 3) {
+          throw std::runtime_error("sink failed");
+        }
+      }),
+                   std::runtime_error);
+      EXPECT_GE(sort.stats().runs, 2u);
+    }
+    EXPECT_EQ(budget.used(), 0u);
+  }
+}
+
+TEST(ExternalSortTest, RejectsTinyBudgets) {
+  memory_budget budget(1024);
+  EXPECT_THROW(IntSort(budget, test_options()), std::runtime_error);
+}
+
+} // namespace
+} // namespace franklin::operators
@@ -0,0 +1,48 @@
+#ifndef FRANKLIN_OPERATORS_OPERATOR_TRAITS_HPP
+#define FRANKLIN_OPERATORS_OPERATOR_TRAITS_HPP
+
+#include "core/bf16.hpp"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace franklin::operators::detail {
+
+// Ordering of column values; bf16 compares through float
+template <typename T> inline bool value_less(T a, T b) noexcept {
+  if constexpr (std::is_same_v<T, bf16>) {
+    return a.to_float() < b.to_float();
+  } else {
+    return a < b;
+  }
+}
+
+// Type used to accumulate sums of T: integer sums accumulate in int64, so
+// that a few thousand large Int32 values cannot wrap, and bf16 sums in float
+template <typename T>
+using accumulator_t = std::conditional_t<
+    std::is_integral_v<T>, std::int64_t,
+    std::conditional_t<std::is_same_v<T, bf16>, float, T>>;
+
+// Bit pattern of a key, for hashing and equality
+template <typename T> inline std::uint64_t key_bits(T value) noexcept {
+  static_assert(sizeof(T) <= sizeof(std::uint64_t));
+  std::uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(T));
+  return bits;
+}
+
+// splitmix64 finalizer: every input bit affects every output bit, so both the
+// low bits (table slots) and the high bits (partitions) are usable
+inline std::uint64_t mix64(std::uint64_t x) noexcept {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+} // namespace franklin::operators::detail
+
+#endif // FRANKLIN_OPERATORS_OPERATOR_TRAITS_HPP
@@ -0,0 +1,267 @@
+#ifndef FRANKLIN_OPERATORS_PIPELINE_HPP
+#define FRANKLIN_OPERATORS_PIPELINE_HPP
+
+#include "container/column.hpp"
+#include "operators/coroutine.hpp"
+#include "operators/operator_traits.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace franklin::operators {
+
+// Streaming query pipelines over row groups.
+//
+// A row group is a horizontal slice of a frame: the same rows of several
+// columns of one type, like a dynmat, plus a selection of the rows that
+// passed the filters so far. Filters narrow the selection instead of
+// compacting the columns, so the column kernels keep working on whole,
+// aligned buffers.
+//
+// Operators come in two kinds:
+//
+//   scan, filter, project  generators, fused: each row group flows through
+//                          the whole chain while it is still in cache
+//   produce, aggregate,    tasks, connected by channels and run by an
+//   sink                   executor, so several scans (and their I/O) run
+//                          alongside the consumer on the worker threads
+//
+//   executor ex(4);
+//   channel<row_group<P>> groups(ex, 8, 2);
+//   ex.spawn(produce(filter(scan(columns, rows, 1 << 14, 0, 2), 0, pred),
+//                    groups));
+//   ex.spawn(produce(filter(scan(columns, rows, 1 << 14, 1, 2), 0, pred),
+//                    groups));
+//   auto totals = ex.sync_wait(aggregate(groups, 1));
+//
+// Row groups reach the consumer in no particular order when there are
+// several producers; row_group::index gives each one's position in the scan.
+
+template <concepts::ColumnPolicy Policy> struct row_group {
+  std::size_t index = 0; // position of the group in its scan
+  std::size_t rows = 0;
+  std::vector<column_vector<Policy>> columns;
+  dynamic_bitset<BitsetPolicy> selection; // rows that passed the filters
+
+  std::size_t cols() const noexcept { return columns.size(); }
+  std::size_t size() const noexcept { return rows; }
+  // Whether row i is selected and present in `column`
+  bool live(std::size_t column, std::size_t i) const noexcept {
+    return selection.test_unchecked(i) &&
+           columns[column].present_unchecked(i);
+  }
+};
+
+// Aggregates of one column over the selected, present rows
+template <typename T> struct column_aggregates {
+  std::size_t count = 0;
+  detail::accumulator_t<T> sum{};
+  T min{};
+  T max{};
+};
+
+// Row groups of `group_rows` rows (a multiple of 64) of the first `rows` rows
+// of `columns`, which must outlive the generator. For partitioned scans,
+// only groups first, first + stride, first + 2 * stride, ... are produced.
+template <concepts::ColumnPolicy Policy>
+generator<row_group<Policy>>
+scan(std::span<const column_vector<Policy>> columns, std::size_t rows,
+     std::size_t group_rows, std::size_t first = 0, std::size_t stride = 1);
+
+// Narrow the selection to rows whose value in `column` satisfies `predicate`
+template <concepts::ColumnPolicy Policy, typename Predicate>
+generator<row_group<Policy>> filter(generator<row_group<Policy>> input,
+                                    std::size_t column, Predicate predicate);
+
+// Apply `projection(row_group&)` to every group, e.g. to append computed
+// columns or drop unused ones
+template <concepts::ColumnPolicy Policy, typename Projection>
+generator<row_group<Policy>> project(generator<row_group<Policy>> input,
+                                     Projection projection);
+
+// Push every group of `input` into `output`, then close it. Stops early if
+// the consumer cancels the channel.
+template <concepts::ColumnPolicy Policy>
+task<> produce(generator<row_group<Policy>> input,
+               channel<row_group<Policy>>& output);
+
+// COUNT, SUM, MIN and MAX of `column` over every group from `input`. The
+// consumers below cancel `input` when they return or throw, so producers
+// never wait on a channel nobody reads any more.
+template <concepts::ColumnPolicy Policy>
+task<column_aggregates<typename Policy::value_type>>
+aggregate(channel<row_group<Policy>>& input, std::size_t column);
+
+// Hand every group from `input` to `consume`
+template <concepts::ColumnPolicy Policy>
+task<> sink(channel<row_group<Policy>>& input,
+            std::function<void(row_group<Policy>&)> consume);
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+template <concepts::ColumnPolicy Policy>
+generator<row_group<Policy>>
+scan(std::span<const column_vector<Policy>> columns, std::size_t rows,
+     std::size_t group_rows, std::size_t first, std::size_t stride) {
+  using value_type = typename Policy::value_type;
+  if (group_rows == 0 || group_rows % 64 != 0 || stride == 0) {
+    throw std::runtime_error("Row groups must be a positive multiple of 64 "
+                             "rows");
+  }
+  for (const auto& column : columns) {
+    if (column.data().size() < rows) {
+      throw std::runtime_error("Column has fewer than " +
+                               std::to_string(rows) + " rows");
+    }
+  }
+  for (std::size_t g = first; g * group_rows < rows; g += stride) {
+    const std::size_t begin = g * group_rows;
+    const std::size_t count = std::min(group_rows, rows - begin);
+    const std::size_t words = (count + 63) / 64;
+    row_group<Policy> group;
+    group.index = g;
+    group.rows = count;
+    group.columns.reserve(columns.size());
+    for (const auto& column : columns) {
+      column_vector<Policy> slice(count);
+      std::memcpy(slice.data().data(), column.data().data() + begin,
+                  count * sizeof(value_type));
+      // Groups start on word boundaries, so validity copies word by word
+      auto& bits = slice.present_mask().blocks();
+      const auto& source = column.present_mask().blocks();
+      std::memcpy(bits.data(), source.data() + begin / 64,
+                  words * sizeof(std::uint64_t));
+      if (count % 64 != 0) {
+        bits[words - 1] &= (std::uint64_t{1} << (count % 64)) - 1;
+      }
+      group.columns.push_back(std::move(slice));
+    }
+    group.selection = dynamic_bitset<BitsetPolicy>(count, true);
+    co_yield std::move(group);
+  }
+}
+
+template <concepts::ColumnPolicy Policy, typename Predicate>
+generator<row_group<Policy>> filter(generator<row_group<Policy>> input,
+                                    std::size_t column, Predicate predicate) {
+  for (row_group<Policy>& group : input) {
+    const auto* values = group.columns.at(column).data().data();
+    auto& selection = group.selection.blocks();
+    const auto& present = group.columns[column].present_mask().blocks();
+    // Build each word branch-free, so the predicate vectorizes; values are
+    // only padded to a cache line, so the last word stops at the last row
+    for (std::size_t w = 0; w * 64 < group.rows; ++w) {
+      const std::size_t width = std::min<std::size_t>(64, group.rows - w * 64);
+      std::uint64_t passed = 0;
+      for (std::size_t j = 0; j < width; ++j) {
+        passed |= static_cast<std::uint64_t>(predicate(values[w * 64 + j]))
+                  << j;
+      }
+      selection[w] &= passed & present[w];
+    }
+    co_yield std::move(group);
+  }
+}
+
+template <concepts::ColumnPolicy Policy, typename Projection>
+generator<row_group<Policy>> project(generator<row_group<Policy>> input,
+                                     Projection projection) {
+  for (row_group<Policy>& group : input) {
+    projection(group);
+    co_yield std::move(group);
+  }
+}
+
+template <concepts::ColumnPolicy Policy>
+task<> produce(generator<row_group<Policy>> input,
+               channel<row_group<Policy>>& output) {
+  // The channel must be closed even if the input throws, or consumers would
+  // wait forever; co_await is not allowed in a handler, hence the detour
+  std::exception_ptr error;
+  try {
+    while (input.next()) {
+      if (!co_await output.push(std::move(input.value()))) {
+        break; // cancelled by the consumer
+      }
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+  output.close();
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+template <concepts::ColumnPolicy Policy>
+task<column_aggregates<typename Policy::value_type>>
+aggregate(channel<row_group<Policy>>& input, std::size_t column) {
+  using value_type = typename Policy::value_type;
+  using accumulator_type = detail::accumulator_t<value_type>;
+  column_aggregates<value_type> result;
+  // As in produce(): the channel is cancelled on every way out, and
+  // co_await is not allowed in a handler
+  std::exception_ptr error;
+  try {
+    while (auto group = co_await input.pop()) {
+      // The group is ours: narrow the column's validity to the selection
+      // and let the masked column kernels skip everything else. The mean's
+      // total is the sum in int64 (Int32) or fp64, so it does not wrap like
+      // sum.
+      column_vector<Policy>& values = group->columns.at(column);
+      bitset_and_avx2(values.present_mask(), group->selection);
+      const auto part =
+          values.aggregate({AggregateOp::Count, AggregateOp::Min,
+                            AggregateOp::Max, AggregateOp::Mean});
+      if (part.count == 0) {
+        continue;
+      }
+      if (result.count == 0 || detail::value_less(part.min, result.min)) {
+        result.min = part.min;
+      }
+      if (result.count == 0 || detail::value_less(result.max, part.max)) {
+        result.max = part.max;
+      }
+      result.sum += static_cast<accumulator_type>(part.total);
+      result.count += part.count;
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+  input.cancel();
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  co_return result;
+}
+
+template <concepts::ColumnPolicy Policy>
+task<> sink(channel<row_group<Policy>>& input,
+            std::function<void(row_group<Policy>&)> consume) {
+  std::exception_ptr error;
+  try {
+    while (auto group = co_await input.pop()) {
+      consume(*group);
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+  input.cancel();
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace franklin::operators
+
+#endif // FRANKLIN_OPERATORS_PIPELINE_HPP
@@ -0,0 +1,280 @@
+#include "operators/pipeline.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace franklin::operators {
+namespace {
+
+generator<int> count_to(int n) {
+  for (int i = 1; i <= n; ++i) {
+    co_yield i;
+  }
+}
+
+generator<int> fail_after(int n) {
+  for (int i = 0; i < n; ++i) {
+    co_yield i;
+  }
+  throw std::runtime_error("scan failed");
+}
+
+generator<int> squares(generator<int> input) {
+  for (int v : input) {
+    co_yield v * v;
+  }
+}
+
+task<int> add(int a, int b) { co_return a + b; }
+
+task<int> add_twice(int a, int b) {
+  const int once = co_await add(a, b);
+  co_return once + co_await add(a, b);
+}
+
+TEST(PipelineTest, GeneratorsChainLazily) {
+  std::vector<int> values;
+  for (int v : squares(count_to(5))) {
+    values.push_back(v);
+  }
+  EXPECT_EQ(values, (std::vector<int>{1, 4, 9, 16, 25}));
+
+  auto failing = squares(fail_after(2));
+  EXPECT_TRUE(failing.next());
+  EXPECT_TRUE(failing.next());
+  EXPECT_EQ(failing.value(), 1);
+  EXPECT_THROW(failing.next(), std::runtime_error);
+  EXPECT_FALSE(failing.next());
+}
+
+TEST(PipelineTest, TasksRunOnTheExecutor) {
+  executor ex(2);
+  EXPECT_EQ(ex.sync_wait(add_twice(2, 3)), 10);
+
+  std::atomic<int> done = 0;
+  auto bump = [](std::atomic<int>& counter) -> task<> {
+    ++counter;
+    co_return;
+  };
+  for (int i = 0; i < 100; ++i) {
+    ex.spawn(bump(done));
+  }
+  ex.wait();
+  EXPECT_EQ(done.load(), 100);
+
+  auto fail = []() -> task<> {
+    throw std::runtime_error("stage failed");
+    co_return;
+  };
+  ex.spawn(fail());
+  EXPECT_THROW(ex.wait(), std::runtime_error);
+  ex.wait(); // the error is reported once
+  EXPECT_THROW(ex.sync_wait(fail()), std::runtime_error);
+}
+
+task<> push_range(channel<int>& out, int begin, int end) {
+  for (int i = begin; i < end; ++i) {
+    co_await out.push(i);
+  }
+  out.close();
+}
+
+task<long> sum_all(channel<int>& in) {
+  long sum = 0;
+  while (auto v = co_await in.pop()) {
+    sum += *v;
+  }
+  co_return sum;
+}
+
+TEST(PipelineTest, ChannelsApplyBackpressure) {
+  for (std::size_t threads : {1, 3}) {
+    executor ex(threads);
+    // Capacity far below the item count, so producers suspend repeatedly
+    channel<int> values(ex, 2, 3);
+    ex.spawn(push_range(values, 0, 1000));
+    ex.spawn(push_range(values, 1000, 2000));
+    ex.spawn(push_range(values, 2000, 3000));
+    EXPECT_EQ(ex.sync_wait(sum_all(values)), 2999L * 3000 / 2);
+    ex.wait();
+  }
+  EXPECT_THROW(
+      {
+        executor ex(1);
+        channel<int> bad(ex, 0);
+      },
+      std::runtime_error);
+}
+
+// Two Float32 columns with a few missing values
+std::vector<column_vector<Float32DefaultPolicy>> make_table(std::size_t rows) {
+  std::vector<column_vector<Float32DefaultPolicy>> table;
+  table.emplace_back(rows);
+  table.emplace_back(rows);
+  for (std::size_t i = 0; i < rows; ++i) {
+    table[0].data()[i] = static_cast<float>(i % 100);
+    table[1].data()[i] = static_cast<float>(i % 7) - 3.0f;
+    table[0].present_mask().set(i, i % 11 != 0);
+    table[1].present_mask().set(i, i % 13 != 0);
+  }
+  return table;
+}
+
+TEST(PipelineTest, PartitionedScansFeedAnAggregate) {
+  const std::size_t rows = 100003;
+  const auto table = make_table(rows);
+  const std::span<const column_vector<Float32DefaultPolicy>> columns(table);
+
+  // Reference: SUM, MIN, MAX of col0 * col1 where col0 >= 50
+  column_aggregates<float> expected;
+  for (std::size_t i = 0; i < rows; ++i) {
+    if (!table[0].present(i) || !table[1].present(i) ||
+        table[0].data()[i] < 50.0f) {
+      continue;
+    }
+    const float v = table[0].data()[i] * table[1].data()[i];
+    expected.min = expected.count == 0 ? v : std::min(expected.min, v);
+    expected.max = expected.count == 0 ? v : std::max(expected.max, v);
+    expected.sum += v;
+    ++expected.count;
+  }
+
+  auto multiply = [](row_group<Float32DefaultPolicy>& group) {
+    group.columns.push_back(group.columns[0] * group.columns[1]);
+  };
+  for (std::size_t threads : {1, 4}) {
+    executor ex(threads);
+    const std::size_t producers = 3;
+    channel<row_group<Float32DefaultPolicy>> groups(ex, 4, producers);
+    for (std::size_t p = 0; p < producers; ++p) {
+      ex.spawn(produce(
+          project(filter(scan(columns, rows, 4096, p, producers), 0,
+                         [](float v) { return v >= 50.0f; }),
+                  multiply),
+          groups));
+    }
+    const auto result = ex.sync_wait(aggregate(groups, 2));
+    ex.wait();
+    EXPECT_EQ(result.count, expected.count);
+    EXPECT_EQ(result.min, expected.min);
+    EXPECT_EQ(result.max, expected.max);
+    EXPECT_NEAR(result.sum, expected.sum, 1e-6 * std::abs(expected.sum) + 1);
+  }
+}
+
+TEST(PipelineTest, SinksSeeEveryRowGroup) {
+  const std::size_t rows = 1000;
+  const auto table = make_table(rows);
+  executor ex(2);
+  channel<row_group<Float32DefaultPolicy>> groups(ex, 1);
+  ex.spawn(produce(
+      scan(std::span<const column_vector<Float32DefaultPolicy>>(table), rows,
+           256),
+      groups));
+  std::set<std::size_t> seen;
+  std::size_t total = 0;
+  ex.sync_wait(sink<Float32DefaultPolicy>(
+      groups, [&](row_group<Float32DefaultPolicy>& group) {
+        EXPECT_EQ(group.cols(), 2u);
+        seen.insert(group.index);
+        total += group.size();
+        // Tail rows beyond the group are not present
+        EXPECT_FALSE(group.columns[0].present(group.size()));
+        EXPECT_EQ(group.columns[0].present(0), (group.index * 256) % 11 != 0);
+      }));
+  ex.wait();
+  EXPECT_EQ(seen, (std::set<std::size_t>{0, 1, 2, 3}));
+  EXPECT_EQ(total, rows);
+}
+
+TEST(PipelineTest, Int32SumsDoNotWrap) {
+  const std::size_t rows = 4096;
+  std::vector<column_vector<Int32DefaultPolicy>> table;
+  table.emplace_back(rows);
+  for (std::size_t i = 0; i < rows; ++i) {
+    table[0].data()[i] = std::numeric_limits<std::int32_t>::max();
+  }
+  executor ex(2);
+  channel<row_group<Int32DefaultPolicy>> groups(ex, 2);
+  ex.spawn(produce(
+      scan(std::span<const column_vector<Int32DefaultPolicy>>(table), rows,
+           1024),
+      groups));
+  const auto result = ex.sync_wait(aggregate(groups, 0));
+  ex.wait();
+  EXPECT_EQ(result.count, rows);
+  EXPECT_EQ(result.sum,
+            std::int64_t{std::numeric_limits<std::int32_t>::max()} * 4096);
+}
+
+TEST(PipelineTest, ScanErrorsCloseTheChannel) {
+  const auto table = make_table(512);
+  const std::span<const column_vector<Float32DefaultPolicy>> columns(table);
+  executor ex(2);
+  channel<row_group<Float32DefaultPolicy>> groups(ex, 2);
+  ex.spawn(produce(scan(columns, 512, 100), groups));
+  // The consumer sees an empty stream instead of hanging
+  EXPECT_EQ(ex.sync_wait(aggregate(groups, 0)).count, 0u);
+  EXPECT_THROW(ex.wait(), std::runtime_error);
+
+  channel<row_group<Float32DefaultPolicy>> more(ex, 2);
+  ex.spawn(produce(scan(columns, 4096, 128), more));
+  EXPECT_EQ(ex.sync_wait(aggregate(more, 0)).count, 0u);
+  EXPECT_THROW(ex.wait(), std::runtime_error);
+}
+
+TEST(PipelineTest, ConsumerErrorsStopTheProducers) {
+  const std::size_t rows = 64 * 1024;
+  std::vector<column_vector<Float32DefaultPolicy>> table;
+  table.emplace_back(rows, 1.0f);
+  const std::span<const column_vector<Float32DefaultPolicy>> columns(table);
+  for (std::size_t threads : {1, 3}) {
+    executor ex(threads);
+    // Far more groups than the channel holds, so both producers are
+    // suspended in push() when the consumer gives up
+    channel<row_group<Float32DefaultPolicy>> groups(ex, 1, 2);
+    ex.spawn(produce(scan(columns, rows, 256, 0, 2), groups));
+    ex.spawn(produce(scan(columns, rows, 256, 1, 2), groups));
+    // No column 5 in a one-column scan
+    EXPECT_THROW(ex.sync_wait(aggregate(groups, 5)), std::out_of_range);
+    ex.wait();
+
+    channel<row_group<Float32DefaultPolicy>> more(ex, 1);
+    ex.spawn(produce(scan(columns, rows, 256), more));
+    std::size_t seen = 0;
+    EXPECT_THROW(ex.sync_wait(sink<Float32DefaultPolicy>(
+                     more,
+                     [&](row_group<Float32DefaultPolicy>&) {
+                       if (++seen == 3) {
+                         throw std::runtime_error("sink failed");
+                       }
+                     })),
+                 std::runtime_error);
+    ex.wait();
+    EXPECT_EQ(seen, 3u);
+  }
+}
+
+TEST(PipelineTest, CancelledChannelsRejectValues) {
+  executor ex(2);
+  channel<int> values(ex, 4);
+  auto push_one = [](channel<int>& out, int v) -> task<bool> {
+    co_return co_await out.push(v);
+  };
+  auto pop_one = [](channel<int>& in) -> task<std::optional<int>> {
+    co_return co_await in.pop();
+  };
+  EXPECT_TRUE(ex.sync_wait(push_one(values, 1)));
+  values.cancel();
+  EXPECT_FALSE(ex.sync_wait(push_one(values, 2)));
+  // Queued values are dropped too
+  EXPECT_EQ(ex.sync_wait(pop_one(values)), std::nullopt);
+}
+
+} // namespace
+} // namespace franklin::operators